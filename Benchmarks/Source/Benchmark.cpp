@@ -0,0 +1,138 @@
+#include "Benchmark.h"
+
+#include <nlohmann/json.hpp>
+
+namespace Pathfinder
+{
+
+bool BenchmarkRunner::IsEnabled(const std::string& group, const std::string& name) const
+{
+    if (m_Filter.empty() || m_Filter == s_DEFAULT_STRING) return true;
+
+    return (group + "/" + name).find(m_Filter) != std::string::npos;
+}
+
+void BenchmarkRunner::Run(const BenchmarkSpecification& spec, const std::function<void()>& func, const std::function<void()>& setupFunc)
+{
+    PFR_ASSERT(func, "Benchmark function is invalid!");
+    if (!IsEnabled(spec.Group, spec.Name)) return;
+
+    const uint32_t iterations = std::max(1u, m_IterationsOverride != 0 ? m_IterationsOverride : spec.Iterations);
+    for (uint32_t i{}; i < spec.WarmupIterations; ++i)
+    {
+        if (setupFunc) setupFunc();
+        func();
+    }
+
+    std::vector<double> timingsMs(iterations);
+    for (uint32_t i{}; i < iterations; ++i)
+    {
+        if (setupFunc) setupFunc();
+
+        Timer t = {};
+        func();
+        timingsMs[i] = t.GetElapsedMilliseconds();
+    }
+
+    auto& result                    = m_Results.emplace_back(spec);
+    result.Specification.Iterations = iterations;
+    result.MeanMs                   = std::accumulate(timingsMs.begin(), timingsMs.end(), 0.0) / iterations;
+
+    double variance = 0.0;
+    for (const auto timingMs : timingsMs)
+        variance += (timingMs - result.MeanMs) * (timingMs - result.MeanMs);
+    result.StdDevMs = std::sqrt(variance / iterations);
+
+    std::ranges::sort(timingsMs);
+    result.MinMs    = timingsMs.front();
+    result.MaxMs    = timingsMs.back();
+    result.MedianMs = iterations % 2 == 0 ? (timingsMs[iterations / 2 - 1] + timingsMs[iterations / 2]) * 0.5 : timingsMs[iterations / 2];
+
+    if (spec.ItemsPerIteration != 0)
+        LOG_INFO("{:<14} {:<44} median {:10.4f}ms min {:10.4f}ms mean {:10.4f}ms ({:.2f}M items/s)", spec.Group, spec.Name,
+                 result.MedianMs, result.MinMs, result.MeanMs, spec.ItemsPerIteration / (result.MedianMs * 1000.0));
+    else
+        LOG_INFO("{:<14} {:<44} median {:10.4f}ms min {:10.4f}ms mean {:10.4f}ms", spec.Group, spec.Name, result.MedianMs,
+                 result.MinMs, result.MeanMs);
+}
+
+void BenchmarkRunner::AddFailure(std::string&& message)
+{
+    LOG_ERROR("Benchmarks: {}", message);
+    m_Failures.emplace_back(std::move(message));
+}
+
+bool BenchmarkRunner::WriteJSON(const std::filesystem::path& outputPath) const
+{
+    nlohmann::ordered_json benchmarks = nlohmann::ordered_json::array();
+    for (const auto& result : m_Results)
+    {
+        const auto& spec = result.Specification;
+        nlohmann::ordered_json jsonResult;
+        jsonResult["group"]      = spec.Group;
+        jsonResult["name"]       = spec.Name;
+        jsonResult["iterations"] = spec.Iterations;
+        jsonResult["min_ms"]     = result.MinMs;
+        jsonResult["median_ms"]  = result.MedianMs;
+        jsonResult["mean_ms"]    = result.MeanMs;
+        jsonResult["max_ms"]     = result.MaxMs;
+        jsonResult["stddev_ms"]  = result.StdDevMs;
+        if (spec.ItemsPerIteration != 0)
+        {
+            jsonResult["items_per_iteration"] = spec.ItemsPerIteration;
+            jsonResult["items_per_second"]    = spec.ItemsPerIteration / (result.MedianMs / 1000.0);
+        }
+
+        for (const auto& [counterName, counterValue] : spec.Counters)
+            jsonResult["counters"][counterName] = counterValue;
+
+        benchmarks.emplace_back(std::move(jsonResult));
+    }
+
+    std::ofstream out(outputPath, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
+    {
+        LOG_WARN("Failed to open benchmark results file \"{}\"!", outputPath.string());
+        return false;
+    }
+
+    nlohmann::ordered_json json;
+    json["context"]["worker_threads"]       = ThreadPool::GetNumThreads();
+    json["context"]["hardware_concurrency"] = std::thread::hardware_concurrency();
+#if PFR_DEBUG
+    json["context"]["build"] = "Debug";
+#else
+    json["context"]["build"] = "Release";
+#endif
+    json["benchmarks"] = std::move(benchmarks);
+    json["failures"]   = m_Failures;
+    out << json.dump(4) << std::endl;
+    out.close();
+
+    LOG_INFO("Benchmark results written to \"{}\".", outputPath.string());
+    return true;
+}
+
+bool BenchmarkRunner::WriteCSV(const std::filesystem::path& outputPath) const
+{
+    std::ofstream out(outputPath, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
+    {
+        LOG_WARN("Failed to open benchmark results file \"{}\"!", outputPath.string());
+        return false;
+    }
+
+    out << "group,name,iterations,min_ms,median_ms,mean_ms,max_ms,stddev_ms,items_per_iteration\n";
+    for (const auto& result : m_Results)
+    {
+        const auto& spec = result.Specification;
+        out << std::format("{},{},{},{:.6f},{:.6f},{:.6f},{:.6f},{:.6f},{}\n", spec.Group, spec.Name, spec.Iterations, result.MinMs,
+                           result.MedianMs, result.MeanMs, result.MaxMs, result.StdDevMs, spec.ItemsPerIteration);
+    }
+    out.close();
+
+    LOG_INFO("Benchmark results written to \"{}\".", outputPath.string());
+    return true;
+}
+
+}  // namespace Pathfinder
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Pathfinder.h"
+
+#include <format>
+#include <functional>
+
+namespace Pathfinder
+{
+
+struct BenchmarkSpecification
+{
+    std::string Group          = s_DEFAULT_STRING;
+    std::string Name           = s_DEFAULT_STRING;
+    uint32_t WarmupIterations  = 2;
+    uint32_t Iterations        = 10;
+    uint64_t ItemsPerIteration = 0;  // Optional, used to report throughput(objects, triangles, tasks, passes).
+    std::vector<std::pair<std::string, double>> Counters;  // Optional, reported as is(e.g. meshlet count), not timed.
+};
+
+struct BenchmarkResult
+{
+    BenchmarkSpecification Specification = {};
+    double MinMs                         = 0.0;
+    double MedianMs                      = 0.0;
+    double MeanMs                        = 0.0;
+    double MaxMs                         = 0.0;
+    double StdDevMs                      = 0.0;
+};
+
+// NOTE: Minimal in-house harness, every benchmark runs warmup iterations, then measured ones, each iteration is timed separately
+// so median is stable against scheduler noise. Inputs are generated from fixed seeds so runs are repeatable.
+// It's also the only test suite there is: code is checked against known cases or brute force reference right before it's measured,
+// every mismatch is reported through ReportFailure() and fails the run, measurements of the rest still go on.
+class BenchmarkRunner final : private Uncopyable, private Unmovable
+{
+  public:
+    BenchmarkRunner(const std::string& filter, const uint32_t iterationsOverride) noexcept
+        : m_Filter(filter), m_IterationsOverride(iterationsOverride)
+    {
+    }
+    ~BenchmarkRunner() = default;
+
+    NODISCARD bool IsEnabled(const std::string& group, const std::string& name) const;
+
+    // func() is timed as a whole, per-iteration setup that shouldn't be measured goes into setupFunc().
+    void Run(const BenchmarkSpecification& spec, const std::function<void()>& func, const std::function<void()>& setupFunc = {});
+
+    template <typename... Args> void ReportFailure(const std::format_string<Args...> format, Args&&... args)
+    {
+        AddFailure(std::format(format, std::forward<Args>(args)...));
+    }
+
+    bool WriteJSON(const std::filesystem::path& outputPath) const;
+    bool WriteCSV(const std::filesystem::path& outputPath) const;
+
+    NODISCARD FORCEINLINE const auto& GetResults() const { return m_Results; }
+    NODISCARD FORCEINLINE const auto& GetFailures() const { return m_Failures; }
+
+  private:
+    std::vector<BenchmarkResult> m_Results;
+    std::vector<std::string> m_Failures;
+    std::string m_Filter          = s_DEFAULT_STRING;
+    uint32_t m_IterationsOverride = 0;
+
+    void AddFailure(std::string&& message);
+};
+
+// Keeps compiler from throwing away results that are computed only to be measured.
+template <typename T> FORCEINLINE void DoNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+    static const void* volatile s_Sink = nullptr;
+    s_Sink                             = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "m"(value) : "memory");
+#endif
+}
+
+namespace Benchmarks
+{
+
+void RunMeshManagerBenchmarks(BenchmarkRunner& runner, const std::filesystem::path& meshDir);
+void RunRenderGraphBenchmarks(BenchmarkRunner& runner);
+void RunThreadPoolBenchmarks(BenchmarkRunner& runner);
+void RunSceneBenchmarks(BenchmarkRunner& runner);
+void RunSortBenchmarks(BenchmarkRunner& runner);
+void RunHiZBenchmarks(BenchmarkRunner& runner);
+void RunTextureCompressionBenchmarks(BenchmarkRunner& runner);
+
+// Compiles synthetic frame on CPU and writes its GraphViz and JSON dumps, no benchmarks are run.
+bool DumpSyntheticRenderGraph(const std::filesystem::path& outputDir);
+
+}  // namespace Benchmarks
+
+}  // namespace Pathfinder
@@ -0,0 +1,77 @@
+#include "Benchmark.h"
+
+using namespace Pathfinder;
+
+/*
+ * Headless benchmark suite, no window, no graphics context, only CPU-side systems.
+ * Usage: PathfinderBenchmarks [--output <results.json>] [--csv <results.csv>] [--filter <group/name substring>] [--iterations <count>]
+ *                             [--meshes <dir with shipped meshes>] [--dump-render-graph <output dir>]
+ * --dump-render-graph only compiles synthetic render graph and writes its GraphViz/JSON dumps.
+ * Exits with non-zero code if any check failed or results couldn't be written.
+ */
+int main(int argc, char** argv)
+{
+    std::filesystem::path outputPath         = "PathfinderBenchmarks.json";
+    std::filesystem::path csvPath            = {};
+    std::filesystem::path meshDir            = std::filesystem::path("Assets") / "Meshes";
+    std::filesystem::path renderGraphDumpDir = {};
+    std::string filter                       = {};
+    uint32_t iterationsOverride              = 0;
+
+    for (int32_t i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        const bool bHasValue       = i + 1 < argc;
+
+        if (arg == "--output" && bHasValue)
+            outputPath = argv[++i];
+        else if (arg == "--csv" && bHasValue)
+            csvPath = argv[++i];
+        else if (arg == "--filter" && bHasValue)
+            filter = argv[++i];
+        else if (arg == "--iterations" && bHasValue)
+            iterationsOverride = static_cast<uint32_t>(std::stoul(argv[++i]));
+        else if (arg == "--meshes" && bHasValue)
+            meshDir = argv[++i];
+        else if (arg == "--dump-render-graph" && bHasValue)
+            renderGraphDumpDir = argv[++i];
+        else
+        {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    Log::Init("PathfinderBenchmarks.log");
+    ThreadPool::Init();
+
+    if (!renderGraphDumpDir.empty())
+    {
+        const bool bDumped = Benchmarks::DumpSyntheticRenderGraph(renderGraphDumpDir);
+
+        ThreadPool::Shutdown();
+        Log::Shutdown();
+        return bDumped ? 0 : 1;
+    }
+
+    BenchmarkRunner runner(filter, iterationsOverride);
+    Benchmarks::RunMeshManagerBenchmarks(runner, meshDir);
+    Benchmarks::RunRenderGraphBenchmarks(runner);
+    Benchmarks::RunThreadPoolBenchmarks(runner);
+    Benchmarks::RunSceneBenchmarks(runner);
+    Benchmarks::RunSortBenchmarks(runner);
+    Benchmarks::RunHiZBenchmarks(runner);
+    Benchmarks::RunTextureCompressionBenchmarks(runner);
+
+    bool bSucceeded = runner.WriteJSON(outputPath);
+    if (!csvPath.empty()) bSucceeded = runner.WriteCSV(csvPath) && bSucceeded;
+    if (!runner.GetFailures().empty())
+    {
+        LOG_ERROR("Benchmarks: ({}) checks failed!", runner.GetFailures().size());
+        bSucceeded = false;
+    }
+
+    ThreadPool::Shutdown();
+    Log::Shutdown();
+    return bSucceeded ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+#include "Benchmark.h"
+
+#include <Renderer/HiZPyramid.h>
+#include <Renderer/Image.h>
+
+namespace Pathfinder
+{
+
+namespace HiZBenchmarkUtils
+{
+
+// Reversed-Z depth of the view space distance, the same way depth pass writes it.
+NODISCARD static float ComputeDepth(const glm::mat4& projection, const float viewDistance)
+{
+    const glm::vec4 clip = projection * glm::vec4(0.0f, 0.0f, -viewDistance, 1.0f);
+    return clip.z / clip.w;
+}
+
+// Farthest depth is put into the last row and column on purpose, pyramid that doesn't fold them in on odd sizes loses it.
+NODISCARD static std::vector<float> GenerateDepth(const uint32_t width, const uint32_t height)
+{
+    std::mt19937 rng(width * 31 + height);
+    std::uniform_real_distribution<float> distribution(0.1f, 0.9f);
+
+    std::vector<float> depth(width * height);
+    for (auto& texelDepth : depth)
+        texelDepth = distribution(rng);
+
+    depth[width - 1]                        = 0.02f;
+    depth[(height - 1) * width]             = 0.03f;
+    depth[(height - 1) * width + width - 1] = 0.01f;
+    return depth;
+}
+
+// Base texels [x, y] every texel of each level covers along one axis. Odd sizes fold extra texel into the footprint, so neighbours
+// overlap by one and the last one reaches the end of the axis.
+NODISCARD static std::vector<std::vector<glm::uvec2>> ComputeCoverage(const uint32_t baseSize, const uint32_t levelCount)
+{
+    std::vector<std::vector<glm::uvec2>> coverage(levelCount);
+    for (uint32_t x{}; x < baseSize; ++x)
+        coverage[0].emplace_back(x, x);
+
+    for (uint32_t level = 1; level < levelCount; ++level)
+    {
+        const uint32_t srcSize = std::max(baseSize >> (level - 1), 1u);
+        const uint32_t dstSize = std::max(baseSize >> level, 1u);
+        for (uint32_t x{}; x < dstSize; ++x)
+        {
+            const uint32_t first = 2 * x;
+            const uint32_t last  = std::min(first + 1 + (srcSize & 1), srcSize - 1);
+            coverage[level].emplace_back(coverage[level - 1][first].x, coverage[level - 1][last].y);
+        }
+    }
+
+    return coverage;
+}
+
+// Texels of every level have to cover base without gaps up to the last row/column and hold MIN of the base texels they cover.
+NODISCARD static bool ValidatePyramid(const HiZPyramid& pyramid, const std::vector<float>& depth, const uint32_t width,
+                                      const uint32_t height)
+{
+    const uint32_t levelCount = pyramid.GetLevelCount();
+    if (levelCount != ImageUtils::CalculateMipCount(width, height)) return false;
+
+    const auto coverageX = ComputeCoverage(width, levelCount);
+    const auto coverageY = ComputeCoverage(height, levelCount);
+    for (uint32_t level{}; level < levelCount; ++level)
+    {
+        const glm::uvec2 levelSize = pyramid.GetLevelSize(level);
+        if (levelSize != glm::max(glm::uvec2(width >> level, height >> level), glm::uvec2(1))) return false;
+
+        for (const auto* coverage : {&coverageX[level], &coverageY[level]})
+        {
+            if (coverage->front().x != 0) return false;
+            for (size_t i = 1; i < coverage->size(); ++i)
+                if ((*coverage)[i].x > (*coverage)[i - 1].y + 1) return false;
+        }
+        if (coverageX[level].back().y != width - 1 || coverageY[level].back().y != height - 1) return false;
+
+        for (uint32_t y{}; y < levelSize.y; ++y)
+        {
+            for (uint32_t x{}; x < levelSize.x; ++x)
+            {
+                float expectedDepth = 1.0f;
+                for (uint32_t baseY = coverageY[level][y].x; baseY <= coverageY[level][y].y; ++baseY)
+                    for (uint32_t baseX = coverageX[level][x].x; baseX <= coverageX[level][x].y; ++baseX)
+                        expectedDepth = std::min(expectedDepth, depth[baseY * width + baseX]);
+
+                if (pyramid.Load(level, x, y) != expectedDepth) return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+}  // namespace HiZBenchmarkUtils
+
+namespace Benchmarks
+{
+
+void RunHiZBenchmarks(BenchmarkRunner& runner)
+{
+    using namespace HiZBenchmarkUtils;
+
+    // Odd and non power of two sizes, 1 texel wide strips and dimensions that stay odd for several levels.
+    for (const auto& [width, height] : {std::pair{1u, 1u}, std::pair{2u, 2u}, std::pair{3u, 3u}, std::pair{5u, 3u}, std::pair{7u, 1u},
+                                        std::pair{1u, 9u}, std::pair{13u, 6u}, std::pair{33u, 17u}, std::pair{1023u, 767u},
+                                        std::pair{1920u, 1080u}})
+    {
+        const auto depth = GenerateDepth(width, height);
+        HiZPyramid pyramid;
+        pyramid.Build(depth.data(), width, height);
+
+        if (!ValidatePyramid(pyramid, depth, width, height))
+            runner.ReportFailure("HiZ pyramid of {}x{} doesn't match reference reduction!", width, height);
+        else if (pyramid.Load(pyramid.GetLevelCount() - 1, 0, 0) != 0.01f)
+            runner.ReportFailure("HiZ pyramid of {}x{} lost farthest depth of its last row/column!", width, height);
+    }
+
+    // Level selection: rect is at most 1 texel wide on the selected level, clamped to the last one.
+    {
+        const std::vector<float> depth(1024 * 768, 0.5f);
+        HiZPyramid pyramid;
+        pyramid.Build(depth.data(), 1024, 768);
+
+        // NOTE: Not constexpr, glm vectors aren't with SIMD enabled.
+        const std::array<std::tuple<std::string_view, glm::vec4, uint32_t>, 7> levelCases = {
+            std::tuple{"Point", glm::vec4(0.5f, 0.5f, 0.5f, 0.5f), 0u},
+            std::tuple{"OneTexel", glm::vec4(0.0f, 0.0f, 1.0f / 1024.0f, 1.0f / 1024.0f), 0u},
+            std::tuple{"16Texels", glm::vec4(0.25f, 0.25f, 0.25f + 16.0f / 1024.0f, 0.25f + 4.0f / 768.0f), 4u},
+            std::tuple{"17Texels", glm::vec4(0.25f, 0.25f, 0.25f + 17.0f / 1024.0f, 0.25f + 4.0f / 768.0f), 5u},
+            std::tuple{"TallStrip", glm::vec4(0.0f, 0.0f, 2.0f / 1024.0f, 0.5f), 9u},
+            std::tuple{"FullScreen", glm::vec4(0.0f, 0.0f, 1.0f, 1.0f), 10u},
+            std::tuple{"BeyondScreen", glm::vec4(-1.0f, -1.0f, 2.0f, 2.0f), 10u}};
+        for (const auto& [caseName, uvRect, expectedLevel] : levelCases)
+        {
+            const uint32_t level = pyramid.SelectLevel(uvRect);
+            if (level != expectedLevel)
+                runner.ReportFailure("HiZ selected level {} instead of {} for \"{}\" rect!", level, expectedLevel, caseName);
+        }
+    }
+
+    // Occlusion against a wall 50 units away, the same reversed-Z projection camera renders with.
+    constexpr uint32_t s_Width  = 1920;
+    constexpr uint32_t s_Height = 1080;
+    constexpr float s_zNear     = 0.1f;
+    constexpr float s_zFar      = 1000.0f;
+    constexpr float s_WallDist  = 50.0f;
+    const glm::mat4 projection  = glm::perspective(glm::radians(90.0f), static_cast<float>(s_Width) / s_Height, s_zFar, s_zNear);
+
+    // Wall with a cleared(far plane) 128x128 hole in the middle.
+    std::vector<float> depth(s_Width * s_Height, ComputeDepth(projection, s_WallDist));
+    for (uint32_t y = s_Height / 2 - 64; y < s_Height / 2 + 64; ++y)
+        for (uint32_t x = s_Width / 2 - 64; x < s_Width / 2 + 64; ++x)
+            depth[y * s_Width + x] = 0.0f;
+
+    HiZPyramid pyramid;
+    pyramid.Build(depth.data(), s_Width, s_Height);
+
+    const std::array<std::tuple<std::string_view, glm::vec3, float, bool>, 7> occlusionCases = {
+        std::tuple{"BehindWall", glm::vec3(30.0f, -10.0f, -100.0f), 3.0f, true},
+        std::tuple{"InFrontOfWall", glm::vec3(30.0f, -10.0f, -20.0f), 5.0f, false},
+        std::tuple{"TouchingWall", glm::vec3(30.0f, -10.0f, -54.0f), 5.0f, false},
+        std::tuple{"BehindHole", glm::vec3(0.0f, 0.0f, -80.0f), 1.0f, false},
+        std::tuple{"BesideHole", glm::vec3(40.0f, 0.0f, -80.0f), 1.0f, true},
+        std::tuple{"CrossingNearPlane", glm::vec3(0.0f, 0.0f, -0.5f), 1.0f, false},
+        std::tuple{"LargeOverHole", glm::vec3(0.0f, 0.0f, -900.0f), 50.0f, false}};
+    for (const auto& [caseName, viewCenter, radius, bExpectedOccluded] : occlusionCases)
+    {
+        if (pyramid.IsSphereOccluded(viewCenter, radius, projection, s_zNear) != bExpectedOccluded)
+            runner.ReportFailure("HiZ occlusion of \"{}\" sphere is wrong, expected it to be {}!", caseName,
+                                 bExpectedOccluded ? "occluded" : "visible");
+    }
+
+    runner.Run({.Group = "HiZ", .Name = "Build/1080p", .Iterations = 20, .ItemsPerIteration = s_Width * s_Height},
+               [&] { pyramid.Build(depth.data(), s_Width, s_Height); });
+
+    std::mt19937 rng(s_Width);
+    std::uniform_real_distribution<float> xyDistribution(-60.0f, 60.0f);
+    std::uniform_real_distribution<float> distDistribution(1.0f, 200.0f);
+    std::uniform_real_distribution<float> radiusDistribution(0.1f, 5.0f);
+
+    std::vector<std::pair<glm::vec3, float>> spheres(10'000);
+    for (auto& [viewCenter, radius] : spheres)
+    {
+        viewCenter = glm::vec3(xyDistribution(rng), xyDistribution(rng), -distDistribution(rng));
+        radius     = radiusDistribution(rng);
+    }
+
+    runner.Run({.Group = "HiZ", .Name = "IsSphereOccluded/10k", .Iterations = 20, .ItemsPerIteration = spheres.size()},
+               [&]
+               {
+                   uint32_t occludedCount = 0;
+                   for (const auto& [viewCenter, radius] : spheres)
+                       occludedCount += pyramid.IsSphereOccluded(viewCenter, radius, projection, s_zNear) ? 1 : 0;
+                   DoNotOptimize(occludedCount);
+               });
+}
+
+}  // namespace Benchmarks
+
+}  // namespace Pathfinder
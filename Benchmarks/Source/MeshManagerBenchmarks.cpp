@@ -0,0 +1,579 @@
+#include "Benchmark.h"
+
+#include <Renderer/Mesh/MeshManager.h>
+#include <Renderer/Mesh/MeshBounds.h>
+#include <Renderer/Mesh/MeshletHierarchy.h>
+#include <Globals.h>
+
+#include <fastgltf/glm_element_traits.hpp>
+#include <fastgltf/core.hpp>
+#include <fastgltf/tools.hpp>
+#include <fastgltf/types.hpp>
+
+namespace Pathfinder
+{
+
+namespace MeshBenchmarkUtils
+{
+
+struct PrimitiveGeometry
+{
+    std::vector<uint32_t> Indices;
+    std::vector<MeshPositionVertex> Positions;
+    std::vector<MeshAttributeVertex> Attributes;
+};
+
+// NOTE: Only what MeshManager's CPU stages consume, node transforms and materials are skipped.
+NODISCARD static bool LoadGLTFGeometry(const std::filesystem::path& meshFilePath, std::vector<PrimitiveGeometry>& outPrimitives)
+{
+    fastgltf::GltfDataBuffer data;
+    if (!data.loadFromFile(meshFilePath) || fastgltf::determineGltfFileType(&data) == fastgltf::GltfType::Invalid) return false;
+
+    constexpr auto gltfOptions = fastgltf::Options::DontRequireValidAssetMember | fastgltf::Options::AllowDouble |
+                                 fastgltf::Options::LoadGLBBuffers | fastgltf::Options::LoadExternalBuffers |
+                                 fastgltf::Options::GenerateMeshIndices;
+
+    fastgltf::Parser parser;
+    auto asset = parser.loadGltf(&data, meshFilePath.parent_path(), gltfOptions);
+    if (asset.error() != fastgltf::Error::None) return false;
+
+    for (const auto& mesh : asset->meshes)
+    {
+        for (const auto& p : mesh.primitives)
+        {
+            const auto positionIt = p.findAttribute("POSITION");
+            if (!p.indicesAccessor.has_value() || positionIt == p.attributes.end()) continue;
+
+            auto& primitive              = outPrimitives.emplace_back();
+            const auto& indicesAccessor  = asset->accessors[p.indicesAccessor.value()];
+            const auto& positionAccessor = asset->accessors[positionIt->second];
+
+            primitive.Indices.resize(indicesAccessor.count);
+            fastgltf::iterateAccessorWithIndex<std::uint32_t>(asset.get(), indicesAccessor, [&](uint32_t index, std::size_t idx)
+                                                              { primitive.Indices[idx] = index; });
+
+            primitive.Positions.resize(positionAccessor.count);
+            primitive.Attributes.resize(positionAccessor.count);
+            fastgltf::iterateAccessorWithIndex<glm::vec3>(asset.get(), positionAccessor, [&](const glm::vec3& position, std::size_t idx)
+                                                          { primitive.Positions[idx].Position = position; });
+        }
+    }
+
+    return !outPrimitives.empty();
+}
+
+// Fallback in case shipped assets aren't next to the executable, so suite still produces comparable numbers.
+NODISCARD static PrimitiveGeometry GenerateGrid(const uint32_t resolution)
+{
+    PrimitiveGeometry grid = {};
+    grid.Positions.reserve((resolution + 1) * (resolution + 1));
+    for (uint32_t y{}; y <= resolution; ++y)
+    {
+        for (uint32_t x{}; x <= resolution; ++x)
+        {
+            const float u = static_cast<float>(x) / resolution;
+            const float v = static_cast<float>(y) / resolution;
+            grid.Positions.push_back({glm::vec3(u, 0.1f * std::sin(u * 20.0f) * std::cos(v * 20.0f), v)});
+        }
+    }
+    grid.Attributes.resize(grid.Positions.size());
+
+    grid.Indices.reserve(resolution * resolution * 6);
+    for (uint32_t y{}; y < resolution; ++y)
+    {
+        for (uint32_t x{}; x < resolution; ++x)
+        {
+            const uint32_t i0 = y * (resolution + 1) + x;
+            const uint32_t i1 = i0 + 1;
+            const uint32_t i2 = i0 + resolution + 1;
+            const uint32_t i3 = i2 + 1;
+            grid.Indices.insert(grid.Indices.end(), {i0, i2, i1, i1, i2, i3});
+        }
+    }
+
+    return grid;
+}
+
+// Off-center and negative on purpose, max seeded with FLT_MIN used to break exactly on such input.
+NODISCARD static std::vector<MeshPositionVertex> GeneratePointCloud(const uint32_t count)
+{
+    std::mt19937 rng(count);
+    std::uniform_real_distribution<float> distribution(-100.0f, -10.0f);
+
+    std::vector<MeshPositionVertex> points(count);
+    for (auto& point : points)
+        point.Position = glm::vec3(distribution(rng), distribution(rng) * 0.25f, distribution(rng) + 50.0f);
+
+    return points;
+}
+
+// Vector kernels against scalar one: AABB is exact(min/max don't round), sphere has to contain every point and be as tight as
+// reference one.
+NODISCARD static bool ValidateBounds(const MeshPositionVertex* points, const size_t count, const EBoundsISA isa)
+{
+    const auto referenceAABB = MeshBounds::ComputeAABB(points, count, EBoundsISA::BOUNDS_ISA_SCALAR);
+    const auto aabb          = MeshBounds::ComputeAABB(points, count, isa);
+    if (aabb.Center != referenceAABB.Center || aabb.Extents != referenceAABB.Extents) return false;
+
+    const auto referenceSphere = MeshBounds::ComputeSphere(points, count, EBoundsISA::BOUNDS_ISA_SCALAR);
+    const auto sphere          = MeshBounds::ComputeSphere(points, count, isa);
+    const float tolerance      = 1e-5f * std::max(referenceSphere.Radius, 1.0f);
+    if (sphere.Radius > referenceSphere.Radius + tolerance) return false;
+
+    for (size_t i{}; i < count; ++i)
+        if (glm::distance(points[i].Position, sphere.Center) > sphere.Radius + tolerance) return false;
+
+    return true;
+}
+
+// Meshlets of LoadMesh's cooked submesh, level 0 goes first.
+struct PrimitiveHierarchy
+{
+    std::vector<Meshlet> Meshlets;
+    std::vector<uint32_t> MeshletVertices;
+    std::vector<uint8_t> MeshletTriangles;
+    size_t BaseMeshletCount = 0;
+};
+
+// NOTE: Meshlets built out of a group carry its bounds and error as lod ones, members of that group carry the same values as parent
+// ones, so these identify groups.
+using MeshletGroupKey = std::array<float, 5>;
+
+NODISCARD static MeshletGroupKey GetLODGroupKey(const Meshlet& meshlet)
+{
+    return {meshlet.lodCenter.x, meshlet.lodCenter.y, meshlet.lodCenter.z, meshlet.lodRadius, meshlet.lodError};
+}
+
+NODISCARD static MeshletGroupKey GetParentGroupKey(const Meshlet& meshlet)
+{
+    return {meshlet.parentCenter.x, meshlet.parentCenter.y, meshlet.parentCenter.z, meshlet.parentRadius, meshlet.parentError};
+}
+
+// Selection is crack-free and bounded only if going up the hierarchy bounds enclose children's and error never decreases.
+NODISCARD static bool ValidateHierarchyBounds(const std::vector<Meshlet>& meshlets)
+{
+    for (const auto& meshlet : meshlets)
+    {
+        if (meshlet.parentError == std::numeric_limits<float>::max()) continue;
+        if (meshlet.parentError < meshlet.lodError) return false;
+
+        const float tolerance = 1e-4f * std::max(meshlet.parentRadius, 1.0f);
+        if (glm::distance(meshlet.lodCenter, meshlet.parentCenter) + meshlet.lodRadius > meshlet.parentRadius + tolerance) return false;
+    }
+
+    return true;
+}
+
+// Group and the one it got simplified into cover the same surface, so they can't be drawn together.
+NODISCARD static bool ValidateLODCut(const std::vector<Meshlet>& meshlets, const std::vector<uint32_t>& selectedMeshlets)
+{
+    std::vector<MeshletGroupKey> parentGroupKeys;
+    for (const auto meshletIndex : selectedMeshlets)
+        if (meshlets[meshletIndex].parentError != std::numeric_limits<float>::max())
+            parentGroupKeys.emplace_back(GetParentGroupKey(meshlets[meshletIndex]));
+    std::sort(parentGroupKeys.begin(), parentGroupKeys.end());
+
+    return std::none_of(selectedMeshlets.begin(), selectedMeshlets.end(),
+                        [&](const uint32_t meshletIndex)
+                        {
+                            return std::binary_search(parentGroupKeys.begin(), parentGroupKeys.end(),
+                                                      GetLODGroupKey(meshlets[meshletIndex]));
+                        });
+}
+
+// Closest point on triangle, "Real-Time Collision Detection" 5.1.5.
+NODISCARD static float ComputeDistanceToTriangle(const glm::vec3& p, const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+{
+    const glm::vec3 ab = b - a, ac = c - a, ap = p - a;
+    const float d1 = glm::dot(ab, ap), d2 = glm::dot(ac, ap);
+    if (d1 <= 0.0f && d2 <= 0.0f) return glm::distance(p, a);
+
+    const glm::vec3 bp = p - b;
+    const float d3 = glm::dot(ab, bp), d4 = glm::dot(ac, bp);
+    if (d3 >= 0.0f && d4 <= d3) return glm::distance(p, b);
+
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return glm::distance(p, a + ab * (d1 / (d1 - d3)));
+
+    const glm::vec3 cp = p - c;
+    const float d5 = glm::dot(ab, cp), d6 = glm::dot(ac, cp);
+    if (d6 >= 0.0f && d5 <= d6) return glm::distance(p, c);
+
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return glm::distance(p, a + ac * (d2 / (d2 - d6)));
+
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+        return glm::distance(p, b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))));
+
+    const float denominator = 1.0f / (va + vb + vc);
+    return glm::distance(p, a + ab * (vb * denominator) + ac * (vc * denominator));
+}
+
+// Pixels between sampled vertices of the primitive and surface the cut draws. Cut keeps original vertices, so it's the ones
+// simplification dropped that drift away from it.
+NODISCARD static float MeasureCutDeviation(const PrimitiveGeometry& primitive, const PrimitiveHierarchy& hierarchy,
+                                           const std::vector<uint32_t>& selectedMeshlets, const MeshletHierarchy::View& view,
+                                           const size_t maxSampleCount)
+{
+    std::vector<glm::vec3> cutTriangles;
+    for (const auto meshletIndex : selectedMeshlets)
+    {
+        const auto& meshlet = hierarchy.Meshlets[meshletIndex];
+        for (uint32_t i{}; i < meshlet.triangleCount * 3; ++i)
+        {
+            const uint32_t localIndex = hierarchy.MeshletTriangles[meshlet.triangleOffset + i];
+            cutTriangles.emplace_back(primitive.Positions[hierarchy.MeshletVertices[meshlet.vertexOffset + localIndex]].Position);
+        }
+    }
+
+    float maxDeviation  = 0.0f;
+    const size_t stride = std::max(primitive.Positions.size() / maxSampleCount, size_t{1});
+    for (size_t i{}; i < primitive.Positions.size(); i += stride)
+    {
+        const glm::vec3& position = primitive.Positions[i].Position;
+
+        float distance = std::numeric_limits<float>::max();
+        for (size_t t{}; t < cutTriangles.size(); t += 3)
+            distance = std::min(distance, ComputeDistanceToTriangle(position, cutTriangles[t], cutTriangles[t + 1], cutTriangles[t + 2]));
+
+        const float viewDistance = std::max(glm::distance(position, view.CameraPosition), view.zNear);
+        maxDeviation             = std::max(maxDeviation, distance * view.ProjectionScale / viewDistance);
+    }
+
+    return maxDeviation;
+}
+
+NODISCARD static uint64_t CountTriangles(const std::vector<PrimitiveGeometry>& primitives)
+{
+    return std::accumulate(primitives.begin(), primitives.end(), 0ull,
+                           [](const uint64_t sum, const PrimitiveGeometry& primitive) { return sum + primitive.Indices.size() / 3; });
+}
+
+}  // namespace MeshBenchmarkUtils
+
+namespace Benchmarks
+{
+
+void RunMeshManagerBenchmarks(BenchmarkRunner& runner, const std::filesystem::path& meshDir)
+{
+    using namespace MeshBenchmarkUtils;
+
+    constexpr std::array<std::pair<std::string_view, std::string_view>, 3> s_ShippedMeshes = {
+        std::pair{"Kitten", "kitten/scene.gltf"}, std::pair{"DamagedHelmet", "damaged_helmet/DamagedHelmet.gltf"},
+        std::pair{"SciFiHelmet", "sci-fi_helmet/scene.gltf"}};
+
+    std::vector<std::pair<std::string, std::vector<PrimitiveGeometry>>> meshes;
+    for (const auto& [meshName, meshRelativePath] : s_ShippedMeshes)
+    {
+        const auto meshFilePath = meshDir / meshRelativePath;
+        std::vector<PrimitiveGeometry> primitives;
+        if (!LoadGLTFGeometry(meshFilePath, primitives))
+        {
+            LOG_WARN("Benchmarks: Failed to load \"{}\", skipping it.", meshFilePath.string());
+            continue;
+        }
+
+        runner.Run({.Group = "MeshManager", .Name = std::string(meshName) + "/ParseGLTF", .Iterations = 5},
+                   [&]
+                   {
+                       std::vector<PrimitiveGeometry> parsedPrimitives;
+                       DoNotOptimize(LoadGLTFGeometry(meshFilePath, parsedPrimitives));
+                   });
+        meshes.emplace_back(meshName, std::move(primitives));
+    }
+    meshes.emplace_back("ProceduralGrid512", std::vector<PrimitiveGeometry>{GenerateGrid(512)});
+
+    std::vector<EBoundsISA> boundsISAs;
+    for (const auto isa : {EBoundsISA::BOUNDS_ISA_SCALAR, EBoundsISA::BOUNDS_ISA_SSE41, EBoundsISA::BOUNDS_ISA_AVX2,
+                           EBoundsISA::BOUNDS_ISA_NEON})
+    {
+        if (MeshBounds::IsISASupported(isa)) boundsISAs.emplace_back(isa);
+    }
+
+    // Counts around vector widths catch remainder handling, the rest are meshlet and mesh sized.
+    for (const uint32_t pointCount : {1u, 3u, 4u, 7u, 8u, 9u, 17u, 64u, 1001u, 65536u})
+    {
+        const auto points = GeneratePointCloud(pointCount);
+        for (const auto isa : boundsISAs)
+        {
+            if (!ValidateBounds(points.data(), points.size(), isa))
+                runner.ReportFailure("{} bounds don't match scalar reference on {} points!", MeshBounds::GetISAName(isa), pointCount);
+        }
+    }
+
+    for (const auto& mesh : meshes)
+    {
+        const auto& meshName         = mesh.first;
+        const auto& sourcePrimitives = mesh.second;
+        const uint64_t triangleCount = CountTriangles(sourcePrimitives);
+
+        std::vector<PrimitiveGeometry> primitives;
+        const auto resetPrimitives = [&] { primitives = sourcePrimitives; };
+        runner.Run({.Group = "MeshManager", .Name = meshName + "/OptimizeMesh", .Iterations = 5, .ItemsPerIteration = triangleCount},
+                   [&]
+                   {
+                       for (auto& primitive : primitives)
+                           MeshManager::OptimizeMesh(primitive.Indices, primitive.Positions, primitive.Attributes);
+                   },
+                   resetPrimitives);
+
+        // Next stages run on optimized geometry, the same way LoadMesh does it.
+        resetPrimitives();
+        for (auto& primitive : primitives)
+            MeshManager::OptimizeMesh(primitive.Indices, primitive.Positions, primitive.Attributes);
+
+        uint64_t vertexCount = 0;
+        for (const auto& primitive : primitives)
+            vertexCount += primitive.Positions.size();
+
+        runner.Run({.Group = "MeshManager", .Name = meshName + "/GenerateBounds", .Iterations = 20, .ItemsPerIteration = vertexCount},
+                   [&]
+                   {
+                       for (const auto& primitive : primitives)
+                       {
+                           DoNotOptimize(MeshManager::GenerateAABB(primitive.Positions));
+                           DoNotOptimize(MeshManager::GenerateBoundingSphere(primitive.Positions));
+                       }
+                   });
+
+        for (const auto isa : boundsISAs)
+        {
+            const std::string isaName = MeshBounds::GetISAName(isa);
+            for (const auto& primitive : primitives)
+            {
+                if (ValidateBounds(primitive.Positions.data(), primitive.Positions.size(), isa)) continue;
+
+                runner.ReportFailure("{} bounds of \"{}\" don't match scalar reference!", isaName, meshName);
+                break;
+            }
+
+            runner.Run({.Group             = "MeshManager",
+                        .Name              = meshName + "/ComputeAABB/" + isaName,
+                        .Iterations        = 20,
+                        .ItemsPerIteration = vertexCount},
+                       [&]
+                       {
+                           for (const auto& primitive : primitives)
+                               DoNotOptimize(MeshBounds::ComputeAABB(primitive.Positions.data(), primitive.Positions.size(), isa));
+                       });
+            runner.Run({.Group             = "MeshManager",
+                        .Name              = meshName + "/ComputeSphere/" + isaName,
+                        .Iterations        = 20,
+                        .ItemsPerIteration = vertexCount},
+                       [&]
+                       {
+                           for (const auto& primitive : primitives)
+                               DoNotOptimize(MeshBounds::ComputeSphere(primitive.Positions.data(), primitive.Positions.size(), isa));
+                       });
+        }
+
+        std::vector<Meshlet> meshlets;
+        std::vector<uint32_t> meshletVertices;
+        std::vector<uint8_t> meshletTriangles;
+        std::vector<std::pair<std::vector<Meshlet>, std::vector<uint32_t>>> primitiveMeshlets;
+        size_t meshletCount = 0;
+        for (const auto& primitive : primitives)
+        {
+            MeshManager::BuildMeshlets(primitive.Indices, primitive.Positions, meshlets, meshletVertices, meshletTriangles);
+            meshletCount += meshlets.size();
+            primitiveMeshlets.emplace_back(meshlets, meshletVertices);
+        }
+
+        // Per-meshlet spheres the way BuildMeshlets computes them, short gathered streams instead of one long one.
+        for (const auto isa : boundsISAs)
+        {
+            runner.Run({.Group             = "MeshManager",
+                        .Name              = meshName + "/MeshletSpheres/" + MeshBounds::GetISAName(isa),
+                        .Iterations        = 20,
+                        .ItemsPerIteration = meshletCount},
+                       [&]
+                       {
+                           for (size_t i{}; i < primitives.size(); ++i)
+                           {
+                               const auto& [builtMeshlets, builtMeshletVertices] = primitiveMeshlets[i];
+                               for (const auto& meshlet : builtMeshlets)
+                               {
+                                   DoNotOptimize(MeshBounds::ComputeSphere(primitives[i].Positions.data(),
+                                                                           &builtMeshletVertices[meshlet.vertexOffset], meshlet.vertexCount,
+                                                                           isa));
+                               }
+                           }
+                       });
+        }
+
+        runner.Run({.Group             = "MeshManager",
+                    .Name              = meshName + "/BuildMeshlets",
+                    .Iterations        = 5,
+                    .ItemsPerIteration = triangleCount,
+                    .Counters          = {{"meshlets", static_cast<double>(meshletCount)}}},
+                   [&]
+                   {
+                       for (const auto& primitive : primitives)
+                       {
+                           MeshManager::BuildMeshlets(primitive.Indices, primitive.Positions, meshlets, meshletVertices, meshletTriangles);
+                           DoNotOptimize(meshlets.data());
+                       }
+                   });
+
+        std::vector<PrimitiveHierarchy> hierarchies(primitives.size());
+        runner.Run({.Group             = "MeshManager",
+                    .Name              = meshName + "/BuildMeshletHierarchy",
+                    .Iterations        = 3,
+                    .ItemsPerIteration = triangleCount},
+                   [&]
+                   {
+                       for (size_t i{}; i < primitives.size(); ++i)
+                       {
+                           auto& hierarchy = hierarchies[i];
+                           MeshletHierarchy::Build(primitives[i].Indices, primitives[i].Positions, hierarchy.Meshlets,
+                                                   hierarchy.MeshletVertices, hierarchy.MeshletTriangles);
+                       }
+                   });
+
+        // NOTE: Level 0 comes out of the same BuildMeshlets() call hierarchy starts with. Mesh bounds are AABB's, so every meshlet
+        // sphere(it holds at least one vertex) is within meshRadius of meshCenter.
+        bool bHasLODs              = false;
+        float minParentError       = std::numeric_limits<float>::max();
+        glm::vec3 boundsMin        = glm::vec3(std::numeric_limits<float>::max());
+        glm::vec3 boundsMax        = glm::vec3(std::numeric_limits<float>::lowest());
+        uint64_t baseTriangleCount = 0;
+        for (size_t i{}; i < primitives.size(); ++i)
+        {
+            auto& hierarchy            = hierarchies[i];
+            hierarchy.BaseMeshletCount = primitiveMeshlets[i].first.size();
+            bHasLODs |= hierarchy.Meshlets.size() > hierarchy.BaseMeshletCount;
+            baseTriangleCount += primitives[i].Indices.size() / 3;
+
+            if (!ValidateHierarchyBounds(hierarchy.Meshlets))
+                runner.ReportFailure("Meshlet hierarchy of \"{}\" has parent bounds or error smaller than children's!", meshName);
+
+            for (const auto& meshlet : hierarchy.Meshlets)
+                if (meshlet.parentError > 0.0f && meshlet.parentError != std::numeric_limits<float>::max())
+                    minParentError = std::min(minParentError, meshlet.parentError);
+
+            for (const auto& vertex : primitives[i].Positions)
+            {
+                boundsMin = glm::min(boundsMin, vertex.Position);
+                boundsMax = glm::max(boundsMax, vertex.Position);
+            }
+        }
+        const glm::vec3 meshCenter = (boundsMin + boundsMax) * 0.5f;
+        const float meshRadius     = std::max(glm::distance(boundsMin, boundsMax) * 0.5f, 1e-3f);
+
+        // Same reversed-Z projection camera renders with.
+        constexpr float s_zNear          = 0.01f;
+        constexpr float s_ViewportHeight = 1080.0f;
+        const glm::mat4 projection       = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 1000.0f, s_zNear);
+        const float expectedScale        = s_ViewportHeight * 0.5f / std::tan(glm::radians(30.0f));
+        if (const auto view = MeshletHierarchy::MakeView(meshCenter, projection, s_zNear, s_ViewportHeight);
+            std::abs(view.ProjectionScale - expectedScale) > 1e-3f * expectedScale)
+            runner.ReportFailure("MakeView() projection scale is {}, expected {}!", view.ProjectionScale, expectedScale);
+
+        std::vector<std::vector<uint32_t>> selectedMeshlets(primitives.size());
+        const auto selectCut = [&](const MeshletHierarchy::View& view)
+        {
+            uint64_t selectedTriangleCount = 0;
+            for (size_t i{}; i < primitives.size(); ++i)
+            {
+                selectedMeshlets[i].clear();
+                selectedTriangleCount += MeshletHierarchy::Select(hierarchies[i].Meshlets, view, glm::vec3(0.0f), glm::vec3(1.0f),
+                                                                  glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), &selectedMeshlets[i]);
+                if (!ValidateLODCut(hierarchies[i].Meshlets, selectedMeshlets[i]))
+                    runner.ReportFailure("\"{}\" LOD cut draws meshlet group together with the one it got simplified into!", meshName);
+            }
+            return selectedTriangleCount;
+        };
+
+        // Near: camera inside the mesh at resolution every non-zero error projects to 2 pixels at least, so only exact meshlets
+        // can be drawn, level 0 or groups simplified without any error.
+        const float nearScale = minParentError == std::numeric_limits<float>::max()
+                                    ? 1.0f
+                                    : 2.0f * MeshletHierarchy::GetErrorThreshold() * std::max(meshRadius, s_zNear) / minParentError;
+        if (selectCut({.CameraPosition = meshCenter, .zNear = s_zNear, .ProjectionScale = nearScale}) > baseTriangleCount)
+            runner.ReportFailure("\"{}\" near LOD cut has more triangles than level 0!", meshName);
+        for (size_t i{}; i < primitives.size(); ++i)
+        {
+            if (std::all_of(selectedMeshlets[i].begin(), selectedMeshlets[i].end(),
+                            [&](const uint32_t meshletIndex) { return hierarchies[i].Meshlets[meshletIndex].lodError == 0.0f; }))
+                continue;
+
+            runner.ReportFailure("\"{}\" near LOD cut draws simplified meshlets!", meshName);
+            break;
+        }
+
+        // Moving away from the mesh(beyond its bounds, so distance to every meshlet grows) can only coarsen the cut.
+        const glm::vec3 viewDirection = glm::normalize(glm::vec3(0.3f, 0.4f, 1.0f));
+        std::vector<MeshletHierarchy::View> views;
+        for (uint32_t distanceLog = 2; distanceLog <= 14; ++distanceLog)
+            views.emplace_back(MeshletHierarchy::MakeView(meshCenter + viewDirection * meshRadius * static_cast<float>(1u << distanceLog),
+                                                          projection, s_zNear, s_ViewportHeight));
+
+        uint64_t prevTriangleCount = baseTriangleCount;
+        bool bDeviationMeasured    = false;
+        float cutDeviation         = 0.0f;
+        for (const auto& view : views)
+        {
+            const uint64_t selectedTriangleCount = selectCut(view);
+            if (selectedTriangleCount > prevTriangleCount)
+                runner.ReportFailure("\"{}\" LOD cut went from ({}) to ({}) triangles moving away!", meshName, prevTriangleCount,
+                                     selectedTriangleCount);
+            prevTriangleCount = selectedTriangleCount;
+
+            // NOTE: Error is meshoptimizer's quadric estimate, not exact distance to source surface, hence slack. Checked once cut is
+            // coarse enough to be mostly simplified geometry and small enough to brute force.
+            if (bDeviationMeasured || selectedTriangleCount * 4 > baseTriangleCount) continue;
+
+            bDeviationMeasured = true;
+            for (size_t i{}; i < primitives.size(); ++i)
+                cutDeviation = std::max(cutDeviation, MeasureCutDeviation(primitives[i], hierarchies[i], selectedMeshlets[i], view, 256));
+
+            if (cutDeviation > 2.0f * MeshletHierarchy::GetErrorThreshold())
+                runner.ReportFailure("\"{}\" LOD cut of ({}) triangles is ({:.2f}) pixels off source surface, error bound is ({})!",
+                                     meshName, selectedTriangleCount, cutDeviation, MeshletHierarchy::GetErrorThreshold());
+        }
+
+        if (bHasLODs && prevTriangleCount >= baseTriangleCount)
+            runner.ReportFailure("\"{}\" has meshlet LODs, but they're never selected!", meshName);
+
+        runner.Run({.Group             = "MeshManager",
+                    .Name              = meshName + "/SelectMeshletLOD",
+                    .Iterations        = 20,
+                    .ItemsPerIteration = views.size(),
+                    .Counters          = {{"deviation", static_cast<double>(cutDeviation)}}},
+                   [&]
+                   {
+                       for (const auto& view : views)
+                           for (const auto& hierarchy : hierarchies)
+                               DoNotOptimize(MeshletHierarchy::Select(hierarchy.Meshlets, view));
+                   });
+
+        // Macro: CPU part of LoadMesh, primitives fanned out on ThreadPool.
+        runner.Run({.Group             = "MeshManager",
+                    .Name              = meshName + "/CookPrimitivesParallel",
+                    .Iterations        = 5,
+                    .ItemsPerIteration = triangleCount},
+                   [&]
+                   {
+                       ThreadPool::ParallelFor(static_cast<uint32_t>(primitives.size()), 1,
+                                               [&](const uint32_t i)
+                                               {
+                                                   auto& primitive = primitives[i];
+                                                   MeshManager::OptimizeMesh(primitive.Indices, primitive.Positions, primitive.Attributes);
+                                                   DoNotOptimize(MeshManager::GenerateBoundingSphere(primitive.Positions));
+
+                                                   std::vector<Meshlet> cookedMeshlets;
+                                                   std::vector<uint32_t> cookedMeshletVertices;
+                                                   std::vector<uint8_t> cookedMeshletTriangles;
+                                                   MeshManager::BuildMeshlets(primitive.Indices, primitive.Positions, cookedMeshlets,
+                                                                              cookedMeshletVertices, cookedMeshletTriangles);
+                                                   DoNotOptimize(cookedMeshlets.data());
+                                               });
+                   },
+                   resetPrimitives);
+    }
+}
+
+}  // namespace Benchmarks
+
+}  // namespace Pathfinder
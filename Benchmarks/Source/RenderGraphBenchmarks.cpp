@@ -0,0 +1,235 @@
+#include "Benchmark.h"
+
+#include <Renderer/RenderGraph/RenderGraph.h>
+
+namespace Pathfinder
+{
+
+namespace RenderGraphBenchmarkUtils
+{
+
+// NOTE: Interned once and reused across iterations, same as passes do with ResourceNames, so setup doesn't measure string hashing.
+static const RGResourceName& GetSyntheticName(std::vector<RGResourceName>& names, const std::string_view prefix, const uint32_t index)
+{
+    while (names.size() <= index)
+        names.emplace_back(std::format("{}{}", prefix, names.size()));
+    return names[index];
+}
+
+static const RGResourceName& GetTextureName(const uint32_t index)
+{
+    static std::vector<RGResourceName> s_TextureNames;
+    return GetSyntheticName(s_TextureNames, "Texture_", index);
+}
+
+static const RGResourceName& GetBufferName(const uint32_t index)
+{
+    static std::vector<RGResourceName> s_BufferNames;
+    return GetSyntheticName(s_BufferNames, "Buffer_", index);
+}
+
+/*
+ * Synthetic frame: every pass produces its own transient texture and reads two earlier ones(previous and one from the middle
+ * of the chain), so dependencies are denser than a plain chain. Every 4th pass is compute and also produces a buffer
+ * that every later 4th pass reads back, which resembles culling/lighting data flowing through the frame. Last pass is the sink,
+ * so nothing gets culled. With bAsyncCompute compute passes go to async compute queue, sink stays on graphics.
+ */
+static void AddSyntheticPasses(RenderGraph& renderGraph, const uint32_t passCount, const bool bAsyncCompute = false)
+{
+    for (uint32_t passIndex{}; passIndex < passCount; ++passIndex)
+    {
+        const bool bCompute           = passIndex % 4 == 0;
+        const auto& textureName       = GetTextureName(passIndex);
+        const std::string passName    = "Pass_" + std::to_string(passIndex);
+        const bool bSink              = passIndex + 1 == passCount;
+
+        ERGPassType passType = ERGPassType::RGPASS_TYPE_GRAPHICS;
+        if (bCompute) passType = bAsyncCompute && !bSink ? ERGPassType::RGPASS_TYPE_COMPUTE_ASYNC : ERGPassType::RGPASS_TYPE_COMPUTE;
+
+        renderGraph.AddPass<void>(
+            passName, passType,
+            [&](RenderGraphBuilder& builder)
+            {
+                constexpr ResourceStateFlags readState =
+                    EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE | EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE;
+                if (passIndex > 0) builder.ReadTexture(GetTextureName(passIndex - 1), readState);
+                if (passIndex > 2) builder.ReadTexture(GetTextureName(passIndex / 2), readState);
+                if (passIndex >= 4 && bCompute) builder.ReadBuffer(GetBufferName(passIndex - 4), readState);
+                if (bSink) builder.SetSideEffect();
+
+                constexpr ImageUsageFlags textureUsage = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                                                         EImageUsage::IMAGE_USAGE_STORAGE_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT;
+                builder.DeclareTexture(textureName, {.DebugName  = textureName.GetString(),
+                                                     .Width      = 1920,
+                                                     .Height     = 1080,
+                                                     .Format     = EImageFormat::FORMAT_RGBA16F,
+                                                     .UsageFlags = textureUsage,
+                                                     .bTransient = true});
+
+                if (bCompute)
+                {
+                    builder.WriteTexture(textureName);
+
+                    const auto& bufferName = GetBufferName(passIndex);
+                    builder.DeclareBuffer(bufferName, {.DebugName  = bufferName.GetString(),
+                                                       .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
+                                                       .Capacity   = 1024 * 1024,
+                                                       .bTransient = true});
+                    builder.WriteBuffer(bufferName);
+                }
+                else
+                {
+                    builder.WriteRenderTarget(textureName, glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
+                    builder.SetViewportScissor(1920, 1080);
+                }
+            },
+            [](RenderGraphContext&, Shared<CommandBuffer>&) {});
+    }
+}
+
+// Compute pass nobody reads from(gets culled) and one writing new version of the last synthetic texture, so dumps show both.
+static void AddCulledAndAliasPasses(RenderGraph& renderGraph, const uint32_t passCount)
+{
+    static const RGResourceName s_UnusedTextureName  = "Texture_Unused";
+    static const RGResourceName s_AliasedTextureName = "Texture_Aliased";
+
+    renderGraph.AddPass<void>(
+        "Pass_Unused", ERGPassType::RGPASS_TYPE_COMPUTE,
+        [&](RenderGraphBuilder& builder)
+        {
+            builder.ReadTexture(GetTextureName(0), EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            builder.DeclareTexture(s_UnusedTextureName, {.DebugName  = s_UnusedTextureName.GetString(),
+                                                         .Width      = 960,
+                                                         .Height     = 540,
+                                                         .Format     = EImageFormat::FORMAT_R16F,
+                                                         .UsageFlags = EImageUsage::IMAGE_USAGE_STORAGE_BIT,
+                                                         .bTransient = true});
+            builder.WriteTexture(s_UnusedTextureName);
+        },
+        [](RenderGraphContext&, Shared<CommandBuffer>&) {});
+
+    renderGraph.AddPass<void>(
+        "Pass_Overlay", ERGPassType::RGPASS_TYPE_COMPUTE,
+        [&](RenderGraphBuilder& builder)
+        {
+            builder.WriteTexture(s_AliasedTextureName, GetTextureName(passCount - 1));
+            builder.SetSideEffect();
+        },
+        [](RenderGraphContext&, Shared<CommandBuffer>&) {});
+}
+
+}  // namespace RenderGraphBenchmarkUtils
+
+namespace Benchmarks
+{
+
+void RunRenderGraphBenchmarks(BenchmarkRunner& runner)
+{
+    using namespace RenderGraphBenchmarkUtils;
+
+    // NOTE: Pool is never asked to place anything, since graphs here are only compiled, not built.
+    RenderGraphResourcePool resourcePool = {};
+    RenderGraphCache renderGraphCache    = {};
+    for (const uint32_t passCount : {16u, 64u, 256u})
+    {
+        runner.Run({.Group             = "RenderGraph",
+                    .Name              = std::format("Setup/{}Passes", passCount),
+                    .Iterations        = 20,
+                    .ItemsPerIteration = passCount},
+                   [&]
+                   {
+                       RenderGraph renderGraph(0, "BenchmarkGraph", resourcePool, renderGraphCache);
+                       AddSyntheticPasses(renderGraph, passCount);
+                       DoNotOptimize(renderGraph.GetPassCount());
+                   });
+
+        RenderGraph renderGraph(0, "BenchmarkGraph", resourcePool, renderGraphCache);
+        AddSyntheticPasses(renderGraph, passCount);
+        renderGraph.Compile();
+
+        const RGBarrierStats barrierStats = renderGraph.GetPlannedBarrierStats();
+        runner.Run({.Group             = "RenderGraph",
+                    .Name              = std::format("Compile/{}Passes", passCount),
+                    .Iterations        = 20,
+                    .ItemsPerIteration = passCount,
+                    .Counters          = {{"barriers", static_cast<double>(barrierStats.BarrierCount)},
+                                          {"merged_barriers", static_cast<double>(barrierStats.MergedBarrierCount)},
+                                          {"barrier_calls", static_cast<double>(barrierStats.BarrierCallCount)},
+                                          {"merged_barrier_calls", static_cast<double>(barrierStats.MergedBarrierCallCount)}}},
+                   [&]
+                   {
+                       renderGraph.Compile();
+                       DoNotOptimize(renderGraph.GetTopologicallySortedPasses().data());
+                   },
+                   [&] { renderGraphCache.Clear(); });
+
+        // Same topology as previous frame, only hashing and cache lookup remain.
+        runner.Run({.Group             = "RenderGraph",
+                    .Name              = std::format("CompileCached/{}Passes", passCount),
+                    .Iterations        = 20,
+                    .ItemsPerIteration = passCount},
+                   [&]
+                   {
+                       renderGraph.Compile();
+                       DoNotOptimize(renderGraph.GetTopologicallySortedPasses().data());
+                   });
+
+        // NOTE: Uniform 1ms per pass, so scheduled time shows only how much work async batches manage to overlap.
+        RenderGraph asyncRenderGraph(0, "BenchmarkAsyncGraph", resourcePool, renderGraphCache);
+        AddSyntheticPasses(asyncRenderGraph, passCount, true);
+        asyncRenderGraph.Compile();
+
+        const auto uniformPassCost          = [](const uint32_t) { return 1.f; };
+        const RGScheduleStats scheduleStats = asyncRenderGraph.SimulateSchedule(uniformPassCost);
+        runner.Run({.Group             = "RenderGraph",
+                    .Name              = std::format("ScheduleAsync/{}Passes", passCount),
+                    .Iterations        = 20,
+                    .ItemsPerIteration = passCount,
+                    .Counters          = {{"batches", static_cast<double>(scheduleStats.BatchCount)},
+                                          {"syncpoints", static_cast<double>(scheduleStats.SyncPointCount)},
+                                          {"transfers", static_cast<double>(scheduleStats.QueueTransferCount)},
+                                          {"serial_ms", scheduleStats.SerialTime},
+                                          {"scheduled_ms", scheduleStats.ScheduledTime}}},
+                   [&]
+                   {
+                       asyncRenderGraph.Compile();
+                       DoNotOptimize(asyncRenderGraph.SimulateSchedule(uniformPassCost).ScheduledTime);
+                   },
+                   [&] { renderGraphCache.Clear(); });
+    }
+}
+
+bool DumpSyntheticRenderGraph(const std::filesystem::path& outputDir)
+{
+    using namespace RenderGraphBenchmarkUtils;
+
+    std::error_code errorCode = {};
+    std::filesystem::create_directories(outputDir, errorCode);
+    if (errorCode)
+    {
+        LOG_WARN("Failed to create render graph dump directory \"{}\"!", outputDir.string());
+        return false;
+    }
+
+    // NOTE: Compile() doesn't touch GPU, so pool stays empty and dumps carry no heap placements.
+    RenderGraphResourcePool resourcePool = {};
+    RenderGraphCache renderGraphCache    = {};
+    RenderGraph renderGraph(0, "SyntheticGraph", resourcePool, renderGraphCache);
+    constexpr uint32_t s_SyntheticPassCount = 32;
+    AddSyntheticPasses(renderGraph, s_SyntheticPassCount, true);
+    AddCulledAndAliasPasses(renderGraph, s_SyntheticPassCount);
+    renderGraph.Compile();
+
+    const std::string graphViz = renderGraph.ExportGraphViz();
+    SaveData((outputDir / "render_graph_synthetic.dot").string().data(), graphViz.data(), graphViz.size());
+
+    const std::string json = renderGraph.ExportJSON();
+    SaveData((outputDir / "render_graph_synthetic.json").string().data(), json.data(), json.size());
+
+    LOG_INFO("Synthetic render graph({} passes) dumped to \"{}\".", renderGraph.GetPassCount(), outputDir.string());
+    return true;
+}
+
+}  // namespace Benchmarks
+
+}  // namespace Pathfinder
@@ -0,0 +1,47 @@
+#include "Benchmark.h"
+
+namespace Pathfinder
+{
+
+namespace Benchmarks
+{
+
+// NOTE: Entities carry only core components(ID, tag, transform), mesh/sprite/light ones would end up in Renderer which needs GPU,
+// so it's the per-entity iteration and transform work of Scene::OnUpdate that gets measured.
+void RunSceneBenchmarks(BenchmarkRunner& runner)
+{
+    for (const uint32_t entityCount : {10'000u, 50'000u, 100'000u})
+    {
+        const std::string entityCountName = std::to_string(entityCount / 1000) + "k";
+        if (!runner.IsEnabled("Scene", "CreateEntities/" + entityCountName) && !runner.IsEnabled("Scene", "OnUpdate/" + entityCountName))
+            continue;
+
+        Unique<Scene> scene = nullptr;
+        runner.Run({.Group = "Scene", .Name = "CreateEntities/" + entityCountName, .Iterations = 5, .ItemsPerIteration = entityCount},
+                   [&]
+                   {
+                       for (uint32_t i{}; i < entityCount; ++i)
+                           scene->CreateEntity("Entity");
+                   },
+                   [&] { scene = MakeUnique<Scene>("BenchmarkScene"); });
+
+        std::mt19937 rng(entityCount);
+        std::uniform_real_distribution<float> positionDistribution(-500.f, 500.f);
+        std::uniform_real_distribution<float> angleDistribution(0.f, 360.f);
+
+        scene = MakeUnique<Scene>("BenchmarkScene");
+        for (uint32_t i{}; i < entityCount; ++i)
+        {
+            auto& tc       = scene->CreateEntity("Entity").GetComponent<TransformComponent>();
+            tc.Translation = glm::vec3(positionDistribution(rng), positionDistribution(rng), positionDistribution(rng));
+            tc.Rotation    = glm::vec3(angleDistribution(rng), angleDistribution(rng), angleDistribution(rng));
+        }
+
+        runner.Run({.Group = "Scene", .Name = "OnUpdate/" + entityCountName, .Iterations = 20, .ItemsPerIteration = entityCount},
+                   [&] { scene->OnUpdate(1.f / 60.f); });
+    }
+}
+
+}  // namespace Benchmarks
+
+}  // namespace Pathfinder
@@ -0,0 +1,100 @@
+#include "Benchmark.h"
+
+namespace Pathfinder
+{
+
+namespace SortBenchmarkUtils
+{
+
+// Mirrors the part of Renderer's render object that draw ordering depends on.
+struct RenderObject
+{
+    uint32_t SubmeshIndex = 0;
+    glm::vec3 Translation = glm::vec3(0.f);
+    glm::vec3 Scale       = glm::vec3(1.f);
+    glm::vec4 Orientation = glm::vec4(0.f, 0.f, 0.f, 1.f);
+};
+
+NODISCARD static std::vector<RenderObject> GenerateRenderObjects(const uint32_t count)
+{
+    std::mt19937 rng(count);
+    std::uniform_real_distribution<float> positionDistribution(-1000.f, 1000.f);
+    std::uniform_int_distribution<uint32_t> submeshDistribution(0, 255);
+
+    std::vector<RenderObject> renderObjects(count);
+    for (auto& renderObject : renderObjects)
+    {
+        renderObject.SubmeshIndex = submeshDistribution(rng);
+        renderObject.Translation  = glm::vec3(positionDistribution(rng), positionDistribution(rng), positionDistribution(rng));
+    }
+
+    return renderObjects;
+}
+
+}  // namespace SortBenchmarkUtils
+
+namespace Benchmarks
+{
+
+// NOTE: FramePreparePass used to sort opaque objects front to back(less overdraw) and transparent ones back to front(correct
+// blending) by camera distance every frame. Scene tables are persistent now, but sort cost per object count is still what decides
+// whether CPU-side ordering is affordable, so it's kept measurable.
+void RunSortBenchmarks(BenchmarkRunner& runner)
+{
+    using namespace SortBenchmarkUtils;
+
+    const glm::vec3 cameraPosition = glm::vec3(12.f, 3.f, -40.f);
+    for (const uint32_t objectCount : {1'000u, 10'000u, 100'000u})
+    {
+        const std::string objectCountName       = std::to_string(objectCount / 1000) + "k";
+        const std::vector<RenderObject> objects = GenerateRenderObjects(objectCount);
+        std::vector<RenderObject> sortedObjects;
+        const auto resetObjects = [&] { sortedObjects = objects; };
+
+        runner.Run({.Group = "Sort", .Name = "FrontToBack/" + objectCountName, .ItemsPerIteration = objectCount},
+                   [&]
+                   {
+                       std::sort(sortedObjects.begin(), sortedObjects.end(),
+                                 [&](const auto& lhs, const auto& rhs) {
+                                     return glm::length(lhs.Translation - cameraPosition) < glm::length(rhs.Translation - cameraPosition);
+                                 });
+                       DoNotOptimize(sortedObjects.data());
+                   },
+                   resetObjects);
+
+        runner.Run({.Group = "Sort", .Name = "BackToFrontParallel/" + objectCountName, .ItemsPerIteration = objectCount},
+                   [&]
+                   {
+                       std::sort(std::execution::par, sortedObjects.begin(), sortedObjects.end(),
+                                 [&](const auto& lhs, const auto& rhs) {
+                                     return glm::length(lhs.Translation - cameraPosition) > glm::length(rhs.Translation - cameraPosition);
+                                 });
+                       DoNotOptimize(sortedObjects.data());
+                   },
+                   resetObjects);
+
+        // Distance computed once per object instead of twice per comparison, then objects are gathered by sorted keys.
+        std::vector<std::pair<float, uint32_t>> sortKeys;
+        runner.Run({.Group = "Sort", .Name = "FrontToBackKeyed/" + objectCountName, .ItemsPerIteration = objectCount},
+                   [&]
+                   {
+                       sortKeys.resize(sortedObjects.size());
+                       for (uint32_t i{}; i < sortedObjects.size(); ++i)
+                       {
+                           const glm::vec3 toObject = sortedObjects[i].Translation - cameraPosition;
+                           sortKeys[i]              = {glm::dot(toObject, toObject), i};
+                       }
+                       std::ranges::sort(sortKeys);
+
+                       std::vector<RenderObject> gatheredObjects(sortKeys.size());
+                       for (uint32_t i{}; i < sortKeys.size(); ++i)
+                           gatheredObjects[i] = sortedObjects[sortKeys[i].second];
+                       DoNotOptimize(gatheredObjects.data());
+                   },
+                   resetObjects);
+    }
+}
+
+}  // namespace Benchmarks
+
+}  // namespace Pathfinder
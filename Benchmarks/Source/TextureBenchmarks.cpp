@@ -0,0 +1,811 @@
+#include "Benchmark.h"
+
+#include <Renderer/BCnEncoder.h>
+#include <Renderer/Image.h>
+
+#include <glm/gtc/packing.hpp>
+
+namespace Pathfinder
+{
+
+namespace TextureBenchmarkUtils
+{
+
+static constexpr uint32_t s_BLOCK_DIM         = 4;
+static constexpr uint32_t s_BLOCK_TEXEL_COUNT = s_BLOCK_DIM * s_BLOCK_DIM;
+
+using DecodedBlock = std::array<glm::vec4, s_BLOCK_TEXEL_COUNT>;
+
+// NOTE: Decoders below are written from the BCn spec(Khronos Data Format, "S3TC" and "BPTC" chapters) apart from the encoder on purpose,
+// so they don't share its mistakes, BPTC ones are pinned by s_BCN_BLOCK_FIXTURES. LDR formats decode into [0, 255], BC6H into floats,
+// channels format doesn't store are left at 0.
+NODISCARD static uint32_t ReadBits(const uint8_t* block, const uint32_t bitOffset, const uint32_t bitCount)
+{
+    uint32_t value = 0;
+    for (uint32_t bit{}; bit < bitCount; ++bit)
+        value |= ((block[(bitOffset + bit) / 8] >> ((bitOffset + bit) % 8)) & 1u) << bit;
+    return value;
+}
+
+NODISCARD static glm::vec4 DecodeRGB565(const uint16_t color)
+{
+    const uint32_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+    return glm::vec4((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 255.0f);
+}
+
+// BC1 picks 3 color + transparent black mode on color0 <= color1, color part of BC2/BC3 is always 4 color.
+static void DecodeColorBlock(const uint8_t* block, const bool bBC1, DecodedBlock& outTexels)
+{
+    const uint16_t color0 = block[0] | (block[1] << 8);
+    const uint16_t color1 = block[2] | (block[3] << 8);
+
+    std::array<glm::vec4, 4> palette = {DecodeRGB565(color0), DecodeRGB565(color1)};
+    if (color0 > color1 || !bBC1)
+    {
+        palette[2] = (2.0f * palette[0] + palette[1]) / 3.0f;
+        palette[3] = (palette[0] + 2.0f * palette[1]) / 3.0f;
+    }
+    else
+    {
+        palette[2] = (palette[0] + palette[1]) / 2.0f;
+        palette[3] = glm::vec4(0.0f);
+    }
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        const glm::vec4& color = palette[ReadBits(block + 4, texelIndex * 2, 2)];
+        outTexels[texelIndex]  = glm::vec4(glm::vec3(color), bBC1 ? color.a : outTexels[texelIndex].a);
+    }
+}
+
+// BC4 block, also alpha of BC3 and channels of BC5. Signed endpoints are two's complement, -128 reads as -127.
+static void DecodeSingleChannelBlock(const uint8_t* block, const bool bSigned, const uint32_t channel, DecodedBlock& outTexels)
+{
+    const float endpoint0 = bSigned ? std::max(static_cast<float>(static_cast<int8_t>(block[0])), -127.0f) : block[0];
+    const float endpoint1 = bSigned ? std::max(static_cast<float>(static_cast<int8_t>(block[1])), -127.0f) : block[1];
+
+    std::array<float, 8> palette = {endpoint0, endpoint1};
+    if (endpoint0 > endpoint1)
+    {
+        for (uint32_t i = 2; i < 8; ++i)
+            palette[i] = ((8 - i) * endpoint0 + (i - 1) * endpoint1) / 7.0f;
+    }
+    else
+    {
+        for (uint32_t i = 2; i < 6; ++i)
+            palette[i] = ((6 - i) * endpoint0 + (i - 1) * endpoint1) / 5.0f;
+        palette[6] = bSigned ? -127.0f : 0.0f;
+        palette[7] = bSigned ? 127.0f : 255.0f;
+    }
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        const float value              = palette[ReadBits(block + 2, texelIndex * 3, 3)];
+        outTexels[texelIndex][channel] = bSigned ? (value + 127.0f) / 254.0f * 255.0f : value;
+    }
+}
+
+static void DecodeExplicitAlphaBlock(const uint8_t* block, DecodedBlock& outTexels)
+{
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+        outTexels[texelIndex].a = ReadBits(block, texelIndex * 4, 4) * 17.0f;
+}
+
+// BC7 mode layout: subsets, bits of partition, rotation and index selection, bits of color and alpha endpoints, p-bits per endpoint
+// or shared by subset, bits of primary and secondary indices.
+struct BC7ModeInfo
+{
+    uint32_t SubsetCount;
+    uint32_t PartitionBits;
+    uint32_t RotationBits;
+    uint32_t IndexSelectionBits;
+    uint32_t ColorBits;
+    uint32_t AlphaBits;
+    uint32_t EndpointPBits;
+    uint32_t SharedPBits;
+    uint32_t IndexBits;
+    uint32_t SecondaryIndexBits;
+};
+
+static constexpr std::array<BC7ModeInfo, 8> s_BC7_MODES = {BC7ModeInfo{3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+                                                           BC7ModeInfo{2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+                                                           BC7ModeInfo{3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+                                                           BC7ModeInfo{2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+                                                           BC7ModeInfo{1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+                                                           BC7ModeInfo{1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+                                                           BC7ModeInfo{1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+                                                           BC7ModeInfo{2, 6, 0, 0, 5, 5, 1, 0, 2, 0}};
+
+// Interpolation weights(out of 64) for 2, 3 and 4-bit indices, shared by BC6H and BC7.
+static constexpr std::array<int32_t, 4> s_BPTC_WEIGHTS_2 = {0, 21, 43, 64};
+static constexpr std::array<int32_t, 8> s_BPTC_WEIGHTS_3 = {0, 9, 18, 27, 37, 46, 55, 64};
+static constexpr std::array<int32_t, 16> s_BPTC_WEIGHTS_4 = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Two subset partitions(BC6H uses the first 32), bit per texel is set if it belongs to the second subset.
+static constexpr std::array<uint16_t, 64> s_BPTC_PARTITIONS_2 = {
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+    0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+    0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+    0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22};
+
+// Three subset partitions, 2 bits per texel hold its subset.
+static constexpr std::array<uint32_t, 64> s_BC7_PARTITIONS_3 = {
+    0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+    0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+    0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+    0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+    0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+    0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+    0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+    0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254};
+
+// Anchor texels(their index is stored without MSB) of every subset but the first one, whose anchor is always texel 0.
+static constexpr std::array<uint8_t, 64> s_BPTC_ANCHORS_2 = {
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+    15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6, 6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15};
+static constexpr std::array<uint8_t, 64> s_BC7_ANCHORS_3_SECOND = {
+    3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3, 3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+    8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15, 3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12, 3, 3};
+static constexpr std::array<uint8_t, 64> s_BC7_ANCHORS_3_THIRD = {
+    15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8, 15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8,
+    15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8, 15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8};
+
+NODISCARD static uint32_t GetPartitionSubset(const uint32_t subsetCount, const uint32_t partition, const uint32_t texelIndex)
+{
+    if (subsetCount == 2) return (s_BPTC_PARTITIONS_2[partition] >> texelIndex) & 1u;
+    if (subsetCount == 3) return (s_BC7_PARTITIONS_3[partition] >> (texelIndex * 2)) & 3u;
+    return 0;
+}
+
+NODISCARD static bool IsAnchorTexel(const uint32_t subsetCount, const uint32_t partition, const uint32_t texelIndex)
+{
+    if (texelIndex == 0) return true;
+    if (subsetCount == 2) return texelIndex == s_BPTC_ANCHORS_2[partition];
+    if (subsetCount == 3) return texelIndex == s_BC7_ANCHORS_3_SECOND[partition] || texelIndex == s_BC7_ANCHORS_3_THIRD[partition];
+    return false;
+}
+
+NODISCARD static int32_t InterpolateBPTC(const int32_t endpoint0, const int32_t endpoint1, const uint32_t index, const uint32_t indexBits)
+{
+    const int32_t weight = indexBits == 2 ? s_BPTC_WEIGHTS_2[index] : indexBits == 3 ? s_BPTC_WEIGHTS_3[index] : s_BPTC_WEIGHTS_4[index];
+    return (endpoint0 * (64 - weight) + endpoint1 * weight + 32) >> 6;
+}
+
+// Every mode, partitions, rotation and index selection. Reserved mode(no mode bit set) is reported as unreadable.
+NODISCARD static bool DecodeBC7Block(const uint8_t* block, DecodedBlock& outTexels)
+{
+    uint32_t mode = 0;
+    while (mode < s_BC7_MODES.size() && ReadBits(block, mode, 1) == 0)
+        ++mode;
+    if (mode == s_BC7_MODES.size()) return false;
+
+    const auto& modeInfo     = s_BC7_MODES[mode];
+    uint32_t bitOffset       = mode + 1;
+    const uint32_t partition = ReadBits(block, bitOffset, modeInfo.PartitionBits);
+    bitOffset += modeInfo.PartitionBits;
+    const uint32_t rotation = ReadBits(block, bitOffset, modeInfo.RotationBits);
+    bitOffset += modeInfo.RotationBits;
+    const uint32_t indexSelection = ReadBits(block, bitOffset, modeInfo.IndexSelectionBits);
+    bitOffset += modeInfo.IndexSelectionBits;
+
+    // Channel by channel, every endpoint of every subset.
+    const uint32_t endpointCount        = modeInfo.SubsetCount * 2;
+    std::array<glm::ivec4, 6> endpoints = {};
+    for (uint32_t channel{}; channel < 4; ++channel)
+    {
+        const uint32_t channelBits = channel < 3 ? modeInfo.ColorBits : modeInfo.AlphaBits;
+        for (uint32_t endpointIndex{}; endpointIndex < endpointCount; ++endpointIndex)
+        {
+            endpoints[endpointIndex][channel] = static_cast<int32_t>(ReadBits(block, bitOffset, channelBits));
+            bitOffset += channelBits;
+        }
+    }
+
+    std::array<uint32_t, 6> pBits = {};
+    for (uint32_t endpointIndex{}; endpointIndex < endpointCount * modeInfo.EndpointPBits; ++endpointIndex)
+        pBits[endpointIndex] = ReadBits(block, bitOffset++, 1);
+    for (uint32_t subset{}; subset < modeInfo.SubsetCount * modeInfo.SharedPBits; ++subset)
+        pBits[subset * 2] = pBits[subset * 2 + 1] = ReadBits(block, bitOffset++, 1);
+
+    // P-bit goes below endpoint LSB, then it's expanded to 8 bits by replicating its MSBs. No alpha bits means opaque.
+    const uint32_t pBitCount = modeInfo.EndpointPBits + modeInfo.SharedPBits;
+    for (uint32_t endpointIndex{}; endpointIndex < endpointCount; ++endpointIndex)
+    {
+        for (uint32_t channel{}; channel < 4; ++channel)
+        {
+            const uint32_t channelBits = channel < 3 ? modeInfo.ColorBits : modeInfo.AlphaBits;
+            if (channelBits == 0)
+            {
+                endpoints[endpointIndex][channel] = 255;
+                continue;
+            }
+
+            const uint32_t valueBits = channelBits + pBitCount;
+            int32_t value            = (endpoints[endpointIndex][channel] << pBitCount) | (pBitCount != 0 ? pBits[endpointIndex] : 0);
+            value <<= 8 - valueBits;
+            endpoints[endpointIndex][channel] = value | (value >> valueBits);
+        }
+    }
+
+    std::array<uint32_t, s_BLOCK_TEXEL_COUNT> indices = {}, secondaryIndices = {};
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        const uint32_t indexBits = modeInfo.IndexBits - (IsAnchorTexel(modeInfo.SubsetCount, partition, texelIndex) ? 1 : 0);
+        indices[texelIndex]      = ReadBits(block, bitOffset, indexBits);
+        bitOffset += indexBits;
+    }
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT * (modeInfo.SecondaryIndexBits != 0 ? 1 : 0); ++texelIndex)
+    {
+        const uint32_t indexBits     = modeInfo.SecondaryIndexBits - (texelIndex == 0 ? 1 : 0);
+        secondaryIndices[texelIndex] = ReadBits(block, bitOffset, indexBits);
+        bitOffset += indexBits;
+    }
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        const uint32_t subset = GetPartitionSubset(modeInfo.SubsetCount, partition, texelIndex);
+        const auto& endpoint0 = endpoints[subset * 2];
+        const auto& endpoint1 = endpoints[subset * 2 + 1];
+
+        // Modes with secondary indices interpolate alpha with them, index selection bit swaps the two sets.
+        uint32_t colorIndex = indices[texelIndex], colorIndexBits = modeInfo.IndexBits;
+        uint32_t alphaIndex = indices[texelIndex], alphaIndexBits = modeInfo.IndexBits;
+        if (modeInfo.SecondaryIndexBits != 0)
+        {
+            alphaIndex     = secondaryIndices[texelIndex];
+            alphaIndexBits = modeInfo.SecondaryIndexBits;
+            if (indexSelection != 0)
+            {
+                std::swap(colorIndex, alphaIndex);
+                std::swap(colorIndexBits, alphaIndexBits);
+            }
+        }
+
+        glm::ivec4 texel = {};
+        for (uint32_t channel{}; channel < 3; ++channel)
+            texel[channel] = InterpolateBPTC(endpoint0[channel], endpoint1[channel], colorIndex, colorIndexBits);
+        texel.a = InterpolateBPTC(endpoint0.a, endpoint1.a, alphaIndex, alphaIndexBits);
+
+        // Rotation swaps alpha with one of the color channels after interpolation.
+        if (rotation != 0) std::swap(texel.a, texel[rotation - 1]);
+        outTexels[texelIndex] = glm::vec4(texel);
+    }
+
+    return true;
+}
+
+// Endpoint/delta field of BC6H mode: endpoint(w, x of the first region, y, z of the second one) * 3 + channel.
+enum EBC6HField : uint8_t
+{
+    RW = 0, GW, BW, RX, GX, BX, RY, GY, BY, RZ, GZ, BZ
+};
+
+// Bits [FirstBit, FirstBit + BitCount) of the field, stored LSB first. Reversed runs of the spec are split into single bits.
+struct BC6HFieldBits
+{
+    EBC6HField Field;
+    uint8_t FirstBit;
+    uint8_t BitCount;
+};
+
+struct BC6HModeInfo
+{
+    uint32_t Code;
+    uint32_t CodeBits;
+    uint32_t RegionCount;
+    uint32_t EndpointBits;
+    glm::uvec3 DeltaBits;  // Transformed modes store every endpoint but w as delta from it, zero if endpoints are stored as is.
+    std::vector<BC6HFieldBits> Layout;
+};
+
+// Header layouts in bit order, right after mode bits. Partition(2 regions) follows in bits [77, 82).
+static const std::array<BC6HModeInfo, 14> s_BC6H_MODES = {
+    BC6HModeInfo{0x00, 2, 2, 10, glm::uvec3(5, 5, 5),
+                 {{GY, 4, 1}, {BY, 4, 1}, {BZ, 4, 1}, {RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 5}, {GZ, 4, 1}, {GY, 0, 4},
+                  {GX, 0, 5}, {BZ, 0, 1}, {GZ, 0, 4}, {BX, 0, 5}, {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 5}, {BZ, 2, 1}, {RZ, 0, 5},
+                  {BZ, 3, 1}}},
+    BC6HModeInfo{0x01, 2, 2, 7, glm::uvec3(6, 6, 6),
+                 {{GY, 5, 1}, {GZ, 4, 1}, {GZ, 5, 1}, {RW, 0, 7}, {BZ, 0, 1}, {BZ, 1, 1}, {BY, 4, 1}, {GW, 0, 7}, {BY, 5, 1},
+                  {BZ, 2, 1}, {GY, 4, 1}, {BW, 0, 7}, {BZ, 3, 1}, {BZ, 5, 1}, {BZ, 4, 1}, {RX, 0, 6}, {GY, 0, 4}, {GX, 0, 6},
+                  {GZ, 0, 4}, {BX, 0, 6}, {BY, 0, 4}, {RY, 0, 6}, {RZ, 0, 6}}},
+    BC6HModeInfo{0x02, 5, 2, 11, glm::uvec3(5, 4, 4),
+                 {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 5}, {RW, 10, 1}, {GY, 0, 4}, {GX, 0, 4}, {GW, 10, 1}, {BZ, 0, 1},
+                  {GZ, 0, 4}, {BX, 0, 4}, {BW, 10, 1}, {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 5}, {BZ, 2, 1}, {RZ, 0, 5}, {BZ, 3, 1}}},
+    BC6HModeInfo{0x06, 5, 2, 11, glm::uvec3(4, 5, 4),
+                 {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 4}, {RW, 10, 1}, {GZ, 4, 1}, {GY, 0, 4}, {GX, 0, 5}, {GW, 10, 1},
+                  {GZ, 0, 4}, {BX, 0, 4}, {BW, 10, 1}, {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 4}, {BZ, 0, 1}, {BZ, 2, 1}, {RZ, 0, 4},
+                  {GY, 4, 1}, {BZ, 3, 1}}},
+    BC6HModeInfo{0x0A, 5, 2, 11, glm::uvec3(4, 4, 5),
+                 {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 4}, {RW, 10, 1}, {BY, 4, 1}, {GY, 0, 4}, {GX, 0, 4}, {GW, 10, 1},
+                  {BZ, 0, 1}, {GZ, 0, 4}, {BX, 0, 5}, {BW, 10, 1}, {BY, 0, 4}, {RY, 0, 4}, {BZ, 1, 1}, {BZ, 2, 1}, {RZ, 0, 4},
+                  {BZ, 4, 1}, {BZ, 3, 1}}},
+    BC6HModeInfo{0x0E, 5, 2, 9, glm::uvec3(5, 5, 5),
+                 {{RW, 0, 9}, {BY, 4, 1}, {GW, 0, 9}, {GY, 4, 1}, {BW, 0, 9}, {BZ, 4, 1}, {RX, 0, 5}, {GZ, 4, 1}, {GY, 0, 4},
+                  {GX, 0, 5}, {BZ, 0, 1}, {GZ, 0, 4}, {BX, 0, 5}, {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 5}, {BZ, 2, 1}, {RZ, 0, 5},
+                  {BZ, 3, 1}}},
+    BC6HModeInfo{0x12, 5, 2, 8, glm::uvec3(6, 5, 5),
+                 {{RW, 0, 8}, {GZ, 4, 1}, {BY, 4, 1}, {GW, 0, 8}, {BZ, 2, 1}, {GY, 4, 1}, {BW, 0, 8}, {BZ, 3, 1}, {BZ, 4, 1},
+                  {RX, 0, 6}, {GY, 0, 4}, {GX, 0, 5}, {BZ, 0, 1}, {GZ, 0, 4}, {BX, 0, 5}, {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 6},
+                  {RZ, 0, 6}}},
+    BC6HModeInfo{0x16, 5, 2, 8, glm::uvec3(5, 6, 5),
+                 {{RW, 0, 8}, {BZ, 0, 1}, {BY, 4, 1}, {GW, 0, 8}, {GY, 5, 1}, {GY, 4, 1}, {BW, 0, 8}, {GZ, 5, 1}, {BZ, 4, 1},
+                  {RX, 0, 5}, {GZ, 4, 1}, {GY, 0, 4}, {GX, 0, 6}, {GZ, 0, 4}, {BX, 0, 5}, {BZ, 1, 1}, {BY, 0, 4}, {RY, 0, 5},
+                  {BZ, 2, 1}, {RZ, 0, 5}, {BZ, 3, 1}}},
+    BC6HModeInfo{0x1A, 5, 2, 8, glm::uvec3(5, 5, 6),
+                 {{RW, 0, 8}, {BZ, 1, 1}, {BY, 4, 1}, {GW, 0, 8}, {BY, 5, 1}, {GY, 4, 1}, {BW, 0, 8}, {BZ, 5, 1}, {BZ, 4, 1},
+                  {RX, 0, 5}, {GZ, 4, 1}, {GY, 0, 4}, {GX, 0, 5}, {BZ, 0, 1}, {GZ, 0, 4}, {BX, 0, 6}, {BY, 0, 4}, {RY, 0, 5},
+                  {BZ, 2, 1}, {RZ, 0, 5}, {BZ, 3, 1}}},
+    BC6HModeInfo{0x1E, 5, 2, 6, glm::uvec3(0),
+                 {{RW, 0, 6}, {GZ, 4, 1}, {BZ, 0, 1}, {BZ, 1, 1}, {BY, 4, 1}, {GW, 0, 6}, {GY, 5, 1}, {BY, 5, 1}, {BZ, 2, 1},
+                  {GY, 4, 1}, {BW, 0, 6}, {GZ, 5, 1}, {BZ, 3, 1}, {BZ, 5, 1}, {BZ, 4, 1}, {RX, 0, 6}, {GY, 0, 4}, {GX, 0, 6},
+                  {GZ, 0, 4}, {BX, 0, 6}, {BY, 0, 4}, {RY, 0, 6}, {RZ, 0, 6}}},
+    BC6HModeInfo{0x03, 5, 1, 10, glm::uvec3(0), {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 10}, {GX, 0, 10}, {BX, 0, 10}}},
+    BC6HModeInfo{0x07, 5, 1, 11, glm::uvec3(9, 9, 9),
+                 {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 9}, {RW, 10, 1}, {GX, 0, 9}, {GW, 10, 1}, {BX, 0, 9}, {BW, 10, 1}}},
+    BC6HModeInfo{0x0B, 5, 1, 12, glm::uvec3(8, 8, 8),
+                 {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 8}, {RW, 11, 1}, {RW, 10, 1}, {GX, 0, 8}, {GW, 11, 1}, {GW, 10, 1},
+                  {BX, 0, 8}, {BW, 11, 1}, {BW, 10, 1}}},
+    BC6HModeInfo{0x0F, 5, 1, 16, glm::uvec3(4, 4, 4),
+                 {{RW, 0, 10}, {GW, 0, 10}, {BW, 0, 10}, {RX, 0, 4}, {RW, 15, 1}, {RW, 14, 1}, {RW, 13, 1}, {RW, 12, 1}, {RW, 11, 1},
+                  {RW, 10, 1}, {GX, 0, 4}, {GW, 15, 1}, {GW, 14, 1}, {GW, 13, 1}, {GW, 12, 1}, {GW, 11, 1}, {GW, 10, 1}, {BX, 0, 4},
+                  {BW, 15, 1}, {BW, 14, 1}, {BW, 13, 1}, {BW, 12, 1}, {BW, 11, 1}, {BW, 10, 1}}}};
+
+NODISCARD static int32_t SignExtend(const int32_t value, const uint32_t bitCount)
+{
+    const int32_t signBit = 1 << (bitCount - 1);
+    return (value & (signBit - 1)) - (value & signBit);
+}
+
+NODISCARD static int32_t UnquantizeBC6HEndpoint(const int32_t value, const uint32_t endpointBits, const bool bSigned)
+{
+    if (!bSigned)
+    {
+        if (endpointBits >= 15 || value == 0) return value;
+        if (value == (1 << endpointBits) - 1) return 0xFFFF;
+        return ((value << 16) + 0x8000) >> endpointBits;
+    }
+
+    if (endpointBits >= 16) return value;
+
+    const int32_t magnitude = std::abs(value);
+    if (magnitude == 0) return 0;
+
+    const int32_t unquantized = magnitude >= (1 << (endpointBits - 1)) - 1 ? 0x7FFF : ((magnitude << 15) + 0x4000) >> (endpointBits - 1);
+    return value < 0 ? -unquantized : unquantized;
+}
+
+// Every mode, one and two regions, transformed(delta) endpoints. Reserved modes are reported as unreadable.
+NODISCARD static bool DecodeBC6HBlock(const uint8_t* block, const bool bSigned, DecodedBlock& outTexels)
+{
+    const uint32_t shortCode = ReadBits(block, 0, 2);
+    const uint32_t code      = shortCode < 2 ? shortCode : ReadBits(block, 0, 5);
+    const auto modeIt =
+        std::find_if(s_BC6H_MODES.begin(), s_BC6H_MODES.end(), [&](const BC6HModeInfo& modeInfo) { return modeInfo.Code == code; });
+    if (modeIt == s_BC6H_MODES.end()) return false;
+
+    const auto& modeInfo           = *modeIt;
+    uint32_t bitOffset             = modeInfo.CodeBits;
+    std::array<int32_t, 12> fields = {};
+    for (const auto& [field, firstBit, bitCount] : modeInfo.Layout)
+    {
+        fields[field] |= static_cast<int32_t>(ReadBits(block, bitOffset, bitCount)) << firstBit;
+        bitOffset += bitCount;
+    }
+
+    const uint32_t partition = modeInfo.RegionCount == 2 ? ReadBits(block, bitOffset, 5) : 0;
+    bitOffset += modeInfo.RegionCount == 2 ? 5 : 0;
+
+    // Deltas are always signed and wrap around endpoint precision, endpoints are signed only in signed format.
+    const uint32_t endpointCount        = modeInfo.RegionCount * 2;
+    const bool bTransformed             = modeInfo.DeltaBits.x != 0;
+    std::array<glm::ivec3, 4> endpoints = {};
+    for (uint32_t channel{}; channel < 3; ++channel)
+    {
+        const int32_t base    = fields[channel];
+        endpoints[0][channel] = bSigned ? SignExtend(base, modeInfo.EndpointBits) : base;
+        for (uint32_t endpointIndex = 1; endpointIndex < endpointCount; ++endpointIndex)
+        {
+            int32_t value = fields[endpointIndex * 3 + channel];
+            if (bTransformed) value = (base + SignExtend(value, modeInfo.DeltaBits[channel])) & ((1 << modeInfo.EndpointBits) - 1);
+            endpoints[endpointIndex][channel] = bSigned ? SignExtend(value, modeInfo.EndpointBits) : value;
+        }
+    }
+
+    for (uint32_t endpointIndex{}; endpointIndex < endpointCount; ++endpointIndex)
+        for (uint32_t channel{}; channel < 3; ++channel)
+            endpoints[endpointIndex][channel] = UnquantizeBC6HEndpoint(endpoints[endpointIndex][channel], modeInfo.EndpointBits, bSigned);
+
+    const uint32_t indexBits = modeInfo.RegionCount == 2 ? 3 : 4;
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        const uint32_t texelIndexBits = indexBits - (IsAnchorTexel(modeInfo.RegionCount, partition, texelIndex) ? 1 : 0);
+        const uint32_t index          = ReadBits(block, bitOffset, texelIndexBits);
+        bitOffset += texelIndexBits;
+
+        const uint32_t region = GetPartitionSubset(modeInfo.RegionCount, partition, texelIndex);
+        for (uint32_t channel{}; channel < 3; ++channel)
+        {
+            // Final unquantization into half bits: unsigned scales by 31/64, signed by 31/32 with sign moved into sign bit.
+            const int32_t value = InterpolateBPTC(endpoints[region * 2][channel], endpoints[region * 2 + 1][channel], index, indexBits);
+            const uint16_t halfBits =
+                !bSigned ? static_cast<uint16_t>((value * 31) >> 6)
+                         : static_cast<uint16_t>(value < 0 ? 0x8000 | ((-value * 31) >> 5) : (value * 31) >> 5);
+            outTexels[texelIndex][channel] = glm::unpackHalf1x16(halfBits);
+        }
+    }
+
+    return true;
+}
+
+NODISCARD static bool DecodeBlock(const uint8_t* block, const EImageFormat format, DecodedBlock& outTexels)
+{
+    outTexels.fill(glm::vec4(0.0f));
+    switch (format)
+    {
+        case EImageFormat::FORMAT_BC1_RGB_UNORM:
+        case EImageFormat::FORMAT_BC1_RGBA_UNORM: DecodeColorBlock(block, true, outTexels); return true;
+        case EImageFormat::FORMAT_BC2_UNORM:
+        {
+            DecodeExplicitAlphaBlock(block, outTexels);
+            DecodeColorBlock(block + 8, false, outTexels);
+            return true;
+        }
+        case EImageFormat::FORMAT_BC3_UNORM:
+        {
+            DecodeSingleChannelBlock(block, false, 3, outTexels);
+            DecodeColorBlock(block + 8, false, outTexels);
+            return true;
+        }
+        case EImageFormat::FORMAT_BC4_UNORM:
+        case EImageFormat::FORMAT_BC4_SNORM:
+            DecodeSingleChannelBlock(block, format == EImageFormat::FORMAT_BC4_SNORM, 0, outTexels);
+            return true;
+        case EImageFormat::FORMAT_BC5_UNORM:
+        case EImageFormat::FORMAT_BC5_SNORM:
+        {
+            const bool bSigned = format == EImageFormat::FORMAT_BC5_SNORM;
+            DecodeSingleChannelBlock(block, bSigned, 0, outTexels);
+            DecodeSingleChannelBlock(block + 8, bSigned, 1, outTexels);
+            return true;
+        }
+        case EImageFormat::FORMAT_BC6H_UFLOAT:
+        case EImageFormat::FORMAT_BC6H_SFLOAT: return DecodeBC6HBlock(block, format == EImageFormat::FORMAT_BC6H_SFLOAT, outTexels);
+        case EImageFormat::FORMAT_BC7_UNORM: return DecodeBC7Block(block, outTexels);
+        default: return false;
+    }
+}
+
+// Known-good blocks, every BC7 mode and BC6H mode code. Expected texels(RGBA8, red in the lowest byte) come from an independent decoder
+// (Pillow's BCn one), BC6H ones are clamped to [0, 1] and truncated to 8 bits. Signed BC6H blocks only decode to non-negative values,
+// Pillow mishandles negative ones.
+struct BCnBlockFixture
+{
+    EImageFormat Format;
+    std::array<uint64_t, 2> Block;
+    std::array<uint32_t, s_BLOCK_TEXEL_COUNT> Texels;
+};
+
+static constexpr std::array<BCnBlockFixture, 24> s_BCN_BLOCK_FIXTURES = {
+    BCnBlockFixture{EImageFormat::FORMAT_BC7_UNORM, {0xDDA1494C73CF256D, 0xDB5B5FAB8F4D3E27},
+                    {0xFFDF3FA7, 0xFFE14591, 0xFFFF089C, 0xFF328FDC, 0xFFE35163, 0xFFE24B7B, 0xFFBC34B1, 0xFFDD1EA7,
+                     0xFF394A7B, 0xFF6A6482, 0xFF51577F, 0xFF51577F, 0xFFB68B8D, 0xFF9E7F89, 0xFF9E7F89, 0xFF9E7F89}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC7_UNORM, {0xC7FDE805EC99108E, 0x73AB48767734D7C1},
+                    {0xFF1C234B, 0xFF1C4262, 0xFFD9EAD1, 0xFFDDD8B4, 0xFF1C4262, 0xFF1C7286, 0xFFD9EAD1, 0xFFED8B40,
+                     0xFFF17824, 0xFFED8B40, 0xFF1C627A, 0xFF1C627A, 0xFFE99D5D, 0xFFD5FDED, 0xFF1C536F, 0xFF1C4262}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC7_UNORM, {0xDAE445508201E2BC, 0x309D6B79965EDA32},
+                    {0xFF994271, 0xFFB52139, 0xFF994271, 0xFFB52139, 0xFF6A6D0B, 0xFF6A6D0B, 0xFF994271, 0xFF994271,
+                     0xFF4DC64C, 0xFF3194A5, 0xFFEF9400, 0xFFA83154, 0xFF5ADE21, 0xFF5ADE21, 0xFF295A10, 0xFF8C528C}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC7_UNORM, {0xCDCC69292F45E678, 0x79CB9E86830C71C2},
+                    {0xFFBC72B9, 0xFF18B85E, 0xFFE048F2, 0xFF14B675, 0xFF0DB3A5, 0xFF71C745, 0xFF18B85E, 0xFF71C745,
+                     0xFF14B675, 0xFFBC72B9, 0xFF11B58E, 0xFF71C745, 0xFFE048F2, 0xFF0DB3A5, 0xFF71C745, 0xFF18B85E}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC7_UNORM, {0x9D2C67EDA13FFE70, 0x2FA91425CB008853},
+                    {0xCB7D58FA, 0xCB7D58FA, 0xCB4358FA, 0xC03433FC, 0xC04333FC, 0xB55210FF, 0xD66F7BF7, 0xB56F10FF,
+                     0xCB4358FA, 0xC06133FC, 0xC04333FC, 0xD6437BF7, 0xD6617BF7, 0xCB1858FA, 0xD6527BF7, 0xCB6F58FA}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC7_UNORM, {0x7253EDC6181879A0, 0x244CAF9C4DABB481},
+                    {0xC1B994F3, 0xC1B95CF3, 0xC1B982F3, 0xA1CF6EC3, 0x80E55C90, 0x80E55C90, 0xA1CF6EC3, 0x60FB6E60,
+                     0xA1CF94C3, 0xA1CF5CC3, 0xA1CF94C3, 0x60FB8260, 0x80E59490, 0xA1CF82C3, 0x80E56E90, 0xC1B994F3}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC7_UNORM, {0x89E7D15F17362F40, 0xE3EFF9C0CF44DD3F},
+                    {0x849BA8B7, 0xBC758ABB, 0x31D4D3B3, 0x31D4D3B3, 0xAF7E91BA, 0xAF7E91BA, 0x13E9E3B1, 0x3ECBCCB3,
+                     0xE75773BD, 0x3ECBCCB3, 0x69AEB6B6, 0x13E9E3B1, 0x13E9E3B1, 0x20E0DCB2, 0xBC758ABB, 0x20E0DCB2}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC7_UNORM, {0xA26B7F62B1852F80, 0x986E86CB0AB8AB67},
+                    {0x5149C3A2, 0x6466D398, 0x7785E38D, 0x6466D398, 0x8AA2F382, 0x5D3CBE8E, 0x5D3CBE8E, 0x7785E38D,
+                     0x7785E38D, 0x2CDFAEAE, 0x3CAAB3A4, 0x6466D398, 0x5149C3A2, 0x7785E38D, 0x6466D398, 0x7785E38D}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0x9944B9632AD030D0, 0xF42A29E82EA5C6D5},
+                    {0xFF26331D, 0xFF24341E, 0xFF1F3622, 0xFF22351F, 0xFF313C24, 0xFF343E23, 0xFF253025, 0xFF1F2B26,
+                     0xFF283325, 0xFF2E3924, 0xFF283325, 0xFF2E3924, 0xFF313C24, 0xFF283325, 0xFF222E26, 0xFF2B3625}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0xFBE683AF6E5DC679, 0xA41AA247741A40C1},
+                    {0xFF3A651B, 0xFF487F22, 0xFF5BB32E, 0xFF1D2A0C, 0xFF304B15, 0xFF141707, 0xFF5BB32E, 0xFF487F22,
+                     0xFF3EBC00, 0xFF25370F, 0xFF3A651B, 0xFF1D2A0C, 0xFF3EBC00, 0xFF4CD200, 0xFF3EBC00, 0xFF1D2A0C}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0x84ED40F6D3E666A2, 0x73BC3AAC987CE67A},
+                    {0xFF4BD62D, 0xFF47CF2C, 0xFF4DDB2D, 0xFF48D12C, 0xFF49D42D, 0xFF49D42D, 0xFF49D22D, 0xFF51D92E,
+                     0xFF49D22D, 0xFF4BD62D, 0xFF51DB2C, 0xFF52D533, 0xFF49D22D, 0xFF52D82F, 0xFF52D632, 0xFF51DA2D}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0xB1DA2C1DF193F266, 0xB6AD7A589F37B61C},
+                    {0xFF182576, 0xFF182377, 0xFF182078, 0xFF181F79, 0xFF172B73, 0xFF192974, 0xFF182A73, 0xFF182A74,
+                     0xFF182A74, 0xFF162C72, 0xFF172B73, 0xFF172B72, 0xFF182477, 0xFF182178, 0xFF182178, 0xFF182178}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0xAE5D862F1580720A, 0xC980CAD4BBC1A561},
+                    {0xFF6D1A73, 0xFF6B1976, 0xFF691978, 0xFF6A1977, 0xFF6A1976, 0xFF6B1976, 0xFF6C1974, 0xFF6C1975,
+                     0xFF76196F, 0xFF761970, 0xFF791A72, 0xFF7A1A73, 0xFF761970, 0xFF791A72, 0xFF791A72, 0xFF771971}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0x09B527B5BF73186E, 0x320E5A8988B0CD92},
+                    {0xFF617C1D, 0xFF4C9719, 0xFF5A831B, 0xFF514D24, 0xFF44A117, 0xFF5A831B, 0xFF594C28, 0xFF514D24,
+                     0xFF3EAB16, 0xFF3B521C, 0xFF40511E, 0xFF494F20, 0xFF614A2C, 0xFF514D24, 0xFF37541A, 0xFF614A2C}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0xB0850C8EC935EBF2, 0xE64CAC26934F6221},
+                    {0xFF265A2D, 0xFF276437, 0xFF1B1945, 0xFF1C1B52, 0xFF25491D, 0xFF1A142E, 0xFF1C1B52, 0xFF25491D,
+                     0xFF276437, 0xFF1A142E, 0xFF1B1945, 0xFF287554, 0xFF1A1634, 0xFF1A1634, 0xFF25491D, 0xFF297E67}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0xD79F9AF4CDB5AD56, 0xB47405A22C0BA9ED},
+                    {0xFF3D3B3A, 0xFF2D403C, 0xFF2D403C, 0xFF4B3939, 0xFF6D371A, 0xFF543B19, 0xFF2F4417, 0xFF1B5115,
+                     0xFF543B19, 0xFF8D341A, 0xFF8D341A, 0xFF543B19, 0xFF9C3034, 0xFF2D403C, 0xFF6D3536, 0xFF6D3536}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0xA23F8220EBB6EE9A, 0x5EF04839DA21AB2E},
+                    {0xFF9C508D, 0xFFAD479E, 0xFFC03FB0, 0xFFD13AC2, 0xFFD13AC2, 0xFFA54B95, 0xFFDA38CA, 0xFF9C508D,
+                     0xFF773F3E, 0xFF773F3E, 0xFF3C1740, 0xFF773F3E, 0xFFCA8D3C, 0xFFAC6E3C, 0xFF66313E, 0xFF481C3F}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0x2E1B8ED6B98B03DE, 0xE64F6E4B63B68B9C},
+                    {0xFF7314BF, 0xFF73237C, 0xFF127403, 0xFF002601, 0xFF735846, 0xFF735846, 0xFF731B9C, 0xFF014002,
+                     0xFF735846, 0xFF733F58, 0xFF733F58, 0xFF73733A, 0xFF733269, 0xFF733269, 0xFF7314BF, 0xFF73733A}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0x81AFCC44ECDD2EA3, 0x7B619F2FD7D2DEA6},
+                    {0xFFFF4116, 0xFF18251A, 0xFF031A1D, 0xFF051D1C, 0xFFFF4816, 0xFF051D1C, 0xFF743119, 0xFF051D1C,
+                     0xFF01191D, 0xFFFF4816, 0xFF01191D, 0xFF2D291A, 0xFFFF5115, 0xFFC23418, 0xFF0E211B, 0xFF743119}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0x01AECE0DE5C16987, 0xD9C2BF05D8DBF91E},
+                    {0xFF16332A, 0xFF165D36, 0xFF172B26, 0xFF17181D, 0xFF172122, 0xFF171C1F, 0xFF172F28, 0xFF171C1F,
+                     0xFF163D2E, 0xFF166538, 0xFF17181D, 0xFF172122, 0xFF165334, 0xFF171E20, 0xFF172B26, 0xFF171C1F}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0x155810E5D561E9AB, 0x4B5A153D3F823B61},
+                    {0xFF594692, 0xFF613C9D, 0xFF6837A6, 0xFF5D4097, 0xFF5C4296, 0xFF633AA0, 0xFF6D33AD, 0xFF5D4097,
+                     0xFF6A35A9, 0xFF5D4097, 0xFF5F3E9B, 0xFF5A4494, 0xFF6638A4, 0xFF5F3E9B, 0xFF6837A6, 0xFF5E3E99}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_UFLOAT, {0x75F54B32F59F754F, 0x4ECBC0FA9234E6BC},
+                    {0xFF6E1842, 0xFF6E1842, 0xFF6E1842, 0xFF6E1842, 0xFF6E1842, 0xFF6E1842, 0xFF6E1842, 0xFF6E1842,
+                     0xFF6E1842, 0xFF6E1842, 0xFF6F1842, 0xFF6E1842, 0xFF6E1842, 0xFF6E1842, 0xFF6E1842, 0xFF6E1842}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_SFLOAT, {0x6E2381398438A1E3, 0xBE51CC9E4F7028C6},
+                    {0xFF220365, 0xFF41FF00, 0xFF332B03, 0xFF1F02BA, 0xFF1C00FF, 0xFF301B07, 0xFF56FF00, 0xFF260636,
+                     0xFF4FFF00, 0xFF364002, 0xFF41FF00, 0xFF41FF00, 0xFF1D01FF, 0xFF290A1D, 0xFF4FFF00, 0xFF3DBC00}},
+    BCnBlockFixture{EImageFormat::FORMAT_BC6H_SFLOAT, {0x14023C61AA629B1C, 0xB178E63D1874070D},
+                    {0xFF3F1D4D, 0xFF591074, 0xFF2D1D5D, 0xFF241E78, 0xFF3D1F46, 0xFF511467, 0xFF221F7C, 0xFF2D1D5D,
+                     0xFF48195A, 0xFF55126E, 0xFF2C1D62, 0xFF241E78, 0xFF48195A, 0xFF3F1D4D, 0xFF241E78, 0xFF2A1D66}}};
+
+// Albedo-like content: smooth gradients, hard edged tiles and mild noise, alpha is a ramp with a round cut-out.
+// Width and height aren't multiples of 4 on purpose, so edge blocks get padded.
+NODISCARD static std::vector<uint8_t> GenerateLDRImage(const uint32_t width, const uint32_t height)
+{
+    std::mt19937 rng(width * 31 + height);
+    std::uniform_int_distribution<int32_t> noiseDistribution(-3, 3);
+
+    std::vector<uint8_t> image(static_cast<size_t>(width) * height * 4);
+    for (uint32_t y{}; y < height; ++y)
+    {
+        for (uint32_t x{}; x < width; ++x)
+        {
+            const float u = static_cast<float>(x) / width, v = static_cast<float>(y) / height;
+            glm::vec4 color(u * 200.0f + 30.0f, v * 180.0f + 40.0f, 128.0f + 90.0f * std::sin(u * 9.0f + v * 5.0f), 255.0f * u);
+            if ((x / 24 + y / 24) % 5 == 0) color = glm::vec4(230.0f, 60.0f, 40.0f, color.a);
+            if (glm::distance(glm::vec2(u, v), glm::vec2(0.6f, 0.4f)) < 0.15f) color.a = 0.0f;
+
+            uint8_t* texel = &image[(static_cast<size_t>(y) * width + x) * 4];
+            for (uint32_t channel{}; channel < 4; ++channel)
+                texel[channel] = static_cast<uint8_t>(std::clamp(static_cast<int32_t>(color[channel]) + noiseDistribution(rng), 0, 255));
+        }
+    }
+
+    return image;
+}
+
+// Exponential ramp over 12 stops with tinted channels, red goes negative on the left half for BC6H_SFLOAT.
+NODISCARD static std::vector<float> GenerateHDRImage(const uint32_t width, const uint32_t height)
+{
+    std::vector<float> image(static_cast<size_t>(width) * height * 4);
+    for (uint32_t y{}; y < height; ++y)
+    {
+        for (uint32_t x{}; x < width; ++x)
+        {
+            const float u = static_cast<float>(x) / width, v = static_cast<float>(y) / height;
+            const float luminance = std::exp2((u + v) * 6.0f - 6.0f);
+
+            float* texel = &image[(static_cast<size_t>(y) * width + x) * 4];
+            texel[0]     = luminance * (u < 0.5f ? -1.0f : 1.0f);
+            texel[1]     = luminance * 0.7f;
+            texel[2]     = luminance * (0.3f + v);
+            texel[3]     = 1.0f;
+        }
+    }
+
+    return image;
+}
+
+// Decodes whole image back and returns PSNR over its first channelCount channels, negative if encoder emitted something
+// reference decoder can't read.
+NODISCARD static double ComputePSNR(const std::vector<uint8_t>& image, const std::vector<uint8_t>& compressedImage, const uint32_t width,
+                                    const uint32_t height, const EImageFormat format, const uint32_t channelCount)
+{
+    const uint32_t blockCountX = (width + s_BLOCK_DIM - 1) / s_BLOCK_DIM;
+    const size_t blockSize     = BCnEncoder::GetCompressedSize(format, 1, 1);
+
+    double squaredErrorSum = 0.0;
+    DecodedBlock texels    = {};
+    for (uint32_t y{}; y < height; y += s_BLOCK_DIM)
+    {
+        for (uint32_t x{}; x < width; x += s_BLOCK_DIM)
+        {
+            const size_t blockIndex = static_cast<size_t>(y / s_BLOCK_DIM) * blockCountX + x / s_BLOCK_DIM;
+            if (!DecodeBlock(&compressedImage[blockIndex * blockSize], format, texels)) return -1.0;
+
+            for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+            {
+                const uint32_t texelX = x + texelIndex % s_BLOCK_DIM, texelY = y + texelIndex / s_BLOCK_DIM;
+                if (texelX >= width || texelY >= height) continue;
+
+                const uint8_t* sourceTexel = &image[(static_cast<size_t>(texelY) * width + texelX) * 4];
+                for (uint32_t channel{}; channel < channelCount; ++channel)
+                {
+                    // Punch-through alpha stores transparent texels as black, the rest as opaque.
+                    double sourceValue = sourceTexel[channel];
+                    if (format == EImageFormat::FORMAT_BC1_RGBA_UNORM)
+                        sourceValue = sourceTexel[3] < 128 ? 0.0 : (channel == 3 ? 255.0 : sourceValue);
+
+                    const double error = texels[texelIndex][channel] - sourceValue;
+                    squaredErrorSum += error * error;
+                }
+            }
+        }
+    }
+
+    const double meanSquaredError = squaredErrorSum / (static_cast<double>(width) * height * channelCount);
+    return meanSquaredError > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / meanSquaredError) : std::numeric_limits<double>::infinity();
+}
+
+// HDR counterpart of ComputePSNR(): RMS of error relative to source texel, unsigned format clamps negative source to 0. Negative if
+// encoder emitted something reference decoder can't read.
+NODISCARD static double ComputeRelativeRMSE(const std::vector<float>& image, const std::vector<uint8_t>& compressedImage,
+                                            const uint32_t width, const uint32_t height, const EImageFormat format)
+{
+    const uint32_t blockCountX = (width + s_BLOCK_DIM - 1) / s_BLOCK_DIM;
+    const bool bSigned         = format == EImageFormat::FORMAT_BC6H_SFLOAT;
+
+    double squaredErrorSum = 0.0;
+    DecodedBlock texels    = {};
+    for (uint32_t y{}; y < height; y += s_BLOCK_DIM)
+    {
+        for (uint32_t x{}; x < width; x += s_BLOCK_DIM)
+        {
+            const size_t blockIndex = static_cast<size_t>(y / s_BLOCK_DIM) * blockCountX + x / s_BLOCK_DIM;
+            if (!DecodeBlock(&compressedImage[blockIndex * 16], format, texels)) return -1.0;
+
+            for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+            {
+                const uint32_t texelX = x + texelIndex % s_BLOCK_DIM, texelY = y + texelIndex / s_BLOCK_DIM;
+                if (texelX >= width || texelY >= height) continue;
+
+                for (uint32_t channel{}; channel < 3; ++channel)
+                {
+                    float sourceValue = image[(static_cast<size_t>(texelY) * width + texelX) * 4 + channel];
+                    if (!bSigned) sourceValue = std::max(sourceValue, 0.0f);
+
+                    const double error = (texels[texelIndex][channel] - sourceValue) / (std::abs(sourceValue) + 1e-3);
+                    squaredErrorSum += error * error;
+                }
+            }
+        }
+    }
+
+    return std::sqrt(squaredErrorSum / (static_cast<double>(width) * height * 3));
+}
+
+NODISCARD static const char* GetQualityName(const ETextureCompressionQuality quality)
+{
+    return quality == ETextureCompressionQuality::TEXTURE_COMPRESSION_QUALITY_FAST ? "FAST" : "NORMAL";
+}
+
+}  // namespace TextureBenchmarkUtils
+
+namespace Benchmarks
+{
+
+void RunTextureCompressionBenchmarks(BenchmarkRunner& runner)
+{
+    using namespace TextureBenchmarkUtils;
+
+    for (const auto& [format, block, expectedTexels] : s_BCN_BLOCK_FIXTURES)
+    {
+        DecodedBlock texels = {};
+        if (!DecodeBlock(reinterpret_cast<const uint8_t*>(block.data()), format, texels))
+        {
+            runner.ReportFailure("{} fixture block {:016X}{:016X} reference decoder can't read!", ImageUtils::ImageFormatToString(format),
+                                 block[1], block[0]);
+            continue;
+        }
+
+        // BC6H expectations were truncated from floats, so they may be off by one, and don't carry alpha.
+        const bool bHDR = format != EImageFormat::FORMAT_BC7_UNORM;
+        for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+        {
+            for (uint32_t channel{}; channel < (bHDR ? 3u : 4u); ++channel)
+            {
+                const float value      = texels[texelIndex][channel];
+                const int32_t expected = (expectedTexels[texelIndex] >> (channel * 8)) & 0xFF;
+                const int32_t decoded  = static_cast<int32_t>(bHDR ? glm::clamp(value, 0.0f, 1.0f) * 255.0f : value);
+                if (std::abs(decoded - expected) <= (bHDR ? 1 : 0)) continue;
+
+                runner.ReportFailure("{} fixture block {:016X}{:016X} texel {} channel {} decodes to {}, expected {}!",
+                                     ImageUtils::ImageFormatToString(format), block[1], block[0], texelIndex, channel, decoded, expected);
+            }
+        }
+    }
+
+    // Thresholds sit slightly below what the encoder gives today, they catch broken bitstreams and quality regressions, not pick the
+    // best encoder.
+    constexpr uint32_t s_Width  = 254;
+    constexpr uint32_t s_Height = 130;
+    const auto ldrImage         = GenerateLDRImage(s_Width, s_Height);
+    const auto hdrImage         = GenerateHDRImage(s_Width, s_Height);
+
+    // Format, channels compared, min PSNR(dB) for FAST, NORMAL.
+    constexpr std::array<std::tuple<std::string_view, EImageFormat, uint32_t, std::array<double, 2>>, 8> s_LDRCases = {
+        std::tuple{"BC1", EImageFormat::FORMAT_BC1_RGB_UNORM, 3u, std::array{39.5, 40.5}},
+        std::tuple{"BC1A", EImageFormat::FORMAT_BC1_RGBA_UNORM, 4u, std::array{44.5, 45.5}},
+        std::tuple{"BC2", EImageFormat::FORMAT_BC2_UNORM, 4u, std::array{37.5, 38.0}},
+        std::tuple{"BC3", EImageFormat::FORMAT_BC3_UNORM, 4u, std::array{40.5, 42.0}},
+        std::tuple{"BC4", EImageFormat::FORMAT_BC4_UNORM, 1u, std::array{60.0, 60.0}},
+        std::tuple{"BC4S", EImageFormat::FORMAT_BC4_SNORM, 1u, std::array{58.0, 58.0}},
+        std::tuple{"BC5", EImageFormat::FORMAT_BC5_UNORM, 2u, std::array{58.5, 58.5}},
+        std::tuple{"BC7", EImageFormat::FORMAT_BC7_UNORM, 4u, std::array{41.5, 43.0}}};
+
+    // Format, max relative RMS error for FAST, NORMAL.
+    constexpr std::array<std::tuple<std::string_view, EImageFormat, std::array<double, 2>>, 2> s_HDRCases = {
+        std::tuple{"BC6H", EImageFormat::FORMAT_BC6H_UFLOAT, std::array{0.012, 0.009}},
+        std::tuple{"BC6HS", EImageFormat::FORMAT_BC6H_SFLOAT, std::array{0.018, 0.015}}};
+
+    for (const auto quality :
+         {ETextureCompressionQuality::TEXTURE_COMPRESSION_QUALITY_FAST, ETextureCompressionQuality::TEXTURE_COMPRESSION_QUALITY_NORMAL})
+    {
+        const uint8_t qualityIndex = static_cast<uint8_t>(quality);
+        for (const auto& [formatName, format, channelCount, minPSNRs] : s_LDRCases)
+        {
+            std::vector<uint8_t> compressedImage(BCnEncoder::GetCompressedSize(format, s_Width, s_Height));
+            BCnEncoder::Encode(ldrImage.data(), EImageFormat::FORMAT_RGBA8_UNORM, s_Width, s_Height, compressedImage.data(), format,
+                               quality);
+
+            const double psnr = ComputePSNR(ldrImage, compressedImage, s_Width, s_Height, format, channelCount);
+            if (psnr < 0.0)
+                runner.ReportFailure("{} {} encoded block reference decoder can't read!", formatName, GetQualityName(quality));
+            else if (psnr < minPSNRs[qualityIndex])
+                runner.ReportFailure("{} {} round trip PSNR is {:.2f}dB, expected at least {:.2f}dB!", formatName,
+                                     GetQualityName(quality), psnr, minPSNRs[qualityIndex]);
+
+            runner.Run({.Group             = "TextureCompression",
+                        .Name              = std::format("Encode/{}/{}", formatName, GetQualityName(quality)),
+                        .Iterations        = 10,
+                        .ItemsPerIteration = s_Width * s_Height,
+                        .Counters          = {{"psnr", psnr}}},
+                       [&]
+                       {
+                           BCnEncoder::Encode(ldrImage.data(), EImageFormat::FORMAT_RGBA8_UNORM, s_Width, s_Height, compressedImage.data(),
+                                              format, quality);
+                           DoNotOptimize(compressedImage.front());
+                       });
+        }
+
+        for (const auto& [formatName, format, maxErrors] : s_HDRCases)
+        {
+            std::vector<uint8_t> compressedImage(BCnEncoder::GetCompressedSize(format, s_Width, s_Height));
+            BCnEncoder::Encode(hdrImage.data(), EImageFormat::FORMAT_RGBA32F, s_Width, s_Height, compressedImage.data(), format, quality);
+
+            const double relativeError = ComputeRelativeRMSE(hdrImage, compressedImage, s_Width, s_Height, format);
+            if (relativeError < 0.0)
+                runner.ReportFailure("{} {} encoded block reference decoder can't read!", formatName, GetQualityName(quality));
+            else if (relativeError > maxErrors[qualityIndex])
+                runner.ReportFailure("{} {} round trip relative RMS error is {:.4f}, expected at most {:.4f}!", formatName,
+                                     GetQualityName(quality), relativeError, maxErrors[qualityIndex]);
+
+            runner.Run({.Group             = "TextureCompression",
+                        .Name              = std::format("Encode/{}/{}", formatName, GetQualityName(quality)),
+                        .Iterations        = 10,
+                        .ItemsPerIteration = s_Width * s_Height,
+                        .Counters          = {{"relative_rmse", relativeError}}},
+                       [&]
+                       {
+                           BCnEncoder::Encode(hdrImage.data(), EImageFormat::FORMAT_RGBA32F, s_Width, s_Height, compressedImage.data(),
+                                              format, quality);
+                           DoNotOptimize(compressedImage.front());
+                       });
+        }
+    }
+}
+
+}  // namespace Benchmarks
+
+}  // namespace Pathfinder
@@ -0,0 +1,83 @@
+#include "Benchmark.h"
+
+namespace Pathfinder
+{
+
+namespace Benchmarks
+{
+
+void RunThreadPoolBenchmarks(BenchmarkRunner& runner)
+{
+    constexpr uint32_t s_TaskCount = 10'000;
+    std::atomic<uint64_t> sink{0};
+
+    // Empty-ish tasks, so it's mostly scheduling overhead that gets measured.
+    runner.Run({.Group = "ThreadPool", .Name = "SubmitWait/10k", .ItemsPerIteration = s_TaskCount},
+               [&]
+               {
+                   std::vector<std::shared_future<uint32_t>> futures;
+                   futures.reserve(s_TaskCount);
+                   for (uint32_t i{}; i < s_TaskCount; ++i)
+                       futures.emplace_back(ThreadPool::Submit([](const uint32_t value) { return value * 2u; }, i));
+
+                   for (auto& future : futures)
+                       sink.fetch_add(future.get(), std::memory_order_relaxed);
+               });
+
+    runner.Run({.Group = "ThreadPool", .Name = "DispatchWait/10k", .ItemsPerIteration = s_TaskCount},
+               [&]
+               {
+                   JobCounter counter = {};
+                   for (uint32_t i{}; i < s_TaskCount; ++i)
+                       ThreadPool::Dispatch(counter, [&sink, i] { sink.fetch_add(i, std::memory_order_relaxed); });
+                   counter.Wait();
+               });
+
+    // Task spawning tasks, the way nested ParallelFor inside a job behaves.
+    runner.Run({.Group = "ThreadPool", .Name = "NestedDispatch/64x64", .ItemsPerIteration = 64 * 64},
+               [&]
+               {
+                   JobCounter outerCounter = {};
+                   for (uint32_t i{}; i < 64; ++i)
+                   {
+                       ThreadPool::Dispatch(outerCounter,
+                                            [&sink]
+                                            {
+                                                const auto increment = [&sink] { sink.fetch_add(1, std::memory_order_relaxed); };
+
+                                                JobCounter innerCounter = {};
+                                                for (uint32_t j{}; j < 64; ++j)
+                                                    ThreadPool::Dispatch(innerCounter, increment);
+                                                innerCounter.Wait();
+                                            });
+                   }
+                   outerCounter.Wait();
+               });
+
+    // Fixed amount of arithmetic per element, shows how well work gets spread across workers for various chunk sizes.
+    constexpr uint32_t s_ElementCount = 1'000'000;
+    std::vector<float> elements(s_ElementCount);
+    for (const uint32_t chunkSize : {0u, 64u, 4096u})
+    {
+        const std::string chunkName = chunkSize == 0 ? std::string("Auto") : std::to_string(chunkSize);
+        runner.Run({.Group             = "ThreadPool",
+                    .Name              = "ParallelFor/1M/Chunk" + chunkName,
+                    .ItemsPerIteration = s_ElementCount},
+                   [&]
+                   {
+                       ThreadPool::ParallelFor(s_ElementCount, chunkSize,
+                                               [&elements](const uint32_t i)
+                                               {
+                                                   const float x = static_cast<float>(i) * 0.001f;
+                                                   elements[i]   = std::sqrt(x) * std::sin(x) + std::cos(x * 0.5f);
+                                               });
+                       DoNotOptimize(elements.data());
+                   });
+    }
+
+    DoNotOptimize(sink.load());
+}
+
+}  // namespace Benchmarks
+
+}  // namespace Pathfinder
@@ -231,13 +231,21 @@ static void SaveData(const std::string_view& filePath, const void* data, const i
 
 struct ProfilerTask
 {
-    double StartTime = 0.0;  // Milliseconds
-    double EndTime   = 0.0;  // Milliseconds
-    std::string Tag  = s_DEFAULT_STRING;
+    double StartTime  = 0.0;  // Milliseconds, relative to ProfilerFrame::StartTime
+    double EndTime    = 0.0;  // Milliseconds, relative to ProfilerFrame::StartTime
+    std::string Tag   = s_DEFAULT_STRING;
+    uint32_t ThreadID = 0;  // ThreadPool's thread index, 0 is main thread.
     glm::vec3 Color{1.f};
 
     // Milliseconds
     NODISCARD FORCEINLINE auto GetLength() const { return EndTime - StartTime; }
 };
 
+struct ProfilerFrame
+{
+    std::chrono::steady_clock::time_point StartTime{};
+    uint64_t FrameNumber = 0;
+    std::vector<ProfilerTask> Tasks;
+};
+
 }  // namespace Pathfinder
@@ -1,20 +1,56 @@
 #pragma once
 
-#if _MSC_VER
-#include <softintrin.h>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PFR_X86 1
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define PFR_ARM64 1
 #endif
+
+#if PFR_X86
 #include <immintrin.h>
+#if _MSC_VER
 #include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif PFR_ARM64
+#include <arm_neon.h>
+#endif
 
 #ifndef _XCR_XFEATURE_ENABLED_MASK
 #define _XCR_XFEATURE_ENABLED_MASK 0
 #endif
 
+// NOTE: GCC/Clang won't compile intrinsics above baseline ISA without these, so only such functions get them and callers dispatch
+// on *Supported() at runtime. MSVC compiles any intrinsic as is.
+#if PFR_X86 && !_MSC_VER
+#define PFR_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define PFR_TARGET_AVX2  __attribute__((target("avx2")))
+#else
+#define PFR_TARGET_SSE41
+#define PFR_TARGET_AVX2
+#endif
+
 namespace Pathfinder
 {
 
+FORCEINLINE static bool SSE41Supported()
+{
+#if PFR_X86 && _MSC_VER
+    int cpuInfo[4] = {0};
+    __cpuid(cpuInfo, 1);
+    return cpuInfo[2] & (1 << 19) || false;
+#elif PFR_X86
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.1");
+#else
+    return false;
+#endif
+}
+
 FORCEINLINE static bool AVXSupported()
 {
+#if PFR_X86 && _MSC_VER
     bool bAVXSupported = false;
 
     int cpuInfo[4] = {0};
@@ -30,19 +66,22 @@ FORCEINLINE static bool AVXSupported()
     const auto bCPUAVXSupport = cpuInfo[2] & (1 << 28) || false;
     if (bOSUsesXSAVE_XRSTORE && bCPUAVXSupport)
     {
-        // TODO: Fix on MINGW xgebv
-#if _MSC_VER
         const size_t xcrFeatureMask = _xgetbv(_XCR_XFEATURE_ENABLED_MASK);
         bAVXSupported               = (xcrFeatureMask & 0x6) == 0x6;
-#else
-        return false;
-#endif
     }
     return bAVXSupported;
+#elif PFR_X86
+    // NOTE: libgcc/compiler-rt check OS YMM state(XGETBV) as well, not only CPUID bits.
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx");
+#else
+    return false;
+#endif
 }
 
 static bool AVX2Supported()
 {
+#if PFR_X86 && _MSC_VER
     bool bAVX2Supported = false;
 
     int cpuInfo[4] = {0};
@@ -58,15 +97,26 @@ static bool AVX2Supported()
     const auto bCPUAVX2Support = cpuInfo[1] & (1 << 5) || false;
     if (bOSUsesXSAVE_XRSTORE && bCPUAVX2Support)
     {
-        // TODO: Fix on MINGW xgebv
-#if _MSC_VER
         const size_t xcrFeatureMask = _xgetbv(_XCR_XFEATURE_ENABLED_MASK);
         bAVX2Supported              = (xcrFeatureMask & 0x6) == 0x6;
-#else
-        return false;
-#endif
     }
     return bAVX2Supported;
+#elif PFR_X86
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+// NOTE: Mandatory on AArch64.
+FORCEINLINE static bool NEONSupported()
+{
+#if PFR_ARM64
+    return true;
+#else
+    return false;
+#endif
 }
 
-} // namespace Pathfinder
\ No newline at end of file
+}  // namespace Pathfinder
@@ -35,49 +35,148 @@ static void SetThreadName(std::jthread& thread, const std::string& name)
 #endif
 }
 
+void JobCounter::Wait()
+{
+    while (!IsDone())
+    {
+        // Help draining queues, so waiting thread doesn't stay idle, otherwise sleep until counter changes.
+        if (ThreadPool::TryExecuteTask()) continue;
+
+        const uint32_t counter = m_Counter.load(std::memory_order_acquire);
+        if (counter != 0) m_Counter.wait(counter, std::memory_order_acquire);
+    }
+
+    // Every decrement registered itself before its fetch_sub, so all of them are visible here, the last one is just finishing notify.
+    while (m_ActiveDecrements.load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+}
+
 void ThreadPool::Init()
 {
-    s_Workers.resize(GetNumThreads());
-
-    std::ranges::for_each(s_Workers,
-                          [&](auto& worker)
-                          {
-                              worker =
-                                  std::jthread{[&]()
-                                               {
-                                                   if (s_MainThreadID == std::this_thread::get_id()) return;
-
-                                                   while (true)
-                                                   {
-                                                       std::move_only_function<void()> job;
-                                                       {
-                                                           std::unique_lock<std::mutex> lock(s_QueueMutex);
-                                                           s_Cv.wait(lock, [&] { return !s_JobQueue.empty() || s_bShutdownRequested; });
-                                                           if (s_bShutdownRequested && s_JobQueue.empty()) return;
-
-                                                           job = std::move(s_JobQueue.front());
-                                                           s_JobQueue.pop_front();
-                                                       }
-                                                       job();
-                                                   }
-                                               }};
-
-                              const std::string workerDebugName = "ThreadPool_Worker_";
-                              SetThreadName(worker, workerDebugName);
-                          });
+    s_bShutdownRequested = false;
+    s_MainThreadID       = std::this_thread::get_id();
+    t_ThreadIndex        = 0;
+
+    const uint32_t workerCount = GetNumThreads();
+    s_WorkerQueues.resize(workerCount);
+    for (auto& workerQueue : s_WorkerQueues)
+        workerQueue = MakeUnique<WorkerQueue>();
+
+    s_Workers.resize(workerCount);
+    for (uint8_t workerIndex{}; workerIndex < workerCount; ++workerIndex)
+    {
+        auto& worker = s_Workers[workerIndex];
+        worker       = std::jthread{[workerIndex]() { WorkerLoop(workerIndex + 1); }};
+
+        const std::string workerDebugName = "ThreadPool_Worker_" + std::to_string(workerIndex + 1);
+        SetThreadName(worker, workerDebugName);
+    }
 
     LOG_TRACE("{}", __FUNCTION__);
 }
 
 void ThreadPool::Shutdown()
 {
-    {
-        std::unique_lock lock(s_QueueMutex);
-        s_bShutdownRequested = true;
-    }
-    s_Cv.notify_all();
+    s_bShutdownRequested = true;
+    s_WorkEpoch.fetch_add(1, std::memory_order_release);
+    s_WorkEpoch.notify_all();
+
     s_Workers.clear();
+    s_WorkerQueues.clear();
     LOG_TRACE("{}", __FUNCTION__);
 }
 
-}  // namespace Pathfinder
\ No newline at end of file
+void ThreadPool::PushTask(Task&& task)
+{
+    PFR_ASSERT(!s_WorkerQueues.empty(), "ThreadPool isn't initialized!");
+
+    // Workers push into their own queue to keep produced work local, others distribute it round-robin.
+    const uint32_t queueIndex = t_ThreadIndex != 0 ? t_ThreadIndex - 1
+                                                   : s_NextQueueIndex.fetch_add(1, std::memory_order_relaxed) % s_WorkerQueues.size();
+    {
+        auto& workerQueue = *s_WorkerQueues[queueIndex];
+        std::scoped_lock lock(workerQueue.Mutex);
+        workerQueue.Tasks.emplace_back(std::move(task));
+    }
+
+    s_PendingTaskCount.fetch_add(1, std::memory_order_release);
+    s_WorkEpoch.fetch_add(1, std::memory_order_release);
+    s_WorkEpoch.notify_one();
+}
+
+bool ThreadPool::PopTask(const uint32_t queueIndex, Task& outTask)
+{
+    auto& workerQueue = *s_WorkerQueues[queueIndex];
+    std::scoped_lock lock(workerQueue.Mutex);
+    if (workerQueue.Tasks.empty()) return false;
+
+    outTask = std::move(workerQueue.Tasks.back());
+    workerQueue.Tasks.pop_back();
+    s_PendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool ThreadPool::StealTask(const uint32_t thiefQueueIndex, Task& outTask)
+{
+    const uint32_t queueCount = static_cast<uint32_t>(s_WorkerQueues.size());
+    for (uint32_t i = 1; i <= queueCount; ++i)
+    {
+        auto& victimQueue = *s_WorkerQueues[(thiefQueueIndex + i) % queueCount];
+
+        // NOTE: Don't block on busy victims, just try the next one.
+        std::unique_lock lock(victimQueue.Mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victimQueue.Tasks.empty()) continue;
+
+        outTask = std::move(victimQueue.Tasks.front());
+        victimQueue.Tasks.pop_front();
+        s_PendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    return false;
+}
+
+bool ThreadPool::TryExecuteTask()
+{
+    if (s_WorkerQueues.empty() || s_PendingTaskCount.load(std::memory_order_acquire) == 0) return false;
+
+    Task task = {};
+    const uint32_t queueIndex =
+        t_ThreadIndex != 0 ? t_ThreadIndex - 1 : s_NextQueueIndex.load(std::memory_order_relaxed) % s_WorkerQueues.size();
+    if ((t_ThreadIndex != 0 && PopTask(queueIndex, task)) || StealTask(queueIndex, task))
+    {
+        task();
+        return true;
+    }
+
+    return false;
+}
+
+void ThreadPool::WorkerLoop(const uint8_t threadIndex)
+{
+    t_ThreadIndex             = threadIndex;
+    const uint32_t queueIndex = threadIndex - 1;
+
+    while (true)
+    {
+        // Capture epoch before looking for work, so push that happens in between won't be missed.
+        const uint32_t epoch = s_WorkEpoch.load(std::memory_order_acquire);
+
+        Task task = {};
+        if (PopTask(queueIndex, task) || StealTask(queueIndex, task))
+        {
+            task();
+            continue;
+        }
+
+        if (s_bShutdownRequested.load(std::memory_order_acquire))
+        {
+            if (s_PendingTaskCount.load(std::memory_order_acquire) == 0) return;
+            continue;
+        }
+
+        if (s_PendingTaskCount.load(std::memory_order_acquire) == 0) s_WorkEpoch.wait(epoch, std::memory_order_acquire);
+    }
+}
+
+}  // namespace Pathfinder
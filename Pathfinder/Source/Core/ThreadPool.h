@@ -3,16 +3,131 @@
 #include <Core/Core.h>
 
 #include <thread>
-#include <condition_variable>
+#include <atomic>
+#include <mutex>
 #include <future>
 
 #include <vector>
 #include <functional>
-#include <queue>
+#include <deque>
 
 namespace Pathfinder
 {
 
+// NOTE: Type-erased move-only callable, small callables(lambdas with few captures, packaged_task) are stored inline, so no heap allocation.
+class Task final : private Uncopyable
+{
+  public:
+    static constexpr size_t s_INLINE_STORAGE_SIZE = 64;
+
+    Task() noexcept = default;
+    ~Task() { Reset(); }
+
+    template <typename Func>
+        requires(!std::is_same_v<std::decay_t<Func>, Task> && std::is_invocable_v<std::decay_t<Func>&>)
+    Task(Func&& func)
+    {
+        using FuncType = std::decay_t<Func>;
+        if constexpr (sizeof(FuncType) <= s_INLINE_STORAGE_SIZE && alignof(FuncType) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible_v<FuncType>)
+        {
+            new (m_Storage) FuncType(std::forward<Func>(func));
+            m_VTable = &s_InlineVTable<FuncType>;
+        }
+        else
+        {
+            *reinterpret_cast<FuncType**>(m_Storage) = new FuncType(std::forward<Func>(func));
+            m_VTable                                 = &s_HeapVTable<FuncType>;
+        }
+    }
+
+    Task(Task&& other) noexcept { MoveFrom(other); }
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    FORCEINLINE void operator()() { m_VTable->Invoke(m_Storage); }
+    NODISCARD FORCEINLINE explicit operator bool() const { return m_VTable != nullptr; }
+
+  private:
+    struct VTable
+    {
+        void (*Invoke)(void* storage);
+        void (*Move)(void* dst, void* src);  // Move-constructs into dst and destroys src.
+        void (*Destroy)(void* storage);
+    };
+
+    template <typename FuncType>
+    static constexpr VTable s_InlineVTable = {
+        .Invoke = [](void* storage) { (*std::launder(reinterpret_cast<FuncType*>(storage)))(); },
+        .Move =
+            [](void* dst, void* src)
+        {
+            auto* srcFunc = std::launder(reinterpret_cast<FuncType*>(src));
+            new (dst) FuncType(std::move(*srcFunc));
+            srcFunc->~FuncType();
+        },
+        .Destroy = [](void* storage) { std::launder(reinterpret_cast<FuncType*>(storage))->~FuncType(); }};
+
+    template <typename FuncType>
+    static constexpr VTable s_HeapVTable = {
+        .Invoke  = [](void* storage) { (**reinterpret_cast<FuncType**>(storage))(); },
+        .Move    = [](void* dst, void* src) { *reinterpret_cast<FuncType**>(dst) = *reinterpret_cast<FuncType**>(src); },
+        .Destroy = [](void* storage) { delete *reinterpret_cast<FuncType**>(storage); }};
+
+    alignas(std::max_align_t) std::byte m_Storage[s_INLINE_STORAGE_SIZE];
+    const VTable* m_VTable = nullptr;
+
+    FORCEINLINE void MoveFrom(Task& other) noexcept
+    {
+        if (!other.m_VTable) return;
+
+        m_VTable = other.m_VTable;
+        m_VTable->Move(m_Storage, other.m_Storage);
+        other.m_VTable = nullptr;
+    }
+
+    FORCEINLINE void Reset() noexcept
+    {
+        if (!m_VTable) return;
+
+        m_VTable->Destroy(m_Storage);
+        m_VTable = nullptr;
+    }
+};
+
+// NOTE: Cheap latch-like wait primitive, waiting thread helps executing pending tasks instead of sleeping.
+class JobCounter final : private Uncopyable, private Unmovable
+{
+  public:
+    JobCounter() noexcept = default;
+    ~JobCounter()         = default;
+
+    FORCEINLINE void Add(const uint32_t count = 1) { m_Counter.fetch_add(count, std::memory_order_relaxed); }
+    FORCEINLINE void Decrement()
+    {
+        // NOTE: Counter reaches 0 before notify_all() runs, m_ActiveDecrements keeps Wait() from returning(and owner from destroying
+        // counter living on its stack) until the last decrementing thread is done touching it.
+        m_ActiveDecrements.fetch_add(1, std::memory_order_acq_rel);
+        if (m_Counter.fetch_sub(1, std::memory_order_acq_rel) == 1) m_Counter.notify_all();
+        m_ActiveDecrements.fetch_sub(1, std::memory_order_release);
+    }
+
+    // NOTE: Doesn't mean counter can be destroyed yet, use Wait() for that.
+    NODISCARD FORCEINLINE bool IsDone() const { return m_Counter.load(std::memory_order_acquire) == 0; }
+    void Wait();
+
+  private:
+    std::atomic<uint32_t> m_Counter{0};
+    std::atomic<uint32_t> m_ActiveDecrements{0};
+};
+
 class ThreadPool final : private Uncopyable, private Unmovable
 {
   public:
@@ -20,31 +135,76 @@ class ThreadPool final : private Uncopyable, private Unmovable
     NODISCARD FORCEINLINE static auto Submit(Func&& func, Args&&... args) -> std::shared_future<decltype(func(args...))>
     {
         using ReturnType = decltype(func(args...));
-        std::packaged_task<ReturnType()> task(std::bind(std::forward<Func>(func), std::forward<Args>(args)...));
+        std::packaged_task<ReturnType()> task(
+            [movedFunc = std::forward<Func>(func), ... movedArgs = std::forward<Args>(args)]() mutable -> ReturnType
+            { return std::invoke(movedFunc, movedArgs...); });
         auto future = task.get_future();
+        PushTask(Task([movedTask = std::move(task)]() mutable { movedTask(); }));
+        return future;
+    }
+
+    // Fire-and-forget task tracked by counter, no shared state allocated unlike Submit().
+    template <typename Func> FORCEINLINE static void Dispatch(JobCounter& counter, Func&& func)
+    {
+        counter.Add();
+        PushTask(Task(
+            [&counter, movedFunc = std::forward<Func>(func)]() mutable
+            {
+                movedFunc();
+                counter.Decrement();
+            }));
+    }
+
+    // Splits [0, count) range into chunks of chunkSize(0 means auto) and calls func(index) for each index, blocks until done.
+    template <typename Func> static void ParallelFor(const uint32_t count, const uint32_t chunkSize, Func&& func)
+    {
+        if (count == 0) return;
+
+        const uint32_t actualChunkSize = chunkSize != 0 ? chunkSize : std::max(1u, count / (GetNumThreads() * 4));
+        if (actualChunkSize >= count || s_Workers.empty())
         {
-            std::scoped_lock lock(s_QueueMutex);
-            s_JobQueue.emplace_back([movedTask = std::move(task)]() mutable { movedTask(); });
+            for (uint32_t i{}; i < count; ++i)
+                func(i);
+            return;
         }
-        s_Cv.notify_one();
-        return future;
+
+        JobCounter counter = {};
+        for (uint32_t chunkBegin{}; chunkBegin < count; chunkBegin += actualChunkSize)
+        {
+            const uint32_t chunkEnd = std::min(chunkBegin + actualChunkSize, count);
+            Dispatch(counter,
+                     [&func, chunkBegin, chunkEnd]
+                     {
+                         for (uint32_t i = chunkBegin; i < chunkEnd; ++i)
+                             func(i);
+                     });
+        }
+        counter.Wait();
     }
 
     static void Init();
     static void Shutdown();
 
+    // Pops any pending task and executes it on the calling thread, returns false if there was nothing to do.
+    static bool TryExecuteTask();
+
+    // NOTE: Slot 0 is reserved for the main thread, that's why workers are limited to (s_WORKER_THREAD_COUNT - 1).
     NODISCARD FORCEINLINE static uint32_t GetNumThreads()
     {
-        return std::clamp(std::thread::hardware_concurrency() - 1u, 1u, (uint32_t)s_WORKER_THREAD_COUNT);
+        return std::clamp(std::thread::hardware_concurrency() - 1u, 1u, (uint32_t)s_WORKER_THREAD_COUNT - 1u);
     }
 
+    // NOTE: Returns index of the calling thread: 0 for main thread(and foreign threads), [1, GetNumThreads()] for workers.
+    NODISCARD FORCEINLINE static uint8_t GetThreadIndex() { return t_ThreadIndex; }
+
     // NOTE: Maps thread::id to actual worker index.
     NODISCARD FORCEINLINE static uint8_t MapThreadID(const std::thread::id& threadID)
     {
+        if (threadID == std::this_thread::get_id()) return t_ThreadIndex;
         if (threadID == s_MainThreadID) return 0;
 
         for (uint8_t i{}; i < s_Workers.size(); ++i)
-            if (s_Workers[i].get_id() == threadID) return i;
+            if (s_Workers[i].get_id() == threadID) return i + 1;
 
         return 0;
     }
@@ -52,12 +212,25 @@ class ThreadPool final : private Uncopyable, private Unmovable
     NODISCARD FORCEINLINE static const auto GetMainThreadID() { return s_MainThreadID; }
 
   private:
-    static inline std::condition_variable_any s_Cv;
-    static inline std::mutex s_QueueMutex;
-    static inline std::deque<std::move_only_function<void()>> s_JobQueue;
+    struct WorkerQueue
+    {
+        std::mutex Mutex;
+        std::deque<Task> Tasks;  // Owner pushes/pops back(LIFO), thieves pop front(FIFO).
+    };
+
+    static inline std::vector<Unique<WorkerQueue>> s_WorkerQueues;
     static inline std::vector<std::jthread> s_Workers;
+    static inline std::atomic<uint32_t> s_PendingTaskCount{0};
+    static inline std::atomic<uint32_t> s_WorkEpoch{0};  // Bumped on every push, idle workers sleep on it.
+    static inline std::atomic<uint32_t> s_NextQueueIndex{0};
     static inline std::thread::id s_MainThreadID = std::this_thread::get_id();
-    static inline bool s_bShutdownRequested      = false;
+    static inline std::atomic<bool> s_bShutdownRequested{false};
+    static inline thread_local uint8_t t_ThreadIndex = 0;
+
+    static void PushTask(Task&& task);
+    NODISCARD static bool PopTask(const uint32_t queueIndex, Task& outTask);
+    NODISCARD static bool StealTask(const uint32_t thiefQueueIndex, Task& outTask);
+    static void WorkerLoop(const uint8_t threadIndex);
 
     ThreadPool()  = default;
     ~ThreadPool() = default;
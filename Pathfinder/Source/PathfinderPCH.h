@@ -32,6 +32,7 @@
 #include <unordered_map>
 #include <numeric>
 #include <numbers>
+#include <bit>
 
 #include <compare>
 #include <functional>
@@ -68,8 +68,65 @@ void VulkanAllocator::CreateBuffer(const VkBufferCreateInfo& bufferCI, VkBuffer&
 #endif
 }
 
+void VulkanAllocator::CreateAliasingBuffer(const VkBufferCreateInfo& bufferCI, VkBuffer& buffer, const VmaAllocation& allocation,
+                                           const VkDeviceSize allocationLocalOffset)
+{
+    PFR_ASSERT(allocation, "Can't create aliasing buffer without allocation!");
+    VK_CHECK(vmaCreateAliasingBuffer2(m_Handle, allocation, allocationLocalOffset, &bufferCI, &buffer),
+             "Failed to create aliasing buffer!");
+
+#if VK_LOG_VMA_ALLOCATIONS
+    LOG_DEBUG("[VMA]: Created aliasing buffer with local offset: {} (bytes), size: {:.6f} (MB).", allocationLocalOffset,
+              static_cast<float>(bufferCI.size) / 1024.0f / 1024.0f);
+#endif
+}
+
+void VulkanAllocator::CreateAliasingImage(const VkImageCreateInfo& imageCI, VkImage& image, const VmaAllocation& allocation,
+                                          const VkDeviceSize allocationLocalOffset)
+{
+    PFR_ASSERT(allocation, "Can't create aliasing image without allocation!");
+    VK_CHECK(vmaCreateAliasingImage2(m_Handle, allocation, allocationLocalOffset, &imageCI, &image), "Failed to create aliasing image!");
+
+#if VK_LOG_VMA_ALLOCATIONS
+    LOG_DEBUG("[VMA]: Created aliasing image with local offset: {} (bytes).", allocationLocalOffset);
+#endif
+}
+
+void VulkanAllocator::AllocateMemory(const VkMemoryRequirements& memoryRequirements, VmaAllocation& allocation)
+{
+    const VmaAllocationCreateInfo allocationCI = {.flags         = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT,
+                                                  .usage         = VMA_MEMORY_USAGE_GPU_ONLY,
+                                                  .requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                  .priority      = 1.f};
+
+    VmaAllocationInfo allocationInfo = {};
+    VK_CHECK(vmaAllocateMemory(m_Handle, &memoryRequirements, &allocationCI, &allocation, &allocationInfo), "Failed to allocate memory!");
+    vmaGetHeapBudgets(m_Handle, m_MemoryBudgets.data());
+
+#if VK_LOG_VMA_ALLOCATIONS
+    LOG_DEBUG("[VMA]: Allocated memory with offset: {} (bytes), size: {:.6f} (MB).", allocationInfo.offset,
+              static_cast<float>(allocationInfo.size) / 1024.0f / 1024.0f);
+#endif
+}
+
+void VulkanAllocator::FreeMemory(VmaAllocation& allocation)
+{
+    if (!allocation) return;
+
+    vmaFreeMemory(m_Handle, allocation);
+    allocation = VK_NULL_HANDLE;
+    vmaGetHeapBudgets(m_Handle, m_MemoryBudgets.data());
+}
+
 void VulkanAllocator::DestroyBuffer(VkBuffer& buffer, VmaAllocation& allocation)
 {
+    // NOTE: Aliasing buffer doesn't own allocation, VMA destroys only buffer handle in that case.
+    if (!allocation)
+    {
+        vmaDestroyBuffer(m_Handle, buffer, VK_NULL_HANDLE);
+        return;
+    }
+
     VmaAllocationInfo allocationInfo = {};
     vmaGetAllocationInfo(m_Handle, allocation, &allocationInfo);
 
@@ -84,6 +141,13 @@ void VulkanAllocator::DestroyBuffer(VkBuffer& buffer, VmaAllocation& allocation)
 
 void VulkanAllocator::DestroyImage(VkImage& image, VmaAllocation& allocation)
 {
+    // NOTE: Aliasing image doesn't own allocation, VMA destroys only image handle in that case.
+    if (!allocation)
+    {
+        vmaDestroyImage(m_Handle, image, VK_NULL_HANDLE);
+        return;
+    }
+
     VmaAllocationInfo allocationInfo = {};
     vmaGetAllocationInfo(m_Handle, allocation, &allocationInfo);
 
@@ -17,6 +17,15 @@ class VulkanAllocator final : private Uncopyable, private Unmovable
     void CreateImage(const VkImageCreateInfo& imageCI, VkImage& image, VmaAllocation& allocation,
                      VmaMemoryUsage memoryUsage = VMA_MEMORY_USAGE_GPU_ONLY);
 
+    // NOTE: Aliasing resources are bound to the part of existing allocation, they don't own the memory.
+    void CreateAliasingBuffer(const VkBufferCreateInfo& bufferCI, VkBuffer& buffer, const VmaAllocation& allocation,
+                              const VkDeviceSize allocationLocalOffset);
+    void CreateAliasingImage(const VkImageCreateInfo& imageCI, VkImage& image, const VmaAllocation& allocation,
+                             const VkDeviceSize allocationLocalOffset);
+
+    void AllocateMemory(const VkMemoryRequirements& memoryRequirements, VmaAllocation& allocation);
+    void FreeMemory(VmaAllocation& allocation);
+
     void DestroyBuffer(VkBuffer& buffer, VmaAllocation& allocation);
     void DestroyImage(VkImage& image, VmaAllocation& allocation);
 
@@ -1,11 +1,9 @@
 #include <PathfinderPCH.h>
 #include "VulkanBuffer.h"
 
-#include "VulkanCommandBuffer.h"
 #include "VulkanContext.h"
 #include "VulkanDevice.h"
-
-#include <Renderer/Renderer.h>
+#include "VulkanStagingManager.h"
 
 namespace Pathfinder
 {
@@ -18,19 +16,29 @@ NODISCARD FORCEINLINE bool BufferFlagsContain(const BufferFlags bufferFlags, con
     return (bufferFlags & flag) == flag;
 }
 
+NODISCARD FORCEINLINE static VkBufferCreateInfo GetBufferCreateInfo(const size_t size, const VkBufferUsageFlags bufferUsage)
+{
+    auto& queueFamilyIndices = VulkanContext::Get().GetDevice()->GetQueueFamilyIndices();
+    return VkBufferCreateInfo{.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                              .size                  = size,
+                              .usage                 = bufferUsage,
+                              .sharingMode           = VK_SHARING_MODE_CONCURRENT,
+                              .queueFamilyIndexCount = static_cast<uint32_t>(queueFamilyIndices.size()),
+                              .pQueueFamilyIndices   = queueFamilyIndices.data()};
+}
+
 FORCEINLINE static void CreateBuffer(VkBuffer& buffer, VmaAllocation& allocation, const size_t size, const VkBufferUsageFlags bufferUsage,
-                                     const BufferFlags extraFlags)
+                                     const BufferFlags extraFlags, const MemoryAliasingInfo& aliasingInfo)
 {
-    const auto& device                = VulkanContext::Get().GetDevice();
-    auto& queueFamilyIndices          = device->GetQueueFamilyIndices();
-    const VkBufferCreateInfo bufferCI = {.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-                                         .size                  = size,
-                                         .usage                 = bufferUsage,
-                                         .sharingMode           = VK_SHARING_MODE_CONCURRENT,
-                                         .queueFamilyIndexCount = static_cast<uint32_t>(queueFamilyIndices.size()),
-                                         .pQueueFamilyIndices   = queueFamilyIndices.data()};
-
-    device->GetAllocator()->CreateBuffer(bufferCI, buffer, allocation, extraFlags);
+    const auto bufferCI = GetBufferCreateInfo(size, bufferUsage);
+    if (aliasingInfo.Memory)
+    {
+        VulkanContext::Get().GetDevice()->GetAllocator()->CreateAliasingBuffer(
+            bufferCI, buffer, static_cast<VmaAllocation>(aliasingInfo.Memory), aliasingInfo.Offset);
+        return;
+    }
+
+    VulkanContext::Get().GetDevice()->GetAllocator()->CreateBuffer(bufferCI, buffer, allocation, extraFlags);
 }
 
 NODISCARD FORCEINLINE VkBufferUsageFlags PathfinderBufferUsageToVulkan(const BufferUsageFlags bufferUsage, const BufferFlags extraFlags)
@@ -80,7 +88,8 @@ VulkanBuffer::VulkanBuffer(const BufferSpecification& bufferSpec, const void* da
     if (m_Specification.Capacity > 0)
     {
         const auto bufferUsage = BufferUtils::PathfinderBufferUsageToVulkan(m_Specification.UsageFlags, m_Specification.ExtraFlags);
-        BufferUtils::CreateBuffer(m_Handle, m_Allocation, m_Specification.Capacity, bufferUsage, m_Specification.ExtraFlags);
+        BufferUtils::CreateBuffer(m_Handle, m_Allocation, m_Specification.Capacity, bufferUsage, m_Specification.ExtraFlags,
+                                  m_Specification.AliasingInfo);
         if (BufferUtils::BufferFlagsContain(m_Specification.ExtraFlags, EBufferFlag::BUFFER_FLAG_ADDRESSABLE))
             m_BufferDeviceAddress = MakeOptional<uint64_t>(VulkanContext::Get().GetDevice()->GetBufferDeviceAddress(m_Handle));
 
@@ -91,21 +100,23 @@ VulkanBuffer::VulkanBuffer(const BufferSpecification& bufferSpec, const void* da
 
     if (data && dataSize != 0) SetData(data, dataSize);
 
-    if (!m_Mapped &&
+    // NOTE: Aliasing buffers live in device-local memory block that isn't mappable.
+    if (!m_Mapped && !m_Specification.AliasingInfo.Memory &&
         m_Specification.Capacity > 0 /*&& BufferUtils::BufferFlagsContain(m_Specification.ExtraFlags, EBufferFlag::BUFFER_FLAG_MAPPED)*/)
         m_Mapped = VulkanContext::Get().GetDevice()->GetAllocator()->Map(m_Allocation);
 }
 
-void VulkanBuffer::SetData(const void* data, const size_t dataSize)
+UploadToken VulkanBuffer::SetData(const void* data, const size_t dataSize)
 {
     PFR_ASSERT(data && dataSize > 0, "Data should be valid and size > 0!");
+    PFR_ASSERT(!m_Specification.AliasingInfo.Memory, "Aliasing buffers are GPU-only!");
 
     if (!m_Handle)
     {
         m_Specification.Capacity = m_Specification.Capacity > dataSize ? m_Specification.Capacity : dataSize;
         BufferUtils::CreateBuffer(m_Handle, m_Allocation, m_Specification.Capacity,
                                   BufferUtils::PathfinderBufferUsageToVulkan(m_Specification.UsageFlags, m_Specification.ExtraFlags),
-                                  m_Specification.ExtraFlags);
+                                  m_Specification.ExtraFlags, m_Specification.AliasingInfo);
         if (BufferUtils::BufferFlagsContain(m_Specification.ExtraFlags, EBufferFlag::BUFFER_FLAG_ADDRESSABLE))
             m_BufferDeviceAddress = MakeOptional<uint64_t>(VulkanContext::Get().GetDevice()->GetBufferDeviceAddress(m_Handle));
 
@@ -129,26 +140,11 @@ void VulkanBuffer::SetData(const void* data, const size_t dataSize)
 
         PFR_ASSERT(m_Mapped, "Mapped memory is invalid!");
         memcpy(m_Mapped, data, dataSize);
+        return {};
     }
-    else
-    {
-        const auto& rd   = Renderer::GetRendererData();
-        auto& uploadHeap = rd->UploadHeap.at(rd->FrameIndex);
-        uploadHeap->SetData(data, dataSize);
-
-        const CommandBufferSpecification cbSpec = {.Type       = ECommandBufferType::COMMAND_BUFFER_TYPE_TRANSFER_ASYNC,
-                                                   .Level      = ECommandBufferLevel::COMMAND_BUFFER_LEVEL_PRIMARY,
-                                                   .FrameIndex = rd->FrameIndex,
-                                                   .ThreadID   = ThreadPool::MapThreadID(std::this_thread::get_id())};
-        auto vulkanCommandBuffer                = MakeShared<VulkanCommandBuffer>(cbSpec);
-        vulkanCommandBuffer->BeginRecording(true);
-
-        const VkBufferCopy region = {.srcOffset = 0, .dstOffset = 0, .size = dataSize};
-        vulkanCommandBuffer->CopyBuffer((VkBuffer)uploadHeap->Get(), m_Handle, 1, &region);
-
-        vulkanCommandBuffer->EndRecording();
-        vulkanCommandBuffer->Submit()->Wait();
-    }
+
+    m_LastUpload = VulkanContext::Get().GetStagingManager()->UploadBuffer(m_Handle, data, dataSize);
+    return m_LastUpload;
 }
 
 void VulkanBuffer::Resize(const size_t newBufferCapacity)
@@ -160,7 +156,7 @@ void VulkanBuffer::Resize(const size_t newBufferCapacity)
     m_Specification.Capacity = newBufferCapacity;
     BufferUtils::CreateBuffer(m_Handle, m_Allocation, m_Specification.Capacity,
                               BufferUtils::PathfinderBufferUsageToVulkan(m_Specification.UsageFlags, m_Specification.ExtraFlags),
-                              m_Specification.ExtraFlags);
+                              m_Specification.ExtraFlags, m_Specification.AliasingInfo);
     if (BufferUtils::BufferFlagsContain(m_Specification.ExtraFlags, EBufferFlag::BUFFER_FLAG_ADDRESSABLE))
         m_BufferDeviceAddress = MakeOptional<uint64_t>(VulkanContext::Get().GetDevice()->GetBufferDeviceAddress(m_Handle));
 
@@ -168,10 +164,27 @@ void VulkanBuffer::Resize(const size_t newBufferCapacity)
         VK_SetDebugName(VulkanContext::Get().GetDevice()->GetLogicalDevice(), m_Handle, VK_OBJECT_TYPE_BUFFER,
                         m_Specification.DebugName.data());
 
-    if (m_Specification.Capacity > 0 /*&& BufferUtils::BufferFlagsContain(m_Specification.ExtraFlags, EBufferFlag::BUFFER_FLAG_MAPPED)*/)
+    if (!m_Specification.AliasingInfo.Memory &&
+        m_Specification.Capacity > 0 /*&& BufferUtils::BufferFlagsContain(m_Specification.ExtraFlags, EBufferFlag::BUFFER_FLAG_MAPPED)*/)
         m_Mapped = VulkanContext::Get().GetDevice()->GetAllocator()->Map(m_Allocation);
 }
 
+MemoryRequirements VulkanBuffer::GetMemoryRequirements(const BufferSpecification& bufferSpec)
+{
+    const auto bufferCI = BufferUtils::GetBufferCreateInfo(
+        bufferSpec.Capacity, BufferUtils::PathfinderBufferUsageToVulkan(bufferSpec.UsageFlags, bufferSpec.ExtraFlags));
+
+    const VkDeviceBufferMemoryRequirements deviceBufferMemoryRequirements = {
+        .sType = VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS, .pCreateInfo = &bufferCI};
+    VkMemoryRequirements2 memoryRequirements = {.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+    vkGetDeviceBufferMemoryRequirements(VulkanContext::Get().GetDevice()->GetLogicalDevice(), &deviceBufferMemoryRequirements,
+                                        &memoryRequirements);
+
+    return {.Size           = memoryRequirements.memoryRequirements.size,
+            .Alignment      = memoryRequirements.memoryRequirements.alignment,
+            .MemoryTypeBits = memoryRequirements.memoryRequirements.memoryTypeBits};
+}
+
 void VulkanBuffer::SetDebugName(const std::string& name)
 {
     m_Specification.DebugName = name;
@@ -183,6 +196,10 @@ void VulkanBuffer::Destroy()
 {
     // VulkanContext::Get().GetDevice()->WaitDeviceOnFinish();
 
+    if (const auto& stagingManager = VulkanContext::Get().GetStagingManager(); stagingManager && m_LastUpload.Value != 0)
+        stagingManager->Wait(m_LastUpload);
+    m_LastUpload = {};
+
     if (m_Mapped /* &&  BufferUtils::BufferFlagsContain(m_Specification.ExtraFlags, EBufferFlag::BUFFER_FLAG_MAPPED)*/)
     {
         VulkanContext::Get().GetDevice()->GetAllocator()->Unmap(m_Allocation);
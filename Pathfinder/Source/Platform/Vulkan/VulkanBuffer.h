@@ -20,14 +20,17 @@ class VulkanBuffer final : public Buffer
         return VkDescriptorBufferInfo{.buffer = m_Handle, .offset = 0, .range = m_Specification.Capacity};
     }
 
-    void SetData(const void* data, const size_t dataSize) final override;
+    UploadToken SetData(const void* data, const size_t dataSize) final override;
     void Resize(const size_t newBufferCapacity) final override;
 
+    NODISCARD static MemoryRequirements GetMemoryRequirements(const BufferSpecification& bufferSpec);
+
     void SetDebugName(const std::string& name) final override;
 
   private:
     VkBuffer m_Handle          = VK_NULL_HANDLE;
     VmaAllocation m_Allocation = VK_NULL_HANDLE;
+    UploadToken m_LastUpload   = {};  // Handle can't be destroyed while staged copy into it is pending.
 
     void Destroy() final override;
     VulkanBuffer() = delete;
@@ -7,6 +7,7 @@
 #include "VulkanImage.h"
 #include "VulkanTexture.h"
 #include "VulkanBuffer.h"
+#include "VulkanStagingManager.h"
 
 #include <Renderer/Renderer.h>
 
@@ -217,9 +218,26 @@ void VulkanSyncPoint::Wait() const
 }
 
 VulkanCommandBuffer::VulkanCommandBuffer(const CommandBufferSpecification& commandBufferSpec) : CommandBuffer(commandBufferSpec)
+{
+    VulkanContext::Get().GetDevice()->AllocateCommandBuffer(m_Handle, m_Specification);
+    CreateTimelineSemaphore();
+}
+
+VulkanCommandBuffer::VulkanCommandBuffer(const CommandBufferSpecification& commandBufferSpec, const VkCommandPool& commandPool)
+    : CommandBuffer(commandBufferSpec), m_ExternalCommandPool(commandPool)
+{
+    const VkCommandBufferAllocateInfo cbAI = {.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                              .commandPool        = m_ExternalCommandPool,
+                                              .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                                              .commandBufferCount = 1};
+    VK_CHECK(vkAllocateCommandBuffers(VulkanContext::Get().GetDevice()->GetLogicalDevice(), &cbAI, &m_Handle),
+             "Failed to allocate command buffer!");
+    CreateTimelineSemaphore();
+}
+
+void VulkanCommandBuffer::CreateTimelineSemaphore()
 {
     const auto& context = VulkanContext::Get();
-    context.GetDevice()->AllocateCommandBuffer(m_Handle, m_Specification);
 
     std::string commandBufferTypeStr;
     switch (m_Specification.Type)
@@ -269,19 +287,69 @@ void VulkanCommandBuffer::EndRecording() const
     VK_CHECK(vkEndCommandBuffer(m_Handle), "Failed to end recording command buffer");
 }
 
+void VulkanCommandBuffer::BeginSecondaryRecording(const Optional<RenderingInheritanceInfo>& renderingInheritanceInfo)
+{
+    PFR_ASSERT(m_Specification.Level == ECommandBufferLevel::COMMAND_BUFFER_LEVEL_SECONDARY, "Command buffer isn't secondary!");
+
+    std::vector<VkFormat> colorAttachmentFormats;
+    VkCommandBufferInheritanceRenderingInfo inheritanceRenderingInfo = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO, .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT};
+    VkCommandBufferInheritanceInfo inheritanceInfo  = {.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO};
+    VkCommandBufferBeginInfo commandBufferBeginInfo = {.sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                       .flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                                                       .pInheritanceInfo = &inheritanceInfo};
+    if (renderingInheritanceInfo.has_value())
+    {
+        for (const auto colorFormat : renderingInheritanceInfo->ColorFormats)
+            colorAttachmentFormats.emplace_back(ImageUtils::PathfinderImageFormatToVulkan(colorFormat));
+
+        inheritanceRenderingInfo.colorAttachmentCount    = static_cast<uint32_t>(colorAttachmentFormats.size());
+        inheritanceRenderingInfo.pColorAttachmentFormats = colorAttachmentFormats.data();
+        if (const auto depthFormat = renderingInheritanceInfo->DepthFormat; depthFormat != EImageFormat::FORMAT_UNDEFINED)
+            inheritanceRenderingInfo.depthAttachmentFormat = ImageUtils::PathfinderImageFormatToVulkan(depthFormat);
+
+        inheritanceInfo.pNext = &inheritanceRenderingInfo;
+        commandBufferBeginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    }
+
+    VK_CHECK(vkBeginCommandBuffer(m_Handle, &commandBufferBeginInfo), "Failed to begin secondary command buffer recording!");
+}
+
+void VulkanCommandBuffer::ExecuteSecondaries(const std::vector<Shared<CommandBuffer>>& secondaryCommandBuffers) const
+{
+    if (secondaryCommandBuffers.empty()) return;
+
+    std::vector<VkCommandBuffer> secondaryCommandBuffersVK;
+    secondaryCommandBuffersVK.reserve(secondaryCommandBuffers.size());
+    for (const auto& secondaryCommandBuffer : secondaryCommandBuffers)
+    {
+        PFR_ASSERT(secondaryCommandBuffer->GetSpecification().Level == ECommandBufferLevel::COMMAND_BUFFER_LEVEL_SECONDARY,
+                   "Only secondary command buffers can be executed!");
+        secondaryCommandBuffersVK.emplace_back(static_cast<VkCommandBuffer>(secondaryCommandBuffer->Get()));
+    }
+
+    vkCmdExecuteCommands(m_Handle, static_cast<uint32_t>(secondaryCommandBuffersVK.size()), secondaryCommandBuffersVK.data());
+}
+
 Shared<SyncPoint> VulkanCommandBuffer::Submit(const std::vector<Shared<SyncPoint>>& waitPoints,
                                               const std::vector<Shared<SyncPoint>>& signalPoints, const void* signalFence)
 {
     VkSubmitInfo2 submitInfo2 = {.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2};
     ++m_TimelineSemaphore.Counter;
 
-    std::vector<VkSemaphoreSubmitInfo> waitSemaphoreInfos(waitPoints.size());
-    for (size_t i{}; i < waitPoints.size(); ++i)
+    // NOTE: Batched uploads are flushed before any other submission, so their consumers only wait GPU-side.
+    std::vector<Shared<SyncPoint>> uploadSyncPoints;
+    if (const auto& stagingManager = VulkanContext::Get().GetStagingManager(); stagingManager && !m_ExternalCommandPool)
+        uploadSyncPoints = stagingManager->Flush();
+
+    std::vector<VkSemaphoreSubmitInfo> waitSemaphoreInfos(waitPoints.size() + uploadSyncPoints.size());
+    for (size_t i{}; i < waitSemaphoreInfos.size(); ++i)
     {
+        const auto& waitPoint             = i < waitPoints.size() ? waitPoints[i] : uploadSyncPoints[i - waitPoints.size()];
         waitSemaphoreInfos[i].sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-        waitSemaphoreInfos[i].semaphore   = (VkSemaphore)waitPoints[i]->GetTimelineSemaphore();
-        waitSemaphoreInfos[i].value       = waitPoints[i]->GetValue();
-        waitSemaphoreInfos[i].stageMask   = CommandBufferUtils::PathfinderPipelineStageToVulkan(waitPoints[i]->GetPipelineStages());
+        waitSemaphoreInfos[i].semaphore   = (VkSemaphore)waitPoint->GetTimelineSemaphore();
+        waitSemaphoreInfos[i].value       = waitPoint->GetValue();
+        waitSemaphoreInfos[i].stageMask   = CommandBufferUtils::PathfinderPipelineStageToVulkan(waitPoint->GetPipelineStages());
         waitSemaphoreInfos[i].deviceIndex = 0;
     }
     submitInfo2.pWaitSemaphoreInfos    = waitSemaphoreInfos.data();
@@ -294,9 +362,9 @@ Shared<SyncPoint> VulkanCommandBuffer::Submit(const std::vector<Shared<SyncPoint
     {
         case ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL:
         {
+            // NOTE: Render graph splits frame into several graphics submissions, async queues may consume any of their outputs.
             queue = context.GetDevice()->GetGraphicsQueue();
-            pipelineStages |= EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT | EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT |
-                              EPipelineStage::PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            pipelineStages |= EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT;
             break;
         }
         case ECommandBufferType::COMMAND_BUFFER_TYPE_COMPUTE_ASYNC:
@@ -459,14 +527,13 @@ void VulkanCommandBuffer::TransitionImageLayout(const VkImage& image, const VkIm
 }
 
 void VulkanCommandBuffer::BeginRendering(const std::vector<Shared<Texture>>& attachments,
-                                         const std::vector<RenderingInfo>& renderingInfos) const
+                                         const std::vector<RenderingInfo>& renderingInfos, const bool bSecondaryContents) const
 {
     PFR_ASSERT(!attachments.empty(), "Nothing to render into!");
     PFR_ASSERT(renderingInfos.size() == attachments.size(), "Rendering Infos should equal to attachments count!");
 
     VkRenderingInfo renderingInfo = {.sType = VK_STRUCTURE_TYPE_RENDERING_INFO};
-    if (m_Specification.Level == ECommandBufferLevel::COMMAND_BUFFER_LEVEL_SECONDARY)
-        renderingInfo.flags |= VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT;
+    if (bSecondaryContents) renderingInfo.flags |= VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT;
 
     uint32_t maxLayerCount = 1;
     std::vector<VkRenderingAttachmentInfo> colorAttachments;
@@ -524,8 +591,9 @@ void VulkanCommandBuffer::InsertBarrier(const VkPipelineStageFlags2 srcStageMask
                                         const VkBufferMemoryBarrier2* pBufferMemoryBarriers, const uint32_t imageMemoryBarrierCount,
                                         const VkImageMemoryBarrier2* pImageMemoryBarriers) const
 {
-    Renderer::GetStats().BarrierCount += memoryBarrierCount + bufferMemoryBarrierCount + imageMemoryBarrierCount;
-    ++Renderer::GetStats().BarrierBatchCount;
+    // NOTE: Secondaries are recorded on ThreadPool workers.
+    std::atomic_ref(Renderer::GetStats().BarrierCount).fetch_add(memoryBarrierCount + bufferMemoryBarrierCount + imageMemoryBarrierCount);
+    std::atomic_ref(Renderer::GetStats().BarrierBatchCount).fetch_add(1);
     const VkDependencyInfo dependencyInfo = {.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
                                              .dependencyFlags          = 0,
                                              .memoryBarrierCount       = memoryBarrierCount,
@@ -550,7 +618,10 @@ void VulkanCommandBuffer::Destroy()
     if (!m_Handle) return;
 
     auto& context = VulkanContext::Get();
-    context.GetDevice()->FreeCommandBuffer(m_Handle, m_Specification);
+    if (m_ExternalCommandPool)
+        vkFreeCommandBuffers(context.GetDevice()->GetLogicalDevice(), m_ExternalCommandPool, 1, &m_Handle);
+    else
+        context.GetDevice()->FreeCommandBuffer(m_Handle, m_Specification);
 
     const auto& logicalDevice = context.GetDevice()->GetLogicalDevice();
     vkDestroySemaphore(logicalDevice, m_TimelineSemaphore.Handle, VK_NULL_HANDLE);
@@ -658,8 +729,9 @@ void VulkanCommandBuffer::InsertBarriers(const std::vector<MemoryBarrier>& memor
                                          const std::vector<BufferMemoryBarrier>& bufferMemoryBarriers,
                                          const std::vector<ImageMemoryBarrier>& imageMemoryBarriers) const
 {
-    Renderer::GetStats().BarrierCount += memoryBarriers.size() + bufferMemoryBarriers.size() + imageMemoryBarriers.size();
-    ++Renderer::GetStats().BarrierBatchCount;
+    std::atomic_ref(Renderer::GetStats().BarrierCount)
+        .fetch_add(static_cast<uint32_t>(memoryBarriers.size() + bufferMemoryBarriers.size() + imageMemoryBarriers.size()));
+    std::atomic_ref(Renderer::GetStats().BarrierBatchCount).fetch_add(1);
 
     std::vector<VkMemoryBarrier2> memoryBarriersVK(memoryBarriers.size());
     for (uint32_t i{}; i < memoryBarriers.size(); ++i)
@@ -40,6 +40,8 @@ class VulkanCommandBuffer final : public CommandBuffer
 {
   public:
     explicit VulkanCommandBuffer(const CommandBufferSpecification& commandBufferSpec);
+    // NOTE: Allocated from caller-owned pool(staging batches), such command buffers don't wait on pending uploads in Submit().
+    VulkanCommandBuffer(const CommandBufferSpecification& commandBufferSpec, const VkCommandPool& commandPool);
     ~VulkanCommandBuffer() override { Destroy(); }
 
     NODISCARD FORCEINLINE void* Get() const final override { return m_Handle; }
@@ -79,14 +81,17 @@ class VulkanCommandBuffer final : public CommandBuffer
     void BeginRecording(bool bOneTimeSubmit = false, const void* inheritanceInfo = VK_NULL_HANDLE) final override;
     void EndRecording() const final override;
 
+    void BeginSecondaryRecording(const Optional<RenderingInheritanceInfo>& renderingInheritanceInfo = std::nullopt) final override;
+    void ExecuteSecondaries(const std::vector<Shared<CommandBuffer>>& secondaryCommandBuffers) const final override;
+
     Shared<SyncPoint> Submit(const std::vector<Shared<SyncPoint>>& waitPoints = {}, const std::vector<Shared<SyncPoint>>& signalPoints = {},
                              const void* signalFence = nullptr) final override;
     void TransitionImageLayout(const VkImage& image, const VkImageLayout oldLayout, const VkImageLayout newLayout,
                                const VkImageAspectFlags aspectMask, const uint32_t layerCount, const uint32_t baseLayer,
                                const uint32_t mipLevels, const uint32_t baseMipLevel) const;
 
-    void BeginRendering(const std::vector<Shared<Texture>>& attachments,
-                        const std::vector<RenderingInfo>& renderingInfos) const final override;
+    void BeginRendering(const std::vector<Shared<Texture>>& attachments, const std::vector<RenderingInfo>& renderingInfos,
+                        const bool bSecondaryContents = false) const final override;
     FORCEINLINE void BeginRendering(const VkRenderingInfo* renderingInfo) const { vkCmdBeginRendering(m_Handle, renderingInfo); }
     FORCEINLINE void EndRendering() const final override { vkCmdEndRendering(m_Handle); }
 
@@ -183,7 +188,9 @@ class VulkanCommandBuffer final : public CommandBuffer
         VkSemaphore Handle = VK_NULL_HANDLE;
         uint64_t Counter   = 0;
     } m_TimelineSemaphore;
+    VkCommandPool m_ExternalCommandPool = VK_NULL_HANDLE;
 
+    void CreateTimelineSemaphore();
     void Destroy() final override;
     VulkanCommandBuffer() = delete;
 };
@@ -3,6 +3,7 @@
 
 #include "VulkanDevice.h"
 #include "VulkanAllocator.h"
+#include "VulkanStagingManager.h"
 
 #include <Core/Application.h>
 #include <Core/Window.h>
@@ -17,7 +18,8 @@ VulkanContext::VulkanContext() noexcept
     CreateInstance();
     CreateDebugMessenger();
 
-    m_Device = MakeUnique<VulkanDevice>(m_VulkanInstance);
+    m_Device         = MakeUnique<VulkanDevice>(m_VulkanInstance);
+    m_StagingManager = MakeUnique<VulkanStagingManager>();
     LOG_INFO("{}", __FUNCTION__);
 }
 
@@ -32,6 +34,24 @@ NODISCARD const float VulkanContext::GetTimestampPeriod() const
     return m_Device->GetTimestampPeriod();
 }
 
+NODISCARD Optional<CalibratedTimestamp> VulkanContext::GetCalibratedTimestamp() const
+{
+    return m_Device->GetCalibratedTimestamp();
+}
+
+NODISCARD uint32_t VulkanContext::GetQueueFamilyIndex(const ECommandBufferType commandBufferType) const
+{
+    switch (commandBufferType)
+    {
+        case ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL: return m_Device->GetGraphicsFamily();
+        case ECommandBufferType::COMMAND_BUFFER_TYPE_COMPUTE_ASYNC: return m_Device->GetComputeFamily();
+        case ECommandBufferType::COMMAND_BUFFER_TYPE_TRANSFER_ASYNC: return m_Device->GetTransferFamily();
+    }
+
+    PFR_ASSERT(false, "Unknown command buffer type!");
+    return UINT32_MAX;
+}
+
 void VulkanContext::CreateInstance()
 {
     PFR_ASSERT(volkInitialize() == VK_SUCCESS, "Failed to initialize volk( meta-loader for Vulkan )!");
@@ -209,6 +229,16 @@ void VulkanContext::WaitDeviceOnFinish() const
     m_Device->WaitDeviceOnFinish();
 }
 
+bool VulkanContext::IsUploadComplete(const UploadToken& uploadToken) const
+{
+    return m_StagingManager->IsComplete(uploadToken);
+}
+
+void VulkanContext::WaitForUpload(const UploadToken& uploadToken) const
+{
+    m_StagingManager->Wait(uploadToken);
+}
+
 void VulkanContext::Begin()
 {
     m_Device->ResetCommandPools();
@@ -221,10 +251,29 @@ void VulkanContext::FillMemoryBudgetStats(std::vector<MemoryBudget>& memoryBudge
     m_Device->GetAllocator()->FillMemoryBudgetStats(memoryBudgets);
 }
 
+void* VulkanContext::AllocateMemory(const MemoryRequirements& memoryRequirements)
+{
+    const VkMemoryRequirements vkMemoryRequirements = {.size           = memoryRequirements.Size,
+                                                       .alignment      = memoryRequirements.Alignment,
+                                                       .memoryTypeBits = memoryRequirements.MemoryTypeBits};
+
+    VmaAllocation allocation = VK_NULL_HANDLE;
+    m_Device->GetAllocator()->AllocateMemory(vkMemoryRequirements, allocation);
+    return allocation;
+}
+
+void VulkanContext::FreeMemory(void*& memory)
+{
+    auto allocation = static_cast<VmaAllocation>(memory);
+    m_Device->GetAllocator()->FreeMemory(allocation);
+    memory = nullptr;
+}
+
 void VulkanContext::Destroy()
 {
     m_Device->WaitDeviceOnFinish();
 
+    m_StagingManager.reset();
     m_Device.reset();
 
     if constexpr (VK_FORCE_VALIDATION || s_bEnableValidationLayers)
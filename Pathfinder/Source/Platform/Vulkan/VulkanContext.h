@@ -7,6 +7,7 @@ namespace Pathfinder
 {
 
 class VulkanDevice;
+class VulkanStagingManager;
 
 class VulkanContext final : public GraphicsContext
 {
@@ -21,19 +22,28 @@ class VulkanContext final : public GraphicsContext
     }
 
     NODISCARD const float GetTimestampPeriod() const final override;
+    NODISCARD Optional<CalibratedTimestamp> GetCalibratedTimestamp() const final override;
+    NODISCARD uint32_t GetQueueFamilyIndex(const ECommandBufferType commandBufferType) const final override;
     FORCEINLINE const auto& GetDevice() const { return m_Device; }
     FORCEINLINE const auto& GetInstance() const { return m_VulkanInstance; }
+    FORCEINLINE const auto& GetStagingManager() const { return m_StagingManager; }
+
+    NODISCARD bool IsUploadComplete(const UploadToken& uploadToken) const final override;
+    void WaitForUpload(const UploadToken& uploadToken) const final override;
 
   private:
     VkInstance m_VulkanInstance               = VK_NULL_HANDLE;
     VkDebugUtilsMessengerEXT m_DebugMessenger = VK_NULL_HANDLE;
 
     Unique<VulkanDevice> m_Device;
+    Unique<VulkanStagingManager> m_StagingManager;
 
     void WaitDeviceOnFinish() const final override;
     void Begin() final override;
     void End() final override;
     void FillMemoryBudgetStats(std::vector<MemoryBudget>& memoryBudgets) final override;
+    NODISCARD void* AllocateMemory(const MemoryRequirements& memoryRequirements) final override;
+    void FreeMemory(void*& memory) final override;
 
     void Destroy() final override;
     void CreateInstance();
@@ -114,6 +114,23 @@ void VulkanDescriptorManager::LoadTexture(const void* pTextureInfo, Optional<uin
                            nullptr);
 }
 
+void VulkanDescriptorManager::UpdateTexture(const void* pTextureInfo, const uint32_t textureIndex, const uint8_t frameIndex)
+{
+    const VkDescriptorImageInfo* vkTextureInfo = (const VkDescriptorImageInfo*)pTextureInfo;
+    PFR_ASSERT(pTextureInfo && vkTextureInfo->imageView, "VulkanDescriptorManager: Texture(Image) for updating is not valid!");
+    PFR_ASSERT(frameIndex < s_FRAMES_IN_FLIGHT, "VulkanDescriptorManager: Invalid frame index!");
+
+    std::scoped_lock lock(m_UploadMutex);
+    const VkWriteDescriptorSet writeSet = {.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                                           .dstSet          = m_MegaSet.at(frameIndex),
+                                           .dstBinding      = TEXTURE_BINDING,
+                                           .dstArrayElement = textureIndex,
+                                           .descriptorCount = 1,
+                                           .descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                           .pImageInfo      = vkTextureInfo};
+    vkUpdateDescriptorSets(VulkanContext::Get().GetDevice()->GetLogicalDevice(), 1, &writeSet, 0, nullptr);
+}
+
 void VulkanDescriptorManager::CreateDescriptorPools()
 {
     const auto& logicalDevice = VulkanContext::Get().GetDevice()->GetLogicalDevice();
@@ -18,6 +18,7 @@ class VulkanDescriptorManager final : public DescriptorManager
 
     void LoadImage(const void* pImageInfo, Optional<uint32_t>& outIndex) final override;
     void LoadTexture(const void* pTextureInfo, Optional<uint32_t>& outIndex) final override;
+    void UpdateTexture(const void* pTextureInfo, const uint32_t textureIndex, const uint8_t frameIndex) final override;
 
     FORCEINLINE void FreeImage(Optional<uint32_t>& imageIndex) final override
     {
@@ -44,6 +44,62 @@ NODISCARD FORCEINLINE static const char* GetDeviceTypeCString(const VkPhysicalDe
     return nullptr;
 }
 
+#if PFR_WINDOWS
+static constexpr VkTimeDomainEXT s_HostTimeDomain = VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_EXT;
+#else
+static constexpr VkTimeDomainEXT s_HostTimeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+#endif
+
+// NOTE: std::chrono::steady_clock is built on top of the same clock(QPC on MSVC, CLOCK_MONOTONIC on libstdc++/libc++).
+NODISCARD FORCEINLINE static std::chrono::steady_clock::time_point HostTimestampToSteadyClock(const uint64_t hostTimestamp)
+{
+#if PFR_WINDOWS
+    static const uint64_t s_QPCFrequency = []
+    {
+        LARGE_INTEGER frequency = {};
+        QueryPerformanceFrequency(&frequency);
+        return static_cast<uint64_t>(frequency.QuadPart);
+    }();
+
+    // Same split as MSVC's steady_clock::now() to avoid overflow.
+    const uint64_t nanoseconds =
+        hostTimestamp / s_QPCFrequency * 1000000000ULL + hostTimestamp % s_QPCFrequency * 1000000000ULL / s_QPCFrequency;
+#else
+    const uint64_t nanoseconds = hostTimestamp;
+#endif
+
+    return std::chrono::steady_clock::time_point(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(nanoseconds)));
+}
+
+NODISCARD static bool IsDeviceExtensionSupported(const VkPhysicalDevice& physicalDevice, const char* extensionName)
+{
+    uint32_t extensionCount = 0;
+    VK_CHECK(vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, nullptr),
+             "Failed to retrieve available device extensions!");
+
+    std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+    VK_CHECK(vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, availableExtensions.data()),
+             "Failed to retrieve available device extensions!");
+
+    return std::ranges::any_of(availableExtensions, [&](const VkExtensionProperties& availableExt)
+                               { return strcmp(extensionName, availableExt.extensionName) == 0; });
+}
+
+NODISCARD static bool AreTimeDomainsCalibrateable(const VkPhysicalDevice& physicalDevice)
+{
+    uint32_t timeDomainCount = 0;
+    VK_CHECK(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, &timeDomainCount, nullptr),
+             "Failed to retrieve calibrateable time domains!");
+
+    std::vector<VkTimeDomainEXT> timeDomains(timeDomainCount);
+    VK_CHECK(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, &timeDomainCount, timeDomains.data()),
+             "Failed to retrieve calibrateable time domains!");
+
+    return std::ranges::find(timeDomains, VK_TIME_DOMAIN_DEVICE_EXT) != timeDomains.end() &&
+           std::ranges::find(timeDomains, s_HostTimeDomain) != timeDomains.end();
+}
+
 struct QueueFamilyIndices
 {
     FORCEINLINE bool IsComplete() const
@@ -576,6 +632,25 @@ NODISCARD bool VulkanDevice::IsDepthStencilFormatSupported(const EImageFormat im
                      ImageUtils::PathfinderImageFormatToVulkan(imageFormat)) != m_SupportedDepthStencilFormats.end();
 }
 
+NODISCARD Optional<CalibratedTimestamp> VulkanDevice::GetCalibratedTimestamp() const
+{
+    if (!m_bCalibratedTimestampsSupported) return std::nullopt;
+
+    std::array<VkCalibratedTimestampInfoEXT, 2> timestampInfos = {};
+    for (auto& timestampInfo : timestampInfos)
+        timestampInfo.sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+    timestampInfos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+    timestampInfos[1].timeDomain = DeviceUtils::s_HostTimeDomain;
+
+    std::array<uint64_t, 2> timestamps = {};
+    uint64_t maxDeviation              = 0;
+    VK_CHECK(vkGetCalibratedTimestampsEXT(m_LogicalDevice, static_cast<uint32_t>(timestampInfos.size()), timestampInfos.data(),
+                                          timestamps.data(), &maxDeviation),
+             "Failed to get calibrated timestamps!");
+
+    return CalibratedTimestamp{.DeviceTicks = timestamps[0], .HostTime = DeviceUtils::HostTimestampToSteadyClock(timestamps[1])};
+}
+
 void VulkanDevice::ChooseBestPhysicalDevice(const VkInstance& instance)
 {
     uint32_t GPUsCount = 0;
@@ -731,8 +806,15 @@ void VulkanDevice::CreateLogicalDevice()
     *ppNext = &pageableDeviceLocalMemoryFeaturesEXT;
     ppNext  = &pageableDeviceLocalMemoryFeaturesEXT.pNext;
 
-    deviceCI.enabledExtensionCount   = static_cast<uint32_t>(s_DeviceExtensions.size());
-    deviceCI.ppEnabledExtensionNames = s_DeviceExtensions.data();
+    // NOTE: Optional, used to align GPU profiler timestamps with CPU ones.
+    std::vector<const char*> enabledExtensions = s_DeviceExtensions;
+    m_bCalibratedTimestampsSupported =
+        DeviceUtils::IsDeviceExtensionSupported(m_PhysicalDevice, VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME) &&
+        DeviceUtils::AreTimeDomainsCalibrateable(m_PhysicalDevice);
+    if (m_bCalibratedTimestampsSupported) enabledExtensions.emplace_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+
+    deviceCI.enabledExtensionCount   = static_cast<uint32_t>(enabledExtensions.size());
+    deviceCI.ppEnabledExtensionNames = enabledExtensions.data();
     VK_CHECK(vkCreateDevice(m_PhysicalDevice, &deviceCI, nullptr, &m_LogicalDevice), "Failed to create vulkan logical device && queues!");
     volkLoadDevice(m_LogicalDevice);
 
@@ -753,7 +835,7 @@ void VulkanDevice::CreateLogicalDevice()
 
 #if PFR_DEBUG
     LOG_TRACE("Enabled device extensions:");
-    for (const auto& ext : s_DeviceExtensions)
+    for (const auto& ext : enabledExtensions)
         LOG_TRACE("  {}", ext);
 #endif
 }
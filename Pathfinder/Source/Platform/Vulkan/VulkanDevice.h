@@ -69,6 +69,7 @@ class VulkanDevice final : private Uncopyable, private Unmovable
     NODISCARD FORCEINLINE const auto& GetQueueFamilyIndices() const { return m_QueueFamilyIndices; }
 
     NODISCARD bool IsDepthStencilFormatSupported(const EImageFormat imageFormat) const;
+    NODISCARD Optional<CalibratedTimestamp> GetCalibratedTimestamp() const;
 
   private:
     std::vector<VkFormat> m_SupportedDepthStencilFormats;
@@ -96,6 +97,8 @@ class VulkanDevice final : private Uncopyable, private Unmovable
     float m_TimestampPeriod      = 1.f;
     float m_MaxSamplerAnisotropy = 0.f;
 
+    bool m_bCalibratedTimestampsSupported = false;  // VK_EXT_calibrated_timestamps is optional, device and host domains are required.
+
     uint32_t m_VendorID                       = 0;
     uint32_t m_DeviceID                       = 0;
     uint8_t m_PipelineCacheUUID[VK_UUID_SIZE] = {0};
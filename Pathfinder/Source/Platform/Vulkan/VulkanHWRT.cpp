@@ -19,6 +19,25 @@ std::vector<AccelerationStructure> VulkanRayTracingBuilder::BuildBLASesImpl(cons
     const auto& context = VulkanContext::Get();
     const auto& device  = context.GetDevice();
 
+    // NOTE: Positions are quantized within submesh bounds, BLAS builds dequantize them through per-geometry transform.
+    std::vector<VkTransformMatrixKHR> dequantizeTransforms;
+    for (auto& mesh : meshes)
+    {
+        for (auto& submesh : mesh->GetSubmeshes())
+        {
+            const auto& center = submesh->GetPositionCenter();
+            const auto& extent = submesh->GetPositionExtent();
+            dequantizeTransforms.emplace_back(VkTransformMatrixKHR{
+                .matrix = {{extent.x, 0.f, 0.f, center.x}, {0.f, extent.y, 0.f, center.y}, {0.f, 0.f, extent.z, center.z}}});
+        }
+    }
+
+    const BufferSpecification tbSpec = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
+                                        .UsageFlags = EBufferUsage::BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY |
+                                                      EBufferUsage::BUFFER_USAGE_TRANSFER_DESTINATION};
+    auto dequantizeTransformsBuffer  = Buffer::Create(tbSpec, dequantizeTransforms.data(),
+                                                      dequantizeTransforms.size() * sizeof(dequantizeTransforms[0]));
+
     std::vector<BLASInput> blasInput;
     for (auto& mesh : meshes)
     {
@@ -30,14 +49,15 @@ std::vector<AccelerationStructure> VulkanRayTracingBuilder::BuildBLASesImpl(cons
 
             VkAccelerationStructureGeometryTrianglesDataKHR triangles = {
                 VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR};
-            triangles.vertexFormat             = VK_FORMAT_R32G32B32_SFLOAT;
+            triangles.vertexFormat             = VK_FORMAT_R16G16B16A16_SNORM;
             triangles.vertexData.deviceAddress = vertexBufferAddress;
-            triangles.vertexStride             = sizeof(MeshPositionVertex);
-            triangles.maxVertex =
-                static_cast<uint32_t>(submesh->GetVertexPositionBuffer()->GetSpecification().Capacity / sizeof(MeshPositionVertex) - 1);
-            triangles.indexType                   = VK_INDEX_TYPE_UINT32;
-            triangles.indexData.deviceAddress     = indexBufferAddress;
-            triangles.transformData.deviceAddress = 0;
+            triangles.vertexStride             = sizeof(MeshQuantizedPositionVertex);
+            triangles.maxVertex                = static_cast<uint32_t>(
+                submesh->GetVertexPositionBuffer()->GetSpecification().Capacity / sizeof(MeshQuantizedPositionVertex) - 1);
+            triangles.indexType               = VK_INDEX_TYPE_UINT32;
+            triangles.indexData.deviceAddress = indexBufferAddress;
+            triangles.transformData.deviceAddress =
+                dequantizeTransformsBuffer->GetBDA() + (blasInput.size() - 1) * sizeof(VkTransformMatrixKHR);
 
             VkAccelerationStructureGeometryKHR geometry = {VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR};
             geometry.geometry.triangles                 = triangles;
@@ -135,6 +155,14 @@ std::vector<AccelerationStructure> VulkanRayTracingBuilder::BuildBLASesImpl(cons
             auto vkCmdBuf = MakeShared<VulkanCommandBuffer>(cbSpec);
             vkCmdBuf->BeginRecording(true);
 
+            // Make sure dequantize transforms are copied before builds read them.
+            VkMemoryBarrier transformsBarrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+            transformsBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            transformsBarrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+            vkCmdPipelineBarrier((VkCommandBuffer)vkCmdBuf->Get(), VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR, 0, 1, &transformsBarrier, 0, nullptr, 0, nullptr);
+            ++Renderer::GetStats().BarrierCount;
+
             //  VkCommandBuffer cmdBuf = m_cmdPool.createCommandBuffer();
             //    cmdCreateBlas(cmdBuf, indices, buildAs, scratchAddress, queryPool);
             {
@@ -5,6 +5,7 @@
 #include "VulkanDevice.h"
 #include "VulkanCommandBuffer.h"
 #include "VulkanBuffer.h"
+#include "VulkanStagingManager.h"
 
 #include <Core/Application.h>
 #include <Core/Window.h>
@@ -127,25 +128,33 @@ NODISCARD VkFormat PathfinderImageFormatToVulkan(const EImageFormat imageFormat)
 }
 
 // NOTE: VK_IMAGE_TILING_LINEAR should never be used and will never be faster.
+VkImageCreateInfo GetImageCreateInfo(const VkFormat format, const VkImageUsageFlags imageUsage, const VkExtent3D& extent,
+                                     const VkImageType imageType, const uint32_t mipLevels, const uint32_t layerCount,
+                                     const VkImageLayout initialLayout, const VkImageTiling imageTiling,
+                                     const VkSampleCountFlagBits samples)
+{
+    const VkImageCreateFlags imageCreateFlags = layerCount == 6 ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
+    return VkImageCreateInfo{
+        .sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .flags         = imageCreateFlags,
+        .imageType     = imageType,
+        .format        = format,
+        .extent        = extent,
+        .mipLevels     = mipLevels,
+        .arrayLayers   = layerCount,
+        .samples       = samples,
+        .tiling        = imageTiling,
+        .usage         = imageUsage,
+        .sharingMode   = VK_SHARING_MODE_EXCLUSIVE,  // NOTE: Images are heavily affected by sharing mode, but buffers aren't.
+        .initialLayout = initialLayout};
+}
+
 void CreateImage(VkImage& outImage, VmaAllocation& outAllocation, const VkFormat format, const VkImageUsageFlags imageUsage,
                  const VkExtent3D& extent, const VkImageType imageType, const uint32_t mipLevels, const uint32_t layerCount,
                  const VkImageLayout initialLayout, const VkImageTiling imageTiling, const VkSampleCountFlagBits samples)
 {
-    const VkImageCreateFlags imageCreateFlags = layerCount == 6 ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
-    const VkImageCreateInfo imageCI           = {
-                  .sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                  .flags         = imageCreateFlags,
-                  .imageType     = imageType,
-                  .format        = format,
-                  .extent        = extent,
-                  .mipLevels     = mipLevels,
-                  .arrayLayers   = layerCount,
-                  .samples       = samples,
-                  .tiling        = imageTiling,
-                  .usage         = imageUsage,
-                  .sharingMode   = VK_SHARING_MODE_EXCLUSIVE,  // NOTE: Images are heavily affected by sharing mode, but buffers aren't.
-                  .initialLayout = initialLayout};
-
+    const auto imageCI =
+        GetImageCreateInfo(format, imageUsage, extent, imageType, mipLevels, layerCount, initialLayout, imageTiling, samples);
     VulkanContext::Get().GetDevice()->GetAllocator()->CreateImage(imageCI, outImage, outAllocation);
 }
 
@@ -221,13 +230,6 @@ void VulkanImage::SetLayout(const EImageLayout newLayout, const bool bImmediate)
 {
     if (bImmediate)
     {
-        const CommandBufferSpecification cbSpec = {.Type       = ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL,
-                                                   .Level      = ECommandBufferLevel::COMMAND_BUFFER_LEVEL_PRIMARY,
-                                                   .FrameIndex = Renderer::GetRendererData()->FrameIndex,
-                                                   .ThreadID   = ThreadPool::MapThreadID(std::this_thread::get_id())};
-        auto vulkanCommandBuffer                = MakeShared<VulkanCommandBuffer>(cbSpec);
-        vulkanCommandBuffer->BeginRecording(true);
-
         VkImageAspectFlags imageAspectMask = VK_IMAGE_ASPECT_NONE;
         if (ImageUtils::IsStencilFormat(m_Specification.Format)) imageAspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
         if (ImageUtils::IsDepthFormat(m_Specification.Format))
@@ -235,64 +237,64 @@ void VulkanImage::SetLayout(const EImageLayout newLayout, const bool bImmediate)
         else
             imageAspectMask |= VK_IMAGE_ASPECT_COLOR_BIT;
 
-        vulkanCommandBuffer->TransitionImageLayout(m_Handle, ImageUtils::PathfinderImageLayoutToVulkan(m_Specification.Layout),
-                                                   ImageUtils::PathfinderImageLayoutToVulkan(newLayout), imageAspectMask,
-                                                   m_Specification.Layers, 0, m_Specification.Mips, 0);
-
-        vulkanCommandBuffer->EndRecording();
-        vulkanCommandBuffer->Submit()->Wait();
+        // NOTE: Recorded into staging batch, which is submitted before any command buffer that might use the image.
+        const auto oldLayout = ImageUtils::PathfinderImageLayoutToVulkan(m_Specification.Layout);
+        RecordStaged(
+            [&](const VulkanCommandBuffer& commandBuffer)
+            {
+                commandBuffer.TransitionImageLayout(m_Handle, oldLayout, ImageUtils::PathfinderImageLayoutToVulkan(newLayout),
+                                                    imageAspectMask, m_Specification.Layers, 0, m_Specification.Mips, 0);
+            });
     }
 
     m_Specification.Layout = newLayout;
 }
 
-void VulkanImage::SetData(const void* data, size_t dataSize)
+UploadToken VulkanImage::SetData(const void* data, size_t dataSize, const uint32_t mipCount)
 {
+    PFR_ASSERT(mipCount > 0 && mipCount <= m_Specification.Mips, "Invalid mip count to upload!");
     SetLayout(EImageLayout::IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
 
-    const auto& rd = Renderer::GetRendererData();
-    rd->UploadHeap[rd->FrameIndex]->SetData(data, dataSize);
-
-    VkBufferImageCopy copyRegion               = {};
-    copyRegion.imageExtent                     = {m_Specification.Width, m_Specification.Height, 1};
-    copyRegion.imageSubresource.mipLevel       = 0;  // which mip we do fill
-    copyRegion.imageSubresource.baseArrayLayer = 0;  // which layer we do fill
-    copyRegion.imageSubresource.layerCount     = m_Specification.Layers;
-
     VkImageAspectFlags imageAspectMask = VK_IMAGE_ASPECT_NONE;
     if (ImageUtils::IsStencilFormat(m_Specification.Format)) imageAspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
     if (ImageUtils::IsDepthFormat(m_Specification.Format))
         imageAspectMask |= VK_IMAGE_ASPECT_DEPTH_BIT;
     else
         imageAspectMask |= VK_IMAGE_ASPECT_COLOR_BIT;
-    copyRegion.imageSubresource.aspectMask = imageAspectMask;
 
-#if TODO
-    if (auto commandBuffer = rd->CurrentTransferCommandBuffer.lock())
+    // NOTE: Block size is derived from data, every mip holds all layers, mips go one after another.
+    const uint32_t blockHeight  = ImageUtils::IsBCFormat(m_Specification.Format) ? 4 : 1;
+    const auto getMipBlockCount = [&](const uint32_t mip)
     {
-        auto vulkanCommandBuffer = std::static_pointer_cast<VulkanCommandBuffer>(commandBuffer);
-        PFR_ASSERT(vulkanCommandBuffer, "Failed to cast CommandBuffer to VulkanCommandBuffer!");
+        const uint64_t blocksX = (std::max(m_Specification.Width >> mip, 1u) + blockHeight - 1) / blockHeight;
+        const uint64_t blocksY = (std::max(m_Specification.Height >> mip, 1u) + blockHeight - 1) / blockHeight;
+        return blocksX * blocksY * m_Specification.Layers;
+    };
 
-        vulkanCommandBuffer->CopyBufferToImage((VkBuffer)rd->UploadHeap[rd->FrameIndex]->Get(), m_Handle,
-                                               ImageUtils::PathfinderImageLayoutToVulkan(m_Specification.Layout), 1, &copyRegion);
-    }
-    else
-#endif
+    uint64_t totalBlockCount = 0;
+    for (uint32_t mip{}; mip < mipCount; ++mip)
+        totalBlockCount += getMipBlockCount(mip);
+    PFR_ASSERT(dataSize % totalBlockCount == 0, "Image data doesn't match its mip chain!");
+    const uint64_t blockSize = dataSize / totalBlockCount;
+
+    uint64_t mipOffset = 0;
+    for (uint32_t mip{}; mip < mipCount; ++mip)
     {
-        const CommandBufferSpecification cbSpec = {
-            .Type       = ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL /*COMMAND_BUFFER_TYPE_TRANSFER_ASYNC*/,
-            .Level      = ECommandBufferLevel::COMMAND_BUFFER_LEVEL_PRIMARY,
-            .FrameIndex = Renderer::GetRendererData()->FrameIndex,
-            .ThreadID   = ThreadPool::MapThreadID(std::this_thread::get_id())};
-        auto vulkanCommandBuffer = MakeShared<VulkanCommandBuffer>(cbSpec);
-        vulkanCommandBuffer->BeginRecording(true);
-
-        vulkanCommandBuffer->CopyBufferToImage((VkBuffer)rd->UploadHeap[rd->FrameIndex]->Get(), m_Handle,
-                                               ImageUtils::PathfinderImageLayoutToVulkan(m_Specification.Layout), 1, &copyRegion);
-
-        vulkanCommandBuffer->EndRecording();
-        vulkanCommandBuffer->Submit()->Wait();
+        const uint64_t mipSize = getMipBlockCount(mip) * blockSize;
+        m_LastUpload           = VulkanContext::Get().GetStagingManager()->UploadImage(
+            m_Handle, imageAspectMask, static_cast<const uint8_t*>(data) + mipOffset, mipSize,
+            {std::max(m_Specification.Width >> mip, 1u), std::max(m_Specification.Height >> mip, 1u)}, m_Specification.Layers, blockHeight,
+            mip);
+        mipOffset += mipSize;
     }
+
+    return m_LastUpload;
+}
+
+UploadToken VulkanImage::RecordStaged(const std::function<void(const VulkanCommandBuffer&)>& recordFunc)
+{
+    m_LastUpload = VulkanContext::Get().GetStagingManager()->Record(EStagingQueue::STAGING_QUEUE_GRAPHICS, recordFunc);
+    return m_LastUpload;
 }
 
 void VulkanImage::Invalidate()
@@ -301,9 +303,21 @@ void VulkanImage::Invalidate()
 
     PFR_ASSERT(m_Specification.Mips > 0, "Mips should be 1 at least!");
     const auto vkImageFormat = ImageUtils::PathfinderImageFormatToVulkan(m_Specification.Format);
-    ImageUtils::CreateImage(
-        m_Handle, m_Allocation, vkImageFormat, ImageUtils::PathfinderImageUsageFlagsToVulkan(m_Specification.UsageFlags),
-        {m_Specification.Width, m_Specification.Height, 1}, VK_IMAGE_TYPE_2D, m_Specification.Mips, m_Specification.Layers);
+    if (m_Specification.AliasingInfo.Memory)
+    {
+        const auto imageCI =
+            ImageUtils::GetImageCreateInfo(vkImageFormat, ImageUtils::PathfinderImageUsageFlagsToVulkan(m_Specification.UsageFlags),
+                                           {m_Specification.Width, m_Specification.Height, 1}, VK_IMAGE_TYPE_2D, m_Specification.Mips,
+                                           m_Specification.Layers);
+        VulkanContext::Get().GetDevice()->GetAllocator()->CreateAliasingImage(
+            imageCI, m_Handle, static_cast<VmaAllocation>(m_Specification.AliasingInfo.Memory), m_Specification.AliasingInfo.Offset);
+    }
+    else
+    {
+        ImageUtils::CreateImage(
+            m_Handle, m_Allocation, vkImageFormat, ImageUtils::PathfinderImageUsageFlagsToVulkan(m_Specification.UsageFlags),
+            {m_Specification.Width, m_Specification.Height, 1}, VK_IMAGE_TYPE_2D, m_Specification.Mips, m_Specification.Layers);
+    }
 
     const VkImageViewType imageViewType = m_Specification.Layers == 1
                                               ? VK_IMAGE_VIEW_TYPE_2D
@@ -319,6 +333,17 @@ void VulkanImage::Invalidate()
     ImageUtils::CreateImageView(m_Handle, m_View, vkImageFormat, imageAspectMask, imageViewType, 0, m_Specification.Mips, 0,
                                 m_Specification.Layers);
 
+    const bool bStorageMips = m_Specification.UsageFlags & EImageUsage::IMAGE_USAGE_STORAGE_BIT && m_Specification.Mips > 1;
+    if (bStorageMips)
+    {
+        m_MipViews.resize(m_Specification.Mips, VK_NULL_HANDLE);
+        for (uint32_t mip{}; mip < m_Specification.Mips; ++mip)
+        {
+            ImageUtils::CreateImageView(m_Handle, m_MipViews[mip], vkImageFormat, imageAspectMask, imageViewType, mip, 1, 0,
+                                        m_Specification.Layers);
+        }
+    }
+
     // NOTE: Small crutch since SetLayout() doesn't assume using inside Invalidate() but I find it convenient.
     // On image creation it has undefined layout. We store newLayout and set it to specification after transition.
     // Because SetLayout uses oldLayout as m_Specification.Layout and newLayout I specify as m_Specification.Layout,
@@ -335,9 +360,19 @@ void VulkanImage::Invalidate()
     if (m_Specification.UsageFlags & EImageUsage::IMAGE_USAGE_STORAGE_BIT && !m_BindlessIndex.has_value())
     {
         SetLayout(EImageLayout::IMAGE_LAYOUT_GENERAL, true);
-        const VkDescriptorImageInfo vkImageInfo = {.imageView   = m_View,
+        const VkDescriptorImageInfo vkImageInfo = {.imageView   = GetMipView(0),
                                                    .imageLayout = ImageUtils::PathfinderImageLayoutToVulkan(m_Specification.Layout)};
         Renderer::GetDescriptorManager()->LoadImage(&vkImageInfo, m_BindlessIndex);
+
+        if (bStorageMips)
+        {
+            m_MipBindlessIndices.resize(m_Specification.Mips, std::nullopt);
+            for (uint32_t mip = 1; mip < m_Specification.Mips; ++mip)
+            {
+                const VkDescriptorImageInfo vkMipImageInfo = {.imageView = m_MipViews[mip], .imageLayout = vkImageInfo.imageLayout};
+                Renderer::GetDescriptorManager()->LoadImage(&vkMipImageInfo, m_MipBindlessIndices[mip]);
+            }
+        }
     }
 
     if (m_Specification.DebugName != s_DEFAULT_STRING)
@@ -347,18 +382,51 @@ void VulkanImage::Invalidate()
     }
 }
 
+MemoryRequirements VulkanImage::GetMemoryRequirements(const ImageSpecification& imageSpec)
+{
+    const auto imageCI = ImageUtils::GetImageCreateInfo(ImageUtils::PathfinderImageFormatToVulkan(imageSpec.Format),
+                                                        ImageUtils::PathfinderImageUsageFlagsToVulkan(imageSpec.UsageFlags),
+                                                        {imageSpec.Width, imageSpec.Height, 1}, VK_IMAGE_TYPE_2D, imageSpec.Mips,
+                                                        imageSpec.Layers);
+
+    // NOTE: Core since 1.3(KHR_maintenance4), no need to create an image to know its requirements.
+    const VkDeviceImageMemoryRequirements deviceImageMemoryRequirements = {
+        .sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS, .pCreateInfo = &imageCI};
+    VkMemoryRequirements2 memoryRequirements = {.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+    vkGetDeviceImageMemoryRequirements(VulkanContext::Get().GetDevice()->GetLogicalDevice(), &deviceImageMemoryRequirements,
+                                       &memoryRequirements);
+
+    return {.Size           = memoryRequirements.memoryRequirements.size,
+            .Alignment      = memoryRequirements.memoryRequirements.alignment,
+            .MemoryTypeBits = memoryRequirements.memoryRequirements.memoryTypeBits};
+}
+
 void VulkanImage::Destroy()
 {
     //    VulkanContext::Get().GetDevice()->WaitDeviceOnFinish();
 
+    if (const auto& stagingManager = VulkanContext::Get().GetStagingManager(); stagingManager && m_LastUpload.Value != 0)
+        stagingManager->Wait(m_LastUpload);
+    m_LastUpload = {};
+
     ImageUtils::DestroyImage(m_Handle, m_Allocation);
     m_Handle = VK_NULL_HANDLE;
 
     ImageUtils::DestroyImageView(m_View);
     vkDestroyImageView(VulkanContext::Get().GetDevice()->GetLogicalDevice(), m_View, nullptr);
 
+    for (auto& mipView : m_MipViews)
+        ImageUtils::DestroyImageView(mipView);
+    m_MipViews.clear();
+
     if (m_Specification.UsageFlags & EImageUsage::IMAGE_USAGE_STORAGE_BIT && m_BindlessIndex.has_value())
         Renderer::GetDescriptorManager()->FreeImage(m_BindlessIndex);
+
+    for (auto& mipBindlessIndex : m_MipBindlessIndices)
+    {
+        if (mipBindlessIndex.has_value()) Renderer::GetDescriptorManager()->FreeImage(mipBindlessIndex);
+    }
+    m_MipBindlessIndices.clear();
 }
 
 void VulkanImage::ClearColor(const Shared<CommandBuffer>& commandBuffer, const glm::vec4& color) const
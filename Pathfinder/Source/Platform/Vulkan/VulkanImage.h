@@ -7,9 +7,17 @@
 namespace Pathfinder
 {
 
+class VulkanCommandBuffer;
+
 namespace ImageUtils
 {
 
+NODISCARD VkImageCreateInfo GetImageCreateInfo(const VkFormat format, const VkImageUsageFlags imageUsage, const VkExtent3D& extent,
+                                               const VkImageType imageType = VK_IMAGE_TYPE_2D, const uint32_t mipLevels = 1,
+                                               const uint32_t layerCount = 1, const VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                                               const VkImageTiling imageTiling     = VK_IMAGE_TILING_OPTIMAL,
+                                               const VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT);
+
 void CreateImage(VkImage& outImage, VmaAllocation& outAllocation, const VkFormat format, const VkImageUsageFlags imageUsage,
                  const VkExtent3D& extent, const VkImageType imageType = VK_IMAGE_TYPE_2D, const uint32_t mipLevels = 1,
                  const uint32_t layerCount = 1, const VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
@@ -30,7 +38,6 @@ VkFormat PathfinderImageFormatToVulkan(const EImageFormat imageFormat);
 
 }  // namespace ImageUtils
 
-// TODO: Vector<ImageView> per mip level
 class VulkanImage final : public Image
 {
   public:
@@ -39,12 +46,18 @@ class VulkanImage final : public Image
 
     NODISCARD FORCEINLINE void* Get() const final override { return m_Handle; }
     NODISCARD FORCEINLINE const auto& GetView() const { return m_View; }
+    NODISCARD FORCEINLINE const auto& GetMipView(const uint32_t mip) const { return m_MipViews.empty() ? m_View : m_MipViews.at(mip); }
+
+    NODISCARD static MemoryRequirements GetMemoryRequirements(const ImageSpecification& imageSpec);
 
     void SetLayout(const EImageLayout newLayout, const bool bImmediate = false) final override;
-    void SetData(const void* data, size_t dataSize) final override;
+    UploadToken SetData(const void* data, size_t dataSize, const uint32_t mipCount = 1) final override;
     void ClearColor(const Shared<CommandBuffer>& commandBuffer, const glm::vec4& color) const final override;
     void SetDebugName(const std::string& name) final override;
 
+    // NOTE: Records commands touching the image into staging graphics batch, image destruction waits for them.
+    UploadToken RecordStaged(const std::function<void(const VulkanCommandBuffer&)>& recordFunc);
+
     FORCEINLINE void Resize(const uint32_t width, const uint32_t height) final override
     {
         if (m_Specification.Width == width && m_Specification.Height == height) return;
@@ -59,7 +72,8 @@ class VulkanImage final : public Image
     VkImage m_Handle                       = VK_NULL_HANDLE;
     VmaAllocation m_Allocation             = VK_NULL_HANDLE;
     VkImageView m_View                     = VK_NULL_HANDLE;
- //   std::vector<VkImageView> m_ViewMips;  // TODO:
+    UploadToken m_LastUpload               = {};
+    std::vector<VkImageView> m_MipViews;  // Single mip views of storage images with mips, storage descriptor can't see the whole chain.
 
     VulkanImage() = delete;
     void Invalidate() final override;
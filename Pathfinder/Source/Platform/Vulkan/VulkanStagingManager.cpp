@@ -0,0 +1,363 @@
+#include <PathfinderPCH.h>
+#include "VulkanStagingManager.h"
+
+#include "VulkanContext.h"
+#include "VulkanDevice.h"
+#include "VulkanCommandBuffer.h"
+
+#include <numeric>
+
+namespace Pathfinder
+{
+
+VulkanStagingManager::VulkanStagingManager()
+{
+    const auto& device        = VulkanContext::Get().GetDevice();
+    const auto& logicalDevice = device->GetLogicalDevice();
+
+    const auto& queueFamilyIndices  = device->GetQueueFamilyIndices();
+    const VkBufferCreateInfo ringCI = {.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                                       .size                  = s_RING_CAPACITY,
+                                       .usage                 = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                       .sharingMode           = VK_SHARING_MODE_CONCURRENT,
+                                       .queueFamilyIndexCount = static_cast<uint32_t>(queueFamilyIndices.size()),
+                                       .pQueueFamilyIndices   = queueFamilyIndices.data()};
+    device->GetAllocator()->CreateBuffer(ringCI, m_RingBuffer, m_RingAllocation, EBufferFlag::BUFFER_FLAG_MAPPED);
+    m_RingMapped = static_cast<uint8_t*>(device->GetAllocator()->Map(m_RingAllocation));
+    PFR_ASSERT(m_RingMapped, "Failed to map staging ring!");
+    VK_SetDebugName(logicalDevice, m_RingBuffer, VK_OBJECT_TYPE_BUFFER, "STAGING_RING");
+
+    for (uint8_t queueIndex{}; queueIndex < m_Queues.size(); ++queueIndex)
+    {
+        auto& stagingQueue          = m_Queues[queueIndex];
+        const bool bIsTransferQueue = static_cast<EStagingQueue>(queueIndex) == EStagingQueue::STAGING_QUEUE_TRANSFER;
+
+        // NOTE: Own pools instead of per-frame ones, since batch may outlive the frame it was recorded in.
+        const VkCommandPoolCreateInfo commandPoolCI = {.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                                                       .flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+                                                       .queueFamilyIndex =
+                                                           bIsTransferQueue ? device->GetTransferFamily() : device->GetGraphicsFamily()};
+        VK_CHECK(vkCreateCommandPool(logicalDevice, &commandPoolCI, nullptr, &stagingQueue.CommandPool),
+                 "Failed to create staging command pool!");
+
+        constexpr VkSemaphoreTypeCreateInfo semaphoreTypeCI = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO, .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE, .initialValue = 0};
+        const VkSemaphoreCreateInfo semaphoreCI = {.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, .pNext = &semaphoreTypeCI};
+        VK_CHECK(vkCreateSemaphore(logicalDevice, &semaphoreCI, nullptr, &stagingQueue.Timeline),
+                 "Failed to create staging timeline semaphore!");
+
+        const std::string queueTypeStr = bIsTransferQueue ? "TRANSFER" : "GRAPHICS";
+        VK_SetDebugName(logicalDevice, stagingQueue.CommandPool, VK_OBJECT_TYPE_COMMAND_POOL,
+                        ("STAGING_COMMAND_POOL_" + queueTypeStr).data());
+        VK_SetDebugName(logicalDevice, stagingQueue.Timeline, VK_OBJECT_TYPE_SEMAPHORE,
+                        ("STAGING_TIMELINE_SEMAPHORE_" + queueTypeStr).data());
+    }
+}
+
+VulkanStagingManager::~VulkanStagingManager()
+{
+    const auto& device        = VulkanContext::Get().GetDevice();
+    const auto& logicalDevice = device->GetLogicalDevice();
+    for (auto& stagingQueue : m_Queues)
+    {
+        stagingQueue.OpenBatch.reset();
+        stagingQueue.InFlightBatches.clear();
+        stagingQueue.FreeBatches.clear();
+
+        vkDestroyCommandPool(logicalDevice, stagingQueue.CommandPool, nullptr);
+        vkDestroySemaphore(logicalDevice, stagingQueue.Timeline, nullptr);
+    }
+
+    device->GetAllocator()->Unmap(m_RingAllocation);
+    device->GetAllocator()->DestroyBuffer(m_RingBuffer, m_RingAllocation);
+}
+
+UploadToken VulkanStagingManager::UploadBuffer(VkBuffer dstBuffer, const void* data, const size_t dataSize, const uint64_t dstOffset)
+{
+    if (!data || dataSize == 0) return {};
+
+    std::scoped_lock lock(m_Mutex);
+    constexpr auto queue = EStagingQueue::STAGING_QUEUE_TRANSFER;
+    auto& stagingQueue   = GetQueue(queue);
+
+    UploadToken token = {.Queue = static_cast<uint8_t>(queue)};
+    for (uint64_t chunkOffset{}; chunkOffset < dataSize; chunkOffset += s_MAX_CHUNK_SIZE)
+    {
+        const uint64_t chunkSize     = std::min<uint64_t>(s_MAX_CHUNK_SIZE, dataSize - chunkOffset);
+        const uint64_t stagingOffset = AllocateStaging(queue, chunkSize, s_STAGING_ALIGNMENT);
+        std::memcpy(m_RingMapped + stagingOffset, static_cast<const uint8_t*>(data) + chunkOffset, chunkSize);
+
+        const auto& batch = GetOpenBatch(queue);
+        if (chunkOffset == 0 && !stagingQueue.OpenBatchDstBuffers.emplace(dstBuffer).second)
+        {
+            const VkMemoryBarrier2 memoryBarrier = {.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+                                                    .srcStageMask  = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+                                                    .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                                                    .dstStageMask  = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+                                                    .dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT};
+            batch.InsertBarrier(VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, 0, 1, &memoryBarrier, 0,
+                                nullptr, 0, nullptr);
+        }
+
+        const VkBufferCopy region = {.srcOffset = stagingOffset, .dstOffset = dstOffset + chunkOffset, .size = chunkSize};
+        batch.CopyBuffer(m_RingBuffer, dstBuffer, 1, &region);
+
+        token.Value = stagingQueue.SubmittedValue + 1;
+        stagingQueue.OpenBatchBytes += chunkSize;
+        if (stagingQueue.OpenBatchBytes >= s_BATCH_SUBMIT_THRESHOLD) SubmitBatch(queue);
+    }
+
+    return token;
+}
+
+UploadToken VulkanStagingManager::UploadImage(VkImage dstImage, const VkImageAspectFlags aspectMask, const void* data,
+                                              const size_t dataSize, const VkExtent2D& extent, const uint32_t layerCount,
+                                              const uint32_t blockHeight, const uint32_t mipLevel)
+{
+    if (!data || dataSize == 0) return {};
+    PFR_ASSERT(layerCount > 0 && blockHeight > 0, "Invalid image upload parameters!");
+
+    const uint32_t blockRowCount = (extent.height + blockHeight - 1) / blockHeight;
+    PFR_ASSERT(dataSize % (static_cast<uint64_t>(layerCount) * blockRowCount) == 0, "Image data isn't tightly packed!");
+    const uint64_t blockRowSize = dataSize / (static_cast<uint64_t>(layerCount) * blockRowCount);
+    PFR_ASSERT(blockRowSize <= s_MAX_CHUNK_SIZE, "Single row of the image doesn't fit into staging chunk!");
+
+    // NOTE: bufferOffset of buffer->image copy has to be multiple of texel block size(12 bytes for RGB32F) and 4, BCn blocks are square.
+    const uint64_t texelBlockSize = std::max<uint64_t>(blockRowSize / ((extent.width + blockHeight - 1) / blockHeight), 1);
+    const uint64_t alignment      = std::lcm(static_cast<uint64_t>(s_STAGING_ALIGNMENT), texelBlockSize);
+    const uint32_t maxChunkRows   = static_cast<uint32_t>(s_MAX_CHUNK_SIZE / blockRowSize);
+
+    std::scoped_lock lock(m_Mutex);
+    constexpr auto queue = EStagingQueue::STAGING_QUEUE_GRAPHICS;
+    auto& stagingQueue   = GetQueue(queue);
+
+    UploadToken token = {.Queue = static_cast<uint8_t>(queue)};
+    for (uint32_t layer{}; layer < layerCount; ++layer)
+    {
+        for (uint32_t blockRow{}; blockRow < blockRowCount;)
+        {
+            const uint32_t chunkRows     = std::min(maxChunkRows, blockRowCount - blockRow);
+            const uint64_t chunkSize     = chunkRows * blockRowSize;
+            const uint64_t srcOffset     = (static_cast<uint64_t>(layer) * blockRowCount + blockRow) * blockRowSize;
+            const uint64_t stagingOffset = AllocateStaging(queue, chunkSize, alignment);
+            std::memcpy(m_RingMapped + stagingOffset, static_cast<const uint8_t*>(data) + srcOffset, chunkSize);
+
+            const uint32_t offsetY         = blockRow * blockHeight;
+            const VkBufferImageCopy region = {
+                .bufferOffset     = stagingOffset,
+                .imageSubresource = {.aspectMask = aspectMask, .mipLevel = mipLevel, .baseArrayLayer = layer, .layerCount = 1},
+                .imageOffset      = {0, static_cast<int32_t>(offsetY), 0},
+                .imageExtent      = {extent.width, std::min(chunkRows * blockHeight, extent.height - offsetY), 1}};
+            GetOpenBatch(queue).CopyBufferToImage(m_RingBuffer, dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+            token.Value = stagingQueue.SubmittedValue + 1;
+            stagingQueue.OpenBatchBytes += chunkSize;
+            if (stagingQueue.OpenBatchBytes >= s_BATCH_SUBMIT_THRESHOLD) SubmitBatch(queue);
+
+            blockRow += chunkRows;
+        }
+    }
+
+    return token;
+}
+
+UploadToken VulkanStagingManager::Record(const EStagingQueue queue, const std::function<void(const VulkanCommandBuffer&)>& recordFunc)
+{
+    std::scoped_lock lock(m_Mutex);
+    recordFunc(GetOpenBatch(queue));
+    return {.Value = GetQueue(queue).SubmittedValue + 1, .Queue = static_cast<uint8_t>(queue)};
+}
+
+bool VulkanStagingManager::IsComplete(const UploadToken& token)
+{
+    if (token.Value == 0) return true;
+
+    return GetCompletedValue(static_cast<EStagingQueue>(token.Queue)) >= token.Value;
+}
+
+void VulkanStagingManager::Wait(const UploadToken& token)
+{
+    if (IsComplete(token)) return;
+
+    const auto queue = static_cast<EStagingQueue>(token.Queue);
+    {
+        std::scoped_lock lock(m_Mutex);
+        if (GetQueue(queue).SubmittedValue < token.Value) SubmitBatch(queue);
+    }
+
+    WaitForValue(queue, token.Value);
+}
+
+std::vector<Shared<SyncPoint>> VulkanStagingManager::Flush()
+{
+    std::scoped_lock lock(m_Mutex);
+
+    std::vector<Shared<SyncPoint>> syncPoints;
+    for (uint8_t queueIndex{}; queueIndex < m_Queues.size(); ++queueIndex)
+    {
+        const auto queue = static_cast<EStagingQueue>(queueIndex);
+        SubmitBatch(queue);
+
+        const auto& stagingQueue = GetQueue(queue);
+        if (GetCompletedValue(queue) >= stagingQueue.SubmittedValue) continue;
+
+        syncPoints.emplace_back(
+            SyncPoint::Create(stagingQueue.Timeline, stagingQueue.SubmittedValue, EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT));
+    }
+
+    return syncPoints;
+}
+
+uint64_t VulkanStagingManager::AllocateStaging(const EStagingQueue queue, const uint64_t size, const uint64_t alignment)
+{
+    PFR_ASSERT(size <= s_MAX_CHUNK_SIZE, "Staging allocation exceeds chunk size!");
+
+    RetireCompletedAllocations();
+    uint64_t offset = 0;
+    while (!TryAllocateFromRing(size, alignment, offset))
+    {
+        // Ring is full, everything that holds ring space has to be submitted before blocking on the oldest allocation.
+        for (uint8_t queueIndex{}; queueIndex < m_Queues.size(); ++queueIndex)
+            SubmitBatch(static_cast<EStagingQueue>(queueIndex));
+
+        PFR_ASSERT(!m_RingAllocations.empty(), "Staging allocation doesn't fit into empty ring!");
+        const auto oldestAllocation = m_RingAllocations.front();
+        WaitForValue(oldestAllocation.Queue, oldestAllocation.Value);
+        RetireCompletedAllocations();
+    }
+
+    // NOTE: Allocations of the same batch retire together, so they're merged to keep bookkeeping small.
+    const uint64_t value = GetQueue(queue).SubmittedValue + 1;
+    if (!m_RingAllocations.empty() && m_RingAllocations.back().Queue == queue && m_RingAllocations.back().Value == value)
+        m_RingAllocations.back().End = offset + size;
+    else
+        m_RingAllocations.emplace_back(RingAllocation{.End = offset + size, .Queue = queue, .Value = value});
+
+    return offset;
+}
+
+bool VulkanStagingManager::TryAllocateFromRing(const uint64_t size, const uint64_t alignment, uint64_t& outOffset)
+{
+    if (!m_RingAllocations.empty() && m_RingHead == m_RingTail) return false;  // Full.
+
+    const uint64_t alignedHead = (m_RingHead + alignment - 1) / alignment * alignment;
+    if (m_RingHead >= m_RingTail)
+    {
+        if (alignedHead + size <= s_RING_CAPACITY)
+        {
+            outOffset  = alignedHead;
+            m_RingHead = alignedHead + size;
+            return true;
+        }
+
+        // Wrap around, the end of the ring stays unused until allocations in front of it retire.
+        if (size > m_RingTail) return false;
+
+        outOffset  = 0;
+        m_RingHead = size;
+        return true;
+    }
+
+    if (alignedHead + size > m_RingTail) return false;
+
+    outOffset  = alignedHead;
+    m_RingHead = alignedHead + size;
+    return true;
+}
+
+void VulkanStagingManager::RetireCompletedAllocations()
+{
+    std::array<uint64_t, static_cast<size_t>(EStagingQueue::STAGING_QUEUE_COUNT)> completedValues = {};
+    for (uint8_t queueIndex{}; queueIndex < m_Queues.size(); ++queueIndex)
+        completedValues[queueIndex] = GetCompletedValue(static_cast<EStagingQueue>(queueIndex));
+
+    while (!m_RingAllocations.empty())
+    {
+        const auto& oldestAllocation = m_RingAllocations.front();
+        if (completedValues[static_cast<size_t>(oldestAllocation.Queue)] < oldestAllocation.Value) break;
+
+        m_RingTail = oldestAllocation.End;
+        m_RingAllocations.pop_front();
+    }
+
+    if (m_RingAllocations.empty()) m_RingHead = m_RingTail = 0;
+}
+
+const VulkanCommandBuffer& VulkanStagingManager::GetOpenBatch(const EStagingQueue queue)
+{
+    auto& stagingQueue = GetQueue(queue);
+    if (stagingQueue.OpenBatch) return *stagingQueue.OpenBatch;
+
+    const uint64_t completedValue = GetCompletedValue(queue);
+    std::erase_if(stagingQueue.InFlightBatches,
+                  [&](auto& inFlightBatch)
+                  {
+                      if (inFlightBatch.second > completedValue) return false;
+
+                      stagingQueue.FreeBatches.emplace_back(std::move(inFlightBatch.first));
+                      return true;
+                  });
+
+    if (stagingQueue.FreeBatches.empty())
+    {
+        const CommandBufferSpecification cbSpec = {.Type  = queue == EStagingQueue::STAGING_QUEUE_TRANSFER
+                                                                ? ECommandBufferType::COMMAND_BUFFER_TYPE_TRANSFER_ASYNC
+                                                                : ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL,
+                                                   .Level = ECommandBufferLevel::COMMAND_BUFFER_LEVEL_PRIMARY};
+        stagingQueue.OpenBatch = MakeShared<VulkanCommandBuffer>(cbSpec, stagingQueue.CommandPool);
+    }
+    else
+    {
+        stagingQueue.OpenBatch = std::move(stagingQueue.FreeBatches.back());
+        stagingQueue.FreeBatches.pop_back();
+    }
+
+    stagingQueue.OpenBatch->BeginRecording(true);
+
+    // NOTE: Previous batches may have written into the same memory, order transfer writes across submissions.
+    const VkMemoryBarrier2 memoryBarrier = {.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2,
+                                            .srcStageMask  = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+                                            .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                                            .dstStageMask  = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+                                            .dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT};
+    stagingQueue.OpenBatch->InsertBarrier(VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, 0, 1, &memoryBarrier,
+                                          0, nullptr, 0, nullptr);
+    return *stagingQueue.OpenBatch;
+}
+
+void VulkanStagingManager::SubmitBatch(const EStagingQueue queue)
+{
+    auto& stagingQueue = GetQueue(queue);
+    if (!stagingQueue.OpenBatch) return;
+
+    stagingQueue.OpenBatch->EndRecording();
+    ++stagingQueue.SubmittedValue;
+    stagingQueue.OpenBatch->Submit(
+        {}, {SyncPoint::Create(stagingQueue.Timeline, stagingQueue.SubmittedValue, EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT)});
+
+    stagingQueue.InFlightBatches.emplace_back(std::move(stagingQueue.OpenBatch), stagingQueue.SubmittedValue);
+    stagingQueue.OpenBatch.reset();
+    stagingQueue.OpenBatchBytes = 0;
+    stagingQueue.OpenBatchDstBuffers.clear();
+}
+
+uint64_t VulkanStagingManager::GetCompletedValue(const EStagingQueue queue) const
+{
+    uint64_t completedValue = 0;
+    VK_CHECK(vkGetSemaphoreCounterValue(VulkanContext::Get().GetDevice()->GetLogicalDevice(),
+                                        m_Queues[static_cast<size_t>(queue)].Timeline, &completedValue),
+             "Failed to retrieve staging timeline semaphore value!");
+    return completedValue;
+}
+
+void VulkanStagingManager::WaitForValue(const EStagingQueue queue, const uint64_t value) const
+{
+    const VkSemaphoreWaitInfo waitInfo = {.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+                                          .semaphoreCount = 1,
+                                          .pSemaphores    = &m_Queues[static_cast<size_t>(queue)].Timeline,
+                                          .pValues        = &value};
+    VK_CHECK(vkWaitSemaphores(VulkanContext::Get().GetDevice()->GetLogicalDevice(), &waitInfo, UINT64_MAX),
+             "Failed to wait on staging timeline semaphore!");
+}
+
+}  // namespace Pathfinder
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "VulkanCore.h"
+#include "VulkanAllocator.h"
+
+#include <mutex>
+#include <deque>
+#include <functional>
+
+namespace Pathfinder
+{
+
+class SyncPoint;
+class VulkanCommandBuffer;
+
+enum class EStagingQueue : uint8_t
+{
+    STAGING_QUEUE_TRANSFER = 0,  // Dedicated transfer queue, buffers are created with concurrent sharing, so no ownership transfers needed.
+    STAGING_QUEUE_GRAPHICS,      // Images are exclusive to graphics family, their layout transitions and mip blits live here too.
+    STAGING_QUEUE_COUNT
+};
+
+/*
+ * Replaces upload-and-wait on every SetData().
+ * Data is copied into persistently mapped staging ring, copy commands are recorded into open batch of the queue. Batch is submitted
+ * once it grows big enough, when ring runs out of space, when somebody waits on its token or right before any other command buffer
+ * submission(so GPU-side wait is enough for consumers). Ring space is reclaimed once batch signals queue's timeline semaphore.
+ */
+class VulkanStagingManager final : private Uncopyable, private Unmovable
+{
+  public:
+    VulkanStagingManager();
+    ~VulkanStagingManager();
+
+    NODISCARD UploadToken UploadBuffer(VkBuffer dstBuffer, const void* data, const size_t dataSize, const uint64_t dstOffset = 0);
+
+    // NOTE: Uploads single mip of all layers, image has to be in TRANSFER_DST layout, data is tightly packed,
+    // extent is the one of mipLevel, blockHeight is 4 for BCn formats so chunks are split on block rows.
+    NODISCARD UploadToken UploadImage(VkImage dstImage, const VkImageAspectFlags aspectMask, const void* data, const size_t dataSize,
+                                      const VkExtent2D& extent, const uint32_t layerCount, const uint32_t blockHeight = 1,
+                                      const uint32_t mipLevel = 0);
+
+    // Records arbitrary commands(layout transitions, blits) into open batch of the queue, keeping them ordered with uploads.
+    NODISCARD UploadToken Record(const EStagingQueue queue, const std::function<void(const VulkanCommandBuffer&)>& recordFunc);
+
+    NODISCARD bool IsComplete(const UploadToken& token);
+    void Wait(const UploadToken& token);
+
+    // Submits open batches, returns sync points of batches that are still in flight.
+    NODISCARD std::vector<Shared<SyncPoint>> Flush();
+
+  private:
+    static constexpr size_t s_RING_CAPACITY          = 64 * 1024 * 1024;  // 64 MB
+    static constexpr size_t s_MAX_CHUNK_SIZE         = s_RING_CAPACITY / 4;
+    static constexpr size_t s_BATCH_SUBMIT_THRESHOLD = 16 * 1024 * 1024;  // 16 MB
+    static constexpr size_t s_STAGING_ALIGNMENT      = 16;
+
+    struct StagingQueue
+    {
+        VkCommandPool CommandPool   = VK_NULL_HANDLE;
+        VkSemaphore Timeline        = VK_NULL_HANDLE;
+        uint64_t SubmittedValue     = 0;  // Open batch will signal SubmittedValue + 1.
+        uint64_t OpenBatchBytes     = 0;
+        Shared<VulkanCommandBuffer> OpenBatch;
+        std::vector<std::pair<Shared<VulkanCommandBuffer>, uint64_t>> InFlightBatches;
+        std::vector<Shared<VulkanCommandBuffer>> FreeBatches;
+        UnorderedSet<VkBuffer> OpenBatchDstBuffers;  // Repeated writes into the same buffer within batch need a barrier.
+    };
+
+    struct RingAllocation
+    {
+        uint64_t End        = 0;
+        EStagingQueue Queue = EStagingQueue::STAGING_QUEUE_TRANSFER;
+        uint64_t Value      = 0;
+    };
+
+    std::mutex m_Mutex;
+    std::array<StagingQueue, static_cast<size_t>(EStagingQueue::STAGING_QUEUE_COUNT)> m_Queues;
+
+    VkBuffer m_RingBuffer             = VK_NULL_HANDLE;
+    VmaAllocation m_RingAllocation    = VK_NULL_HANDLE;
+    uint8_t* m_RingMapped             = nullptr;
+    uint64_t m_RingHead               = 0;  // Next free byte.
+    uint64_t m_RingTail               = 0;  // Oldest byte still in use by GPU.
+    std::deque<RingAllocation> m_RingAllocations;
+
+    NODISCARD FORCEINLINE auto& GetQueue(const EStagingQueue queue) { return m_Queues[static_cast<size_t>(queue)]; }
+
+    NODISCARD uint64_t AllocateStaging(const EStagingQueue queue, const uint64_t size, const uint64_t alignment);
+    NODISCARD bool TryAllocateFromRing(const uint64_t size, const uint64_t alignment, uint64_t& outOffset);
+    void RetireCompletedAllocations();
+
+    NODISCARD const VulkanCommandBuffer& GetOpenBatch(const EStagingQueue queue);
+    void SubmitBatch(const EStagingQueue queue);
+    NODISCARD uint64_t GetCompletedValue(const EStagingQueue queue) const;
+    void WaitForValue(const EStagingQueue queue, const uint64_t value) const;
+};
+
+}  // namespace Pathfinder
@@ -12,7 +12,9 @@
 namespace Pathfinder
 {
 
-VulkanTexture::VulkanTexture(const TextureSpecification& textureSpec, const void* data, const size_t dataSize) : Texture(textureSpec)
+VulkanTexture::VulkanTexture(const TextureSpecification& textureSpec, const void* data, const size_t dataSize,
+                             const MemoryAliasingInfo& aliasingInfo)
+    : Texture(textureSpec, aliasingInfo)
 {
     m_Specification.UsageFlags |= EImageUsage::IMAGE_USAGE_SAMPLED_BIT;
     Invalidate(data, dataSize);
@@ -56,6 +58,26 @@ void VulkanTexture::Invalidate(const void* data, const size_t dataSize)
     Renderer::GetDescriptorManager()->LoadTexture(&vkTextureInfo, m_BindlessIndex);
 }
 
+Shared<Image> VulkanTexture::Reload(const TextureSpecification& textureSpec, const void* data, const size_t dataSize)
+{
+    PFR_ASSERT(m_BindlessIndex.has_value(), "VulkanTexture: Texture has to be loaded before reloading!");
+    PFR_ASSERT(textureSpec.Filter == m_Specification.Filter && textureSpec.Wrap == m_Specification.Wrap,
+               "VulkanTexture: Reloading can't change sampler!");
+
+    auto prevImage  = std::move(m_Image);
+    m_Specification = textureSpec;
+    m_Specification.UsageFlags |= EImageUsage::IMAGE_USAGE_SAMPLED_BIT;
+    Texture::Invalidate(data, dataSize);
+
+    return prevImage;
+}
+
+void VulkanTexture::UpdateDescriptor(const uint8_t frameIndex)
+{
+    const auto& vkTextureInfo = GetDescriptorInfo();
+    Renderer::GetDescriptorManager()->UpdateTexture(&vkTextureInfo, m_BindlessIndex.value(), frameIndex);
+}
+
 void VulkanTexture::GenerateMipMaps()
 {
     // Check if image format supports linear blitting.
@@ -70,13 +92,6 @@ void VulkanTexture::GenerateMipMaps()
     auto vulkanImage = std::static_pointer_cast<VulkanImage>(m_Image);
     PFR_ASSERT(vulkanImage, "Failed to cast Image to VulkanImage!");
 
-    const CommandBufferSpecification cbSpec = {ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL,
-                                               ECommandBufferLevel::COMMAND_BUFFER_LEVEL_PRIMARY, Renderer::GetRendererData()->FrameIndex,
-                                               ThreadPool::MapThreadID(std::this_thread::get_id())};
-    auto vulkanCommandBuffer =
-        MakeShared<VulkanCommandBuffer>(cbSpec);  // Blit is a graphics command, so dedicated transfer queue doesn't support them.
-    vulkanCommandBuffer->BeginRecording(true);
-
     const auto& imageSpec             = m_Image->GetSpecification();
     VkImageBlit regions               = {};
     regions.srcSubresource.aspectMask = ImageUtils::IsDepthFormat(imageSpec.Format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
@@ -84,44 +99,48 @@ void VulkanTexture::GenerateMipMaps()
     regions.srcOffsets[0]             = {0, 0, 0};
     regions.dstSubresource            = regions.srcSubresource;
 
-    int32_t mipWidth = imageSpec.Width, mipHeight = imageSpec.Height;
+    // NOTE: Blit is a graphics command, so dedicated transfer queue doesn't support them, recorded right after the upload.
     VkImage vulkanImageRaw     = (VkImage)vulkanImage->Get();
     const auto prevImageLayout = ImageUtils::PathfinderImageLayoutToVulkan(imageSpec.Layout);
-    for (uint32_t mipLevel = 1; mipLevel < imageSpec.Mips; ++mipLevel)
-    {
-        vulkanCommandBuffer->TransitionImageLayout(vulkanImageRaw, mipLevel == 1 ? prevImageLayout : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                                   VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, regions.srcSubresource.aspectMask,
-                                                   regions.srcSubresource.layerCount, 0, 1, mipLevel - 1);
-
-        vulkanCommandBuffer->TransitionImageLayout(vulkanImageRaw, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                                   regions.srcSubresource.aspectMask, regions.srcSubresource.layerCount, 0, 1, mipLevel);
-
-        regions.srcSubresource.baseArrayLayer = 0;
-        regions.srcSubresource.mipLevel       = mipLevel - 1;  // Get previous.
-        regions.srcOffsets[1]                 = {mipWidth, mipHeight, 1};
-
-        if (mipWidth > 1) mipWidth /= 2;
-        if (mipHeight > 1) mipHeight /= 2;
-
-        regions.dstSubresource.baseArrayLayer = 0;
-        regions.dstSubresource.mipLevel       = mipLevel;  // Blit previous into current.
-        regions.dstOffsets[1]                 = {mipWidth, mipHeight, 1};
-
-        vulkanCommandBuffer->BlitImage(vulkanImageRaw, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, vulkanImageRaw,
-                                       VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &regions, VK_FILTER_LINEAR);
-
-        vulkanCommandBuffer->TransitionImageLayout(vulkanImageRaw, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, prevImageLayout,
-                                                   regions.srcSubresource.aspectMask, regions.srcSubresource.layerCount, 0, 1,
-                                                   mipLevel - 1);
-    }
-
-    // Last one 1x1 mip is not covered by the loop
-    vulkanCommandBuffer->TransitionImageLayout(vulkanImageRaw, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, prevImageLayout,
-                                               regions.srcSubresource.aspectMask, regions.srcSubresource.layerCount, 0, 1,
-                                               imageSpec.Mips - 1);
-
-    vulkanCommandBuffer->EndRecording();
-    vulkanCommandBuffer->Submit()->Wait();
+    vulkanImage->RecordStaged(
+        [&](const VulkanCommandBuffer& vulkanCommandBuffer)
+        {
+            int32_t mipWidth = imageSpec.Width, mipHeight = imageSpec.Height;
+            for (uint32_t mipLevel = 1; mipLevel < imageSpec.Mips; ++mipLevel)
+            {
+                vulkanCommandBuffer.TransitionImageLayout(
+                    vulkanImageRaw, mipLevel == 1 ? prevImageLayout : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, regions.srcSubresource.aspectMask, regions.srcSubresource.layerCount, 0, 1,
+                    mipLevel - 1);
+
+                vulkanCommandBuffer.TransitionImageLayout(vulkanImageRaw, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                                          regions.srcSubresource.aspectMask, regions.srcSubresource.layerCount, 0, 1,
+                                                          mipLevel);
+
+                regions.srcSubresource.baseArrayLayer = 0;
+                regions.srcSubresource.mipLevel       = mipLevel - 1;  // Get previous.
+                regions.srcOffsets[1]                 = {mipWidth, mipHeight, 1};
+
+                if (mipWidth > 1) mipWidth /= 2;
+                if (mipHeight > 1) mipHeight /= 2;
+
+                regions.dstSubresource.baseArrayLayer = 0;
+                regions.dstSubresource.mipLevel       = mipLevel;  // Blit previous into current.
+                regions.dstOffsets[1]                 = {mipWidth, mipHeight, 1};
+
+                vulkanCommandBuffer.BlitImage(vulkanImageRaw, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, vulkanImageRaw,
+                                              VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &regions, VK_FILTER_LINEAR);
+
+                vulkanCommandBuffer.TransitionImageLayout(vulkanImageRaw, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, prevImageLayout,
+                                                          regions.srcSubresource.aspectMask, regions.srcSubresource.layerCount, 0, 1,
+                                                          mipLevel - 1);
+            }
+
+            // Last one 1x1 mip is not covered by the loop
+            vulkanCommandBuffer.TransitionImageLayout(vulkanImageRaw, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, prevImageLayout,
+                                                      regions.srcSubresource.aspectMask, regions.srcSubresource.layerCount, 0, 1,
+                                                      imageSpec.Mips - 1);
+        });
 }
 
 }  // namespace Pathfinder
\ No newline at end of file
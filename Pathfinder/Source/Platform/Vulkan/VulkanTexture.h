@@ -9,7 +9,8 @@ namespace Pathfinder
 class VulkanTexture final : public Texture
 {
   public:
-    VulkanTexture(const TextureSpecification& textureSpec, const void* data, const size_t dataSize);
+    VulkanTexture(const TextureSpecification& textureSpec, const void* data, const size_t dataSize,
+                  const MemoryAliasingInfo& aliasingInfo = {});
     ~VulkanTexture() override { Destroy(); }
 
     // NOTE: Since image layout changes frequently, update layout on call.
@@ -33,6 +34,9 @@ class VulkanTexture final : public Texture
         m_Image->SetDebugName(name);
     }
 
+    NODISCARD Shared<Image> Reload(const TextureSpecification& textureSpec, const void* data, const size_t dataSize) final override;
+    void UpdateDescriptor(const uint8_t frameIndex) final override;
+
   private:
     VkSampler m_Sampler                    = VK_NULL_HANDLE;
 
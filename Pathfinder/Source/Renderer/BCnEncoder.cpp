@@ -0,0 +1,773 @@
+#include <PathfinderPCH.h>
+#include "BCnEncoder.h"
+
+#include "Image.h"
+#include <Core/ThreadPool.h>
+
+#include <glm/gtc/packing.hpp>
+
+namespace Pathfinder
+{
+
+namespace BCnUtils
+{
+
+static constexpr uint32_t s_BLOCK_DIM         = 4;
+static constexpr uint32_t s_BLOCK_TEXEL_COUNT = s_BLOCK_DIM * s_BLOCK_DIM;
+
+using BlockTexels  = std::array<glm::vec4, s_BLOCK_TEXEL_COUNT>;
+using BlockIndices = std::array<uint8_t, s_BLOCK_TEXEL_COUNT>;
+
+// BC6H/BC7 interpolation weights(out of 64) for 4-bit indices.
+static constexpr std::array<int32_t, 16> s_BPTC_WEIGHTS = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+struct EncodeSettings
+{
+    uint32_t RefineIterations = 0;
+    bool bPrincipalAxis       = false;
+};
+
+NODISCARD FORCEINLINE static EncodeSettings GetEncodeSettings(const ETextureCompressionQuality quality)
+{
+    switch (quality)
+    {
+        case ETextureCompressionQuality::TEXTURE_COMPRESSION_QUALITY_FAST:
+            return {.RefineIterations = 0, .bPrincipalAxis = false};
+        case ETextureCompressionQuality::TEXTURE_COMPRESSION_QUALITY_NORMAL:
+            return {.RefineIterations = 1, .bPrincipalAxis = true};
+    }
+
+    PFR_ASSERT(false, "Unknown texture compression quality!");
+    return {};
+}
+
+NODISCARD FORCEINLINE static bool IsHDRFormat(const EImageFormat format)
+{
+    return format == EImageFormat::FORMAT_RGBA16F || format == EImageFormat::FORMAT_RGBA32F;
+}
+
+NODISCARD FORCEINLINE static uint32_t GetBlockSize(const EImageFormat format)
+{
+    switch (format)
+    {
+        case EImageFormat::FORMAT_BC1_RGB_UNORM:
+        case EImageFormat::FORMAT_BC1_RGB_SRGB:
+        case EImageFormat::FORMAT_BC1_RGBA_UNORM:
+        case EImageFormat::FORMAT_BC1_RGBA_SRGB:
+        case EImageFormat::FORMAT_BC4_UNORM:
+        case EImageFormat::FORMAT_BC4_SNORM: return 8;
+        default: return 16;
+    }
+}
+
+// Texels outside of the image repeat edge ones. LDR sources land in [0, 255], HDR ones are kept as is. R8/RG8 are expanded into
+// gray(+alpha) color in case bGrayscale is set, otherwise channels stay where they are.
+static void FetchBlock(const uint8_t* srcData, const EImageFormat srcFormat, const uint32_t width, const uint32_t height,
+                       const uint32_t blockX, const uint32_t blockY, const bool bGrayscale, BlockTexels& outTexels)
+{
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        const uint32_t x         = std::min(blockX * s_BLOCK_DIM + texelIndex % s_BLOCK_DIM, width - 1);
+        const uint32_t y         = std::min(blockY * s_BLOCK_DIM + texelIndex / s_BLOCK_DIM, height - 1);
+        const size_t texelOffset = static_cast<size_t>(y) * width + x;
+        auto& texel              = outTexels[texelIndex];
+
+        switch (srcFormat)
+        {
+            case EImageFormat::FORMAT_R8_UNORM:
+            {
+                const float luminance = srcData[texelOffset];
+                texel                 = bGrayscale ? glm::vec4(glm::vec3(luminance), 255.f) : glm::vec4(luminance, 0.f, 0.f, 255.f);
+                break;
+            }
+            case EImageFormat::FORMAT_RG8_UNORM:
+            {
+                const float luminance = srcData[texelOffset * 2 + 0];
+                const float alpha     = srcData[texelOffset * 2 + 1];
+                texel                 = bGrayscale ? glm::vec4(glm::vec3(luminance), alpha) : glm::vec4(luminance, alpha, 0.f, 255.f);
+                break;
+            }
+            case EImageFormat::FORMAT_RGBA8_UNORM:
+            {
+                const uint8_t* rgba = srcData + texelOffset * 4;
+                texel               = glm::vec4(rgba[0], rgba[1], rgba[2], rgba[3]);
+                break;
+            }
+            case EImageFormat::FORMAT_RGBA16F:
+            {
+                uint16_t rgba[4] = {};
+                std::memcpy(rgba, srcData + texelOffset * sizeof(rgba), sizeof(rgba));
+                texel = glm::vec4(glm::unpackHalf1x16(rgba[0]), glm::unpackHalf1x16(rgba[1]), glm::unpackHalf1x16(rgba[2]),
+                                  glm::unpackHalf1x16(rgba[3]));
+                break;
+            }
+            case EImageFormat::FORMAT_RGBA32F:
+            {
+                std::memcpy(&texel, srcData + texelOffset * sizeof(glm::vec4), sizeof(glm::vec4));
+                break;
+            }
+            default: PFR_ASSERT(false, "Unsupported source image format!"); break;
+        }
+    }
+}
+
+// 128-bit blocks(BC6H, BC7) are written bit by bit from LSB of the first byte, block has to be zeroed.
+class BlockBitWriter final : private Uncopyable, private Unmovable
+{
+  public:
+    explicit BlockBitWriter(uint8_t* block) : m_Block(block) {}
+    ~BlockBitWriter() = default;
+
+    FORCEINLINE void Write(const uint32_t value, const uint32_t bitCount)
+    {
+        for (uint32_t bit{}; bit < bitCount; ++bit, ++m_BitOffset)
+        {
+            if ((value >> bit) & 1u) m_Block[m_BitOffset >> 3] |= static_cast<uint8_t>(1u << (m_BitOffset & 7u));
+        }
+    }
+
+  private:
+    uint8_t* m_Block     = nullptr;
+    uint32_t m_BitOffset = 0;
+};
+
+// Endpoints of the segment texels are spread along, channels outside of channelMask stay 0.
+// Without principal axis it's bounding box diagonal flipped per channel to follow correlation with the dominant channel.
+static std::pair<glm::vec4, glm::vec4> FitEndpoints(const std::span<const glm::vec4> texels, const glm::vec4& channelMask,
+                                                    const bool bPrincipalAxis)
+{
+    PFR_ASSERT(!texels.empty(), "Nothing to fit endpoints to!");
+
+    glm::vec4 minColor(std::numeric_limits<float>::max());
+    glm::vec4 maxColor(std::numeric_limits<float>::lowest());
+    glm::vec4 mean(0.f);
+    for (const auto& texel : texels)
+    {
+        minColor = glm::min(minColor, texel * channelMask);
+        maxColor = glm::max(maxColor, texel * channelMask);
+        mean += texel * channelMask;
+    }
+    mean /= static_cast<float>(texels.size());
+
+    glm::mat4 covariance(0.f);
+    for (const auto& texel : texels)
+    {
+        const glm::vec4 delta = texel * channelMask - mean;
+        covariance += glm::outerProduct(delta, delta);
+    }
+
+    if (!bPrincipalAxis)
+    {
+        uint32_t dominantChannel = 0;
+        for (uint32_t channel = 1; channel < 4; ++channel)
+        {
+            if (covariance[channel][channel] > covariance[dominantChannel][dominantChannel]) dominantChannel = channel;
+        }
+
+        for (uint32_t channel{}; channel < 4; ++channel)
+        {
+            if (covariance[dominantChannel][channel] < 0.f) std::swap(minColor[channel], maxColor[channel]);
+        }
+        return {minColor, maxColor};
+    }
+
+    // Power iteration, converges quickly since texels of a block are mostly spread along a single direction.
+    glm::vec4 axis = maxColor - minColor;
+    for (uint32_t iteration{}; iteration < 8; ++iteration)
+    {
+        axis                 = covariance * axis;
+        const float maxValue = glm::max(glm::max(glm::abs(axis.x), glm::abs(axis.y)), glm::max(glm::abs(axis.z), glm::abs(axis.w)));
+        if (maxValue < 1e-6f) return {mean, mean};
+
+        axis /= maxValue;
+    }
+    axis = glm::normalize(axis);
+
+    float minProjection = std::numeric_limits<float>::max();
+    float maxProjection = std::numeric_limits<float>::lowest();
+    for (const auto& texel : texels)
+    {
+        const float projection = glm::dot(texel * channelMask - mean, axis);
+        minProjection          = std::min(minProjection, projection);
+        maxProjection          = std::max(maxProjection, projection);
+    }
+
+    return {mean + axis * minProjection, mean + axis * maxProjection};
+}
+
+// Least squares endpoints for already chosen interpolation weights(0 - first endpoint, 1 - second one), false if every texel
+// uses the same weight, so there's nothing to solve.
+static bool RefineEndpoints(const std::span<const glm::vec4> texels, const std::span<const float> weights, glm::vec4& outEndpoint0,
+                            glm::vec4& outEndpoint1)
+{
+    float alpha2 = 0.f, beta2 = 0.f, alphaBeta = 0.f;
+    glm::vec4 alphaX(0.f), betaX(0.f);
+    for (size_t i{}; i < texels.size(); ++i)
+    {
+        const float beta  = weights[i];
+        const float alpha = 1.f - beta;
+        alpha2 += alpha * alpha;
+        beta2 += beta * beta;
+        alphaBeta += alpha * beta;
+        alphaX += alpha * texels[i];
+        betaX += beta * texels[i];
+    }
+
+    const float determinant = alpha2 * beta2 - alphaBeta * alphaBeta;
+    if (std::abs(determinant) < 1e-6f) return false;
+
+    outEndpoint0 = (alphaX * beta2 - betaX * alphaBeta) / determinant;
+    outEndpoint1 = (betaX * alpha2 - alphaX * alphaBeta) / determinant;
+    return true;
+}
+
+NODISCARD FORCEINLINE static float SquaredDistance(const glm::vec4& lhs, const glm::vec4& rhs)
+{
+    const glm::vec4 delta = lhs - rhs;
+    return glm::dot(delta, delta);
+}
+
+// Index of the closest palette entry, its squared distance goes into outError.
+NODISCARD FORCEINLINE static uint8_t FindClosest(const glm::vec4& texel, const std::span<const glm::vec4> palette, float& outError)
+{
+    uint8_t bestIndex = 0;
+    outError          = std::numeric_limits<float>::max();
+    for (uint8_t paletteIndex{}; paletteIndex < palette.size(); ++paletteIndex)
+    {
+        const float error = SquaredDistance(texel, palette[paletteIndex]);
+        if (error >= outError) continue;
+
+        outError  = error;
+        bestIndex = paletteIndex;
+    }
+    return bestIndex;
+}
+
+// BC1-BC3 color part.
+
+NODISCARD FORCEINLINE static uint16_t QuantizeRGB565(const glm::vec4& color)
+{
+    const auto quantize = [](const float value, const float maxValue)
+    { return static_cast<uint16_t>(std::clamp(std::round(value * maxValue / 255.f), 0.f, maxValue)); };
+    return static_cast<uint16_t>(quantize(color.r, 31.f) << 11 | quantize(color.g, 63.f) << 5 | quantize(color.b, 31.f));
+}
+
+NODISCARD FORCEINLINE static glm::vec4 ExpandRGB565(const uint16_t color)
+{
+    const uint32_t r = color >> 11, g = (color >> 5) & 63u, b = color & 31u;
+    return glm::vec4((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 0.f);
+}
+
+struct ColorBlockCandidate
+{
+    uint16_t Color0      = 0;
+    uint16_t Color1      = 0;
+    uint32_t IndexBits   = 0;
+    float Error          = std::numeric_limits<float>::max();
+    BlockIndices Indices = {};
+};
+
+// NOTE: Color0 > Color1 selects 4 color mode, otherwise it's 3 colors + transparent black, which BC1 uses for punch-through alpha.
+// BC2/BC3 always decode 4 color mode, so they never get here with bPunchThrough.
+static ColorBlockCandidate EvaluateColorBlock(const BlockTexels& texels, const std::array<bool, s_BLOCK_TEXEL_COUNT>& transparentTexels,
+                                              const glm::vec4& endpoint0, const glm::vec4& endpoint1, const bool bPunchThrough)
+{
+    ColorBlockCandidate candidate = {.Color0 = QuantizeRGB565(endpoint0), .Color1 = QuantizeRGB565(endpoint1), .Error = 0.f};
+    if (bPunchThrough == (candidate.Color0 > candidate.Color1)) std::swap(candidate.Color0, candidate.Color1);
+
+    const glm::vec4 color0 = ExpandRGB565(candidate.Color0);
+    const glm::vec4 color1 = ExpandRGB565(candidate.Color1);
+
+    std::array<glm::vec4, 4> palette = {color0, color1};
+    uint32_t paletteSize             = 4;
+    if (bPunchThrough)
+    {
+        palette[2]  = (color0 + color1) / 2.f;
+        paletteSize = 3;
+    }
+    else if (candidate.Color0 == candidate.Color1)
+        paletteSize = 1;
+    else
+    {
+        palette[2] = (color0 * 2.f + color1) / 3.f;
+        palette[3] = (color0 + color1 * 2.f) / 3.f;
+    }
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        uint8_t index = 3;
+        if (!transparentTexels[texelIndex])
+        {
+            float error = 0.f;
+            index       = FindClosest(glm::vec4(glm::vec3(texels[texelIndex]), 0.f), std::span(palette.data(), paletteSize), error);
+            candidate.Error += error;
+        }
+
+        candidate.Indices[texelIndex] = index;
+        candidate.IndexBits |= static_cast<uint32_t>(index) << (texelIndex * 2);
+    }
+
+    return candidate;
+}
+
+static void EncodeColorBlock(const BlockTexels& texels, const bool bAllowPunchThrough, const EncodeSettings& settings, uint8_t* outBlock)
+{
+    std::array<bool, s_BLOCK_TEXEL_COUNT> transparentTexels = {};
+    std::vector<glm::vec4> opaqueTexels;
+    opaqueTexels.reserve(s_BLOCK_TEXEL_COUNT);
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        transparentTexels[texelIndex] = bAllowPunchThrough && texels[texelIndex].a < 128.f;
+        if (!transparentTexels[texelIndex]) opaqueTexels.emplace_back(glm::vec3(texels[texelIndex]), 0.f);
+    }
+
+    const bool bPunchThrough = opaqueTexels.size() != s_BLOCK_TEXEL_COUNT;
+    ColorBlockCandidate best = {.Color0 = 0, .Color1 = 0, .IndexBits = 0xFFFFFFFF, .Error = 0.f};
+    if (!opaqueTexels.empty())
+    {
+        auto [endpoint0, endpoint1] = FitEndpoints(opaqueTexels, glm::vec4(1.f, 1.f, 1.f, 0.f), settings.bPrincipalAxis);
+        best                        = EvaluateColorBlock(texels, transparentTexels, endpoint0, endpoint1, bPunchThrough);
+
+        std::vector<float> weights(opaqueTexels.size());
+        for (uint32_t iteration{}; iteration < settings.RefineIterations && best.Error > 0.f; ++iteration)
+        {
+            const std::array<float, 4> indexWeights =
+                bPunchThrough ? std::array{0.f, 1.f, 0.5f, 0.f} : std::array{0.f, 1.f, 1 / 3.f, 2 / 3.f};
+            for (uint32_t texelIndex{}, opaqueIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+            {
+                if (!transparentTexels[texelIndex]) weights[opaqueIndex++] = indexWeights[best.Indices[texelIndex]];
+            }
+
+            if (!RefineEndpoints(opaqueTexels, weights, endpoint0, endpoint1)) break;
+
+            const auto candidate = EvaluateColorBlock(texels, transparentTexels, endpoint0, endpoint1, bPunchThrough);
+            if (candidate.Error >= best.Error) break;
+
+            best = candidate;
+        }
+    }
+
+    std::memcpy(outBlock + 0, &best.Color0, sizeof(best.Color0));
+    std::memcpy(outBlock + 2, &best.Color1, sizeof(best.Color1));
+    std::memcpy(outBlock + 4, &best.IndexBits, sizeof(best.IndexBits));
+}
+
+// BC4 block, also alpha of BC3 and both channels of BC5. Values are in [0, 255] or [-127, 127] for signed.
+
+struct SingleChannelCandidate
+{
+    float Endpoint0      = 0.f;
+    float Endpoint1      = 0.f;
+    uint64_t IndexBits   = 0;
+    float Error          = std::numeric_limits<float>::max();
+    BlockIndices Indices = {};
+};
+
+// NOTE: Endpoint0 > Endpoint1 selects 8 value mode: 0 - Endpoint0, 1 - Endpoint1, 2..7 - interpolated from Endpoint0 to Endpoint1.
+static SingleChannelCandidate EvaluateSingleChannelBlock(const std::span<const float, s_BLOCK_TEXEL_COUNT> values, const float endpoint0,
+                                                         const float endpoint1, const bool bSigned)
+{
+    const float minValue = bSigned ? -127.f : 0.f;
+    const float maxValue = bSigned ? 127.f : 255.f;
+
+    SingleChannelCandidate candidate = {.Endpoint0 = std::clamp(std::round(std::max(endpoint0, endpoint1)), minValue, maxValue),
+                                        .Endpoint1 = std::clamp(std::round(std::min(endpoint0, endpoint1)), minValue, maxValue),
+                                        .Error     = 0.f};
+
+    std::array<glm::vec4, 8> palette = {glm::vec4(candidate.Endpoint0), glm::vec4(candidate.Endpoint1)};
+    for (uint32_t i = 2; i < palette.size(); ++i)
+        palette[i] = glm::vec4((candidate.Endpoint0 * static_cast<float>(8 - i) + candidate.Endpoint1 * static_cast<float>(i - 1)) / 7.f);
+    const uint32_t paletteSize = candidate.Endpoint0 == candidate.Endpoint1 ? 1 : 8;
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        float error      = 0.f;
+        const auto index = FindClosest(glm::vec4(values[texelIndex]), std::span(palette.data(), paletteSize), error);
+        candidate.Error += error / 4.f;  // Distance is taken over 4 equal channels.
+        candidate.Indices[texelIndex] = index;
+        candidate.IndexBits |= static_cast<uint64_t>(index) << (texelIndex * 3);
+    }
+
+    return candidate;
+}
+
+static void EncodeSingleChannelBlock(const std::span<const float, s_BLOCK_TEXEL_COUNT> values, const bool bSigned,
+                                     const EncodeSettings& settings, uint8_t* outBlock)
+{
+    const auto [minIt, maxIt]   = std::ranges::minmax_element(values);
+    float endpoint0             = *maxIt;
+    float endpoint1             = *minIt;
+    SingleChannelCandidate best = EvaluateSingleChannelBlock(values, endpoint0, endpoint1, bSigned);
+
+    std::array<glm::vec4, s_BLOCK_TEXEL_COUNT> texels = {};
+    std::array<float, s_BLOCK_TEXEL_COUNT> weights    = {};
+    for (uint32_t iteration{}; iteration < settings.RefineIterations && best.Error > 0.f; ++iteration)
+    {
+        for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+        {
+            const uint8_t index = best.Indices[texelIndex];
+            weights[texelIndex] = index <= 1 ? static_cast<float>(index) : static_cast<float>(index - 1) / 7.f;
+            texels[texelIndex]  = glm::vec4(values[texelIndex]);
+        }
+
+        glm::vec4 refinedEndpoint0(0.f), refinedEndpoint1(0.f);
+        if (!RefineEndpoints(texels, weights, refinedEndpoint0, refinedEndpoint1)) break;
+
+        const auto candidate = EvaluateSingleChannelBlock(values, refinedEndpoint0.x, refinedEndpoint1.x, bSigned);
+        if (candidate.Error >= best.Error) break;
+
+        best = candidate;
+    }
+
+    // Signed endpoints are stored as two's complement bytes.
+    outBlock[0] = static_cast<uint8_t>(static_cast<int32_t>(best.Endpoint0) & 0xFF);
+    outBlock[1] = static_cast<uint8_t>(static_cast<int32_t>(best.Endpoint1) & 0xFF);
+    for (uint32_t byteIndex{}; byteIndex < 6; ++byteIndex)
+        outBlock[2 + byteIndex] = static_cast<uint8_t>(best.IndexBits >> (byteIndex * 8));
+}
+
+static void EncodeExplicitAlphaBlock(const BlockTexels& texels, uint8_t* outBlock)
+{
+    uint64_t alphaBits = 0;
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        const auto alpha = static_cast<uint64_t>(std::clamp(std::round(texels[texelIndex].a * 15.f / 255.f), 0.f, 15.f));
+        alphaBits |= alpha << (texelIndex * 4);
+    }
+    std::memcpy(outBlock, &alphaBits, sizeof(alphaBits));
+}
+
+// BC7 mode 6: single subset, RGBA endpoints of 7 bits + shared per endpoint p-bit, 4-bit indices.
+
+struct BC7Candidate
+{
+    std::array<glm::u8vec4, 2> QuantizedEndpoints = {};  // 7 bits per channel.
+    std::array<uint32_t, 2> PBits                 = {};
+    BlockIndices Indices                          = {};
+    float Error                                   = std::numeric_limits<float>::max();
+};
+
+NODISCARD FORCEINLINE static glm::u8vec4 QuantizeBC7Endpoint(const glm::vec4& endpoint, const uint32_t pBit)
+{
+    return glm::u8vec4(glm::clamp(glm::round((endpoint - static_cast<float>(pBit)) / 2.f), glm::vec4(0.f), glm::vec4(127.f)));
+}
+
+NODISCARD FORCEINLINE static glm::ivec4 ExpandBC7Endpoint(const glm::u8vec4& quantizedEndpoint, const uint32_t pBit)
+{
+    return glm::ivec4(quantizedEndpoint) * 2 + static_cast<int32_t>(pBit);
+}
+
+// P-bit this endpoint loses the least to when quantized.
+NODISCARD FORCEINLINE static uint32_t ChooseBC7PBit(const glm::vec4& endpoint)
+{
+    const auto quantizationError = [&](const uint32_t pBit)
+    { return SquaredDistance(endpoint, glm::vec4(ExpandBC7Endpoint(QuantizeBC7Endpoint(endpoint, pBit), pBit))); };
+    return quantizationError(1) < quantizationError(0) ? 1 : 0;
+}
+
+static BC7Candidate EvaluateBC7Block(const BlockTexels& texels, const glm::vec4& endpoint0, const glm::vec4& endpoint1,
+                                     const uint32_t pBit0, const uint32_t pBit1)
+{
+    BC7Candidate candidate = {.QuantizedEndpoints = {QuantizeBC7Endpoint(endpoint0, pBit0), QuantizeBC7Endpoint(endpoint1, pBit1)},
+                              .PBits = {pBit0, pBit1},
+                              .Error = 0.f};
+
+    const glm::ivec4 expandedEndpoint0 = ExpandBC7Endpoint(candidate.QuantizedEndpoints[0], pBit0);
+    const glm::ivec4 expandedEndpoint1 = ExpandBC7Endpoint(candidate.QuantizedEndpoints[1], pBit1);
+
+    std::array<glm::vec4, s_BPTC_WEIGHTS.size()> palette = {};
+    for (size_t i{}; i < palette.size(); ++i)
+        palette[i] = glm::vec4((expandedEndpoint0 * (64 - s_BPTC_WEIGHTS[i]) + expandedEndpoint1 * s_BPTC_WEIGHTS[i] + 32) >> 6);
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        float error                   = 0.f;
+        candidate.Indices[texelIndex] = FindClosest(texels[texelIndex], palette, error);
+        candidate.Error += error;
+    }
+
+    return candidate;
+}
+
+static void EncodeBC7Block(const BlockTexels& texels, const EncodeSettings& settings, uint8_t* outBlock)
+{
+    auto [endpoint0, endpoint1] = FitEndpoints(texels, glm::vec4(1.f), settings.bPrincipalAxis);
+
+    BC7Candidate best = EvaluateBC7Block(texels, endpoint0, endpoint1, ChooseBC7PBit(endpoint0), ChooseBC7PBit(endpoint1));
+
+    std::array<float, s_BLOCK_TEXEL_COUNT> weights = {};
+    for (uint32_t iteration{}; iteration < settings.RefineIterations && best.Error > 0.f; ++iteration)
+    {
+        for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+            weights[texelIndex] = static_cast<float>(s_BPTC_WEIGHTS[best.Indices[texelIndex]]) / 64.f;
+
+        if (!RefineEndpoints(texels, weights, endpoint0, endpoint1)) break;
+
+        const auto candidate = EvaluateBC7Block(texels, endpoint0, endpoint1, ChooseBC7PBit(endpoint0), ChooseBC7PBit(endpoint1));
+        if (candidate.Error >= best.Error) break;
+
+        best = candidate;
+    }
+
+    // NOTE: Anchor(first) index is stored without its MSB, so it has to be < 8, otherwise endpoints are swapped and indices flipped.
+    if (best.Indices[0] >= 8)
+    {
+        std::swap(best.QuantizedEndpoints[0], best.QuantizedEndpoints[1]);
+        std::swap(best.PBits[0], best.PBits[1]);
+        for (auto& index : best.Indices)
+            index = static_cast<uint8_t>(15 - index);
+    }
+
+    std::memset(outBlock, 0, 16);
+    BlockBitWriter bitWriter(outBlock);
+    bitWriter.Write(1u << 6, 7);  // Mode 6.
+    for (uint32_t channel{}; channel < 4; ++channel)
+    {
+        bitWriter.Write(best.QuantizedEndpoints[0][channel], 7);
+        bitWriter.Write(best.QuantizedEndpoints[1][channel], 7);
+    }
+    bitWriter.Write(best.PBits[0], 1);
+    bitWriter.Write(best.PBits[1], 1);
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+        bitWriter.Write(best.Indices[texelIndex], texelIndex == 0 ? 3 : 4);
+}
+
+// BC6H mode 11: single region, 10-bit RGB endpoints without delta encoding, 4-bit indices. Texels are fitted in the space decoder
+// interpolates in(half float bits scaled up to 16 bits), which is close to logarithmic, so error is spread evenly across exposure.
+
+NODISCARD FORCEINLINE static float HalfToBC6HSpace(const float value, const bool bSigned)
+{
+    constexpr uint32_t s_MAX_FINITE_HALF = 0x7BFF;
+    const uint32_t halfBits              = std::min<uint32_t>(glm::packHalf1x16(std::min(std::abs(value), 65504.f)), s_MAX_FINITE_HALF);
+    const float magnitude                = static_cast<float>(halfBits);
+    if (!bSigned) return value > 0.f ? magnitude * 64.f / 31.f : 0.f;
+
+    return value < 0.f ? -magnitude * 32.f / 31.f : magnitude * 32.f / 31.f;
+}
+
+NODISCARD FORCEINLINE static int32_t QuantizeBC6HEndpoint(const float value, const bool bSigned)
+{
+    return bSigned ? std::clamp(static_cast<int32_t>(std::round(value / 64.f)), -511, 511)
+                   : std::clamp(static_cast<int32_t>(std::round(value / 64.f)), 0, 1023);
+}
+
+// Same as decoder does for 10-bit endpoints.
+NODISCARD FORCEINLINE static int32_t UnquantizeBC6HEndpoint(const int32_t quantizedValue, const bool bSigned)
+{
+    if (!bSigned)
+    {
+        if (quantizedValue == 0) return 0;
+        if (quantizedValue == 1023) return 0xFFFF;
+        return ((quantizedValue << 16) + 0x8000) >> 10;
+    }
+
+    const int32_t magnitude = std::abs(quantizedValue);
+    int32_t unquantized     = ((magnitude << 15) + 0x4000) >> 9;
+    if (magnitude == 0) unquantized = 0;
+    if (magnitude >= 511) unquantized = 0x7FFF;
+    return quantizedValue < 0 ? -unquantized : unquantized;
+}
+
+struct BC6HCandidate
+{
+    std::array<glm::ivec3, 2> QuantizedEndpoints = {};
+    BlockIndices Indices                         = {};
+    float Error                                  = std::numeric_limits<float>::max();
+};
+
+static BC6HCandidate EvaluateBC6HBlock(const BlockTexels& texels, const glm::vec4& endpoint0, const glm::vec4& endpoint1,
+                                       const bool bSigned)
+{
+    BC6HCandidate candidate                        = {.Error = 0.f};
+    std::array<glm::ivec3, 2> unquantizedEndpoints = {};
+    for (uint32_t channel{}; channel < 3; ++channel)
+    {
+        candidate.QuantizedEndpoints[0][channel] = QuantizeBC6HEndpoint(endpoint0[channel], bSigned);
+        candidate.QuantizedEndpoints[1][channel] = QuantizeBC6HEndpoint(endpoint1[channel], bSigned);
+        unquantizedEndpoints[0][channel]         = UnquantizeBC6HEndpoint(candidate.QuantizedEndpoints[0][channel], bSigned);
+        unquantizedEndpoints[1][channel]         = UnquantizeBC6HEndpoint(candidate.QuantizedEndpoints[1][channel], bSigned);
+    }
+
+    std::array<glm::vec4, s_BPTC_WEIGHTS.size()> palette = {};
+    for (size_t i{}; i < palette.size(); ++i)
+    {
+        palette[i] = glm::vec4(
+            (unquantizedEndpoints[0] * (64 - s_BPTC_WEIGHTS[i]) + unquantizedEndpoints[1] * s_BPTC_WEIGHTS[i] + 32) >> 6, 0.f);
+    }
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        float error                   = 0.f;
+        candidate.Indices[texelIndex] = FindClosest(texels[texelIndex], palette, error);
+        candidate.Error += error;
+    }
+
+    return candidate;
+}
+
+static void EncodeBC6HBlock(const BlockTexels& hdrTexels, const bool bSigned, const EncodeSettings& settings, uint8_t* outBlock)
+{
+    BlockTexels texels = {};
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+    {
+        const auto& hdrTexel = hdrTexels[texelIndex];
+        texels[texelIndex]   = glm::vec4(HalfToBC6HSpace(hdrTexel.r, bSigned), HalfToBC6HSpace(hdrTexel.g, bSigned),
+                                         HalfToBC6HSpace(hdrTexel.b, bSigned), 0.f);
+    }
+
+    auto [endpoint0, endpoint1] = FitEndpoints(texels, glm::vec4(1.f, 1.f, 1.f, 0.f), settings.bPrincipalAxis);
+    BC6HCandidate best          = EvaluateBC6HBlock(texels, endpoint0, endpoint1, bSigned);
+
+    std::array<float, s_BLOCK_TEXEL_COUNT> weights = {};
+    for (uint32_t iteration{}; iteration < settings.RefineIterations && best.Error > 0.f; ++iteration)
+    {
+        for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+            weights[texelIndex] = static_cast<float>(s_BPTC_WEIGHTS[best.Indices[texelIndex]]) / 64.f;
+
+        if (!RefineEndpoints(texels, weights, endpoint0, endpoint1)) break;
+
+        const auto candidate = EvaluateBC6HBlock(texels, endpoint0, endpoint1, bSigned);
+        if (candidate.Error >= best.Error) break;
+
+        best = candidate;
+    }
+
+    // Same anchor index rule as BC7.
+    if (best.Indices[0] >= 8)
+    {
+        std::swap(best.QuantizedEndpoints[0], best.QuantizedEndpoints[1]);
+        for (auto& index : best.Indices)
+            index = static_cast<uint8_t>(15 - index);
+    }
+
+    std::memset(outBlock, 0, 16);
+    BlockBitWriter bitWriter(outBlock);
+    bitWriter.Write(0x03, 5);  // Mode 11.
+    for (const auto& quantizedEndpoint : best.QuantizedEndpoints)
+    {
+        for (uint32_t channel{}; channel < 3; ++channel)
+            bitWriter.Write(static_cast<uint32_t>(quantizedEndpoint[channel]) & 0x3FF, 10);
+    }
+
+    for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+        bitWriter.Write(best.Indices[texelIndex], texelIndex == 0 ? 3 : 4);
+}
+
+static void EncodeBlock(const BlockTexels& texels, const EImageFormat dstFormat, const EncodeSettings& settings, uint8_t* outBlock)
+{
+    const auto getChannel = [&texels](const uint32_t channel, const bool bSigned)
+    {
+        std::array<float, s_BLOCK_TEXEL_COUNT> values = {};
+        for (uint32_t texelIndex{}; texelIndex < s_BLOCK_TEXEL_COUNT; ++texelIndex)
+            values[texelIndex] = bSigned ? texels[texelIndex][channel] / 255.f * 254.f - 127.f : texels[texelIndex][channel];
+        return values;
+    };
+
+    switch (dstFormat)
+    {
+        case EImageFormat::FORMAT_BC1_RGB_UNORM:
+        case EImageFormat::FORMAT_BC1_RGB_SRGB: EncodeColorBlock(texels, false, settings, outBlock); break;
+        case EImageFormat::FORMAT_BC1_RGBA_UNORM:
+        case EImageFormat::FORMAT_BC1_RGBA_SRGB: EncodeColorBlock(texels, true, settings, outBlock); break;
+        case EImageFormat::FORMAT_BC2_UNORM:
+        case EImageFormat::FORMAT_BC2_SRGB:
+        {
+            EncodeExplicitAlphaBlock(texels, outBlock);
+            EncodeColorBlock(texels, false, settings, outBlock + 8);
+            break;
+        }
+        case EImageFormat::FORMAT_BC3_UNORM:
+        case EImageFormat::FORMAT_BC3_SRGB:
+        {
+            EncodeSingleChannelBlock(getChannel(3, false), false, settings, outBlock);
+            EncodeColorBlock(texels, false, settings, outBlock + 8);
+            break;
+        }
+        case EImageFormat::FORMAT_BC4_UNORM:
+        case EImageFormat::FORMAT_BC4_SNORM:
+        {
+            const bool bSigned = dstFormat == EImageFormat::FORMAT_BC4_SNORM;
+            EncodeSingleChannelBlock(getChannel(0, bSigned), bSigned, settings, outBlock);
+            break;
+        }
+        case EImageFormat::FORMAT_BC5_UNORM:
+        case EImageFormat::FORMAT_BC5_SNORM:
+        {
+            const bool bSigned = dstFormat == EImageFormat::FORMAT_BC5_SNORM;
+            EncodeSingleChannelBlock(getChannel(0, bSigned), bSigned, settings, outBlock);
+            EncodeSingleChannelBlock(getChannel(1, bSigned), bSigned, settings, outBlock + 8);
+            break;
+        }
+        case EImageFormat::FORMAT_BC6H_UFLOAT:
+        case EImageFormat::FORMAT_BC6H_SFLOAT:
+            EncodeBC6HBlock(texels, dstFormat == EImageFormat::FORMAT_BC6H_SFLOAT, settings, outBlock);
+            break;
+        case EImageFormat::FORMAT_BC7_UNORM:
+        case EImageFormat::FORMAT_BC7_SRGB: EncodeBC7Block(texels, settings, outBlock); break;
+        default: PFR_ASSERT(false, "Unsupported BCn format!"); break;
+    }
+}
+
+}  // namespace BCnUtils
+
+namespace BCnEncoder
+{
+
+bool IsSupported(const EImageFormat srcFormat, const EImageFormat dstFormat)
+{
+    if (!ImageUtils::IsBCFormat(dstFormat)) return false;
+
+    const bool bLDRSource = srcFormat == EImageFormat::FORMAT_R8_UNORM || srcFormat == EImageFormat::FORMAT_RG8_UNORM ||
+                            srcFormat == EImageFormat::FORMAT_RGBA8_UNORM;
+    if (dstFormat == EImageFormat::FORMAT_BC6H_UFLOAT || dstFormat == EImageFormat::FORMAT_BC6H_SFLOAT)
+        return bLDRSource || BCnUtils::IsHDRFormat(srcFormat);
+
+    return bLDRSource;
+}
+
+size_t GetCompressedSize(const EImageFormat dstFormat, const uint32_t width, const uint32_t height)
+{
+    const size_t blockCountX = (width + BCnUtils::s_BLOCK_DIM - 1) / BCnUtils::s_BLOCK_DIM;
+    const size_t blockCountY = (height + BCnUtils::s_BLOCK_DIM - 1) / BCnUtils::s_BLOCK_DIM;
+    return blockCountX * blockCountY * BCnUtils::GetBlockSize(dstFormat);
+}
+
+void Encode(const void* srcData, const EImageFormat srcFormat, const uint32_t width, const uint32_t height, void* dstData,
+            const EImageFormat dstFormat, const ETextureCompressionQuality quality)
+{
+    PFR_ASSERT(srcData && dstData && width > 0 && height > 0, "Invalid image to encode!");
+    PFR_ASSERT(IsSupported(srcFormat, dstFormat), "Unsupported BCn encoding!");
+
+    const auto settings        = BCnUtils::GetEncodeSettings(quality);
+    const bool bHDRTarget      = dstFormat == EImageFormat::FORMAT_BC6H_UFLOAT || dstFormat == EImageFormat::FORMAT_BC6H_SFLOAT;
+    const bool bGrayscale      = !(dstFormat >= EImageFormat::FORMAT_BC4_UNORM && dstFormat <= EImageFormat::FORMAT_BC5_SNORM);
+    const uint32_t blockSize   = BCnUtils::GetBlockSize(dstFormat);
+    const uint32_t blockCountX = (width + BCnUtils::s_BLOCK_DIM - 1) / BCnUtils::s_BLOCK_DIM;
+    const uint32_t blockCountY = (height + BCnUtils::s_BLOCK_DIM - 1) / BCnUtils::s_BLOCK_DIM;
+
+    // NOTE: Row of blocks per job, rows are written into disjoint ranges of dstData.
+    ThreadPool::ParallelFor(blockCountY, 0,
+                            [&](const uint32_t blockY)
+                            {
+                                BCnUtils::BlockTexels texels = {};
+                                for (uint32_t blockX{}; blockX < blockCountX; ++blockX)
+                                {
+                                    BCnUtils::FetchBlock(static_cast<const uint8_t*>(srcData), srcFormat, width, height, blockX, blockY,
+                                                         bGrayscale, texels);
+                                    if (bHDRTarget && !BCnUtils::IsHDRFormat(srcFormat))
+                                    {
+                                        for (auto& texel : texels)
+                                            texel /= 255.f;
+                                    }
+
+                                    const size_t blockIndex = static_cast<size_t>(blockY) * blockCountX + blockX;
+                                    uint8_t* block          = static_cast<uint8_t*>(dstData) + blockIndex * blockSize;
+                                    BCnUtils::EncodeBlock(texels, dstFormat, settings, block);
+                                }
+                            });
+}
+
+}  // namespace BCnEncoder
+
+}  // namespace Pathfinder
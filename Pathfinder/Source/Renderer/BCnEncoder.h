@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Core/Core.h>
+#include "RendererCoreDefines.h"
+
+namespace Pathfinder
+{
+
+enum class ETextureCompressionQuality : uint8_t
+{
+    TEXTURE_COMPRESSION_QUALITY_FAST = 0,  // Bounding box endpoints.
+    TEXTURE_COMPRESSION_QUALITY_NORMAL     // Endpoints along principal axis + one least squares refinement.
+};
+
+// NOTE: Portable CPU BCn encoder. Blocks are independent, rows of blocks are encoded in parallel on ThreadPool, no global state,
+// so it can be called from several threads at once. Output is plain mip 0 block stream, the same thing GPU expects.
+// BC6H is single region(mode 11) and BC7 is single subset RGBA(mode 6), partitioned modes aren't searched, so there's no high quality
+// preset: more endpoint refinement can't make up for them. Output is checked against reference decoders in TextureBenchmarks.
+namespace BCnEncoder
+{
+
+// R8, RG8 and RGBA8 sources for everything, RGBA16F and RGBA32F for BC6H only.
+NODISCARD bool IsSupported(const EImageFormat srcFormat, const EImageFormat dstFormat);
+NODISCARD size_t GetCompressedSize(const EImageFormat dstFormat, const uint32_t width, const uint32_t height);
+
+// srcData is tightly packed srcFormat image, dstData has to hold at least GetCompressedSize() bytes.
+// R8/RG8 are treated as grayscale(+alpha) for color formats, BC4/BC5 take their channels as is.
+void Encode(const void* srcData, const EImageFormat srcFormat, const uint32_t width, const uint32_t height, void* dstData,
+            const EImageFormat dstFormat, const ETextureCompressionQuality quality);
+
+}  // namespace BCnEncoder
+
+}  // namespace Pathfinder
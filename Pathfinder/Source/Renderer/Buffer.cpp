@@ -18,4 +18,15 @@ Shared<Buffer> Buffer::Create(const BufferSpecification& bufferSpec, const void*
     return nullptr;
 }
 
+MemoryRequirements Buffer::GetMemoryRequirements(const BufferSpecification& bufferSpec)
+{
+    switch (RendererAPI::Get())
+    {
+        case ERendererAPI::RENDERER_API_VULKAN: return VulkanBuffer::GetMemoryRequirements(bufferSpec);
+    }
+
+    PFR_ASSERT(false, "Unknown RendererAPI!");
+    return {};
+}
+
 }  // namespace Pathfinder
\ No newline at end of file
@@ -8,10 +8,11 @@ namespace Pathfinder
 
 struct BufferSpecification
 {
-    std::string DebugName       = s_DEFAULT_STRING;
-    BufferFlags ExtraFlags      = 0;
-    BufferUsageFlags UsageFlags = 0;
-    size_t Capacity             = 0;
+    std::string DebugName           = s_DEFAULT_STRING;
+    BufferFlags ExtraFlags          = 0;
+    BufferUsageFlags UsageFlags     = 0;
+    size_t Capacity                 = 0;
+    MemoryAliasingInfo AliasingInfo = {};
 };
 
 class Buffer : private Uncopyable, private Unmovable
@@ -29,10 +30,11 @@ class Buffer : private Uncopyable, private Unmovable
     NODISCARD FORCEINLINE void* GetMapped() const { return m_Mapped; }
     template <typename T> NODISCARD FORCEINLINE void* GetMapped() const { return reinterpret_cast<T*>(m_Mapped); }
 
-    virtual void SetData(const void* data, const size_t dataSize) = 0;
-    virtual void Resize(const size_t newCapacity)                 = 0;
+    virtual UploadToken SetData(const void* data, const size_t dataSize) = 0;
+    virtual void Resize(const size_t newCapacity)                        = 0;
 
     NODISCARD static Shared<Buffer> Create(const BufferSpecification& bufferSpec, const void* data = nullptr, const size_t dataSize = 0);
+    NODISCARD static MemoryRequirements GetMemoryRequirements(const BufferSpecification& bufferSpec);
 
     virtual void SetDebugName(const std::string& name) = 0;
 
@@ -0,0 +1,50 @@
+#include <PathfinderPCH.h>
+#include "CPUProfiler.h"
+
+#include <Core/ThreadPool.h>
+
+namespace Pathfinder
+{
+
+void CPUProfiler::BeginFrame()
+{
+    std::scoped_lock lock(m_Mutex);
+
+    // NOTE: Tasks recorded in between frames(e.g. workers) belong to this one, so frame start is moved only if it's still empty.
+    if (m_CurrentFrame.Tasks.empty()) m_CurrentFrame.StartTime = std::chrono::steady_clock::now();
+}
+
+void CPUProfiler::EndFrame()
+{
+    std::scoped_lock lock(m_Mutex);
+
+    const uint64_t nextFrameNumber = m_CurrentFrame.FrameNumber + 1;
+    m_History.emplace_back(std::move(m_CurrentFrame));
+    while (m_History.size() > s_PROFILER_HISTORY_FRAME_COUNT)
+        m_History.pop_front();
+
+    m_CurrentFrame = {.StartTime = std::chrono::steady_clock::now(), .FrameNumber = nextFrameNumber};
+}
+
+void CPUProfiler::BeginTimestamp(const std::string& name, const glm::vec3& color)
+{
+    t_OpenTasks.emplace_back(std::chrono::steady_clock::now(), name, color);
+}
+
+void CPUProfiler::EndTimestamp()
+{
+    PFR_ASSERT(!t_OpenTasks.empty(), "EndTimestamp() without BeginTimestamp() on this thread!");
+
+    const auto endTime = std::chrono::steady_clock::now();
+    auto openTask      = std::move(t_OpenTasks.back());
+    t_OpenTasks.pop_back();
+
+    std::scoped_lock lock(m_Mutex);
+    const auto toFrameMs = [&](const std::chrono::steady_clock::time_point& timePoint)
+    { return std::chrono::duration<double, std::milli>(timePoint - m_CurrentFrame.StartTime).count(); };
+
+    m_CurrentFrame.Tasks.emplace_back(toFrameMs(openTask.StartTime), toFrameMs(endTime), std::move(openTask.Tag),
+                                      ThreadPool::MapThreadID(std::this_thread::get_id()), openTask.Color);
+}
+
+}  // namespace Pathfinder
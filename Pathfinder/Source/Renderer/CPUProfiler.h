@@ -1,42 +1,66 @@
 #pragma once
 
 #include <Core/Core.h>
+#include <mutex>
+#include <deque>
 
 namespace Pathfinder
 {
 
+static constexpr uint32_t s_PROFILER_HISTORY_FRAME_COUNT = 240;
+
+// NOTE: Thread-safe, scopes can be recorded from ThreadPool workers as well, every task is tagged with its thread index.
+// Last s_PROFILER_HISTORY_FRAME_COUNT frames are kept for trace export.
 class CPUProfiler final
 {
   public:
     CPUProfiler()  = default;
     ~CPUProfiler() = default;
 
-    FORCEINLINE void BeginFrame()
-    {
-        m_ProfilerTasks.clear();
-        m_FrameStartTime = Timer::Now();
-        ++m_FrameNumber;
-    }
-    FORCEINLINE void EndFrame() {}
+    void BeginFrame();
+    void EndFrame();
+
+    // Scopes nest per thread, EndTimestamp() closes the last one opened on the calling thread.
+    void BeginTimestamp(const std::string& name, const glm::vec3& color = glm::vec3{1.f});
+    void EndTimestamp();
 
-    FORCEINLINE void BeginTimestamp(const std::string& name, const glm::vec3& color = glm::vec3{1.f})
+    // Tasks of the last finished frame.
+    NODISCARD FORCEINLINE const auto& GetResults() const
     {
-        m_ProfilerTasks.emplace_back(GetCurrentFrameTimeSeconds(), 0.0, name, color);
+        PFR_ASSERT(!m_History.empty(), "No frames were profiled yet!");
+        return m_History.back().Tasks;
     }
 
-    FORCEINLINE void EndTimestamp() { m_ProfilerTasks.back().EndTime = GetCurrentFrameTimeSeconds(); }
-
-    NODISCARD FORCEINLINE const auto& GetResults() const { return m_ProfilerTasks; }
+    // Main thread only, history is modified in EndFrame().
+    NODISCARD FORCEINLINE const auto& GetHistory() const { return m_History; }
 
   private:
-    std::chrono::high_resolution_clock::time_point m_FrameStartTime{};
-    std::vector<ProfilerTask> m_ProfilerTasks;
-    uint64_t m_FrameNumber{};
+    struct OpenTask
+    {
+        std::chrono::steady_clock::time_point StartTime{};
+        std::string Tag = s_DEFAULT_STRING;
+        glm::vec3 Color{1.f};
+    };
+
+    static inline thread_local std::vector<OpenTask> t_OpenTasks;
 
-    NODISCARD FORCEINLINE double GetCurrentFrameTimeSeconds() const
+    std::mutex m_Mutex;
+    ProfilerFrame m_CurrentFrame = {.StartTime = std::chrono::steady_clock::now()};
+    std::deque<ProfilerFrame> m_History;
+};
+
+// RAII helper for code outside render graph passes(e.g. ThreadPool jobs).
+class CPUProfilerScope final : private Uncopyable, private Unmovable
+{
+  public:
+    CPUProfilerScope(CPUProfiler& profiler, const std::string& name, const glm::vec3& color = glm::vec3{1.f}) : m_Profiler(profiler)
     {
-        return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(Timer::Now() - m_FrameStartTime).count());
+        m_Profiler.BeginTimestamp(name, color);
     }
+    ~CPUProfilerScope() { m_Profiler.EndTimestamp(); }
+
+  private:
+    CPUProfiler& m_Profiler;
 };
 
 }  // namespace Pathfinder
\ No newline at end of file
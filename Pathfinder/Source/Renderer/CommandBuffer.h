@@ -31,6 +31,13 @@ struct CommandBufferSpecification
     uint8_t ThreadID          = 0;
 };
 
+// NOTE: Dynamic rendering state secondary command buffer continues, has to match BeginRendering() of the primary executing it.
+struct RenderingInheritanceInfo
+{
+    std::vector<EImageFormat> ColorFormats;
+    EImageFormat DepthFormat = EImageFormat::FORMAT_UNDEFINED;
+};
+
 class QueryPool : private Uncopyable, private Unmovable
 {
   public:
@@ -111,14 +118,19 @@ class CommandBuffer : private Uncopyable, private Unmovable
     virtual void BeginRecording(bool bOneTimeSubmit = false, const void* inheritanceInfo = nullptr) = 0;
     virtual void EndRecording() const                                                               = 0;
 
+    // Secondary only, without inheritance info it's recorded outside of rendering, otherwise continues one begun by the primary.
+    virtual void BeginSecondaryRecording(const Optional<RenderingInheritanceInfo>& renderingInheritanceInfo = std::nullopt) = 0;
+    virtual void ExecuteSecondaries(const std::vector<Shared<CommandBuffer>>& secondaryCommandBuffers) const               = 0;
+
     virtual void SetViewportAndScissor(const uint32_t width, const uint32_t height, const int32_t offsetX = 0,
                                        const int32_t offsetY = 0) const                 = 0;
     virtual void BindPipeline(Shared<Pipeline>& pipeline) const                         = 0;
     virtual void BindPushConstants(Shared<Pipeline> pipeline, const uint32_t offset, const uint32_t size,
                                    const void* data = nullptr) const                    = 0;
-    virtual void BeginRendering(const std::vector<Shared<Texture>>& attachments,
-                                const std::vector<RenderingInfo>& renderingInfos) const = 0;
-    virtual void EndRendering() const                                                   = 0;
+    // NOTE: With bSecondaryContents rendering can only contain ExecuteSecondaries(), secondaries set dynamic state themselves.
+    virtual void BeginRendering(const std::vector<Shared<Texture>>& attachments, const std::vector<RenderingInfo>& renderingInfos,
+                                const bool bSecondaryContents = false) const = 0;
+    virtual void EndRendering() const                                        = 0;
 
     FORCEINLINE virtual void Dispatch(const uint32_t groupCountX, const uint32_t groupCountY = 1, const uint32_t groupCountZ = 1) const = 0;
 
@@ -26,6 +26,9 @@ class DescriptorManager : private Uncopyable, private Unmovable
     virtual void LoadImage(const void* pImageInfo, Optional<uint32_t>& outIndex)     = 0;
     virtual void LoadTexture(const void* pTextureInfo, Optional<uint32_t>& outIndex) = 0;
 
+    // NOTE: Rewrites already loaded texture slot in a single frame's set, that set must not be in use by GPU.
+    virtual void UpdateTexture(const void* pTextureInfo, const uint32_t textureIndex, const uint8_t frameIndex) = 0;
+
     virtual void FreeImage(Optional<uint32_t>& imageIndex)     = 0;
     virtual void FreeTexture(Optional<uint32_t>& textureIndex) = 0;
 
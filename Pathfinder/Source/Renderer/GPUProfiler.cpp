@@ -0,0 +1,45 @@
+#include <PathfinderPCH.h>
+#include "GPUProfiler.h"
+
+namespace Pathfinder
+{
+
+void GPUProfiler::CalculateResults(const Shared<CommandBuffer>& commandBuffer)
+{
+    m_PipelineStatistics = commandBuffer->CalculateQueryPoolStatisticsResults(m_PipelineStatisticsQueryPool);
+    if (m_ProfilerTasks.empty()) return;
+
+    const auto rawProfilerResults = commandBuffer->CalculateQueryPoolProfilerResults(m_ProfilerQueryPool, m_ProfilerTasks.size() * 2);
+
+    // NOTE: timestampPeriod contains the number of nanoseconds it takes for a timestamp query value to be increased by 1("tick").
+    const double timestampPeriod = static_cast<double>(GraphicsContext::Get().GetTimestampPeriod());
+
+    // Without calibration first timestamp is anchored to submit time, good enough to eyeball the frame.
+    const auto calibratedTimestamp = GraphicsContext::Get().GetCalibratedTimestamp();
+    const auto calibration         = calibratedTimestamp.value_or(
+        CalibratedTimestamp{.DeviceTicks = rawProfilerResults.front(), .HostTime = m_SubmitTime});
+
+    const auto ticksToHostTime = [&](const uint64_t ticks)
+    {
+        const double deltaNs = static_cast<double>(static_cast<int64_t>(ticks - calibration.DeviceTicks)) * timestampPeriod;
+        return calibration.HostTime +
+               std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::nano>(deltaNs));
+    };
+
+    ProfilerFrame frame  = {.StartTime = ticksToHostTime(rawProfilerResults.front()), .FrameNumber = m_RecordedFrameNumber};
+    const auto toFrameMs   = [&](const uint64_t ticks)
+    { return std::chrono::duration<double, std::milli>(ticksToHostTime(ticks) - frame.StartTime).count(); };
+    for (size_t i{}, k{}; i + 1 < rawProfilerResults.size(); i += 2, ++k)
+    {
+        auto& task     = m_ProfilerTasks.at(k);
+        task.StartTime = toFrameMs(rawProfilerResults[i]);
+        task.EndTime   = toFrameMs(rawProfilerResults[i + 1]);
+    }
+
+    frame.Tasks = m_ProfilerTasks;
+    m_History.emplace_back(std::move(frame));
+    while (m_History.size() > s_PROFILER_HISTORY_FRAME_COUNT)
+        m_History.pop_front();
+}
+
+}  // namespace Pathfinder
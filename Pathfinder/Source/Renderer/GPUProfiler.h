@@ -3,10 +3,13 @@
 #include <Core/Core.h>
 #include <Renderer/CommandBuffer.h>
 #include <Renderer/GraphicsContext.h>
+#include <Renderer/CPUProfiler.h>
 
 namespace Pathfinder
 {
 
+// NOTE: Results are mapped onto CPU timeline through calibrated timestamps(if device supports them, otherwise first timestamp is
+// anchored to submit time), last s_PROFILER_HISTORY_FRAME_COUNT frames are kept for trace export.
 class GPUProfiler final
 {
   public:
@@ -24,7 +27,12 @@ class GPUProfiler final
         m_PipelineStatistics.clear();
         m_CurrentTimestampIndex = 0;
     }
-    FORCEINLINE void EndFrame() {}
+    // Called right before submit.
+    FORCEINLINE void EndFrame()
+    {
+        m_SubmitTime = std::chrono::steady_clock::now();
+        ++m_FrameNumber;
+    }
 
     FORCEINLINE void BeginPipelineStatisticsQuery(const Shared<CommandBuffer>& commandBuffer)
     {
@@ -40,7 +48,11 @@ class GPUProfiler final
     FORCEINLINE void BeginTimestamp(const Shared<CommandBuffer>& commandBuffer, const std::string& name, const glm::vec3& color,
                                     const EPipelineStage pipelineStage = EPipelineStage::PIPELINE_STAGE_TOP_OF_PIPE_BIT)
     {
-        if (m_ProfilerTasks.empty()) commandBuffer->ResetPool(m_ProfilerQueryPool);
+        if (m_ProfilerTasks.empty())
+        {
+            commandBuffer->ResetPool(m_ProfilerQueryPool);
+            m_RecordedFrameNumber = m_FrameNumber;
+        }
 
         auto& task = m_ProfilerTasks.emplace_back();
         task.Tag   = name;
@@ -55,23 +67,10 @@ class GPUProfiler final
         commandBuffer->WriteTimestamp(m_ProfilerQueryPool, m_CurrentTimestampIndex++, pipelineStage);
     }
 
-    FORCEINLINE void CalculateResults(const Shared<CommandBuffer>& commandBuffer)
-    {
-        m_PipelineStatistics          = commandBuffer->CalculateQueryPoolStatisticsResults(m_PipelineStatisticsQueryPool);
-        const auto rawProfilerResults = commandBuffer->CalculateQueryPoolProfilerResults(m_ProfilerQueryPool, m_ProfilerTasks.size() * 2);
-
-        // NOTE: timestampPeriod contains the number of nanoseconds it takes for a timestamp query value to be increased by 1("tick").
-        const float timestampPeriod = GraphicsContext::Get().GetTimestampPeriod();
-        for (size_t i{}, k{}; i < rawProfilerResults.size() - 1; i += 2, ++k)
-        {
-            auto& task     = m_ProfilerTasks.at(k);
-            task.StartTime = 0.f;
-            task.EndTime   = static_cast<float>(rawProfilerResults[i + 1] - rawProfilerResults[i]) * timestampPeriod /
-                           1000000.0f;  // convert nanoseconds to milliseconds
-        }
-    }
+    void CalculateResults(const Shared<CommandBuffer>& commandBuffer);
     NODISCARD FORCEINLINE const auto& GetProfilerResults() const { return m_ProfilerTasks; }
     NODISCARD FORCEINLINE const auto& GetPipelineStatisticsResults() const { return m_PipelineStatistics; }
+    NODISCARD FORCEINLINE const auto& GetHistory() const { return m_History; }
 
   private:
     Shared<QueryPool> m_PipelineStatisticsQueryPool = nullptr;
@@ -79,6 +78,10 @@ class GPUProfiler final
     uint32_t m_CurrentTimestampIndex                = 0;
     std::vector<ProfilerTask> m_ProfilerTasks;
     std::vector<std::pair<std::string, std::uint64_t>> m_PipelineStatistics;
+    std::deque<ProfilerFrame> m_History;
+    std::chrono::steady_clock::time_point m_SubmitTime{};
+    uint64_t m_FrameNumber         = 0;
+    uint64_t m_RecordedFrameNumber = 0;  // Frame the queries in the pool belong to.
 };
 
 }  // namespace Pathfinder
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include <PathfinderPCH.h>
+#include "GPUScene.h"
+
+#include "Renderer.h"
+#include "Buffer.h"
+#include "Material.h"
+#include "Mesh/Submesh.h"
+
+namespace Pathfinder
+{
+
+static constexpr uint32_t s_INITIAL_SLOT_CAPACITY = 256;
+
+GPUScene::GPUScene(const std::string_view& debugName)
+{
+    static_assert(s_FRAMES_IN_FLIGHT <= 8, "Dirty frame mask is uint8_t!");
+
+    for (uint8_t frame{}; frame < s_FRAMES_IN_FLIGHT; ++frame)
+    {
+        const BufferSpecification bufferSpec = {.DebugName  = std::string(debugName) + "_" + std::to_string(frame),
+                                                .ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL | EBufferFlag::BUFFER_FLAG_MAPPED,
+                                                .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
+                                                .Capacity   = s_INITIAL_SLOT_CAPACITY * sizeof(MeshData)};
+        m_Buffers[frame]                     = Buffer::Create(bufferSpec);
+    }
+
+    const BufferSpecification visibilityBufferSpec = {.DebugName  = std::string(debugName) + "_Visibility",
+                                                      .ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
+                                                      .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
+                                                      .Capacity   = s_INITIAL_SLOT_CAPACITY * sizeof(uint32_t)};
+    m_VisibilityBuffer                             = Buffer::Create(visibilityBufferSpec);
+}
+
+uint32_t GPUScene::AddObject(const Shared<Submesh>& submesh, const glm::vec3& translation, const glm::vec3& scale,
+                            const glm::vec4& orientation)
+{
+    const uint32_t slot         = AllocateSlot(submesh);
+    const uint32_t meshletCount = submesh->GetMeshletBuffer()->GetSpecification().Capacity / sizeof(Meshlet);
+    m_Records[slot]             = {.sphere                    = submesh->GetBoundingSphere(),
+                                   .meshletCount              = meshletCount,
+                                   .translation               = translation,
+                                   .scale                     = scale,
+                                   .orientation               = orientation,
+                                   .positionCenter            = submesh->GetPositionCenter(),
+                                   .positionExtent            = submesh->GetPositionExtent(),
+                                   .materialBufferBDA         = submesh->GetMaterial()->GetBDA(),
+                                   .indexBufferBDA            = submesh->GetIndexBuffer()->GetBDA(),
+                                   .vertexPosBufferBDA        = submesh->GetVertexPositionBuffer()->GetBDA(),
+                                   .vertexAttributeBufferBDA  = submesh->GetVertexAttributeBuffer()->GetBDA(),
+                                   .meshletBufferBDA          = submesh->GetMeshletBuffer()->GetBDA(),
+                                   .meshletVerticesBufferBDA  = submesh->GetMeshletVerticesBuffer()->GetBDA(),
+                                   .meshletTrianglesBufferBDA = submesh->GetMeshletTrianglesBuffer()->GetBDA()};
+    MarkDirty(slot);
+    return slot;
+}
+
+void GPUScene::UpdateObject(const uint32_t slot, const glm::vec3& translation, const glm::vec3& scale, const glm::vec4& orientation)
+{
+    PFR_ASSERT(slot < m_Records.size() && m_SlotSubmeshes[slot], "Updating object that isn't in GPUScene!");
+
+    // NOTE: Geometry buffers of the submesh are immutable, only transform and material can change.
+    const uint64_t materialBDA = m_SlotSubmeshes[slot]->GetMaterial()->GetBDA();
+    auto& record               = m_Records[slot];
+    if (record.translation == translation && record.scale == scale && record.orientation == orientation &&
+        record.materialBufferBDA == materialBDA)
+        return;
+
+    record.translation       = translation;
+    record.scale             = scale;
+    record.orientation       = orientation;
+    record.materialBufferBDA = materialBDA;
+    MarkDirty(slot);
+}
+
+void GPUScene::RemoveObject(const uint32_t slot)
+{
+    PFR_ASSERT(slot < m_Records.size() && m_SlotSubmeshes[slot], "Removing object that isn't in GPUScene!");
+
+    m_Records[slot] = {};  // meshletCount == 0 marks empty slot.
+    m_SlotSubmeshes[slot].reset();
+    m_FreeSlots.emplace_back(slot);
+    MarkDirty(slot);
+}
+
+void GPUScene::EndUpdate(const uint8_t frameIndex)
+{
+    UpdateVisibilityBuffer(frameIndex);
+
+    auto& buffer      = m_Buffers.at(frameIndex);
+    auto& dirtySlots  = m_DirtySlots.at(frameIndex);
+    const uint8_t bit = 1 << frameIndex;
+
+    auto& rs                = Renderer::GetStats();
+    const size_t tableSize  = m_Records.size() * sizeof(MeshData);
+    const bool bNeedsResize = tableSize > buffer->GetSpecification().Capacity;
+    if (bNeedsResize) buffer->Resize(std::max(tableSize, buffer->GetSpecification().Capacity * 3 / 2));
+
+    if (!bNeedsResize && dirtySlots.empty()) return;
+
+    // NOTE: Resize() drops contents, non-mappable buffers go through staging, in both cases upload whole table at once.
+    if (bNeedsResize || !buffer->GetMapped())
+    {
+        if (tableSize > 0) buffer->SetData(m_Records.data(), tableSize);
+
+        for (const auto slot : dirtySlots)
+            m_DirtyFrameMasks[slot] &= ~bit;
+        dirtySlots.clear();
+
+        rs.SceneRecordsUploaded += static_cast<uint32_t>(m_Records.size());
+        rs.SceneUploadRangeCount += tableSize > 0 ? 1 : 0;
+        return;
+    }
+
+    // Coalesce sorted dirty slots into contiguous ranges to keep number of writes low.
+    std::ranges::sort(dirtySlots);
+    auto* mapped = static_cast<uint8_t*>(buffer->GetMapped());
+    for (size_t rangeBegin{}; rangeBegin < dirtySlots.size();)
+    {
+        size_t rangeEnd = rangeBegin + 1;
+        while (rangeEnd < dirtySlots.size() && dirtySlots[rangeEnd] == dirtySlots[rangeEnd - 1] + 1)
+            ++rangeEnd;
+
+        const uint32_t firstSlot = dirtySlots[rangeBegin];
+        std::memcpy(mapped + firstSlot * sizeof(MeshData), &m_Records[firstSlot], (rangeEnd - rangeBegin) * sizeof(MeshData));
+
+        for (size_t i = rangeBegin; i < rangeEnd; ++i)
+            m_DirtyFrameMasks[dirtySlots[i]] &= ~bit;
+
+        rs.SceneRecordsUploaded += static_cast<uint32_t>(rangeEnd - rangeBegin);
+        ++rs.SceneUploadRangeCount;
+        rangeBegin = rangeEnd;
+    }
+    dirtySlots.clear();
+}
+
+uint32_t GPUScene::AllocateSlot(const Shared<Submesh>& submesh)
+{
+    uint32_t slot = 0;
+    if (!m_FreeSlots.empty())
+    {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(m_Records.size());
+        m_Records.emplace_back();
+        m_SlotSubmeshes.emplace_back();
+        m_DirtyFrameMasks.emplace_back(0);
+    }
+
+    m_SlotSubmeshes[slot] = submesh;
+    return slot;
+}
+
+void GPUScene::UpdateVisibilityBuffer(const uint8_t frameIndex)
+{
+    // NOTE: Frame that used to have this index is finished by now, so buffers retired back then are safe to destroy.
+    m_RetiredVisibilityBuffers.at(frameIndex).reset();
+
+    const size_t visibilitySize = m_Records.size() * sizeof(uint32_t);
+    if (visibilitySize > m_VisibilityBuffer->GetSpecification().Capacity)
+    {
+        auto bufferSpec     = m_VisibilityBuffer->GetSpecification();
+        bufferSpec.Capacity = std::max(visibilitySize, bufferSpec.Capacity * 3 / 2);
+
+        m_RetiredVisibilityBuffers.at(frameIndex) = m_VisibilityBuffer;
+        m_VisibilityBuffer                        = Buffer::Create(bufferSpec);
+        m_VisibilityWrittenSlotCount              = 0;  // New buffer has no history.
+    }
+
+    // Late culling of this frame writes all slots, next frame can rely on them.
+    m_VisibilityHistorySlotCount = m_VisibilityWrittenSlotCount;
+    m_VisibilityWrittenSlotCount = GetSlotCount();
+}
+
+void GPUScene::MarkDirty(const uint32_t slot)
+{
+    for (uint8_t frame{}; frame < s_FRAMES_IN_FLIGHT; ++frame)
+    {
+        const uint8_t bit = 1 << frame;
+        if (m_DirtyFrameMasks[slot] & bit) continue;
+
+        m_DirtyFrameMasks[slot] |= bit;
+        m_DirtySlots[frame].emplace_back(slot);
+    }
+}
+
+}  // namespace Pathfinder
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Core/Core.h>
+#include "RendererCoreDefines.h"
+
+namespace Pathfinder
+{
+
+class Buffer;
+class Submesh;
+
+/*
+ * Persistent GPU-resident table of MeshData records.
+ * Objects are added once and keep their slot until removed, callers only report changes(see Renderer mesh instances), so per frame
+ * cost depends on number of changed records, not on number of objects. Changed records are uploaded, coalesced into contiguous
+ * ranges. Freed slots keep meshletCount == 0, culling shader skips them.
+ * Visibility buffer keeps per slot result of the late occlusion culling, it's only touched by GPU, frame after frame.
+ */
+class GPUScene final : private Uncopyable, private Unmovable
+{
+  public:
+    GPUScene(const std::string_view& debugName);
+    ~GPUScene() = default;
+
+    NODISCARD uint32_t AddObject(const Shared<Submesh>& submesh, const glm::vec3& translation, const glm::vec3& scale,
+                                 const glm::vec4& orientation);
+    // NOTE: Material BDA is refetched as well, in case submesh got another material.
+    void UpdateObject(const uint32_t slot, const glm::vec3& translation, const glm::vec3& scale, const glm::vec4& orientation);
+    void RemoveObject(const uint32_t slot);
+
+    // Uploads records changed since frame's buffer was last updated.
+    void EndUpdate(const uint8_t frameIndex);
+
+    NODISCARD FORCEINLINE const auto& GetBuffer(const uint8_t frameIndex) const { return m_Buffers.at(frameIndex); }
+    NODISCARD FORCEINLINE uint32_t GetSlotCount() const { return static_cast<uint32_t>(m_Records.size()); }
+    NODISCARD FORCEINLINE uint32_t GetObjectCount() const { return GetSlotCount() - static_cast<uint32_t>(m_FreeSlots.size()); }
+
+    NODISCARD FORCEINLINE const auto& GetVisibilityBuffer() const { return m_VisibilityBuffer; }
+    // Slots whose visibility was written by previous frame, the rest are treated as not visible.
+    NODISCARD FORCEINLINE uint32_t GetVisibilityHistorySlotCount() const { return m_VisibilityHistorySlotCount; }
+
+  private:
+    BufferPerFrame m_Buffers;
+    std::vector<MeshData> m_Records;                // CPU mirror of the table.
+    std::vector<Shared<Submesh>> m_SlotSubmeshes;   // Keeps submesh alive while its slot is occupied.
+    std::vector<uint8_t> m_DirtyFrameMasks;         // Per slot, bit per frame in flight whose buffer hasn't received the record yet.
+    std::array<std::vector<uint32_t>, s_FRAMES_IN_FLIGHT> m_DirtySlots;
+    std::vector<uint32_t> m_FreeSlots;
+
+    Shared<Buffer> m_VisibilityBuffer     = nullptr;
+    BufferPerFrame m_RetiredVisibilityBuffers;  // Grown out buffers stay alive until frames that might use them are finished.
+    uint32_t m_VisibilityHistorySlotCount = 0;
+    uint32_t m_VisibilityWrittenSlotCount = 0;
+
+    NODISCARD uint32_t AllocateSlot(const Shared<Submesh>& submesh);
+    void MarkDirty(const uint32_t slot);
+    void UpdateVisibilityBuffer(const uint8_t frameIndex);
+};
+
+}  // namespace Pathfinder
@@ -7,6 +7,8 @@
 namespace Pathfinder
 {
 
+enum class ECommandBufferType : uint8_t;
+
 class GraphicsContext : private Uncopyable, private Unmovable
 {
   public:
@@ -25,9 +27,21 @@ class GraphicsContext : private Uncopyable, private Unmovable
 
     static Unique<GraphicsContext> Create(const ERendererAPI rendererApi);
 
-    NODISCARD virtual const float GetTimestampPeriod() const                     = 0;
-    virtual void FillMemoryBudgetStats(std::vector<MemoryBudget>& memoryBudgets) = 0;
-    virtual void WaitDeviceOnFinish() const                                      = 0;
+    NODISCARD virtual const float GetTimestampPeriod() const                       = 0;
+    NODISCARD virtual Optional<CalibratedTimestamp> GetCalibratedTimestamp() const = 0;  // Empty if device can't calibrate.
+    virtual void FillMemoryBudgetStats(std::vector<MemoryBudget>& memoryBudgets)   = 0;
+    virtual void WaitDeviceOnFinish() const                                        = 0;
+
+    // NOTE: Queue types may share the same family, ownership transfers between them aren't needed then.
+    NODISCARD virtual uint32_t GetQueueFamilyIndex(const ECommandBufferType commandBufferType) const = 0;
+
+    // NOTE: Raw device-local memory block, resources are placed into it through MemoryAliasingInfo.
+    NODISCARD virtual void* AllocateMemory(const MemoryRequirements& memoryRequirements) = 0;
+    virtual void FreeMemory(void*& memory)                                               = 0;
+
+    // NOTE: SetData() of device-local resources is batched, GPU consumers wait on uploads implicitly on submit, CPU has to ask.
+    NODISCARD virtual bool IsUploadComplete(const UploadToken& uploadToken) const = 0;
+    virtual void WaitForUpload(const UploadToken& uploadToken) const              = 0;
 
     virtual void Begin() = 0;
     virtual void End()   = 0;
@@ -0,0 +1,76 @@
+#include <PathfinderPCH.h>
+#include "HiZPyramid.h"
+
+#include "Image.h"
+#include "HiZ.h"
+
+namespace Pathfinder
+{
+
+void HiZPyramid::Build(const float* depth, const uint32_t width, const uint32_t height)
+{
+    PFR_ASSERT(depth && width > 0 && height > 0, "Invalid depth to build HiZ pyramid from!");
+
+    m_Levels.resize(ImageUtils::CalculateMipCount(width, height));
+    m_Levels[0] = {.Width = width, .Height = height, .Depth = std::vector<float>(depth, depth + width * height)};
+
+    for (uint32_t level = 1; level < m_Levels.size(); ++level)
+    {
+        const auto& src     = m_Levels[level - 1];
+        const ivec2 srcSize = ivec2(src.Width, src.Height);
+        const ivec2 dstSize = GetHiZLevelSize(ivec2(width, height), level);
+        auto& dst           = m_Levels[level];
+        dst.Width           = static_cast<uint32_t>(dstSize.x);
+        dst.Height          = static_cast<uint32_t>(dstSize.y);
+        dst.Depth.resize(dst.Width * dst.Height);
+
+        for (int32_t y{}; y < dstSize.y; ++y)
+        {
+            for (int32_t x{}; x < dstSize.x; ++x)
+            {
+                const ivec4 footprint = GetHiZReductionFootprint(ivec2(x, y), srcSize);
+
+                float minDepth = 1.0f;
+                for (int32_t sy = footprint.y; sy <= footprint.w; ++sy)
+                    for (int32_t sx = footprint.x; sx <= footprint.z; ++sx)
+                        minDepth = std::min(minDepth, src.Depth[sy * src.Width + sx]);
+
+                dst.Depth[y * dst.Width + x] = minDepth;
+            }
+        }
+    }
+}
+
+float HiZPyramid::Load(const uint32_t level, const uint32_t x, const uint32_t y) const
+{
+    const auto& lvl = m_Levels.at(level);
+    PFR_ASSERT(x < lvl.Width && y < lvl.Height, "HiZ texel out of bounds!");
+    return lvl.Depth[y * lvl.Width + x];
+}
+
+uint32_t HiZPyramid::SelectLevel(const glm::vec4& uvRect) const
+{
+    PFR_ASSERT(!m_Levels.empty(), "HiZ pyramid isn't built!");
+    return SelectHiZLevel(uvRect, ivec2(m_Levels[0].Width, m_Levels[0].Height), GetLevelCount());
+}
+
+bool HiZPyramid::IsSphereOccluded(const glm::vec3& viewCenter, const float radius, const glm::mat4& projection, const float zNear) const
+{
+    if (m_Levels.empty()) return false;
+
+    const HiZSphereProjection projectedSphere = ProjectSphereHiZ(viewCenter, radius, projection, zNear);
+    if (!projectedSphere.bValid) return false;
+
+    const ivec2 baseSize = ivec2(m_Levels[0].Width, m_Levels[0].Height);
+    const uint32_t level = SelectLevel(projectedSphere.UVRect);
+    const ivec4 texels   = GetHiZTestTexels(projectedSphere.UVRect, GetHiZLevelSize(baseSize, level));
+
+    float pyramidDepth = 1.0f;
+    for (int32_t y = texels.y; y <= texels.w; ++y)
+        for (int32_t x = texels.x; x <= texels.z; ++x)
+            pyramidDepth = std::min(pyramidDepth, Load(level, x, y));
+
+    return IsHiZOccluded(projectedSphere.NearestDepth, pyramidDepth);
+}
+
+}  // namespace Pathfinder
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Core/Core.h>
+
+namespace Pathfinder
+{
+
+/*
+ * CPU reference of the Hi-Z occlusion culling done on GPU(DepthReduce.comp, ObjectCulling.comp and DepthPrePass.task late variants).
+ * Reduction footprint, sphere projection and level selection come from the same HiZ.h shaders use, so results match texel for texel
+ * and culling can be verified without GPU.
+ */
+class HiZPyramid final
+{
+  public:
+    HiZPyramid()  = default;
+    ~HiZPyramid() = default;
+
+    // Level 0 is a copy of reversed-Z depth, every next level is MIN-reduced previous one.
+    void Build(const float* depth, const uint32_t width, const uint32_t height);
+
+    NODISCARD FORCEINLINE uint32_t GetLevelCount() const { return static_cast<uint32_t>(m_Levels.size()); }
+    NODISCARD FORCEINLINE glm::uvec2 GetLevelSize(const uint32_t level) const
+    {
+        return {m_Levels.at(level).Width, m_Levels.at(level).Height};
+    }
+    NODISCARD float Load(const uint32_t level, const uint32_t x, const uint32_t y) const;
+
+    // Level screen rect(minU, minV, maxU, maxV) is tested at, the one where it spans at most 2x2 texels.
+    NODISCARD uint32_t SelectLevel(const glm::vec4& uvRect) const;
+
+    // Sphere is in view space, projection is the one camera renders depth with. Spheres crossing near plane are never occluded.
+    NODISCARD bool IsSphereOccluded(const glm::vec3& viewCenter, const float radius, const glm::mat4& projection, const float zNear) const;
+
+  private:
+    struct Level
+    {
+        uint32_t Width  = 0;
+        uint32_t Height = 0;
+        std::vector<float> Depth;
+    };
+
+    std::vector<Level> m_Levels;
+};
+
+}  // namespace Pathfinder
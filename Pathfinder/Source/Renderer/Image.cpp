@@ -18,27 +18,30 @@ void* LoadRawImage(const std::filesystem::path& imagePath, bool bFlipOnLoad, int
 {
     PFR_ASSERT(!imagePath.empty() && x && y && nChannels, "Invalid data passed into LoadRawImage()!");
 
-    const auto prevFlipOnLoad = stbi__vertically_flip_on_load_global;
-    stbi_set_flip_vertically_on_load(bFlipOnLoad);
+    stbi_set_flip_vertically_on_load_thread(bFlipOnLoad);
 
     void* imageData = stbi_load(imagePath.string().data(), x, y, nChannels, STBI_default);
     PFR_ASSERT(imageData, "Failed to load image data!");
 
-    stbi_set_flip_vertically_on_load(prevFlipOnLoad);
     return imageData;
 }
 
+bool GetRawImageInfo(const std::filesystem::path& imagePath, int32_t* x, int32_t* y, int32_t* nChannels)
+{
+    PFR_ASSERT(!imagePath.empty() && x && y && nChannels, "Invalid data passed into GetRawImageInfo()!");
+
+    return stbi_info(imagePath.string().data(), x, y, nChannels) != 0;
+}
+
 void* LoadRawImageFromMemory(const uint8_t* data, size_t dataSize, bool bFlipOnLoad, int32_t* x, int32_t* y, int32_t* nChannels)
 {
     PFR_ASSERT(data && x && y && nChannels, "Invalid data passed into LoadRawImageFromMemory()!");
 
-    const auto prevFlipOnLoad = stbi__vertically_flip_on_load_global;
-    stbi_set_flip_vertically_on_load(bFlipOnLoad);
+    stbi_set_flip_vertically_on_load_thread(bFlipOnLoad);
 
     void* imageData = stbi_load_from_memory(data, dataSize, x, y, nChannels, STBI_default);
     PFR_ASSERT(imageData, "Failed to load image data!");
 
-    stbi_set_flip_vertically_on_load(prevFlipOnLoad);
     return imageData;
 }
 
@@ -129,6 +132,52 @@ void UnloadRawImage(void* data)
     stbi_image_free(data);
 }
 
+std::vector<uint8_t> GenerateMipChain(const uint8_t* data, const uint32_t width, const uint32_t height, const uint32_t channelCount)
+{
+    PFR_ASSERT(data && width > 0 && height > 0 && channelCount > 0, "Invalid data passed into GenerateMipChain()!");
+
+    const uint32_t mipCount = CalculateMipCount(width, height);
+    size_t chainSize        = 0;
+    for (uint32_t mip{}; mip < mipCount; ++mip)
+        chainSize += static_cast<size_t>(std::max(width >> mip, 1u)) * std::max(height >> mip, 1u) * channelCount;
+
+    std::vector<uint8_t> mipChain(chainSize);
+    std::memcpy(mipChain.data(), data, static_cast<size_t>(width) * height * channelCount);
+
+    size_t srcOffset = 0;
+    size_t dstOffset = static_cast<size_t>(width) * height * channelCount;
+    for (uint32_t mip = 1; mip < mipCount; ++mip)
+    {
+        const uint32_t srcWidth  = std::max(width >> (mip - 1), 1u);
+        const uint32_t srcHeight = std::max(height >> (mip - 1), 1u);
+        const uint32_t dstWidth  = std::max(width >> mip, 1u);
+        const uint32_t dstHeight = std::max(height >> mip, 1u);
+
+        // NOTE: Odd sizes clamp the second tap, so last row/column gets averaged with itself.
+        const uint8_t* src = mipChain.data() + srcOffset;
+        uint8_t* dst       = mipChain.data() + dstOffset;
+        for (uint32_t y{}; y < dstHeight; ++y)
+        {
+            const uint32_t y0 = std::min(y * 2, srcHeight - 1), y1 = std::min(y * 2 + 1, srcHeight - 1);
+            for (uint32_t x{}; x < dstWidth; ++x)
+            {
+                const uint32_t x0 = std::min(x * 2, srcWidth - 1), x1 = std::min(x * 2 + 1, srcWidth - 1);
+                for (uint32_t c{}; c < channelCount; ++c)
+                {
+                    const uint32_t sum = src[(y0 * srcWidth + x0) * channelCount + c] + src[(y0 * srcWidth + x1) * channelCount + c] +
+                                         src[(y1 * srcWidth + x0) * channelCount + c] + src[(y1 * srcWidth + x1) * channelCount + c];
+                    dst[(y * dstWidth + x) * channelCount + c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+
+        srcOffset = dstOffset;
+        dstOffset += static_cast<size_t>(dstWidth) * dstHeight * channelCount;
+    }
+
+    return mipChain;
+}
+
 }  // namespace ImageUtils
 
 Shared<Image> Image::Create(const ImageSpecification& imageSpec)
@@ -142,6 +191,17 @@ Shared<Image> Image::Create(const ImageSpecification& imageSpec)
     return nullptr;
 }
 
+MemoryRequirements Image::GetMemoryRequirements(const ImageSpecification& imageSpec)
+{
+    switch (RendererAPI::Get())
+    {
+        case ERendererAPI::RENDERER_API_VULKAN: return VulkanImage::GetMemoryRequirements(imageSpec);
+    }
+
+    PFR_ASSERT(false, "Unknown RendererAPI!");
+    return {};
+}
+
 void SamplerStorage::Init()
 {
     switch (RendererAPI::Get())
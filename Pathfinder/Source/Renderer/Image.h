@@ -9,14 +9,15 @@ namespace Pathfinder
 // NOTE: Bindless by default, once and forever.
 struct ImageSpecification
 {
-    std::string DebugName      = s_DEFAULT_STRING;
-    uint32_t Width             = 0;
-    uint32_t Height            = 0;
-    EImageFormat Format        = EImageFormat::FORMAT_UNDEFINED;
-    EImageLayout Layout        = EImageLayout::IMAGE_LAYOUT_UNDEFINED;
-    ImageUsageFlags UsageFlags = 0;
-    uint32_t Mips              = 1;
-    uint32_t Layers            = 1;
+    std::string DebugName           = s_DEFAULT_STRING;
+    uint32_t Width                  = 0;
+    uint32_t Height                 = 0;
+    EImageFormat Format             = EImageFormat::FORMAT_UNDEFINED;
+    EImageLayout Layout             = EImageLayout::IMAGE_LAYOUT_UNDEFINED;
+    ImageUsageFlags UsageFlags      = 0;
+    uint32_t Mips                   = 1;
+    uint32_t Layers                 = 1;
+    MemoryAliasingInfo AliasingInfo = {};
 };
 
 class Image : private Uncopyable, private Unmovable
@@ -31,19 +32,29 @@ class Image : private Uncopyable, private Unmovable
         PFR_ASSERT(m_BindlessIndex.has_value(), "Image doesn't have bindless index!");
         return m_BindlessIndex.value();
     }
+    // NOTE: Storage images with mips get storage view per mip level, mip 0 is the same as GetBindlessIndex().
+    NODISCARD FORCEINLINE const auto GetMipBindlessIndex(const uint32_t mip) const
+    {
+        if (mip == 0) return GetBindlessIndex();
+
+        PFR_ASSERT(mip < m_MipBindlessIndices.size() && m_MipBindlessIndices[mip].has_value(), "Image doesn't have mip bindless index!");
+        return m_MipBindlessIndices[mip].value();
+    }
 
     virtual void Resize(const uint32_t width, const uint32_t height)                                  = 0;
     virtual void SetLayout(const EImageLayout newLayout, const bool bImmediate = false)               = 0;
-    virtual void SetData(const void* data, size_t dataSize)                                           = 0;
+    virtual UploadToken SetData(const void* data, size_t dataSize, const uint32_t mipCount = 1)       = 0;  // Mips packed from mip 0.
     virtual void ClearColor(const Shared<CommandBuffer>& commandBuffer, const glm::vec4& color) const = 0;
 
     static Shared<Image> Create(const ImageSpecification& imageSpec);
+    NODISCARD static MemoryRequirements GetMemoryRequirements(const ImageSpecification& imageSpec);
 
     virtual void SetDebugName(const std::string& name) = 0;
 
   protected:
     ImageSpecification m_Specification = {};
     Optional<uint32_t> m_BindlessIndex = std::nullopt;
+    std::vector<Optional<uint32_t>> m_MipBindlessIndices;  // [0] is unused, see m_BindlessIndex.
 
     Image(const ImageSpecification& imageSpec) : m_Specification(imageSpec) {}
     Image() = delete;
@@ -189,14 +200,78 @@ FORCEINLINE NODISCARD static bool IsStencilFormat(const EImageFormat imageFormat
     return false;
 }
 
+FORCEINLINE NODISCARD static bool IsBCFormat(const EImageFormat imageFormat)
+{
+    return imageFormat >= EImageFormat::FORMAT_BC1_RGB_UNORM && imageFormat <= EImageFormat::FORMAT_BC7_SRGB;
+}
+
+FORCEINLINE NODISCARD static std::string_view ImageFormatToString(const EImageFormat imageFormat)
+{
+    switch (imageFormat)
+    {
+        case EImageFormat::FORMAT_UNDEFINED: return "UNDEFINED";
+        case EImageFormat::FORMAT_R8_UNORM: return "R8_UNORM";
+        case EImageFormat::FORMAT_RG8_UNORM: return "RG8_UNORM";
+        case EImageFormat::FORMAT_RGB8_UNORM: return "RGB8_UNORM";
+        case EImageFormat::FORMAT_RGBA8_UNORM: return "RGBA8_UNORM";
+        case EImageFormat::FORMAT_BGRA8_UNORM: return "BGRA8_UNORM";
+        case EImageFormat::FORMAT_A2R10G10B10_UNORM_PACK32: return "A2R10G10B10_UNORM_PACK32";
+        case EImageFormat::FORMAT_R16_UNORM: return "R16_UNORM";
+        case EImageFormat::FORMAT_R16F: return "R16F";
+        case EImageFormat::FORMAT_R32F: return "R32F";
+        case EImageFormat::FORMAT_R64F: return "R64F";
+        case EImageFormat::FORMAT_RGB16_UNORM: return "RGB16_UNORM";
+        case EImageFormat::FORMAT_RGB16F: return "RGB16F";
+        case EImageFormat::FORMAT_RGBA16_UNORM: return "RGBA16_UNORM";
+        case EImageFormat::FORMAT_RGBA16F: return "RGBA16F";
+        case EImageFormat::FORMAT_RGB32F: return "RGB32F";
+        case EImageFormat::FORMAT_RGBA32F: return "RGBA32F";
+        case EImageFormat::FORMAT_RGB64F: return "RGB64F";
+        case EImageFormat::FORMAT_RGBA64F: return "RGBA64F";
+        case EImageFormat::FORMAT_D16_UNORM: return "D16_UNORM";
+        case EImageFormat::FORMAT_D32F: return "D32F";
+        case EImageFormat::FORMAT_S8_UINT: return "S8_UINT";
+        case EImageFormat::FORMAT_D16_UNORM_S8_UINT: return "D16_UNORM_S8_UINT";
+        case EImageFormat::FORMAT_D24_UNORM_S8_UINT: return "D24_UNORM_S8_UINT";
+        case EImageFormat::FORMAT_D32_SFLOAT_S8_UINT: return "D32_SFLOAT_S8_UINT";
+        case EImageFormat::FORMAT_BC1_RGB_UNORM: return "BC1_RGB_UNORM";
+        case EImageFormat::FORMAT_BC1_RGB_SRGB: return "BC1_RGB_SRGB";
+        case EImageFormat::FORMAT_BC1_RGBA_UNORM: return "BC1_RGBA_UNORM";
+        case EImageFormat::FORMAT_BC1_RGBA_SRGB: return "BC1_RGBA_SRGB";
+        case EImageFormat::FORMAT_BC2_UNORM: return "BC2_UNORM";
+        case EImageFormat::FORMAT_BC2_SRGB: return "BC2_SRGB";
+        case EImageFormat::FORMAT_BC3_UNORM: return "BC3_UNORM";
+        case EImageFormat::FORMAT_BC3_SRGB: return "BC3_SRGB";
+        case EImageFormat::FORMAT_BC4_UNORM: return "BC4_UNORM";
+        case EImageFormat::FORMAT_BC4_SNORM: return "BC4_SNORM";
+        case EImageFormat::FORMAT_BC5_UNORM: return "BC5_UNORM";
+        case EImageFormat::FORMAT_BC5_SNORM: return "BC5_SNORM";
+        case EImageFormat::FORMAT_BC6H_UFLOAT: return "BC6H_UFLOAT";
+        case EImageFormat::FORMAT_BC6H_SFLOAT: return "BC6H_SFLOAT";
+        case EImageFormat::FORMAT_BC7_UNORM: return "BC7_UNORM";
+        case EImageFormat::FORMAT_BC7_SRGB: return "BC7_SRGB";
+    }
+
+    PFR_ASSERT(false, "Unknown image format!");
+    return s_DEFAULT_STRING;
+}
+
+// NOTE: Flip flag is per thread, so images can be decoded from several threads at once.
 void* LoadRawImage(const std::filesystem::path& imagePath, bool bFlipOnLoad, int32_t* x, int32_t* y, int32_t* nChannels);
 
+// Reads only image header, false if format isn't recognized.
+NODISCARD bool GetRawImageInfo(const std::filesystem::path& imagePath, int32_t* x, int32_t* y, int32_t* nChannels);
+
 void* LoadRawImageFromMemory(const uint8_t* data, size_t dataSize, bool bFlipOnLoad, int32_t* x, int32_t* y, int32_t* nChannels);
 
 void* ConvertRgbToRgba(const uint8_t* rgb, const uint32_t width, const uint32_t height);
 
 void UnloadRawImage(void* data);
 
+// 2x2 box filtered 8-bit per channel chain, mip 0(copied) down to 1x1, every level tightly packed one after another.
+NODISCARD std::vector<uint8_t> GenerateMipChain(const uint8_t* data, const uint32_t width, const uint32_t height,
+                                                const uint32_t channelCount);
+
 FORCEINLINE NODISCARD static uint32_t CalculateMipCount(const uint32_t width, const uint32_t height)
 {
     return static_cast<uint32_t>(std::floor(std::log2(std::max(width, height)))) + 1;  // +1 for base mip level.
@@ -0,0 +1,563 @@
+#include <PathfinderPCH.h>
+#include "KTX2.h"
+
+#include "Texture.h"
+#include <charconv>
+
+namespace Pathfinder
+{
+
+namespace KTX2Utils
+{
+
+static constexpr std::array<uint8_t, 12> s_IDENTIFIER = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+static constexpr uint64_t s_HEADER_SIZE            = s_IDENTIFIER.size() + 9 * sizeof(uint32_t);
+static constexpr uint64_t s_INDEX_SIZE             = 4 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+static constexpr uint64_t s_LEVEL_INDEX_ENTRY_SIZE = 3 * sizeof(uint64_t);
+
+static constexpr std::string_view s_KEY_WRITER        = "KTXwriter";
+static constexpr std::string_view s_KEY_CACHE_VERSION = "pfr.cache_version";
+static constexpr std::string_view s_KEY_DEBUG_NAME    = "pfr.debug_name";
+static constexpr std::string_view s_KEY_SAMPLER_WRAP  = "pfr.sampler_wrap";
+static constexpr std::string_view s_KEY_FILTER        = "pfr.sampler_filter";
+
+// Khronos Data Format(DFD) constants.
+static constexpr uint8_t s_KHR_DF_MODEL_RGBSDA    = 1;
+static constexpr uint8_t s_KHR_DF_MODEL_BC1A      = 128;
+static constexpr uint8_t s_KHR_DF_MODEL_BC2       = 129;
+static constexpr uint8_t s_KHR_DF_MODEL_BC3       = 130;
+static constexpr uint8_t s_KHR_DF_MODEL_BC4       = 131;
+static constexpr uint8_t s_KHR_DF_MODEL_BC5       = 132;
+static constexpr uint8_t s_KHR_DF_MODEL_BC6H      = 133;
+static constexpr uint8_t s_KHR_DF_MODEL_BC7       = 134;
+static constexpr uint8_t s_KHR_DF_PRIMARIES_BT709 = 1;
+static constexpr uint8_t s_KHR_DF_TRANSFER_LINEAR = 1;
+static constexpr uint8_t s_KHR_DF_TRANSFER_SRGB   = 2;
+static constexpr uint8_t s_KHR_DF_SAMPLE_SIGNED   = 0x40;
+static constexpr uint8_t s_KHR_DF_SAMPLE_FLOAT    = 0x80;
+static constexpr uint8_t s_KHR_DF_CHANNEL_ALPHA   = 15;
+static constexpr uint32_t s_FLOAT_MINUS_ONE_BITS  = 0xBF800000;
+static constexpr uint32_t s_FLOAT_ONE_BITS        = 0x3F800000;
+
+struct FormatSample
+{
+    uint16_t BitOffset  = 0;
+    uint8_t BitLength   = 0;
+    uint8_t ChannelType = 0;  // Channel id + datatype qualifiers.
+    uint32_t Lower      = 0;
+    uint32_t Upper      = 0;
+};
+
+struct FormatInfo
+{
+    uint32_t VkFormat                   = 0;  // NOTE: VkFormat value, KTX2 stores it no matter which API texture ends up in.
+    uint8_t ColorModel                  = 0;
+    uint8_t BlockDim                    = 1;  // Texels per block side.
+    uint8_t BlockSize                   = 0;  // Bytes per block(per texel for uncompressed formats).
+    uint8_t TypeSize                    = 1;
+    bool bSRGB                          = false;
+    std::array<FormatSample, 4> Samples = {};
+    uint32_t SampleCount                = 0;
+};
+
+static constexpr std::array<EImageFormat, 21> s_SUPPORTED_FORMATS = {
+    EImageFormat::FORMAT_R8_UNORM,       EImageFormat::FORMAT_RG8_UNORM,       EImageFormat::FORMAT_RGBA8_UNORM,
+    EImageFormat::FORMAT_RGBA16F,        EImageFormat::FORMAT_RGBA32F,         EImageFormat::FORMAT_BC1_RGB_UNORM,
+    EImageFormat::FORMAT_BC1_RGB_SRGB,   EImageFormat::FORMAT_BC1_RGBA_UNORM,  EImageFormat::FORMAT_BC1_RGBA_SRGB,
+    EImageFormat::FORMAT_BC2_UNORM,      EImageFormat::FORMAT_BC2_SRGB,        EImageFormat::FORMAT_BC3_UNORM,
+    EImageFormat::FORMAT_BC3_SRGB,       EImageFormat::FORMAT_BC4_UNORM,       EImageFormat::FORMAT_BC4_SNORM,
+    EImageFormat::FORMAT_BC5_UNORM,      EImageFormat::FORMAT_BC5_SNORM,       EImageFormat::FORMAT_BC6H_UFLOAT,
+    EImageFormat::FORMAT_BC6H_SFLOAT,    EImageFormat::FORMAT_BC7_UNORM,       EImageFormat::FORMAT_BC7_SRGB};
+
+NODISCARD static Optional<FormatInfo> GetFormatInfo(const EImageFormat format)
+{
+    const auto makeFormatInfo = [](const uint32_t vkFormat, const uint8_t colorModel, const uint8_t blockDim, const uint8_t blockSize,
+                                   const uint8_t typeSize, const bool bSRGB, const std::initializer_list<FormatSample> samples)
+    {
+        FormatInfo formatInfo = {.VkFormat   = vkFormat,
+                                 .ColorModel = colorModel,
+                                 .BlockDim   = blockDim,
+                                 .BlockSize  = blockSize,
+                                 .TypeSize   = typeSize,
+                                 .bSRGB      = bSRGB};
+        for (const auto& sample : samples)
+            formatInfo.Samples[formatInfo.SampleCount++] = sample;
+        return formatInfo;
+    };
+
+    const auto unorm8 = [](const uint8_t index, const uint8_t channel)
+    { return FormatSample{static_cast<uint16_t>(index * 8), 8, channel, 0, 0xFF}; };
+    const auto sfloat = [](const uint8_t index, const uint8_t channel, const uint8_t bitLength)
+    {
+        return FormatSample{static_cast<uint16_t>(index * bitLength), bitLength,
+                            static_cast<uint8_t>(channel | s_KHR_DF_SAMPLE_FLOAT | s_KHR_DF_SAMPLE_SIGNED), s_FLOAT_MINUS_ONE_BITS,
+                            s_FLOAT_ONE_BITS};
+    };
+    const auto bcBlock  = [](const uint16_t bitOffset, const uint8_t bitLength, const uint8_t channel)
+    { return FormatSample{bitOffset, bitLength, channel, 0, 0xFFFFFFFF}; };
+    const auto bcSigned = [](const uint16_t bitOffset, const uint8_t channel)
+    { return FormatSample{bitOffset, 64, static_cast<uint8_t>(channel | s_KHR_DF_SAMPLE_SIGNED), 0x80000000, 0x7FFFFFFF}; };
+    constexpr uint8_t s_ALPHA = s_KHR_DF_CHANNEL_ALPHA;
+
+    switch (format)
+    {
+        case EImageFormat::FORMAT_R8_UNORM: return makeFormatInfo(9, s_KHR_DF_MODEL_RGBSDA, 1, 1, 1, false, {unorm8(0, 0)});
+        case EImageFormat::FORMAT_RG8_UNORM:
+            return makeFormatInfo(16, s_KHR_DF_MODEL_RGBSDA, 1, 2, 1, false, {unorm8(0, 0), unorm8(1, 1)});
+        case EImageFormat::FORMAT_RGBA8_UNORM:
+            return makeFormatInfo(37, s_KHR_DF_MODEL_RGBSDA, 1, 4, 1, false,
+                                  {unorm8(0, 0), unorm8(1, 1), unorm8(2, 2), unorm8(3, s_ALPHA)});
+        case EImageFormat::FORMAT_RGBA16F:
+            return makeFormatInfo(97, s_KHR_DF_MODEL_RGBSDA, 1, 8, 2, false,
+                                  {sfloat(0, 0, 16), sfloat(1, 1, 16), sfloat(2, 2, 16), sfloat(3, s_ALPHA, 16)});
+        case EImageFormat::FORMAT_RGBA32F:
+            return makeFormatInfo(109, s_KHR_DF_MODEL_RGBSDA, 1, 16, 4, false,
+                                  {sfloat(0, 0, 32), sfloat(1, 1, 32), sfloat(2, 2, 32), sfloat(3, s_ALPHA, 32)});
+        case EImageFormat::FORMAT_BC1_RGB_UNORM: return makeFormatInfo(131, s_KHR_DF_MODEL_BC1A, 4, 8, 1, false, {bcBlock(0, 64, 0)});
+        case EImageFormat::FORMAT_BC1_RGB_SRGB: return makeFormatInfo(132, s_KHR_DF_MODEL_BC1A, 4, 8, 1, true, {bcBlock(0, 64, 0)});
+        case EImageFormat::FORMAT_BC1_RGBA_UNORM: return makeFormatInfo(133, s_KHR_DF_MODEL_BC1A, 4, 8, 1, false, {bcBlock(0, 64, 1)});
+        case EImageFormat::FORMAT_BC1_RGBA_SRGB: return makeFormatInfo(134, s_KHR_DF_MODEL_BC1A, 4, 8, 1, true, {bcBlock(0, 64, 1)});
+        case EImageFormat::FORMAT_BC2_UNORM:
+            return makeFormatInfo(135, s_KHR_DF_MODEL_BC2, 4, 16, 1, false, {bcBlock(0, 64, s_ALPHA), bcBlock(64, 64, 0)});
+        case EImageFormat::FORMAT_BC2_SRGB:
+            return makeFormatInfo(136, s_KHR_DF_MODEL_BC2, 4, 16, 1, true, {bcBlock(0, 64, s_ALPHA), bcBlock(64, 64, 0)});
+        case EImageFormat::FORMAT_BC3_UNORM:
+            return makeFormatInfo(137, s_KHR_DF_MODEL_BC3, 4, 16, 1, false, {bcBlock(0, 64, s_ALPHA), bcBlock(64, 64, 0)});
+        case EImageFormat::FORMAT_BC3_SRGB:
+            return makeFormatInfo(138, s_KHR_DF_MODEL_BC3, 4, 16, 1, true, {bcBlock(0, 64, s_ALPHA), bcBlock(64, 64, 0)});
+        case EImageFormat::FORMAT_BC4_UNORM: return makeFormatInfo(139, s_KHR_DF_MODEL_BC4, 4, 8, 1, false, {bcBlock(0, 64, 0)});
+        case EImageFormat::FORMAT_BC4_SNORM: return makeFormatInfo(140, s_KHR_DF_MODEL_BC4, 4, 8, 1, false, {bcSigned(0, 0)});
+        case EImageFormat::FORMAT_BC5_UNORM:
+            return makeFormatInfo(141, s_KHR_DF_MODEL_BC5, 4, 16, 1, false, {bcBlock(0, 64, 0), bcBlock(64, 64, 1)});
+        case EImageFormat::FORMAT_BC5_SNORM:
+            return makeFormatInfo(142, s_KHR_DF_MODEL_BC5, 4, 16, 1, false, {bcSigned(0, 0), bcSigned(64, 1)});
+        case EImageFormat::FORMAT_BC6H_UFLOAT:
+            return makeFormatInfo(143, s_KHR_DF_MODEL_BC6H, 4, 16, 1, false, {{0, 128, s_KHR_DF_SAMPLE_FLOAT, 0, s_FLOAT_ONE_BITS}});
+        case EImageFormat::FORMAT_BC6H_SFLOAT:
+            return makeFormatInfo(144, s_KHR_DF_MODEL_BC6H, 4, 16, 1, false,
+                                  {{0, 128, s_KHR_DF_SAMPLE_FLOAT | s_KHR_DF_SAMPLE_SIGNED, s_FLOAT_MINUS_ONE_BITS, s_FLOAT_ONE_BITS}});
+        case EImageFormat::FORMAT_BC7_UNORM: return makeFormatInfo(145, s_KHR_DF_MODEL_BC7, 4, 16, 1, false, {bcBlock(0, 128, 0)});
+        case EImageFormat::FORMAT_BC7_SRGB: return makeFormatInfo(146, s_KHR_DF_MODEL_BC7, 4, 16, 1, true, {bcBlock(0, 128, 0)});
+        default: return std::nullopt;
+    }
+}
+
+NODISCARD FORCEINLINE static uint64_t AlignUp(const uint64_t value, const uint64_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+NODISCARD FORCEINLINE static uint64_t GetLevelSize(const FormatInfo& formatInfo, const uint32_t width, const uint32_t height,
+                                                   const uint32_t mip)
+{
+    const uint64_t mipWidth  = std::max(width >> mip, 1u);
+    const uint64_t mipHeight = std::max(height >> mip, 1u);
+    return ((mipWidth + formatInfo.BlockDim - 1) / formatInfo.BlockDim) * ((mipHeight + formatInfo.BlockDim - 1) / formatInfo.BlockDim) *
+           formatInfo.BlockSize;
+}
+
+class ByteWriter final : private Uncopyable, private Unmovable
+{
+  public:
+    explicit ByteWriter(std::vector<uint8_t>& bytes) : m_Bytes(bytes) {}
+    ~ByteWriter() = default;
+
+    template <typename T> FORCEINLINE void Write(const T value) { WriteBytes(&value, sizeof(value)); }
+
+    FORCEINLINE void WriteBytes(const void* data, const size_t dataSize)
+    {
+        m_Bytes.insert(m_Bytes.end(), static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + dataSize);
+    }
+
+    FORCEINLINE void Align(const uint64_t alignment) { m_Bytes.resize(AlignUp(m_Bytes.size(), alignment), 0); }
+
+  private:
+    std::vector<uint8_t>& m_Bytes;
+};
+
+// Bounds checked reads, any out of range access marks the reader as failed and returns zeroes.
+class ByteReader final : private Uncopyable, private Unmovable
+{
+  public:
+    explicit ByteReader(const std::vector<uint8_t>& bytes) : m_Bytes(bytes) {}
+    ~ByteReader() = default;
+
+    template <typename T> NODISCARD FORCEINLINE T Read(const uint64_t offset)
+    {
+        T value = {};
+        if (!IsInRange(offset, sizeof(T))) return value;
+
+        std::memcpy(&value, m_Bytes.data() + offset, sizeof(T));
+        return value;
+    }
+
+    NODISCARD FORCEINLINE bool IsInRange(const uint64_t offset, const uint64_t size)
+    {
+        if (offset > m_Bytes.size() || size > m_Bytes.size() - offset) m_bFailed = true;
+        return !m_bFailed;
+    }
+
+    NODISCARD FORCEINLINE bool HasFailed() const { return m_bFailed; }
+
+  private:
+    const std::vector<uint8_t>& m_Bytes;
+    bool m_bFailed = false;
+};
+
+static void WriteDFD(ByteWriter& writer, const FormatInfo& formatInfo)
+{
+    const uint32_t descriptorBlockSize = 24 + 16 * formatInfo.SampleCount;
+    writer.Write<uint32_t>(sizeof(uint32_t) + descriptorBlockSize);  // dfdTotalSize
+    writer.Write<uint32_t>(0);                                       // vendorId = KHRONOS, descriptorType = BASICFORMAT
+    writer.Write<uint32_t>(2 | descriptorBlockSize << 16);           // versionNumber = 1.3
+
+    const uint8_t transferFunction = formatInfo.bSRGB ? s_KHR_DF_TRANSFER_SRGB : s_KHR_DF_TRANSFER_LINEAR;
+    writer.Write<uint32_t>(formatInfo.ColorModel | s_KHR_DF_PRIMARIES_BT709 << 8 | transferFunction << 16);
+
+    const uint32_t blockDimension = formatInfo.BlockDim - 1u;
+    writer.Write<uint32_t>(blockDimension | blockDimension << 8);
+    writer.Write<uint32_t>(formatInfo.BlockSize);  // bytesPlane0, other planes are unused.
+    writer.Write<uint32_t>(0);
+
+    for (uint32_t sampleIndex{}; sampleIndex < formatInfo.SampleCount; ++sampleIndex)
+    {
+        const auto& sample = formatInfo.Samples[sampleIndex];
+        writer.Write<uint32_t>(sample.BitOffset | (sample.BitLength - 1u) << 16 | static_cast<uint32_t>(sample.ChannelType) << 24);
+        writer.Write<uint32_t>(0);  // samplePosition
+        writer.Write<uint32_t>(sample.Lower);
+        writer.Write<uint32_t>(sample.Upper);
+    }
+}
+
+// NOTE: Values are NUL-terminated strings, entries have to be sorted by key, std::map takes care of it.
+static void WriteKeyValueData(ByteWriter& writer, const std::map<std::string_view, std::string>& keyValues)
+{
+    for (const auto& [key, value] : keyValues)
+    {
+        writer.Write<uint32_t>(static_cast<uint32_t>(key.size() + 1 + value.size() + 1));
+        writer.WriteBytes(key.data(), key.size());
+        writer.Write<uint8_t>(0);
+        writer.WriteBytes(value.data(), value.size());
+        writer.Write<uint8_t>(0);
+        writer.Align(4);
+    }
+}
+
+static UnorderedMap<std::string, std::string> ReadKeyValueData(ByteReader& reader, const std::vector<uint8_t>& bytes, uint64_t offset,
+                                                               const uint64_t size)
+{
+    UnorderedMap<std::string, std::string> keyValues;
+    const uint64_t end = offset + size;
+    while (offset + sizeof(uint32_t) <= end && !reader.HasFailed())
+    {
+        const uint32_t keyAndValueSize = reader.Read<uint32_t>(offset);
+        offset += sizeof(uint32_t);
+        if (keyAndValueSize > end - offset || !reader.IsInRange(offset, keyAndValueSize)) break;
+
+        const std::string_view keyAndValue(reinterpret_cast<const char*>(bytes.data() + offset), keyAndValueSize);
+        if (const auto keyEnd = keyAndValue.find('\0'); keyEnd != std::string_view::npos)
+        {
+            std::string_view value = keyAndValue.substr(keyEnd + 1);
+            if (!value.empty() && value.back() == '\0') value.remove_suffix(1);
+            keyValues.emplace(keyAndValue.substr(0, keyEnd), value);
+        }
+
+        offset = AlignUp(offset + keyAndValueSize, 4);
+    }
+
+    return keyValues;
+}
+
+template <typename T> NODISCARD FORCEINLINE static Optional<T> ParseEnum(const UnorderedMap<std::string, std::string>& keyValues,
+                                                                           const std::string_view key)
+{
+    const auto it = keyValues.find(std::string(key));
+    if (it == keyValues.end()) return std::nullopt;
+
+    uint32_t value              = 0;
+    const auto [ptr, errorCode] = std::from_chars(it->second.data(), it->second.data() + it->second.size(), value);
+    return errorCode == std::errc{} ? Optional<T>{static_cast<T>(value)} : std::nullopt;
+}
+
+struct LevelRange
+{
+    uint64_t Offset = 0;
+    uint64_t Size   = 0;
+};
+
+// Reads and validates everything in front of mip levels, outLevels go from mip 0 and hold file offsets.
+NODISCARD static bool ReadHeader(std::ifstream& file, const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec,
+                                 std::vector<LevelRange>& outLevels)
+{
+    file.seekg(0, std::ios::end);
+    const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+
+    std::vector<uint8_t> bytes;
+    const auto readPrefix = [&](const uint64_t prefixSize)
+    {
+        bytes.resize(std::min(prefixSize, fileSize));
+        file.seekg(0, std::ios::beg);
+        file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    };
+
+    readPrefix(s_HEADER_SIZE + s_INDEX_SIZE);
+    if (!file || bytes.size() < s_HEADER_SIZE + s_INDEX_SIZE || !std::equal(s_IDENTIFIER.begin(), s_IDENTIFIER.end(), bytes.begin()))
+    {
+        LOG_WARN("KTX2: Not a KTX2 file! <{}>", loadPath.string());
+        return false;
+    }
+
+    ByteReader reader(bytes);
+    uint64_t offset       = s_IDENTIFIER.size();
+    const auto readUint32 = [&] { return reader.Read<uint32_t>(std::exchange(offset, offset + sizeof(uint32_t))); };
+    const auto readUint64 = [&] { return reader.Read<uint64_t>(std::exchange(offset, offset + sizeof(uint64_t))); };
+
+    const uint32_t vkFormat = readUint32();
+    readUint32();  // typeSize, implied by format.
+    const uint32_t width                  = readUint32();
+    const uint32_t height                 = readUint32();
+    const uint32_t depth                  = readUint32();
+    const uint32_t layerCount             = readUint32();
+    const uint32_t faceCount              = readUint32();
+    const uint32_t levelCount             = readUint32();
+    const uint32_t supercompressionScheme = readUint32();
+
+    const auto formatIt = std::ranges::find_if(s_SUPPORTED_FORMATS, [&](const EImageFormat format)
+                                               { return GetFormatInfo(format)->VkFormat == vkFormat; });
+    if (formatIt == s_SUPPORTED_FORMATS.end() || width == 0 || height == 0 || depth > 1 || layerCount > 1 || faceCount != 1 ||
+        levelCount == 0 || levelCount > ImageUtils::CalculateMipCount(width, height))
+    {
+        LOG_WARN("KTX2: Only single 2D textures of supported formats with explicit mips can be loaded! <{}>", loadPath.string());
+        return false;
+    }
+
+    // NOTE: No zstd/zlib in the tree yet, supercompressed caches are treated as stale and rebuilt.
+    if (supercompressionScheme != 0)
+    {
+        LOG_WARN("KTX2: Supercompression scheme ({}) isn't supported! <{}>", supercompressionScheme, loadPath.string());
+        return false;
+    }
+
+    offset += 2 * sizeof(uint32_t);  // DFD, format is fully described by vkFormat.
+    const uint32_t kvdOffset = readUint32();
+    const uint32_t kvdSize   = readUint32();
+    offset += 2 * sizeof(uint64_t);  // Supercompression global data.
+
+    // NOTE: Level index and key/value data are tiny, so whole prefix in front of mip levels is read at once.
+    readPrefix(std::max(s_HEADER_SIZE + s_INDEX_SIZE + s_LEVEL_INDEX_ENTRY_SIZE * levelCount, uint64_t{kvdOffset} + kvdSize));
+
+    const auto keyValues = ReadKeyValueData(reader, bytes, kvdOffset, kvdSize);
+    if (const auto it = keyValues.find(std::string(s_KEY_CACHE_VERSION));
+        it == keyValues.end() || it->second != std::to_string(KTX2::s_CACHE_VERSION))
+    {
+        LOG_WARN("KTX2: Texture cache version mismatch! <{}>", loadPath.string());
+        return false;
+    }
+
+    const auto formatInfo = GetFormatInfo(*formatIt);
+    outLevels.resize(levelCount);
+    bool bLevelsValid = true;
+    for (uint32_t mip{}; mip < levelCount; ++mip)
+    {
+        auto& [levelOffset, levelSize] = outLevels[mip];
+        levelOffset                    = readUint64();
+        levelSize                      = readUint64();
+        readUint64();  // uncompressedByteLength
+
+        bLevelsValid &= levelSize == GetLevelSize(*formatInfo, width, height, mip) && levelOffset <= fileSize &&
+                        levelSize <= fileSize - levelOffset;
+    }
+
+    if (!file || !bLevelsValid || reader.HasFailed())
+    {
+        LOG_WARN("KTX2: File is corrupted! <{}>", loadPath.string());
+        return false;
+    }
+
+    outTextureSpec = {.Width  = width,
+                      .Height = height,
+                      .Format = *formatIt,
+                      .Mips   = levelCount};
+    if (const auto it = keyValues.find(std::string(s_KEY_DEBUG_NAME)); it != keyValues.end()) outTextureSpec.DebugName = it->second;
+    if (const auto wrap = ParseEnum<ESamplerWrap>(keyValues, s_KEY_SAMPLER_WRAP)) outTextureSpec.Wrap = *wrap;
+    if (const auto filter = ParseEnum<ESamplerFilter>(keyValues, s_KEY_FILTER)) outTextureSpec.Filter = *filter;
+
+    return true;
+}
+
+}  // namespace KTX2Utils
+
+namespace KTX2
+{
+
+bool IsFormatSupported(const EImageFormat format)
+{
+    return KTX2Utils::GetFormatInfo(format).has_value();
+}
+
+bool Save(const std::filesystem::path& savePath, const TextureSpecification& textureSpec, const void* data, const size_t dataSize)
+{
+    PFR_ASSERT(!savePath.empty(), "Invalid save path for KTX2 texture!");
+    PFR_ASSERT(data && dataSize > 0, "Invalid image data to save!");
+
+    const auto formatInfo = KTX2Utils::GetFormatInfo(textureSpec.Format);
+    if (!formatInfo.has_value())
+    {
+        LOG_WARN("KTX2: Image format isn't supported! <{}>", savePath.string());
+        return false;
+    }
+
+    const uint32_t levelCount = std::max(textureSpec.Mips, 1u);
+    std::vector<uint64_t> levelSizes(levelCount);
+    for (uint32_t mip{}; mip < levelCount; ++mip)
+        levelSizes[mip] = KTX2Utils::GetLevelSize(*formatInfo, textureSpec.Width, textureSpec.Height, mip);
+
+    if (std::accumulate(levelSizes.begin(), levelSizes.end(), uint64_t{0}) != dataSize)
+    {
+        LOG_WARN("KTX2: Image data doesn't match its mip chain! <{}>", savePath.string());
+        return false;
+    }
+
+    std::vector<uint8_t> dfdBytes;
+    {
+        KTX2Utils::ByteWriter dfdWriter(dfdBytes);
+        KTX2Utils::WriteDFD(dfdWriter, *formatInfo);
+    }
+
+    std::vector<uint8_t> kvdBytes;
+    {
+        KTX2Utils::ByteWriter kvdWriter(kvdBytes);
+        KTX2Utils::WriteKeyValueData(kvdWriter, {{KTX2Utils::s_KEY_WRITER, "Pathfinder"},
+                                                 {KTX2Utils::s_KEY_CACHE_VERSION, std::to_string(s_CACHE_VERSION)},
+                                                 {KTX2Utils::s_KEY_DEBUG_NAME, textureSpec.DebugName},
+                                                 {KTX2Utils::s_KEY_SAMPLER_WRAP, std::to_string(static_cast<uint32_t>(textureSpec.Wrap))},
+                                                 {KTX2Utils::s_KEY_FILTER, std::to_string(static_cast<uint32_t>(textureSpec.Filter))}});
+    }
+
+    // NOTE: Mip levels are stored smallest first, each one aligned to lcm(texel block size, 4).
+    const uint64_t levelAlignment = std::lcm<uint64_t>(formatInfo->BlockSize, 4);
+    const uint64_t dfdOffset      = KTX2Utils::s_HEADER_SIZE + KTX2Utils::s_INDEX_SIZE + KTX2Utils::s_LEVEL_INDEX_ENTRY_SIZE * levelCount;
+    const uint64_t kvdOffset      = dfdOffset + dfdBytes.size();
+    std::vector<uint64_t> levelOffsets(levelCount);
+    uint64_t fileSize = kvdOffset + kvdBytes.size();
+    for (int32_t mip = static_cast<int32_t>(levelCount) - 1; mip >= 0; --mip)
+    {
+        levelOffsets[mip] = KTX2Utils::AlignUp(fileSize, levelAlignment);
+        fileSize          = levelOffsets[mip] + levelSizes[mip];
+    }
+
+    std::vector<uint8_t> fileBytes;
+    fileBytes.reserve(fileSize);
+    KTX2Utils::ByteWriter writer(fileBytes);
+    writer.WriteBytes(KTX2Utils::s_IDENTIFIER.data(), KTX2Utils::s_IDENTIFIER.size());
+    writer.Write<uint32_t>(formatInfo->VkFormat);
+    writer.Write<uint32_t>(formatInfo->TypeSize);
+    writer.Write<uint32_t>(textureSpec.Width);
+    writer.Write<uint32_t>(textureSpec.Height);
+    writer.Write<uint32_t>(0);  // pixelDepth
+    writer.Write<uint32_t>(0);  // layerCount, not an array
+    writer.Write<uint32_t>(1);  // faceCount
+    writer.Write<uint32_t>(levelCount);
+    writer.Write<uint32_t>(0);  // supercompressionScheme
+
+    writer.Write<uint32_t>(static_cast<uint32_t>(dfdOffset));
+    writer.Write<uint32_t>(static_cast<uint32_t>(dfdBytes.size()));
+    writer.Write<uint32_t>(static_cast<uint32_t>(kvdOffset));
+    writer.Write<uint32_t>(static_cast<uint32_t>(kvdBytes.size()));
+    writer.Write<uint64_t>(0);  // sgdByteOffset
+    writer.Write<uint64_t>(0);  // sgdByteLength
+
+    for (uint32_t mip{}; mip < levelCount; ++mip)
+    {
+        writer.Write<uint64_t>(levelOffsets[mip]);
+        writer.Write<uint64_t>(levelSizes[mip]);
+        writer.Write<uint64_t>(levelSizes[mip]);  // uncompressedByteLength
+    }
+
+    writer.WriteBytes(dfdBytes.data(), dfdBytes.size());
+    writer.WriteBytes(kvdBytes.data(), kvdBytes.size());
+
+    // Input goes from mip 0, file goes from the smallest mip.
+    std::vector<uint64_t> srcLevelOffsets(levelCount);
+    std::exclusive_scan(levelSizes.begin(), levelSizes.end(), srcLevelOffsets.begin(), uint64_t{0});
+    for (int32_t mip = static_cast<int32_t>(levelCount) - 1; mip >= 0; --mip)
+    {
+        writer.Align(levelAlignment);
+        PFR_ASSERT(fileBytes.size() == levelOffsets[mip], "KTX2 level offset mismatch!");
+        writer.WriteBytes(static_cast<const uint8_t*>(data) + srcLevelOffsets[mip], levelSizes[mip]);
+    }
+
+    SaveData(savePath.string(), fileBytes.data(), static_cast<int64_t>(fileBytes.size()));
+    return true;
+}
+
+uint64_t GetMipChainSize(const TextureSpecification& textureSpec, const uint32_t firstMip)
+{
+    const auto formatInfo = KTX2Utils::GetFormatInfo(textureSpec.Format);
+    if (!formatInfo.has_value()) return 0;
+
+    uint64_t chainSize = 0;
+    for (uint32_t mip = firstMip; mip < std::max(textureSpec.Mips, 1u); ++mip)
+        chainSize += KTX2Utils::GetLevelSize(*formatInfo, textureSpec.Width, textureSpec.Height, mip);
+    return chainSize;
+}
+
+bool LoadSpecification(const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec)
+{
+    PFR_ASSERT(!loadPath.empty(), "Invalid load path for KTX2 texture!");
+
+    std::ifstream file(loadPath, std::ios::in | std::ios::binary);
+    if (!file.is_open()) return false;
+
+    std::vector<KTX2Utils::LevelRange> levels;
+    return KTX2Utils::ReadHeader(file, loadPath, outTextureSpec, levels);
+}
+
+bool Load(const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec, std::vector<uint8_t>& outData,
+          const uint32_t firstMip)
+{
+    PFR_ASSERT(!loadPath.empty(), "Invalid load path for KTX2 texture!");
+
+    std::ifstream file(loadPath, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+    {
+        LOG_WARN("KTX2: Failed to open file! <{}>", loadPath.string());
+        return false;
+    }
+
+    std::vector<KTX2Utils::LevelRange> levels;
+    if (!KTX2Utils::ReadHeader(file, loadPath, outTextureSpec, levels)) return false;
+
+    if (firstMip >= levels.size())
+    {
+        LOG_WARN("KTX2: Requested mip ({}) is out of range ({})! <{}>", firstMip, levels.size(), loadPath.string());
+        return false;
+    }
+
+    uint64_t dataSize = 0;
+    for (uint32_t mip = firstMip; mip < levels.size(); ++mip)
+        dataSize += levels[mip].Size;
+
+    // NOTE: Only requested levels are read, streaming asks for smaller tails way more often than for full chains.
+    outData.resize(dataSize);
+    uint64_t dataOffset = 0;
+    for (uint32_t mip = firstMip; mip < levels.size(); ++mip)
+    {
+        file.seekg(static_cast<std::streamoff>(levels[mip].Offset), std::ios::beg);
+        file.read(reinterpret_cast<char*>(outData.data() + dataOffset), static_cast<std::streamsize>(levels[mip].Size));
+        dataOffset += levels[mip].Size;
+    }
+
+    if (!file)
+    {
+        LOG_WARN("KTX2: Failed to read mip levels! <{}>", loadPath.string());
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace KTX2
+
+}  // namespace Pathfinder
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Core/Core.h>
+#include "RendererCoreDefines.h"
+
+namespace Pathfinder
+{
+
+struct TextureSpecification;
+
+/*
+ * Texture cache container, plain KTX2(https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html):
+ * [identifier][header][index][level index][DFD][key/value data][mip levels, smallest first]
+ * Every field is written one by one(little-endian), so nothing depends on TextureSpecification layout.
+ * Sampler and debug name go into "pfr.*" key/value entries, s_CACHE_VERSION is stored there as well and bumped
+ * whenever encoded contents change, so stale caches get rebuilt instead of being loaded.
+ */
+namespace KTX2
+{
+
+static constexpr uint32_t s_CACHE_VERSION = 1;
+
+// R8/RG8/RGBA8, RGBA16F/RGBA32F and every BCn format.
+NODISCARD bool IsFormatSupported(const EImageFormat format);
+
+// data holds textureSpec.Mips levels tightly packed from mip 0.
+NODISCARD bool Save(const std::filesystem::path& savePath, const TextureSpecification& textureSpec, const void* data,
+                    const size_t dataSize);
+
+// Bytes taken by mips [firstMip, textureSpec.Mips), 0 for unsupported formats.
+NODISCARD uint64_t GetMipChainSize(const TextureSpecification& textureSpec, const uint32_t firstMip = 0);
+
+// Header only, mip levels aren't touched. Fails the same way as Load() does.
+NODISCARD bool LoadSpecification(const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec);
+
+// Returns false in case file is missing, corrupted, supercompressed or written by different cache version.
+// outTextureSpec describes the whole chain, outData receives mips [firstMip, outTextureSpec.Mips) tightly packed.
+NODISCARD bool Load(const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec, std::vector<uint8_t>& outData,
+                    const uint32_t firstMip = 0);
+
+}  // namespace KTX2
+
+}  // namespace Pathfinder
@@ -2,9 +2,10 @@
 #include "Mesh.h"
 
 #include "Submesh.h"
+#include "MeshManager.h"
 #include "Core/Application.h"
 
-#include "MeshManager.h"
+#include "MeshRegistry.h"
 
 namespace Pathfinder
 {
@@ -23,7 +24,7 @@ Shared<Mesh> Mesh::Create(const std::string& meshPath)
     const std::filesystem::path fullMeshPath = workingDirFilePath / appSpec.AssetsDir / appSpec.MeshDir / meshPath;
     std::string fullMeshPathString           = fullMeshPath.string();
     std::replace(fullMeshPathString.begin(), fullMeshPathString.end(), '\\', '/');  // adjust
-    return MakeShared<Mesh>(fullMeshPathString);
+    return MeshRegistry::Acquire(fullMeshPathString);
 }
 
 }  // namespace Pathfinder
\ No newline at end of file
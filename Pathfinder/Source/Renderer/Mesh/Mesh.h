@@ -14,6 +14,7 @@ public:
     explicit Mesh(const std::filesystem::path& meshPath);
     ~Mesh() { Destroy(); }
 
+    // Shared handle from MeshRegistry, every mesh file is loaded once no matter how many entities reference it.
     NODISCARD static Shared<Mesh> Create(const std::string& meshPath);
 
     NODISCARD FORCEINLINE const auto& GetSubmeshes() const { return m_Submeshes; }
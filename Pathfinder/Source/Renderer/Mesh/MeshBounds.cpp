@@ -0,0 +1,469 @@
+#include <PathfinderPCH.h>
+#include "MeshBounds.h"
+
+#include "Globals.h"
+
+#include <Core/Intrinsics.h>
+
+namespace Pathfinder
+{
+
+namespace MeshBoundsUtils
+{
+
+static_assert(sizeof(MeshPositionVertex) == sizeof(float) * 3, "Bounds kernels expect tightly packed xyz stream!");
+
+using MinMaxFunc   = void (*)(const float* xyz, const size_t count, glm::vec3& outMin, glm::vec3& outMax);
+using FarthestFunc = float (*)(const float* xyz, const size_t count, const glm::vec3& from, size_t& outIndex);  // Squared distance.
+
+struct BoundsKernels
+{
+    MinMaxFunc MinMax     = nullptr;
+    FarthestFunc Farthest = nullptr;
+};
+
+// Accumulates into outMin/outMax, so vector kernels reuse it for remainders.
+void AccumulateMinMax(const float* xyz, const size_t begin, const size_t end, glm::vec3& outMin, glm::vec3& outMax)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        const glm::vec3 point(xyz[i * 3 + 0], xyz[i * 3 + 1], xyz[i * 3 + 2]);
+        outMin = glm::min(outMin, point);
+        outMax = glm::max(outMax, point);
+    }
+}
+
+// Strict comparison keeps the lowest index among equally far points, vector kernels follow the same rule.
+void AccumulateFarthest(const float* xyz, const size_t begin, const size_t end, const glm::vec3& from, float& maxDistance2,
+                        size_t& outIndex)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float dx        = xyz[i * 3 + 0] - from.x;
+        const float dy        = xyz[i * 3 + 1] - from.y;
+        const float dz        = xyz[i * 3 + 2] - from.z;
+        const float distance2 = dx * dx + dy * dy + dz * dz;
+        if (distance2 > maxDistance2)
+        {
+            maxDistance2 = distance2;
+            outIndex     = i;
+        }
+    }
+}
+
+// Accumulators loaded straight from xyz stream hold component k % 3 in lane k, lane count is a multiple of 3.
+void FoldInterleavedMinMax(const float* mins, const float* maxs, const size_t laneCount, glm::vec3& outMin, glm::vec3& outMax)
+{
+    outMin = glm::vec3(std::numeric_limits<float>::max());
+    outMax = glm::vec3(std::numeric_limits<float>::lowest());
+    for (size_t k{}; k < laneCount; ++k)
+    {
+        const auto component = static_cast<glm::length_t>(k % 3);
+        outMin[component]    = std::min(outMin[component], mins[k]);
+        outMax[component]    = std::max(outMax[component], maxs[k]);
+    }
+}
+
+void FoldFarthest(const float* distances2, const uint32_t* indices, const size_t laneCount, float& maxDistance2, size_t& outIndex)
+{
+    maxDistance2 = -1.f;
+    outIndex     = 0;
+    for (size_t k{}; k < laneCount; ++k)
+    {
+        if (distances2[k] > maxDistance2 || (distances2[k] == maxDistance2 && indices[k] < outIndex))
+        {
+            maxDistance2 = distances2[k];
+            outIndex     = indices[k];
+        }
+    }
+}
+
+void MinMaxScalar(const float* xyz, const size_t count, glm::vec3& outMin, glm::vec3& outMax)
+{
+    outMin = glm::vec3(std::numeric_limits<float>::max());
+    outMax = glm::vec3(std::numeric_limits<float>::lowest());
+    AccumulateMinMax(xyz, 0, count, outMin, outMax);
+}
+
+float FarthestScalar(const float* xyz, const size_t count, const glm::vec3& from, size_t& outIndex)
+{
+    float maxDistance2 = -1.f;
+    outIndex           = 0;
+    AccumulateFarthest(xyz, 0, count, from, maxDistance2, outIndex);
+    return maxDistance2;
+}
+
+#if PFR_X86
+
+// NOTE: Min/max don't care what lane holds, so points are loaded as is, 4 points(12 floats) at a time, no transposing.
+PFR_TARGET_SSE41 void MinMaxSSE41(const float* xyz, const size_t count, glm::vec3& outMin, glm::vec3& outMax)
+{
+    __m128 minA = _mm_set1_ps(std::numeric_limits<float>::max()), minB = minA, minC = minA;
+    __m128 maxA = _mm_set1_ps(std::numeric_limits<float>::lowest()), maxB = maxA, maxC = maxA;
+
+    const size_t alignedCount = count & ~static_cast<size_t>(3);
+    for (size_t i{}; i < alignedCount; i += 4)
+    {
+        const float* p = xyz + i * 3;
+        const __m128 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4), c = _mm_loadu_ps(p + 8);
+
+        minA = _mm_min_ps(minA, a);
+        minB = _mm_min_ps(minB, b);
+        minC = _mm_min_ps(minC, c);
+
+        maxA = _mm_max_ps(maxA, a);
+        maxB = _mm_max_ps(maxB, b);
+        maxC = _mm_max_ps(maxC, c);
+    }
+
+    float mins[12], maxs[12];
+    _mm_storeu_ps(mins, minA);
+    _mm_storeu_ps(mins + 4, minB);
+    _mm_storeu_ps(mins + 8, minC);
+    _mm_storeu_ps(maxs, maxA);
+    _mm_storeu_ps(maxs + 4, maxB);
+    _mm_storeu_ps(maxs + 8, maxC);
+
+    FoldInterleavedMinMax(mins, maxs, 12, outMin, outMax);
+    AccumulateMinMax(xyz, alignedCount, count, outMin, outMax);
+}
+
+// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 -> x0 x1 x2 x3 | y0 y1 y2 y3 | z0 z1 z2 z3
+PFR_TARGET_SSE41 void TransposeSSE41(const __m128 a, const __m128 b, const __m128 c, __m128& outX, __m128& outY, __m128& outZ)
+{
+    outX = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    outY = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)),
+                          _MM_SHUFFLE(2, 0, 2, 0));
+    outZ = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)),
+                          _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+PFR_TARGET_SSE41 float FarthestSSE41(const float* xyz, const size_t count, const glm::vec3& from, size_t& outIndex)
+{
+    const __m128 fromX = _mm_set1_ps(from.x), fromY = _mm_set1_ps(from.y), fromZ = _mm_set1_ps(from.z);
+    const __m128i indexStep = _mm_set1_epi32(4);
+
+    __m128 maxDistances2 = _mm_set1_ps(-1.f);
+    __m128i maxIndices = _mm_setzero_si128(), indices = _mm_setr_epi32(0, 1, 2, 3);
+
+    const size_t alignedCount = count & ~static_cast<size_t>(3);
+    for (size_t i{}; i < alignedCount; i += 4)
+    {
+        const float* p = xyz + i * 3;
+        __m128 x, y, z;
+        TransposeSSE41(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+
+        x = _mm_sub_ps(x, fromX);
+        y = _mm_sub_ps(y, fromY);
+        z = _mm_sub_ps(z, fromZ);
+        const __m128 distances2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+
+        const __m128 mask = _mm_cmpgt_ps(distances2, maxDistances2);
+        maxDistances2     = _mm_blendv_ps(maxDistances2, distances2, mask);
+        maxIndices        = _mm_blendv_epi8(maxIndices, indices, _mm_castps_si128(mask));
+        indices           = _mm_add_epi32(indices, indexStep);
+    }
+
+    float laneDistances2[4];
+    uint32_t laneIndices[4];
+    _mm_storeu_ps(laneDistances2, maxDistances2);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(laneIndices), maxIndices);
+
+    float maxDistance2 = -1.f;
+    FoldFarthest(laneDistances2, laneIndices, 4, maxDistance2, outIndex);
+    AccumulateFarthest(xyz, alignedCount, count, from, maxDistance2, outIndex);
+    return maxDistance2;
+}
+
+PFR_TARGET_AVX2 void MinMaxAVX2(const float* xyz, const size_t count, glm::vec3& outMin, glm::vec3& outMax)
+{
+    __m256 minA = _mm256_set1_ps(std::numeric_limits<float>::max()), minB = minA, minC = minA;
+    __m256 maxA = _mm256_set1_ps(std::numeric_limits<float>::lowest()), maxB = maxA, maxC = maxA;
+
+    const size_t alignedCount = count & ~static_cast<size_t>(7);
+    for (size_t i{}; i < alignedCount; i += 8)
+    {
+        const float* p = xyz + i * 3;
+        const __m256 a = _mm256_loadu_ps(p), b = _mm256_loadu_ps(p + 8), c = _mm256_loadu_ps(p + 16);
+
+        minA = _mm256_min_ps(minA, a);
+        minB = _mm256_min_ps(minB, b);
+        minC = _mm256_min_ps(minC, c);
+
+        maxA = _mm256_max_ps(maxA, a);
+        maxB = _mm256_max_ps(maxB, b);
+        maxC = _mm256_max_ps(maxC, c);
+    }
+
+    float mins[24], maxs[24];
+    _mm256_storeu_ps(mins, minA);
+    _mm256_storeu_ps(mins + 8, minB);
+    _mm256_storeu_ps(mins + 16, minC);
+    _mm256_storeu_ps(maxs, maxA);
+    _mm256_storeu_ps(maxs + 8, maxB);
+    _mm256_storeu_ps(maxs + 16, maxC);
+
+    FoldInterleavedMinMax(mins, maxs, 24, outMin, outMax);
+    AccumulateMinMax(xyz, alignedCount, count, outMin, outMax);
+}
+
+PFR_TARGET_AVX2 float FarthestAVX2(const float* xyz, const size_t count, const glm::vec3& from, size_t& outIndex)
+{
+    const __m256 fromX = _mm256_set1_ps(from.x), fromY = _mm256_set1_ps(from.y), fromZ = _mm256_set1_ps(from.z);
+    const __m256i indexStep = _mm256_set1_epi32(8);
+
+    __m256 maxDistances2 = _mm256_set1_ps(-1.f);
+    __m256i maxIndices = _mm256_setzero_si256(), indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    const size_t alignedCount = count & ~static_cast<size_t>(7);
+    for (size_t i{}; i < alignedCount; i += 8)
+    {
+        // NOTE: Points 0-3 go to low 128-bit lanes, 4-7 to high ones, in-lane shuffles then transpose both halves at once,
+        // that's cheaper than gathers.
+        const float* p = xyz + i * 3;
+        const __m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + 12), 1);
+        const __m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+        const __m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+
+        __m256 x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        __m256 y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)),
+                                     _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)),
+                                     _MM_SHUFFLE(2, 0, 2, 0));
+
+        x = _mm256_sub_ps(x, fromX);
+        y = _mm256_sub_ps(y, fromY);
+        z = _mm256_sub_ps(z, fromZ);
+        const __m256 distances2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+
+        const __m256 mask = _mm256_cmp_ps(distances2, maxDistances2, _CMP_GT_OQ);
+        maxDistances2     = _mm256_blendv_ps(maxDistances2, distances2, mask);
+        maxIndices        = _mm256_blendv_epi8(maxIndices, indices, _mm256_castps_si256(mask));
+        indices           = _mm256_add_epi32(indices, indexStep);
+    }
+
+    float laneDistances2[8];
+    uint32_t laneIndices[8];
+    _mm256_storeu_ps(laneDistances2, maxDistances2);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(laneIndices), maxIndices);
+
+    float maxDistance2 = -1.f;
+    FoldFarthest(laneDistances2, laneIndices, 8, maxDistance2, outIndex);
+    AccumulateFarthest(xyz, alignedCount, count, from, maxDistance2, outIndex);
+    return maxDistance2;
+}
+
+#elif PFR_ARM64
+
+void MinMaxNEON(const float* xyz, const size_t count, glm::vec3& outMin, glm::vec3& outMax)
+{
+    float32x4_t minA = vdupq_n_f32(std::numeric_limits<float>::max()), minB = minA, minC = minA;
+    float32x4_t maxA = vdupq_n_f32(std::numeric_limits<float>::lowest()), maxB = maxA, maxC = maxA;
+
+    const size_t alignedCount = count & ~static_cast<size_t>(3);
+    for (size_t i{}; i < alignedCount; i += 4)
+    {
+        const float* p      = xyz + i * 3;
+        const float32x4_t a = vld1q_f32(p), b = vld1q_f32(p + 4), c = vld1q_f32(p + 8);
+
+        minA = vminq_f32(minA, a);
+        minB = vminq_f32(minB, b);
+        minC = vminq_f32(minC, c);
+
+        maxA = vmaxq_f32(maxA, a);
+        maxB = vmaxq_f32(maxB, b);
+        maxC = vmaxq_f32(maxC, c);
+    }
+
+    float mins[12], maxs[12];
+    vst1q_f32(mins, minA);
+    vst1q_f32(mins + 4, minB);
+    vst1q_f32(mins + 8, minC);
+    vst1q_f32(maxs, maxA);
+    vst1q_f32(maxs + 4, maxB);
+    vst1q_f32(maxs + 8, maxC);
+
+    FoldInterleavedMinMax(mins, maxs, 12, outMin, outMax);
+    AccumulateMinMax(xyz, alignedCount, count, outMin, outMax);
+}
+
+float FarthestNEON(const float* xyz, const size_t count, const glm::vec3& from, size_t& outIndex)
+{
+    const float32x4_t fromX = vdupq_n_f32(from.x), fromY = vdupq_n_f32(from.y), fromZ = vdupq_n_f32(from.z);
+    const uint32x4_t indexStep = vdupq_n_u32(4);
+
+    constexpr uint32_t s_LaneIndices[4] = {0, 1, 2, 3};
+    float32x4_t maxDistances2           = vdupq_n_f32(-1.f);
+    uint32x4_t maxIndices = vdupq_n_u32(0), indices = vld1q_u32(s_LaneIndices);
+
+    const size_t alignedCount = count & ~static_cast<size_t>(3);
+    for (size_t i{}; i < alignedCount; i += 4)
+    {
+        const float32x4x3_t points = vld3q_f32(xyz + i * 3);  // Deinterleaves xyz on load.
+
+        const float32x4_t x          = vsubq_f32(points.val[0], fromX);
+        const float32x4_t y          = vsubq_f32(points.val[1], fromY);
+        const float32x4_t z          = vsubq_f32(points.val[2], fromZ);
+        const float32x4_t distances2 = vaddq_f32(vaddq_f32(vmulq_f32(x, x), vmulq_f32(y, y)), vmulq_f32(z, z));
+
+        const uint32x4_t mask = vcgtq_f32(distances2, maxDistances2);
+        maxDistances2         = vbslq_f32(mask, distances2, maxDistances2);
+        maxIndices            = vbslq_u32(mask, indices, maxIndices);
+        indices               = vaddq_u32(indices, indexStep);
+    }
+
+    float laneDistances2[4];
+    uint32_t laneIndices[4];
+    vst1q_f32(laneDistances2, maxDistances2);
+    vst1q_u32(laneIndices, maxIndices);
+
+    float maxDistance2 = -1.f;
+    FoldFarthest(laneDistances2, laneIndices, 4, maxDistance2, outIndex);
+    AccumulateFarthest(xyz, alignedCount, count, from, maxDistance2, outIndex);
+    return maxDistance2;
+}
+
+#endif
+
+const BoundsKernels& GetKernels(const EBoundsISA isa)
+{
+    static constexpr BoundsKernels s_ScalarKernels = {.MinMax = MinMaxScalar, .Farthest = FarthestScalar};
+#if PFR_X86
+    static constexpr BoundsKernels s_SSE41Kernels = {.MinMax = MinMaxSSE41, .Farthest = FarthestSSE41};
+    static constexpr BoundsKernels s_AVX2Kernels  = {.MinMax = MinMaxAVX2, .Farthest = FarthestAVX2};
+#elif PFR_ARM64
+    static constexpr BoundsKernels s_NEONKernels = {.MinMax = MinMaxNEON, .Farthest = FarthestNEON};
+#endif
+
+    switch (isa)
+    {
+        case EBoundsISA::BOUNDS_ISA_SCALAR: return s_ScalarKernels;
+#if PFR_X86
+        case EBoundsISA::BOUNDS_ISA_SSE41: return s_SSE41Kernels;
+        case EBoundsISA::BOUNDS_ISA_AVX2: return s_AVX2Kernels;
+#elif PFR_ARM64
+        case EBoundsISA::BOUNDS_ISA_NEON: return s_NEONKernels;
+#endif
+        default: break;
+    }
+
+    PFR_ASSERT(false, "Bounds ISA isn't compiled in!");
+    return s_ScalarKernels;
+}
+
+}  // namespace MeshBoundsUtils
+
+AABB MeshBounds::ComputeAABB(const MeshPositionVertex* points, const size_t count, const EBoundsISA isa)
+{
+    if (!points || count == 0) return {};
+    PFR_ASSERT(IsISASupported(isa), "Bounds ISA isn't supported by this CPU!");
+
+    glm::vec3 min = {}, max = {};
+    MeshBoundsUtils::GetKernels(isa).MinMax(&points[0].Position.x, count, min, max);
+
+    const glm::vec3 center = (max + min) * 0.5f;
+    return {.Center = center, .Extents = max - center};
+}
+
+Sphere MeshBounds::ComputeSphere(const MeshPositionVertex* points, const size_t count, const EBoundsISA isa)
+{
+    PFR_ASSERT(points && count > 0, "Empty vertices, can't generate bounding sphere!");
+    PFR_ASSERT(count <= UINT32_MAX, "Bounds kernels track point indices in 32 bits!");
+    PFR_ASSERT(IsISASupported(isa), "Bounds ISA isn't supported by this CPU!");
+
+    const auto& kernels = MeshBoundsUtils::GetKernels(isa);
+    const float* xyz    = &points[0].Position.x;
+
+    glm::vec3 min = {}, max = {};
+    kernels.MinMax(xyz, count, min, max);
+    const glm::vec3 aabbCenter = (max + min) * 0.5f;
+
+    // Farthest point from AABB center and the farthest one from it span roughly the diameter, that's Ritter's initial sphere.
+    size_t firstIndex = 0, secondIndex = 0;
+    const float aabbRadius = std::sqrt(kernels.Farthest(xyz, count, aabbCenter, firstIndex));
+    kernels.Farthest(xyz, count, points[firstIndex].Position, secondIndex);
+
+    Sphere sphere = {};
+    sphere.Center = (points[firstIndex].Position + points[secondIndex].Position) * 0.5f;
+    sphere.Radius = glm::distance(points[firstIndex].Position, points[secondIndex].Position) * 0.5f;
+    for (uint32_t iteration{};; ++iteration)
+    {
+        size_t outlierIndex         = 0;
+        const float outlierDistance = std::sqrt(kernels.Farthest(xyz, count, sphere.Center, outlierIndex));
+        if (outlierDistance <= sphere.Radius) break;
+
+        // NOTE: Rounding may keep outlier a hair outside for a while, radius snaps to the exact farthest distance then.
+        if (iteration == s_MAX_SPHERE_REFINEMENT_ITERATIONS)
+        {
+            sphere.Radius = outlierDistance;
+            break;
+        }
+
+        // Grow just enough to touch the outlier, old sphere stays inside the new one.
+        const float grownRadius = (sphere.Radius + outlierDistance) * 0.5f;
+        sphere.Center += (points[outlierIndex].Position - sphere.Center) * ((grownRadius - sphere.Radius) / outlierDistance);
+        sphere.Radius = grownRadius;
+    }
+
+    // Boxy point sets are better off with AABB centered sphere, its radius is known from the first pass anyway.
+    if (aabbRadius < sphere.Radius)
+    {
+        sphere.Center = aabbCenter;
+        sphere.Radius = aabbRadius;
+    }
+
+    return sphere;
+}
+
+Sphere MeshBounds::ComputeSphere(const MeshPositionVertex* points, const uint32_t* indices, const size_t indexCount, const EBoundsISA isa)
+{
+    thread_local std::vector<MeshPositionVertex> gatheredPoints;
+    gatheredPoints.resize(indexCount);
+    for (size_t i{}; i < indexCount; ++i)
+        gatheredPoints[i] = points[indices[i]];
+
+    return ComputeSphere(gatheredPoints.data(), indexCount, isa);
+}
+
+EBoundsISA MeshBounds::GetBestISA()
+{
+    static const EBoundsISA s_BestISA = []
+    {
+        EBoundsISA bestISA = EBoundsISA::BOUNDS_ISA_SCALAR;
+        for (const auto isa : {EBoundsISA::BOUNDS_ISA_AVX2, EBoundsISA::BOUNDS_ISA_SSE41, EBoundsISA::BOUNDS_ISA_NEON})
+        {
+            if (!IsISASupported(isa)) continue;
+
+            bestISA = isa;
+            break;
+        }
+
+        LOG_INFO("MeshBounds: Using {} kernels.", GetISAName(bestISA));
+        return bestISA;
+    }();
+
+    return s_BestISA;
+}
+
+bool MeshBounds::IsISASupported(const EBoundsISA isa)
+{
+    // NOTE: Indexed by EBoundsISA, CPUID is queried once.
+    static const std::array<bool, 4> s_SupportedISAs = {true, SSE41Supported(), AVX2Supported(), NEONSupported()};
+    return s_SupportedISAs[static_cast<size_t>(isa)];
+}
+
+const char* MeshBounds::GetISAName(const EBoundsISA isa)
+{
+    switch (isa)
+    {
+        case EBoundsISA::BOUNDS_ISA_SCALAR: return "Scalar";
+        case EBoundsISA::BOUNDS_ISA_SSE41: return "SSE41";
+        case EBoundsISA::BOUNDS_ISA_AVX2: return "AVX2";
+        case EBoundsISA::BOUNDS_ISA_NEON: return "NEON";
+    }
+
+    PFR_ASSERT(false, "Unknown bounds ISA!");
+    return "Unknown";
+}
+
+}  // namespace Pathfinder
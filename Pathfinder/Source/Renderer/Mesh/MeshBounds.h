@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Renderer/RendererCoreDefines.h"
+
+namespace Pathfinder
+{
+
+enum class EBoundsISA : uint8_t
+{
+    BOUNDS_ISA_SCALAR = 0,
+    BOUNDS_ISA_SSE41,
+    BOUNDS_ISA_AVX2,
+    BOUNDS_ISA_NEON,
+};
+
+/*
+ * Bounds of position streams, vectorized with SSE4.1/AVX2 on x86 and NEON on AArch64. x86 kernels are compiled per function, so binary
+ * still runs on baseline CPUs, the best supported ISA is picked once at runtime. Scalar kernels are the reference the rest is checked
+ * against(see MeshManagerBenchmarks).
+ * Sphere is Ritter's: initial diameter comes from 2 farthest point passes, then sphere is grown towards the farthest outlier until
+ * every point is inside. Each step is a farthest point pass, that's the part that gets vectorized.
+ */
+class MeshBounds final
+{
+  public:
+    NODISCARD static AABB ComputeAABB(const MeshPositionVertex* points, const size_t count, const EBoundsISA isa = GetBestISA());
+    NODISCARD static Sphere ComputeSphere(const MeshPositionVertex* points, const size_t count, const EBoundsISA isa = GetBestISA());
+
+    // Sphere of indexed subset(e.g. meshlet vertices), points are gathered into thread local scratch first.
+    NODISCARD static Sphere ComputeSphere(const MeshPositionVertex* points, const uint32_t* indices, const size_t indexCount,
+                                          const EBoundsISA isa = GetBestISA());
+
+    NODISCARD static EBoundsISA GetBestISA();
+    NODISCARD static bool IsISASupported(const EBoundsISA isa);
+    NODISCARD static const char* GetISAName(const EBoundsISA isa);
+
+  private:
+    static constexpr uint32_t s_MAX_SPHERE_REFINEMENT_ITERATIONS = 32;
+
+    MeshBounds()  = delete;
+    ~MeshBounds() = default;
+};
+
+}  // namespace Pathfinder
@@ -0,0 +1,322 @@
+#include <PathfinderPCH.h>
+#include "MeshCache.h"
+
+#include <Core/Application.h>
+#include <Core/ThreadPool.h>
+
+#include <meshoptimizer.h>
+
+namespace Pathfinder
+{
+
+namespace MeshCacheUtils
+{
+
+FORCEINLINE static void HashCombine(uint64_t& seed, const uint64_t value)
+{
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+NODISCARD FORCEINLINE static uint64_t HashFileContents(const std::filesystem::path& filePath)
+{
+    const auto fileData = LoadData<std::vector<uint8_t>>(filePath.string());
+    return ankerl::unordered_dense::hash<std::string_view>{}(
+        std::string_view(reinterpret_cast<const char*>(fileData.data()), fileData.size()));
+}
+
+NODISCARD FORCEINLINE static uint64_t AlignUp(const uint64_t value, const uint64_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+template <typename T> static MeshCache::CookedSection AppendSection(std::vector<uint8_t>& blob, const T* data, const size_t count)
+{
+    const uint64_t offset = AlignUp(blob.size(), MeshCache::s_SECTION_ALIGNMENT);
+    const uint64_t size   = count * sizeof(T);
+    blob.resize(offset + size);
+    if (size > 0) std::memcpy(blob.data() + offset, data, size);
+
+    return {.Offset = offset, .Size = size, .Count = count};
+}
+
+// meshopt vertex codec needs stride to be multiple of 4, so odd sized elements(MeshAttributeVertex) are encoded in runs of 2 or 4.
+template <typename T> NODISCARD FORCEINLINE static constexpr size_t GetVertexCodecRun()
+{
+    return 4 / std::gcd(sizeof(T), size_t{4});
+}
+
+template <typename T> static MeshCache::CookedSection AppendVertexSection(std::vector<uint8_t>& blob, const std::vector<T>& data)
+{
+    constexpr size_t run    = GetVertexCodecRun<T>();
+    constexpr size_t stride = sizeof(T) * run;
+    static_assert(stride <= 256, "meshopt vertex codec supports strides up to 256 bytes!");
+
+    const size_t vertexCount = (data.size() + run - 1) / run;
+    std::vector<uint8_t> vertices(vertexCount * stride);  // NOTE: Tail of the last run is zero-padded.
+    if (!data.empty()) std::memcpy(vertices.data(), data.data(), data.size() * sizeof(T));
+
+    std::vector<uint8_t> encoded(meshopt_encodeVertexBufferBound(vertexCount, stride));
+    encoded.resize(meshopt_encodeVertexBuffer(encoded.data(), encoded.size(), vertices.data(), vertexCount, stride));
+
+    auto section  = AppendSection(blob, encoded.data(), encoded.size());
+    section.Count = data.size();
+    return section;
+}
+
+// Triangle lists go through index buffer codec, anything else referencing vertices(meshlet vertices) through index sequence one.
+static MeshCache::CookedSection AppendIndexSection(std::vector<uint8_t>& blob, const std::vector<uint32_t>& indices,
+                                                   const size_t vertexCount, const bool bTriangleList)
+{
+    std::vector<uint8_t> encoded(bTriangleList ? meshopt_encodeIndexBufferBound(indices.size(), vertexCount)
+                                               : meshopt_encodeIndexSequenceBound(indices.size(), vertexCount));
+    encoded.resize(bTriangleList ? meshopt_encodeIndexBuffer(encoded.data(), encoded.size(), indices.data(), indices.size())
+                                 : meshopt_encodeIndexSequence(encoded.data(), encoded.size(), indices.data(), indices.size()));
+
+    auto section  = AppendSection(blob, encoded.data(), encoded.size());
+    section.Count = indices.size();
+    return section;
+}
+
+template <typename T>
+NODISCARD static bool ReadSection(const std::vector<uint8_t>& blob, const MeshCache::CookedSection& section, std::vector<T>& outData)
+{
+    if (section.Size % sizeof(T) != 0 || section.Offset + section.Size > blob.size()) return false;
+
+    outData.resize(section.Size / sizeof(T));
+    if (section.Size > 0) std::memcpy(outData.data(), blob.data() + section.Offset, section.Size);
+    return true;
+}
+
+template <typename T>
+NODISCARD static bool ReadVertexSection(const std::vector<uint8_t>& blob, const MeshCache::CookedSection& section, std::vector<T>& outData)
+{
+    if (section.Offset + section.Size > blob.size()) return false;
+
+    constexpr size_t run     = GetVertexCodecRun<T>();
+    const size_t vertexCount = (section.Count + run - 1) / run;
+    outData.resize(vertexCount * run);
+    if (meshopt_decodeVertexBuffer(outData.data(), vertexCount, sizeof(T) * run, blob.data() + section.Offset, section.Size) != 0)
+        return false;
+
+    outData.resize(section.Count);
+    return true;
+}
+
+NODISCARD static bool ReadIndexSection(const std::vector<uint8_t>& blob, const MeshCache::CookedSection& section,
+                                       std::vector<uint32_t>& outIndices, const bool bTriangleList)
+{
+    if (section.Offset + section.Size > blob.size() || (bTriangleList && section.Count % 3 != 0)) return false;
+
+    outIndices.resize(section.Count);
+    const uint8_t* encoded = blob.data() + section.Offset;
+    if (bTriangleList) return meshopt_decodeIndexBuffer(outIndices.data(), outIndices.size(), sizeof(uint32_t), encoded, section.Size) == 0;
+
+    return meshopt_decodeIndexSequence(outIndices.data(), outIndices.size(), sizeof(uint32_t), encoded, section.Size) == 0;
+}
+
+NODISCARD static uint64_t GetDecodedGeometrySize(const CookedSubmesh& submesh)
+{
+    return submesh.Indices.size() * sizeof(submesh.Indices[0]) + submesh.VertexPositions.size() * sizeof(submesh.VertexPositions[0]) +
+           submesh.VertexAttributes.size() * sizeof(submesh.VertexAttributes[0]) + submesh.Meshlets.size() * sizeof(submesh.Meshlets[0]) +
+           submesh.MeshletVertices.size() * sizeof(submesh.MeshletVertices[0]) +
+           submesh.MeshletTriangles.size() * sizeof(submesh.MeshletTriangles[0]);
+}
+
+}  // namespace MeshCacheUtils
+
+uint64_t MeshCache::ComputeCacheKey(const std::filesystem::path& meshFilePath)
+{
+    uint64_t cacheKey = MeshCacheUtils::HashFileContents(meshFilePath);
+
+    // NOTE: .gltf references external buffers, they can change independently of json part.
+    if (meshFilePath.extension() == ".gltf")
+    {
+        std::vector<std::filesystem::path> bufferPaths;
+        for (const auto& dirEntry : std::filesystem::directory_iterator(meshFilePath.parent_path()))
+        {
+            if (dirEntry.is_regular_file() && dirEntry.path().extension() == ".bin") bufferPaths.emplace_back(dirEntry.path());
+        }
+
+        std::sort(bufferPaths.begin(), bufferPaths.end());
+        for (const auto& bufferPath : bufferPaths)
+            MeshCacheUtils::HashCombine(cacheKey, MeshCacheUtils::HashFileContents(bufferPath));
+    }
+
+    MeshCacheUtils::HashCombine(cacheKey, s_COOKED_MESH_VERSION);
+    MeshCacheUtils::HashCombine(cacheKey, MAX_MESHLET_VERTEX_COUNT);
+    MeshCacheUtils::HashCombine(cacheKey, MAX_MESHLET_TRIANGLE_COUNT);
+    MeshCacheUtils::HashCombine(cacheKey, std::bit_cast<uint32_t>(MESHLET_CONE_WEIGHT));
+    return cacheKey;
+}
+
+std::filesystem::path MeshCache::GetCookedMeshPath(const std::filesystem::path& meshFilePath)
+{
+    const auto& appSpec           = Application::Get().GetSpecification();
+    const std::string meshDirPath = meshFilePath.parent_path().string() + "/";
+    const auto ind                = meshDirPath.find(appSpec.MeshDir);
+    PFR_ASSERT(ind != std::string::npos, "Failed to find meshes substr index!");
+
+    // Same directory as texture cache: "Cache/Meshes/sponza/".
+    const auto cookedMeshDir = std::filesystem::path(appSpec.WorkingDir) / appSpec.AssetsDir / appSpec.CacheDir / meshDirPath.substr(ind);
+    if (!std::filesystem::exists(cookedMeshDir)) std::filesystem::create_directories(cookedMeshDir);
+
+    auto cookedMeshPath = cookedMeshDir / meshFilePath.filename();
+    cookedMeshPath.replace_extension(s_COOKED_MESH_EXTENSION);
+    return cookedMeshPath;
+}
+
+bool MeshCache::Load(const std::filesystem::path& cookedMeshPath, const uint64_t cacheKey, std::vector<CookedSubmesh>& outSubmeshes)
+{
+    if (!std::filesystem::exists(cookedMeshPath)) return false;
+
+    const auto blob = LoadData<std::vector<uint8_t>>(cookedMeshPath.string());
+    if (blob.size() < sizeof(CookedMeshHeader)) return false;
+
+    CookedMeshHeader header = {};
+    std::memcpy(&header, blob.data(), sizeof(header));
+    if (header.Magic != s_COOKED_MESH_MAGIC || header.Version != s_COOKED_MESH_VERSION || header.FileSize != blob.size())
+    {
+        LOG_WARN("MeshCache: \"{}\" is corrupted or has outdated version!", cookedMeshPath.string());
+        return false;
+    }
+
+    if (header.CacheKey != cacheKey || header.MaxMeshletVertexCount != MAX_MESHLET_VERTEX_COUNT ||
+        header.MaxMeshletTriangleCount != MAX_MESHLET_TRIANGLE_COUNT || header.MeshletConeWeight != MESHLET_CONE_WEIGHT)
+        return false;
+
+    const uint64_t submeshTableOffset = MeshCacheUtils::AlignUp(sizeof(CookedMeshHeader), s_SECTION_ALIGNMENT);
+    if (submeshTableOffset + header.SubmeshCount * sizeof(CookedSubmeshHeader) > blob.size()) return false;
+
+    Timer decodeTimer      = {};
+    const auto& workingDir = Application::Get().GetSpecification().WorkingDir;
+    std::vector<CookedSubmeshHeader> submeshHeaders(header.SubmeshCount);
+    outSubmeshes.resize(header.SubmeshCount);
+    for (uint32_t submeshIndex{}; submeshIndex < header.SubmeshCount; ++submeshIndex)
+    {
+        auto& submeshHeader = submeshHeaders[submeshIndex];
+        std::memcpy(&submeshHeader, blob.data() + submeshTableOffset + submeshIndex * sizeof(CookedSubmeshHeader), sizeof(submeshHeader));
+
+        auto& submesh          = outSubmeshes[submeshIndex];
+        submesh.BoundingSphere = submeshHeader.BoundingSphere;
+        submesh.PositionCenter = submeshHeader.PositionCenter;
+        submesh.PositionExtent = submeshHeader.PositionExtent;
+        submesh.MaterialData   = submeshHeader.MaterialData;
+
+        for (size_t slot{}; slot < submesh.TextureCachePaths.size(); ++slot)
+        {
+            const auto& section = submeshHeader.TextureCachePaths[slot];
+            if (section.Size == 0) continue;
+
+            std::vector<char> texturePath;
+            if (!MeshCacheUtils::ReadSection(blob, section, texturePath))
+            {
+                outSubmeshes.clear();
+                return false;
+            }
+            submesh.TextureCachePaths[slot] = std::string(texturePath.begin(), texturePath.end());
+
+            // NOTE: Texture cache can be wiped separately, in this case we have to go through the full import.
+            if (!std::filesystem::exists(std::filesystem::path(workingDir) / submesh.TextureCachePaths[slot]))
+            {
+                outSubmeshes.clear();
+                return false;
+            }
+        }
+    }
+
+    // Decoding touches only its own submesh, so fan it out.
+    std::atomic<bool> bSectionsValid = true;
+    ThreadPool::ParallelFor(header.SubmeshCount, 1,
+                            [&](const uint32_t submeshIndex)
+                            {
+                                const auto& submeshHeader = submeshHeaders[submeshIndex];
+                                auto& submesh             = outSubmeshes[submeshIndex];
+                                if (!MeshCacheUtils::ReadIndexSection(blob, submeshHeader.Indices, submesh.Indices, true) ||
+                                    !MeshCacheUtils::ReadVertexSection(blob, submeshHeader.VertexPositions, submesh.VertexPositions) ||
+                                    !MeshCacheUtils::ReadVertexSection(blob, submeshHeader.VertexAttributes, submesh.VertexAttributes) ||
+                                    !MeshCacheUtils::ReadVertexSection(blob, submeshHeader.Meshlets, submesh.Meshlets) ||
+                                    !MeshCacheUtils::ReadIndexSection(blob, submeshHeader.MeshletVertices, submesh.MeshletVertices,
+                                                                      false) ||
+                                    !MeshCacheUtils::ReadVertexSection(blob, submeshHeader.MeshletTriangles, submesh.MeshletTriangles))
+                                    bSectionsValid.store(false, std::memory_order_relaxed);
+                            });
+
+    if (!bSectionsValid.load(std::memory_order_relaxed))
+    {
+        LOG_WARN("MeshCache: \"{}\" has invalid sections!", cookedMeshPath.string());
+        outSubmeshes.clear();
+        return false;
+    }
+
+    uint64_t decodedSize = 0;
+    for (const auto& submesh : outSubmeshes)
+        decodedSize += MeshCacheUtils::GetDecodedGeometrySize(submesh);
+    LOG_INFO("MeshCache: \"{}\" decoded ({:.3f}) MB of geometry out of ({:.3f}) MB file in ({:.3f}) ms.", cookedMeshPath.string(),
+             decodedSize / 1024.0 / 1024.0, blob.size() / 1024.0 / 1024.0, decodeTimer.GetElapsedMilliseconds());
+    return true;
+}
+
+void MeshCache::Save(const std::filesystem::path& cookedMeshPath, const uint64_t cacheKey, const std::vector<CookedSubmesh>& submeshes)
+{
+    PFR_ASSERT(!cookedMeshPath.empty(), "Invalid save path for cooked mesh!");
+
+    const uint64_t submeshTableOffset = MeshCacheUtils::AlignUp(sizeof(CookedMeshHeader), s_SECTION_ALIGNMENT);
+    std::vector<uint8_t> blob(submeshTableOffset + submeshes.size() * sizeof(CookedSubmeshHeader));
+    uint64_t decodedSize = 0;
+
+    for (size_t submeshIndex{}; submeshIndex < submeshes.size(); ++submeshIndex)
+    {
+        const auto& submesh               = submeshes[submeshIndex];
+        CookedSubmeshHeader submeshHeader = {};
+        submeshHeader.BoundingSphere      = submesh.BoundingSphere;
+        submeshHeader.PositionCenter      = submesh.PositionCenter;
+        submeshHeader.PositionExtent      = submesh.PositionExtent;
+        submeshHeader.MaterialData        = submesh.MaterialData;
+        decodedSize += MeshCacheUtils::GetDecodedGeometrySize(submesh);
+
+        const size_t vertexCount       = submesh.VertexPositions.size();
+        submeshHeader.Indices          = MeshCacheUtils::AppendIndexSection(blob, submesh.Indices, vertexCount, true);
+        submeshHeader.VertexPositions  = MeshCacheUtils::AppendVertexSection(blob, submesh.VertexPositions);
+        submeshHeader.VertexAttributes = MeshCacheUtils::AppendVertexSection(blob, submesh.VertexAttributes);
+        submeshHeader.Meshlets         = MeshCacheUtils::AppendVertexSection(blob, submesh.Meshlets);
+        submeshHeader.MeshletVertices  = MeshCacheUtils::AppendIndexSection(blob, submesh.MeshletVertices, vertexCount, false);
+        submeshHeader.MeshletTriangles = MeshCacheUtils::AppendVertexSection(blob, submesh.MeshletTriangles);
+
+        for (size_t slot{}; slot < submesh.TextureCachePaths.size(); ++slot)
+        {
+            const auto& texturePath = submesh.TextureCachePaths[slot];
+            submeshHeader.TextureCachePaths[slot] =
+                texturePath.empty() ? CookedSection{} : MeshCacheUtils::AppendSection(blob, texturePath.data(), texturePath.size());
+        }
+
+        std::memcpy(blob.data() + submeshTableOffset + submeshIndex * sizeof(CookedSubmeshHeader), &submeshHeader, sizeof(submeshHeader));
+    }
+
+    const CookedMeshHeader header = {.Magic                   = s_COOKED_MESH_MAGIC,
+                                     .Version                 = s_COOKED_MESH_VERSION,
+                                     .CacheKey                = cacheKey,
+                                     .MaxMeshletVertexCount   = MAX_MESHLET_VERTEX_COUNT,
+                                     .MaxMeshletTriangleCount = MAX_MESHLET_TRIANGLE_COUNT,
+                                     .MeshletConeWeight       = MESHLET_CONE_WEIGHT,
+                                     .SubmeshCount            = static_cast<uint32_t>(submeshes.size()),
+                                     .FileSize                = blob.size()};
+    std::memcpy(blob.data(), &header, sizeof(header));
+
+    // Write to temporary file first, so interrupted save won't leave half-written cooked mesh.
+    auto tempPath = cookedMeshPath;
+    tempPath += ".tmp";
+    SaveData(tempPath.string(), blob.data(), blob.size());
+
+    std::error_code ec = {};
+    std::filesystem::rename(tempPath, cookedMeshPath, ec);
+    if (ec)
+    {
+        LOG_WARN("MeshCache: Failed to save cooked mesh \"{}\"! {}", cookedMeshPath.string(), ec.message());
+        return;
+    }
+
+    LOG_INFO("MeshCache: \"{}\" ({:.3f}) MB of geometry encoded into ({:.3f}) MB file.", cookedMeshPath.string(),
+             decodedSize / 1024.0 / 1024.0, blob.size() / 1024.0 / 1024.0);
+}
+
+}  // namespace Pathfinder
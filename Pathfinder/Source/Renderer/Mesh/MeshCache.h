@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core/Core.h"
+#include "Renderer/RendererCoreDefines.h"
+#include "Globals.h"
+
+namespace Pathfinder
+{
+
+// NOTE: Slots of material textures stored in cooked mesh, order matters.
+enum class ECookedTextureSlot : uint8_t
+{
+    COOKED_TEXTURE_SLOT_ALBEDO = 0,
+    COOKED_TEXTURE_SLOT_NORMAL,
+    COOKED_TEXTURE_SLOT_METALLIC_ROUGHNESS,
+    COOKED_TEXTURE_SLOT_EMISSIVE,
+    COOKED_TEXTURE_SLOT_OCCLUSION,
+    COOKED_TEXTURE_SLOT_COUNT
+};
+
+// Final (optimized) data of single submesh, exactly what goes to the GPU.
+struct CookedSubmesh
+{
+    std::vector<uint32_t> Indices;
+    std::vector<MeshQuantizedPositionVertex> VertexPositions;
+    std::vector<MeshAttributeVertex> VertexAttributes;
+    std::vector<Meshlet> Meshlets;
+    std::vector<uint32_t> MeshletVertices;
+    std::vector<uint8_t> MeshletTriangles;
+    Sphere BoundingSphere    = {};
+    glm::vec3 PositionCenter = glm::vec3(0.f);  // Dequantization of VertexPositions.
+    glm::vec3 PositionExtent = glm::vec3(1.f);
+
+    PBRData MaterialData = {};  // NOTE: Texture indices are bindless indices of the current run, they aren't valid after load.
+    std::array<std::string, static_cast<size_t>(ECookedTextureSlot::COOKED_TEXTURE_SLOT_COUNT)>
+        TextureCachePaths;  // Relative to WorkingDir, empty if slot isn't used.
+};
+
+/*
+ * Cooked mesh file layout(native endianness and struct layout, offsets are from file start):
+ * [CookedMeshHeader, padded to s_SECTION_ALIGNMENT][CookedSubmeshHeader * SubmeshCount]
+ * [submesh 0: Indices, VertexPositions, VertexAttributes, Meshlets, MeshletVertices, MeshletTriangles, texture cache paths][submesh 1]...
+ * Every section starts at s_SECTION_ALIGNMENT, CookedSection holds its offset, stored size and decoded element count.
+ * Geometry sections are encoded by meshoptimizer codecs(vertex codec for vertices, meshlets and meshlet triangles, index codecs for
+ * indices and meshlet vertices). Texture cache paths are raw chars without terminator, unused slots have empty section.
+ * NOTE: It's not meant to be consumed in place: whole file is read into memory, headers are memcpy'd out and every section is
+ * decoded(submeshes in parallel) into CookedSubmesh.
+ */
+class MeshCache final
+{
+  public:
+    static constexpr uint32_t s_COOKED_MESH_MAGIC   = 0x48534D50;  // "PMSH"
+    static constexpr uint32_t s_COOKED_MESH_VERSION = 5;
+    static constexpr uint64_t s_SECTION_ALIGNMENT   = 16;
+    static constexpr std::string_view s_COOKED_MESH_EXTENSION = ".pfmesh";
+
+    // Hash of the source file(and its .bin buffers if it's .gltf) contents combined with meshlet build limits and format version.
+    NODISCARD static uint64_t ComputeCacheKey(const std::filesystem::path& meshFilePath);
+    NODISCARD static std::filesystem::path GetCookedMeshPath(const std::filesystem::path& meshFilePath);
+
+    // Returns false in case cooked mesh doesn't exist, is stale or corrupted.
+    NODISCARD static bool Load(const std::filesystem::path& cookedMeshPath, const uint64_t cacheKey,
+                               std::vector<CookedSubmesh>& outSubmeshes);
+    static void Save(const std::filesystem::path& cookedMeshPath, const uint64_t cacheKey, const std::vector<CookedSubmesh>& submeshes);
+
+    // NOTE: On-disk layout, public since section codecs(MeshCacheUtils) read and write it.
+    struct CookedMeshHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint64_t CacheKey;
+        uint32_t MaxMeshletVertexCount;
+        uint32_t MaxMeshletTriangleCount;
+        float MeshletConeWeight;
+        uint32_t SubmeshCount;
+        uint64_t FileSize;
+    };
+
+    struct CookedSection
+    {
+        uint64_t Offset;
+        uint64_t Size;   // [bytes] as stored(encoded).
+        uint64_t Count;  // Decoded element count.
+    };
+
+    struct CookedSubmeshHeader
+    {
+        CookedSection Indices;
+        CookedSection VertexPositions;
+        CookedSection VertexAttributes;
+        CookedSection Meshlets;
+        CookedSection MeshletVertices;
+        CookedSection MeshletTriangles;
+        CookedSection TextureCachePaths[static_cast<size_t>(ECookedTextureSlot::COOKED_TEXTURE_SLOT_COUNT)];
+        Sphere BoundingSphere;
+        glm::vec3 PositionCenter;
+        glm::vec3 PositionExtent;
+        PBRData MaterialData;
+    };
+
+  private:
+    MeshCache()  = delete;
+    ~MeshCache() = default;
+};
+
+}  // namespace Pathfinder
@@ -2,15 +2,20 @@
 #include "MeshManager.h"
 
 #include "Submesh.h"
+#include "MeshCache.h"
+#include "MeshletHierarchy.h"
+#include "MeshBounds.h"
 #include "Globals.h"
 
 #include <Core/Application.h>
-#include <Core/Intrinsics.h>
+#include <Core/ThreadPool.h>
 
 #include <Renderer/Buffer.h>
 #include <Renderer/Material.h>
 #include <Renderer/Image.h>
 #include <Renderer/Texture.h>
+#include <Renderer/TextureStreamer.h>
+#include <Renderer/KTX2.h>
 #include <Renderer/Renderer.h>
 
 #include <fastgltf/glm_element_traits.hpp>
@@ -36,6 +41,72 @@ FORCEINLINE constexpr static void RemapVertexStream(const size_t remappedVertexC
 }
 }  // namespace MeshOptimizerUtils
 
+// NOTE: Upper bound for memory of decoded texture images being processed at once during mesh load.
+static constexpr size_t s_MAX_IN_FLIGHT_DECODED_IMAGE_BYTES = 512ull * 1024 * 1024;
+
+struct MeshPrimitiveTask
+{
+    const fastgltf::Primitive* Primitive = nullptr;
+    glm::mat4 LocalTransform             = glm::mat4(1.f);
+};
+
+// Single unique texture of the mesh, decoded/compressed(or read from cache) on a worker, turned into Texture on the loading thread.
+struct MeshTextureJob
+{
+    std::string TexturePath             = s_DEFAULT_STRING;  // Source image.
+    std::filesystem::path CacheFilePath = {};                // Absolute path to BCn cache.
+    TextureSpecification TextureSpec    = {};                // Sampler and requested format, size is filled by the job.
+    bool bMetallicRoughness             = false;
+    bool bFlipOnLoad                    = false;
+    bool bStreamed                      = false;             // Cache is valid, so texture is streamed from it by TextureStreamer.
+    size_t DecodedByteSize              = 0;                 // Memory decoding and compression take, 0 if texture is streamed.
+    std::vector<uint8_t> ImageData      = {};                // Compressed blocks, or raw texels if no BCn requested.
+    Shared<Texture> LoadedTexture       = nullptr;
+};
+
+// Material slot waiting for its texture job.
+struct MeshTextureBinding
+{
+    Shared<Material> TargetMaterial = nullptr;
+    ECookedTextureSlot Slot         = ECookedTextureSlot::COOKED_TEXTURE_SLOT_ALBEDO;
+    uint32_t JobIndex               = 0;
+};
+
+struct MeshTextureJobs
+{
+    UnorderedMap<std::string, uint32_t> JobIndices;  // Cache path relative to WorkingDir -> index into Jobs.
+    std::vector<MeshTextureJob> Jobs;
+    std::vector<MeshTextureBinding> Bindings;
+};
+
+// Texel streamed texture shows until its mip tail is loaded(or for good, if loading fails). Neutral for the material slot, so surfaces
+// don't flash with emission, bent normals or metal meanwhile.
+NODISCARD static uint32_t GetStreamedTextureFallback(const ECookedTextureSlot slot)
+{
+    switch (slot)
+    {
+        case ECookedTextureSlot::COOKED_TEXTURE_SLOT_ALBEDO: return glm::packUnorm4x8(glm::vec4(1.f));
+        case ECookedTextureSlot::COOKED_TEXTURE_SLOT_NORMAL: return glm::packUnorm4x8(glm::vec4(0.5f, 0.5f, 1.f, 1.f));  // Flat.
+        // NOTE: Cooked metallic-roughness keeps roughness in R and metallic in G, so it's rough dielectric.
+        case ECookedTextureSlot::COOKED_TEXTURE_SLOT_METALLIC_ROUGHNESS: return glm::packUnorm4x8(glm::vec4(1.f, 0.f, 0.f, 1.f));
+        case ECookedTextureSlot::COOKED_TEXTURE_SLOT_EMISSIVE: return glm::packUnorm4x8(glm::vec4(0.f, 0.f, 0.f, 1.f));
+        case ECookedTextureSlot::COOKED_TEXTURE_SLOT_OCCLUSION: return glm::packUnorm4x8(glm::vec4(1.f));
+        default: break;
+    }
+
+    PFR_ASSERT(false, "Unknown cooked texture slot!");
+    return glm::packUnorm4x8(glm::vec4(1.f));
+}
+
+// NOTE: Summed across all workers, so it may exceed wall time of the parallel stage.
+struct PrimitiveStageTimings
+{
+    std::atomic<uint64_t> AttributesNs{0};
+    std::atomic<uint64_t> OptimizeNs{0};
+    std::atomic<uint64_t> BoundsNs{0};
+    std::atomic<uint64_t> MeshletsNs{0};
+};
+
 namespace FastGLTFUtils
 {
 
@@ -66,10 +137,40 @@ NODISCARD FORCEINLINE static ESamplerWrap SamplerWrapToPathfinder(const fastgltf
     return ESamplerWrap::SAMPLER_WRAP_REPEAT;
 }
 
-NODISCARD static Shared<Texture> LoadTexture(UnorderedMap<std::string, Shared<Texture>>& loadedTextures, const std::string& meshAssetsDir,
-                                             const size_t textureIndex, const fastgltf::Asset& asset,
-                                             const EImageFormat requestedImageFormat = EImageFormat::FORMAT_RGBA8_UNORM,
-                                             const bool bMetallicRoughness = false, const bool bFlipOnLoad = false)
+// NOTE: Cache files are KTX2 containers, see KTX2.h, inner extension keeps BCn variants of the same image apart.
+NODISCARD static std::string GetTextureCacheExtension(const EImageFormat format)
+{
+    std::string bcExtension = ".bc";
+    switch (format)
+    {
+        case EImageFormat::FORMAT_BC1_RGB_UNORM: bcExtension += "1_rgb_unorm"; break;
+        case EImageFormat::FORMAT_BC1_RGB_SRGB: bcExtension += "1_rgb_srgb"; break;
+        case EImageFormat::FORMAT_BC1_RGBA_UNORM: bcExtension += "1_rgba_unorm"; break;
+        case EImageFormat::FORMAT_BC1_RGBA_SRGB: bcExtension += "1_rgba_srgb"; break;
+        case EImageFormat::FORMAT_BC2_UNORM: bcExtension += "2_unorm"; break;
+        case EImageFormat::FORMAT_BC2_SRGB: bcExtension += "2_srgb"; break;
+        case EImageFormat::FORMAT_BC3_UNORM: bcExtension += "3_unorm"; break;
+        case EImageFormat::FORMAT_BC3_SRGB: bcExtension += "3_srgb"; break;
+        case EImageFormat::FORMAT_BC4_UNORM: bcExtension += "4_unorm"; break;
+        case EImageFormat::FORMAT_BC4_SNORM: bcExtension += "4_snorm"; break;
+        case EImageFormat::FORMAT_BC5_UNORM: bcExtension += "5_unorm"; break;
+        case EImageFormat::FORMAT_BC5_SNORM: bcExtension += "5_snorm"; break;
+        case EImageFormat::FORMAT_BC6H_UFLOAT: bcExtension += "6H_ufloat"; break;
+        case EImageFormat::FORMAT_BC6H_SFLOAT: bcExtension += "6H_sfloat"; break;
+        case EImageFormat::FORMAT_BC7_UNORM: bcExtension += "7_unorm"; break;
+        case EImageFormat::FORMAT_BC7_SRGB: bcExtension += "7_srgb"; break;
+        default: bcExtension = ".raw"; break;  // Uncompressed texels.
+    }
+
+    return bcExtension + ".ktx2";
+}
+
+// NOTE: outCacheFilePath is relative to WorkingDir, so it can be stored in cooked mesh.
+// Only describes the texture, decoding happens later in ProcessTextureJob(). Textures shared between materials get single job.
+NODISCARD static uint32_t AddTextureJob(MeshTextureJobs& textureJobs, const std::string& meshAssetsDir, const size_t textureIndex,
+                                        const fastgltf::Asset& asset, std::string& outCacheFilePath,
+                                        const EImageFormat requestedImageFormat = EImageFormat::FORMAT_RGBA8_UNORM,
+                                        const bool bMetallicRoughness = false, const bool bFlipOnLoad = false)
 {
     const auto& fastgltfTexture = asset.textures.at(textureIndex);
     const auto imageIndex       = fastgltfTexture.imageIndex;
@@ -82,9 +183,28 @@ NODISCARD static Shared<Texture> LoadTexture(UnorderedMap<std::string, Shared<Te
     PFR_ASSERT(std::holds_alternative<fastgltf::sources::URI>(fastgltfImage.data), "Texture hasn't path!");
     const auto& fastgltfURI = std::get<fastgltf::sources::URI>(fastgltfImage.data);
 
-    const std::string textureName = fastgltfURI.uri.fspath().stem().string();
-    PFR_ASSERT(textureName.data(), "Texture has no name!");
-    if (loadedTextures.contains(textureName)) return loadedTextures.at(textureName);
+    const auto& appSpec = Application::Get().GetSpecification();
+    const auto ind      = meshAssetsDir.find(appSpec.MeshDir);
+    PFR_ASSERT(ind != std::string::npos, "Failed to find meshes substr index!");
+    const std::string meshDir = meshAssetsDir.substr(ind);  // contains something like: "Meshes/sponza/"
+    const auto currentMeshTextureCacheDir = std::filesystem::path(appSpec.AssetsDir) / appSpec.CacheDir / meshDir / "textures/";
+    const auto fullTextureCacheDir        = std::filesystem::path(appSpec.WorkingDir) / currentMeshTextureCacheDir;
+    if (!std::filesystem::exists(fullTextureCacheDir)) std::filesystem::create_directories(fullTextureCacheDir);
+
+    std::filesystem::path textureURIPath = fastgltfURI.uri.string();
+    if (const auto lastSlashIndex = textureURIPath.string().find_last_of("/"); lastSlashIndex != std::string::npos)
+    {
+        // Strip extra info, all we want is texture name(everything after last slash).
+        textureURIPath = fastgltfURI.uri.string().substr(lastSlashIndex + 1);
+    }
+
+    std::filesystem::path textureCacheFilePath = currentMeshTextureCacheDir / textureURIPath;
+    textureCacheFilePath.replace_extension(GetTextureCacheExtension(textureSpec.Format));
+    outCacheFilePath = textureCacheFilePath.string();
+    std::replace(outCacheFilePath.begin(), outCacheFilePath.end(), '\\', '/');  // adjust
+
+    // NOTE: Cache path carries both image name and target format, so it tells apart same image requested as different BCn.
+    if (const auto it = textureJobs.JobIndices.find(outCacheFilePath); it != textureJobs.JobIndices.end()) return it->second;
 
     if (fastgltfTexture.samplerIndex.has_value())
     {
@@ -94,149 +214,212 @@ NODISCARD static Shared<Texture> LoadTexture(UnorderedMap<std::string, Shared<Te
             textureSpec.Filter = FastGLTFUtils::SamplerFilterToPathfinder(fastgltfTextureSampler.magFilter.value());
     }
 
-    const auto& appSpec = Application::Get().GetSpecification();
-    const auto ind      = meshAssetsDir.find(appSpec.MeshDir);
-    PFR_ASSERT(ind != std::string::npos, "Failed to find meshes substr index!");
-    const std::string meshDir = meshAssetsDir.substr(ind);  // contains something like: "Meshes/sponza/"
-    const auto currentMeshTextureCacheDir =
-        std::filesystem::path(appSpec.WorkingDir) / appSpec.AssetsDir / appSpec.CacheDir / meshDir / "textures/";
-    if (!std::filesystem::exists(currentMeshTextureCacheDir)) std::filesystem::create_directories(currentMeshTextureCacheDir);
-
-    Shared<Texture> texture = nullptr;
-    std::visit(
-        fastgltf::visitor{
-            [](auto& arg) {},
-            [&](const fastgltf::sources::URI& uri)
-            {
-                std::filesystem::path textureURIPath = uri.uri.string();
-                if (const auto lastSlashIndex = textureURIPath.string().find_last_of("/"); lastSlashIndex != std::string::npos)
-                {
-                    // Strip extra info, all we want is texture name(everything after last slash).
-                    textureURIPath = uri.uri.string().substr(lastSlashIndex + 1);
-                }
-
-                std::string bcExtension = ".bc";
-                switch (textureSpec.Format)
-                {
-                    case EImageFormat::FORMAT_BC1_RGB_UNORM: bcExtension += "1_rgb_unorm"; break;
-                    case EImageFormat::FORMAT_BC1_RGB_SRGB: bcExtension += "1_rgb_srgb"; break;
-                    case EImageFormat::FORMAT_BC1_RGBA_UNORM: bcExtension += "1_rgba_unorm"; break;
-                    case EImageFormat::FORMAT_BC1_RGBA_SRGB: bcExtension += "1_rgba_srgb"; break;
-                    case EImageFormat::FORMAT_BC2_UNORM: bcExtension += "2_unorm"; break;
-                    case EImageFormat::FORMAT_BC2_SRGB: bcExtension += "2_srgb"; break;
-                    case EImageFormat::FORMAT_BC3_UNORM: bcExtension += "3_unorm"; break;
-                    case EImageFormat::FORMAT_BC3_SRGB: bcExtension += "3_srgb"; break;
-                    case EImageFormat::FORMAT_BC4_UNORM: bcExtension += "4_unorm"; break;
-                    case EImageFormat::FORMAT_BC4_SNORM: bcExtension += "4_snorm"; break;
-                    case EImageFormat::FORMAT_BC5_UNORM: bcExtension += "5_unorm"; break;
-                    case EImageFormat::FORMAT_BC5_SNORM: bcExtension += "5_snorm"; break;
-                    case EImageFormat::FORMAT_BC6H_UFLOAT: bcExtension += "6H_ufloat"; break;
-                    case EImageFormat::FORMAT_BC6H_SFLOAT: bcExtension += "6H_sfloat"; break;
-                    case EImageFormat::FORMAT_BC7_UNORM: bcExtension += "7_unorm"; break;
-                    case EImageFormat::FORMAT_BC7_SRGB: bcExtension += "7_srgb"; break;
-                    default: LOG_WARN("Image format is not a BC!"); break;
-                }
-
-                std::filesystem::path textureCacheFilePath = currentMeshTextureCacheDir / textureURIPath;
-                textureCacheFilePath.replace_extension(bcExtension);
-
-                // Firstly try to load compressed, otherwise compress and save.
-                if (std::filesystem::exists(textureCacheFilePath))
-                {
-                    std::vector<uint8_t> compressedImage;
-                    TextureCompressor::LoadCompressed(textureCacheFilePath, textureSpec, compressedImage);
-                    texture = Texture::Create(textureSpec, compressedImage.data(), compressedImage.size());
-                }
-                else
-                {
-                    int32_t x = 1, y = 1, channels = 4;
-                    const std::string texturePath   = meshAssetsDir + std::string(uri.uri.string());
-                    void* uncompressedData          = ImageUtils::LoadRawImage(texturePath, bFlipOnLoad, &x, &y, &channels);
-                    const auto uncompressedDataSize = static_cast<size_t>(x) * static_cast<size_t>(y) * channels;
-                    textureSpec.Width               = x;
-                    textureSpec.Height              = y;
-
-                    void* rgbToRgbaBuffer = nullptr;
-                    if (channels == 3) rgbToRgbaBuffer = ImageUtils::ConvertRgbToRgba((uint8_t*)uncompressedData, x, y);
-
-                    // Default format set in texture specification in case no BCn specified.
-                    EImageFormat srcImageFormat = EImageFormat::FORMAT_RGBA8_UNORM;
-                    switch (channels)
-                    {
-                        case 1:
-                        {
-                            if (textureSpec.Format == EImageFormat::FORMAT_RGBA8_UNORM) textureSpec.Format = EImageFormat::FORMAT_R8_UNORM;
-                            srcImageFormat = EImageFormat::FORMAT_R8_UNORM;  // Grayscale
-                            break;
-                        }
-                        case 2:
-                        {
-                            if (textureSpec.Format == EImageFormat::FORMAT_RGBA8_UNORM) textureSpec.Format = EImageFormat::FORMAT_RG8_UNORM;
-                            srcImageFormat = EImageFormat::FORMAT_RG8_UNORM;  // Grayscale with alpha
-                            break;
-                        }
-                        case 3:  // 24bpp(RGB) formats are hard to optimize in graphics hardware, so they're mostly
-                        // not supported(also in Vulkan). (but we handle this by converting rgb to rgba)
-                        case 4:
-                        {
-                            if (textureSpec.Format == EImageFormat::FORMAT_RGBA8_UNORM)
-                                textureSpec.Format = EImageFormat::FORMAT_RGBA8_UNORM;
-                            srcImageFormat = EImageFormat::FORMAT_RGBA8_UNORM;  // RGBA
-                            break;
-                        }
-                        default: PFR_ASSERT(false, "Unsupported number of image channels!");
-                    }
-
-                    uint8_t* whatToCompress   = nullptr;
-                    size_t whatToCompressSize = 0;
-
-                    // From: https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html
-                    // The textures for METALNESS and ROUGHNESS properties are packed together in a single texture called
-                    // metallicRoughnessTexture. Its GREEN channel contains ROUGHNESS values and its BLUE channel contains METALNESS values.
-                    // This texture MUST be encoded with linear transfer function and MAY use more than 8 bits per channel.
-                    // Convert to RG format by shifting GB to the left.
-                    if (bMetallicRoughness)
-                    {
-                        const size_t dataSize = static_cast<size_t>(x) * static_cast<size_t>(y);
-                        whatToCompressSize    = rgbToRgbaBuffer ? dataSize * 4 : uncompressedDataSize;
-                        whatToCompress        = static_cast<uint8_t*>(rgbToRgbaBuffer ? rgbToRgbaBuffer : uncompressedData);
-                        for (size_t i{}; i < dataSize; ++i)
-                        {
-                            whatToCompress[i * 4 + 0] = whatToCompress[i * 4 + 1];
-                            whatToCompress[i * 4 + 1] = whatToCompress[i * 4 + 2];
-                        }
-                    }
-                    else
-                    {
-                        whatToCompress     = reinterpret_cast<uint8_t*>(rgbToRgbaBuffer ? rgbToRgbaBuffer : uncompressedData);
-                        whatToCompressSize = rgbToRgbaBuffer ? static_cast<size_t>(x) * static_cast<size_t>(y) * 4 : uncompressedDataSize;
-                    }
-
-                    if (textureSpec.Format == EImageFormat::FORMAT_RGBA8_UNORM)
-                    {
-                        texture = Texture::Create(textureSpec, whatToCompress, whatToCompressSize);
-                    }
-                    else
-                    {
-                        void* compressedData      = nullptr;
-                        size_t compressedDataSize = 0;
-
-                        TextureCompressor::Compress(textureSpec, srcImageFormat, whatToCompress, whatToCompressSize, &compressedData,
-                                                    compressedDataSize);
-
-                        texture = Texture::Create(textureSpec, compressedData, compressedDataSize);
-                        TextureCompressor::SaveCompressed(textureCacheFilePath, textureSpec, compressedData, compressedDataSize);
-                        free(compressedData);
-                    }
-
-                    ImageUtils::UnloadRawImage(uncompressedData);
-                    if (channels == 3) delete[] rgbToRgbaBuffer;
-                }
-            }},
-        fastgltfImage.data);
-
-    loadedTextures[textureName] = texture;
-    return texture;
+    const auto jobIndex                      = static_cast<uint32_t>(textureJobs.Jobs.size());
+    textureJobs.JobIndices[outCacheFilePath] = jobIndex;
+    textureJobs.Jobs.emplace_back(MeshTextureJob{.TexturePath        = meshAssetsDir + std::string(fastgltfURI.uri.string()),
+                                                 .CacheFilePath      = std::filesystem::path(appSpec.WorkingDir) / textureCacheFilePath,
+                                                 .TextureSpec        = textureSpec,
+                                                 .bMetallicRoughness = bMetallicRoughness,
+                                                 .bFlipOnLoad        = bFlipOnLoad});
+    return jobIndex;
+}
+
+// NOTE: Runs on worker threads, reads only headers. Valid cache gets streamed, otherwise(missing or stale cache) job has to decode
+// source image, memory it takes(image, its RGBA copy and mip chain, ~4/3 of mip 0) is what jobs are admitted by.
+static void PrepareTextureJob(MeshTextureJob& job)
+{
+    if (std::filesystem::exists(job.CacheFilePath) && KTX2::LoadSpecification(job.CacheFilePath, job.TextureSpec))
+    {
+        job.bStreamed = true;
+        return;
+    }
+
+    int32_t x = 1, y = 1, channels = 4;
+    PFR_ASSERT(ImageUtils::GetRawImageInfo(job.TexturePath, &x, &y, &channels), "Failed to read image info!");
+    const size_t texelCount       = static_cast<size_t>(x) * static_cast<size_t>(y);
+    const size_t mipChainByteSize = texelCount * (channels == 3 ? 4 : channels) * 4 / 3 + 1;
+    job.DecodedByteSize           = texelCount * channels + (channels == 3 ? texelCount * 4 : 0) + mipChainByteSize;
+}
+
+// NOTE: Runs on worker threads, touches only its own job, so no GPU objects are created here. Compresses and saves the cache.
+static void ProcessTextureJob(MeshTextureJob& job)
+{
+    auto& textureSpec = job.TextureSpec;
+    if (job.bStreamed) return;
+
+    int32_t x = 1, y = 1, channels = 4;
+    void* uncompressedData          = ImageUtils::LoadRawImage(job.TexturePath, job.bFlipOnLoad, &x, &y, &channels);
+    const size_t texelCount         = static_cast<size_t>(x) * static_cast<size_t>(y);
+    const auto uncompressedDataSize = texelCount * channels;
+    textureSpec.Width               = x;
+    textureSpec.Height              = y;
+
+    void* rgbToRgbaBuffer = nullptr;
+    if (channels == 3) rgbToRgbaBuffer = ImageUtils::ConvertRgbToRgba((uint8_t*)uncompressedData, x, y);
+
+    // Default format set in texture specification in case no BCn specified.
+    EImageFormat srcImageFormat = EImageFormat::FORMAT_RGBA8_UNORM;
+    switch (channels)
+    {
+        case 1:
+        {
+            if (textureSpec.Format == EImageFormat::FORMAT_RGBA8_UNORM) textureSpec.Format = EImageFormat::FORMAT_R8_UNORM;
+            srcImageFormat = EImageFormat::FORMAT_R8_UNORM;  // Grayscale
+            break;
+        }
+        case 2:
+        {
+            if (textureSpec.Format == EImageFormat::FORMAT_RGBA8_UNORM) textureSpec.Format = EImageFormat::FORMAT_RG8_UNORM;
+            srcImageFormat = EImageFormat::FORMAT_RG8_UNORM;  // Grayscale with alpha
+            break;
+        }
+        case 3:  // 24bpp(RGB) formats are hard to optimize in graphics hardware, so they're mostly
+        // not supported(also in Vulkan). (but we handle this by converting rgb to rgba)
+        case 4:
+        {
+            if (textureSpec.Format == EImageFormat::FORMAT_RGBA8_UNORM) textureSpec.Format = EImageFormat::FORMAT_RGBA8_UNORM;
+            srcImageFormat = EImageFormat::FORMAT_RGBA8_UNORM;  // RGBA
+            break;
+        }
+        default: PFR_ASSERT(false, "Unsupported number of image channels!");
+    }
+
+    uint8_t* whatToCompress   = reinterpret_cast<uint8_t*>(rgbToRgbaBuffer ? rgbToRgbaBuffer : uncompressedData);
+    size_t whatToCompressSize = rgbToRgbaBuffer ? texelCount * 4 : uncompressedDataSize;
+
+    // From: https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html
+    // The textures for METALNESS and ROUGHNESS properties are packed together in a single texture called
+    // metallicRoughnessTexture. Its GREEN channel contains ROUGHNESS values and its BLUE channel contains METALNESS values.
+    // This texture MUST be encoded with linear transfer function and MAY use more than 8 bits per channel.
+    // Convert to RG format by shifting GB to the left.
+    if (job.bMetallicRoughness)
+    {
+        for (size_t i{}; i < texelCount; ++i)
+        {
+            whatToCompress[i * 4 + 0] = whatToCompress[i * 4 + 1];
+            whatToCompress[i * 4 + 1] = whatToCompress[i * 4 + 2];
+        }
+    }
+
+    // NOTE: Whole mip chain is built on CPU and cached, so cached textures upload every mip as is, no GPU blits.
+    auto mipChain    = ImageUtils::GenerateMipChain(whatToCompress, x, y, static_cast<uint32_t>(whatToCompressSize / texelCount));
+    textureSpec.Mips = ImageUtils::CalculateMipCount(x, y);
+
+    if (!ImageUtils::IsBCFormat(textureSpec.Format))
+    {
+        job.bStreamed = TextureCompressor::SaveCompressed(job.CacheFilePath, textureSpec, mipChain.data(), mipChain.size());
+        if (!job.bStreamed) job.ImageData = std::move(mipChain);
+    }
+    else
+    {
+        void* compressedData      = nullptr;
+        size_t compressedDataSize = 0;
+
+        TextureCompressor::Compress(textureSpec, srcImageFormat, mipChain.data(), mipChain.size(), &compressedData, compressedDataSize);
+        job.bStreamed = TextureCompressor::SaveCompressed(job.CacheFilePath, textureSpec, compressedData, compressedDataSize);
+
+        // NOTE: Saved cache is streamed like any other, data is kept only in case there's nothing to stream from.
+        if (!job.bStreamed)
+            job.ImageData.assign(static_cast<uint8_t*>(compressedData), static_cast<uint8_t*>(compressedData) + compressedDataSize);
+        free(compressedData);
+    }
+
+    ImageUtils::UnloadRawImage(uncompressedData);
+    if (channels == 3) delete[] rgbToRgbaBuffer;
+}
+
+// NOTE: Only reads the asset and writes into its own CookedSubmesh, so primitives are processed in parallel.
+static void ProcessPrimitive(const fastgltf::Asset& asset, const MeshPrimitiveTask& task, CookedSubmesh& cookedSubmesh,
+                             PrimitiveStageTimings& stageTimings)
+{
+    auto stageStart     = Timer::Now();
+    const auto endStage = [&stageStart](std::atomic<uint64_t>& stageNs)
+    {
+        const auto stageEnd = Timer::Now();
+        stageNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(stageEnd - stageStart).count(), std::memory_order_relaxed);
+        stageStart = stageEnd;
+    };
+
+    const auto& p = *task.Primitive;
+
+    // INDICES
+    PFR_ASSERT(p.indicesAccessor.has_value(), "Non-indexed geometry is not supported!");
+    const auto& indicesAccessor = asset.accessors[p.indicesAccessor.value()];
+    std::vector<uint32_t> indices(indicesAccessor.count);
+    fastgltf::iterateAccessorWithIndex<std::uint32_t>(asset, indicesAccessor,
+                                                      [&](uint32_t index, std::size_t idx) { indices[idx] = index; });
+
+    // POSITION
+    const auto positionIt = p.findAttribute("POSITION");
+    PFR_ASSERT(positionIt != p.attributes.end(), "Mesh doesn't contain positions?!");
+
+    const auto& positionAccessor = asset.accessors[positionIt->second];
+    PFR_ASSERT(positionAccessor.type == fastgltf::AccessorType::Vec3, "Positions can only contain vec3!");
+
+    std::vector<MeshAttributeVertex> attributeVertices(positionAccessor.count);
+    std::vector<MeshPositionVertex> rawVertices(positionAccessor.count);
+    fastgltf::iterateAccessorWithIndex<glm::vec3>(asset, positionAccessor,
+                                                  [&](const glm::vec3& position, std::size_t idx)
+                                                  { rawVertices[idx].Position = task.LocalTransform * vec4(position, 1.0); });
+
+    constexpr auto packUnorm3x8 = [](const glm::vec3& value) { return glm::u8vec3(value * 127.f + 127.5f); };
+
+    // NORMAL
+    if (const auto& normalIt = p.findAttribute("NORMAL"); normalIt != p.attributes.end())
+    {
+        fastgltf::iterateAccessorWithIndex<glm::vec3>(asset, asset.accessors[normalIt->second],
+                                                      [&](const glm::vec3& normal, std::size_t idx)
+                                                      {
+                                                          // NOTE: Decode by using (int32_t(x)/127.0 - 1.0)
+                                                          attributeVertices[idx].Normal = packUnorm3x8(normal);
+                                                      });
+    }
+
+    // TANGENT
+    if (const auto& tangentIt = p.findAttribute("TANGENT"); tangentIt != p.attributes.end())
+    {
+        fastgltf::iterateAccessorWithIndex<glm::vec4>(asset, asset.accessors[tangentIt->second],
+                                                      [&](const glm::vec4& tangent, std::size_t idx)
+                                                      { attributeVertices[idx].Tangent = packUnorm3x8(tangent); });
+    }
+
+    // COLOR_0
+    if (const auto& color_0_It = p.findAttribute("COLOR_0"); color_0_It != p.attributes.end())
+    {
+        fastgltf::iterateAccessorWithIndex<glm::vec4>(asset, asset.accessors[color_0_It->second],
+                                                      [&](const glm::vec4& color, std::size_t idx)
+                                                      { attributeVertices[idx].Color = glm::packUnorm4x8(color); });
+    }
+    else
+    {
+        for (auto& attributeVertex : attributeVertices)
+            attributeVertex.Color = 0xFFFFFFFF;
+    }
+
+    // UV
+    if (const auto& uvIT = p.findAttribute("TEXCOORD_0"); uvIT != p.attributes.end())
+    {
+        fastgltf::iterateAccessorWithIndex<glm::vec2>(asset, asset.accessors[uvIT->second],
+                                                      [&](const glm::vec2& uv, std::size_t idx) {
+                                                          attributeVertices[idx].UV =
+                                                              glm::u16vec2(meshopt_quantizeHalf(uv.x), meshopt_quantizeHalf(uv.y));
+                                                      });
+    }
+    endStage(stageTimings.AttributesNs);
+
+    MeshManager::OptimizeMesh(indices, rawVertices, attributeVertices);
+    endStage(stageTimings.OptimizeNs);
+
+    cookedSubmesh.BoundingSphere = MeshManager::GenerateBoundingSphere(rawVertices);
+    endStage(stageTimings.BoundsNs);
+
+    MeshletHierarchy::Build(indices, rawVertices, cookedSubmesh.Meshlets, cookedSubmesh.MeshletVertices, cookedSubmesh.MeshletTriangles);
+    endStage(stageTimings.MeshletsNs);
+
+    MeshManager::QuantizePositions(rawVertices, cookedSubmesh.VertexPositions, cookedSubmesh.PositionCenter, cookedSubmesh.PositionExtent);
+
+    cookedSubmesh.Indices          = std::move(indices);
+    cookedSubmesh.VertexAttributes = std::move(attributeVertices);
 }
 
 }  // namespace FastGLTFUtils
@@ -247,6 +430,30 @@ void MeshManager::LoadMesh(std::vector<Shared<Submesh>>& submeshes, const std::f
     thread_local fastgltf::Parser parser;
 
     Timer t = {};
+
+    const auto cookedMeshPath = MeshCache::GetCookedMeshPath(meshFilePath);
+    const uint64_t cacheKey   = MeshCache::ComputeCacheKey(meshFilePath);
+    std::vector<CookedSubmesh> cookedSubmeshes;
+    if (MeshCache::Load(cookedMeshPath, cacheKey, cookedSubmeshes))
+    {
+        if (LoadCookedSubmeshes(submeshes, cookedSubmeshes))
+        {
+            LogGeometryMemory(meshFilePath, cookedSubmeshes);
+
+            submeshes.shrink_to_fit();
+            LOG_INFO("MeshCache: Time taken to load and create cooked mesh - \"{}\": ({:.5f}) seconds.", meshFilePath.string(),
+                     t.GetElapsedSeconds());
+            return;
+        }
+
+        // NOTE: Cooked mesh references texture cache that's gone or stale, so it's invalid as a whole, full load below re-cooks
+        // both of them.
+        LOG_WARN("MeshCache: Cooked mesh \"{}\" is invalidated, rebuilding it.", cookedMeshPath.string());
+        std::error_code errorCode;
+        std::filesystem::remove(cookedMeshPath, errorCode);
+        cookedSubmeshes.clear();
+    }
+
     fastgltf::GltfDataBuffer data;
     PFR_ASSERT(data.loadFromFile(meshFilePath), "Failed to load  fastgltf::GltfDataBuffer!");
 
@@ -270,11 +477,75 @@ void MeshManager::LoadMesh(std::vector<Shared<Submesh>>& submeshes, const std::f
     std::string currentMeshDir = meshFilePath.parent_path().string() + "/";
     PFR_ASSERT(!currentMeshDir.empty(), "Current mesh directory path invalid!");
 
-    UnorderedMap<std::string, Shared<Texture>> loadedTextures;
+    // NOTE: Materials go first on this thread, textures are only gathered here(deduplicated across materials), bindless
+    // registry is touched later once they're decoded.
+    Timer materialTimer            = {};
+    const size_t firstSubmeshIndex = submeshes.size();
+    std::vector<MeshPrimitiveTask> primitiveTasks;
+    MeshTextureJobs textureJobs = {};
     for (size_t meshIndex{}; meshIndex < asset->meshes.size(); ++meshIndex)
     {
-        LoadSubmeshes(loadedTextures, submeshes, currentMeshDir, asset.get(), meshIndex);
+        LoadSubmeshes(textureJobs, submeshes, cookedSubmeshes, primitiveTasks, currentMeshDir, asset.get(), meshIndex);
+    }
+    const double materialMs = materialTimer.GetElapsedMilliseconds();
+    PFR_ASSERT(primitiveTasks.size() == cookedSubmeshes.size(), "Every cooked submesh should have its primitive task!");
+
+    // Decode + compression(or cache reads) of every unique texture, all jobs are independent.
+    Timer textureTimer = {};
+    ThreadPool::ParallelFor(static_cast<uint32_t>(textureJobs.Jobs.size()), 1,
+                            [&](const uint32_t i) { FastGLTFUtils::PrepareTextureJob(textureJobs.Jobs[i]); });
+
+    // NOTE: Decoding jobs are admitted from this thread in waves that fit into the budget(bigger job goes alone), workers never wait on
+    // it: compression runs nested ParallelFor, and waiting on that one runs other queued texture jobs on the same stack.
+    std::vector<uint32_t> decodeJobIndices;
+    for (uint32_t i{}; i < textureJobs.Jobs.size(); ++i)
+        if (!textureJobs.Jobs[i].bStreamed) decodeJobIndices.emplace_back(i);
+
+    for (size_t waveBegin{}; waveBegin < decodeJobIndices.size();)
+    {
+        size_t waveEnd = waveBegin, waveByteSize = 0;
+        while (waveEnd < decodeJobIndices.size() &&
+               (waveEnd == waveBegin ||
+                waveByteSize + textureJobs.Jobs[decodeJobIndices[waveEnd]].DecodedByteSize <= s_MAX_IN_FLIGHT_DECODED_IMAGE_BYTES))
+            waveByteSize += textureJobs.Jobs[decodeJobIndices[waveEnd++]].DecodedByteSize;
+
+        ThreadPool::ParallelFor(static_cast<uint32_t>(waveEnd - waveBegin), 1,
+                                [&](const uint32_t i)
+                                {
+                                    CPUProfilerScope profilerScope(Renderer::GetRendererData()->CPUProfiler, "ProcessTexture");
+                                    FastGLTFUtils::ProcessTextureJob(textureJobs.Jobs[decodeJobIndices[waveBegin + i]]);
+                                });
+        waveBegin = waveEnd;
     }
+    CreateTextures(textureJobs);
+    const double textureMs = textureTimer.GetElapsedMilliseconds();
+
+    // Geometry of each primitive is independent, so fan it out, every task writes only into its own cooked submesh.
+    Timer processTimer                 = {};
+    PrimitiveStageTimings stageTimings = {};
+    ThreadPool::ParallelFor(static_cast<uint32_t>(primitiveTasks.size()), 1,
+                            [&](const uint32_t i)
+                            {
+                                CPUProfilerScope profilerScope(Renderer::GetRendererData()->CPUProfiler, "ProcessPrimitive");
+                                FastGLTFUtils::ProcessPrimitive(asset.get(), primitiveTasks[i], cookedSubmeshes[i], stageTimings);
+                            });
+    const double processMs = processTimer.GetElapsedMilliseconds();
+
+    // Buffer creation stays on this thread, uploads are batched by staging manager anyway.
+    Timer bufferTimer = {};
+    for (size_t i{}; i < cookedSubmeshes.size(); ++i)
+        CreateSubmeshBuffers(submeshes[firstSubmeshIndex + i], cookedSubmeshes[i]);
+    const double bufferMs = bufferTimer.GetElapsedMilliseconds();
+
+    constexpr auto nsToMs = [](const std::atomic<uint64_t>& ns) { return static_cast<double>(ns.load(std::memory_order_relaxed)) * 1e-6; };
+    LOG_INFO("FASTGLTF: \"{}\" ({}) primitives: materials ({:.3f}) ms, ({}) textures ({:.3f}) ms, geometry ({:.3f}) ms [CPU time: "
+             "attributes ({:.3f}) ms, optimize ({:.3f}) ms, bounds ({:.3f}) ms, meshlets ({:.3f}) ms], buffers ({:.3f}) ms.",
+             meshFilePath.string(), primitiveTasks.size(), materialMs, textureJobs.Jobs.size(), textureMs, processMs,
+             nsToMs(stageTimings.AttributesNs), nsToMs(stageTimings.OptimizeNs), nsToMs(stageTimings.BoundsNs),
+             nsToMs(stageTimings.MeshletsNs), bufferMs);
+
+    LogGeometryMemory(meshFilePath, cookedSubmeshes);
+    MeshCache::Save(cookedMeshPath, cacheKey, cookedSubmeshes);
 
     submeshes.shrink_to_fit();
     LOG_INFO("FASTGLTF: Time taken to load and create mesh - \"{}\": ({:.5f}) seconds.", meshFilePath.string(), t.GetElapsedSeconds());
@@ -351,7 +622,8 @@ SurfaceMesh MeshManager::GenerateUVSphere(const uint32_t sectorCount, const uint
     return mesh;
 }
 
-void MeshManager::LoadSubmeshes(UnorderedMap<std::string, Shared<Texture>>& loadedTextures, std::vector<Shared<Submesh>>& submeshes,
+void MeshManager::LoadSubmeshes(MeshTextureJobs& textureJobs, std::vector<Shared<Submesh>>& submeshes,
+                                std::vector<CookedSubmesh>& cookedSubmeshes, std::vector<MeshPrimitiveTask>& outPrimitiveTasks,
                                 const std::string& meshDir, const fastgltf::Asset& asset, const size_t meshIndex)
 {
     fastgltf::Node fastGLTFnode = {};
@@ -366,13 +638,6 @@ void MeshManager::LoadSubmeshes(UnorderedMap<std::string, Shared<Texture>>& load
 
     for (const auto& p : asset.meshes[meshIndex].primitives)
     {
-        // INDICES
-        PFR_ASSERT(p.indicesAccessor.has_value(), "Non-indexed geometry is not supported!");
-        const auto& indicesAccessor = asset.accessors[p.indicesAccessor.value()];
-        std::vector<uint32_t> indices(indicesAccessor.count);
-        fastgltf::iterateAccessorWithIndex<std::uint32_t>(asset, indicesAccessor,
-                                                          [&](uint32_t index, std::size_t idx) { indices[idx] = index; });
-
         glm::mat4 localTransform = glm::mat4(1.f);
         std::visit(fastgltf::visitor{[&](const fastgltf::Node::TransformMatrix& matrix)
                                      { memcpy(&localTransform, matrix.data(), sizeof(matrix)); },
@@ -390,65 +655,12 @@ void MeshManager::LoadSubmeshes(UnorderedMap<std::string, Shared<Texture>>& load
                                          localTransform = tm * rm * sm;
                                      }},
                    fastGLTFnode.transform);
+        outPrimitiveTasks.emplace_back(&p, localTransform);
 
-        // POSITION
-        const auto positionIt = p.findAttribute("POSITION");
-        PFR_ASSERT(positionIt != p.attributes.end(), "Mesh doesn't contain positions?!");
-
-        const auto& positionAccessor = asset.accessors[positionIt->second];
-        PFR_ASSERT(positionAccessor.type == fastgltf::AccessorType::Vec3, "Positions can only contain vec3!");
-
-        std::vector<MeshAttributeVertex> attributeVertices(positionAccessor.count);
-        std::vector<MeshPositionVertex> rawVertices(positionAccessor.count);
-        fastgltf::iterateAccessorWithIndex<glm::vec3>(asset, positionAccessor,
-                                                      [&](const glm::vec3& position, std::size_t idx)
-                                                      { rawVertices[idx].Position = localTransform * vec4(position, 1.0); });
-
-        constexpr auto packUnorm3x8 = [](const glm::vec3& value) { return glm::u8vec3(value * 127.f + 127.5f); };
-
-        // NORMAL
-        if (const auto& normalIt = p.findAttribute("NORMAL"); normalIt != p.attributes.end())
-        {
-            fastgltf::iterateAccessorWithIndex<glm::vec3>(asset, asset.accessors[normalIt->second],
-                                                          [&](const glm::vec3& normal, std::size_t idx)
-                                                          {
-                                                              // NOTE: Decode by using (int32_t(x)/127.0 - 1.0)
-                                                              attributeVertices[idx].Normal = packUnorm3x8(normal);
-                                                          });
-        }
-
-        // TANGENT
-        if (const auto& tangentIt = p.findAttribute("TANGENT"); tangentIt != p.attributes.end())
-        {
-            fastgltf::iterateAccessorWithIndex<glm::vec4>(asset, asset.accessors[tangentIt->second],
-                                                          [&](const glm::vec4& tangent, std::size_t idx)
-                                                          { attributeVertices[idx].Tangent = packUnorm3x8(tangent); });
-        }
-
-        // COLOR_0
-        if (const auto& color_0_It = p.findAttribute("COLOR_0"); color_0_It != p.attributes.end())
-        {
-            fastgltf::iterateAccessorWithIndex<glm::vec4>(asset, asset.accessors[color_0_It->second],
-                                                          [&](const glm::vec4& color, std::size_t idx)
-                                                          { attributeVertices[idx].Color = glm::packUnorm4x8(color); });
-        }
-        else
-        {
-            for (auto& attributeVertex : attributeVertices)
-                attributeVertex.Color = 0xFFFFFFFF;
-        }
-
-        // UV
-        if (const auto& uvIT = p.findAttribute("TEXCOORD_0"); uvIT != p.attributes.end())
-        {
-            fastgltf::iterateAccessorWithIndex<glm::vec2>(asset, asset.accessors[uvIT->second],
-                                                          [&](const glm::vec2& uv, std::size_t idx) {
-                                                              attributeVertices[idx].UV =
-                                                                  glm::u16vec2(meshopt_quantizeHalf(uv.x), meshopt_quantizeHalf(uv.y));
-                                                          });
-        }
-
-        auto& submesh = submeshes.emplace_back(MakeShared<Submesh>());
+        auto& submesh       = submeshes.emplace_back(MakeShared<Submesh>());
+        auto& cookedSubmesh = cookedSubmeshes.emplace_back();
+        const auto getTextureCachePath = [&](const ECookedTextureSlot slot) -> std::string&
+        { return cookedSubmesh.TextureCachePaths[static_cast<size_t>(slot)]; };
 
         // PBR shading model materials
         Shared<Material> material = nullptr;
@@ -456,208 +668,218 @@ void MeshManager::LoadSubmeshes(UnorderedMap<std::string, Shared<Texture>>& load
         {
             const auto& materialAccessor = asset.materials[p.materialIndex.value()];
 
-            // Assemble gathered textures.
-            PBRData pbrData = {
+            const PBRData pbrData = {
                 .BaseColor = glm::make_vec4(materialAccessor.pbrData.baseColorFactor.data()),
                 .Roughness = materialAccessor.pbrData.roughnessFactor,
                 .Metallic  = materialAccessor.pbrData.metallicFactor,
                 .bIsOpaque = materialAccessor.alphaMode == fastgltf::AlphaMode::Opaque,
             };
 
-            Shared<Texture> albedo = nullptr;
-            if (materialAccessor.pbrData.baseColorTexture.has_value())
+            // NOTE: Bindless indices are only valid for current run, textures get patched in once their jobs finish.
+            cookedSubmesh.MaterialData = pbrData;
+            material                   = MakeShared<Material>(pbrData);
+            submesh->SetMaterial(material);
+
+            const auto addTextureBinding = [&](const size_t textureIndex, const ECookedTextureSlot slot, const EImageFormat imageFormat,
+                                               const bool bMetallicRoughness = false)
             {
-                TextureSpecification albedoTextureSpec = {};
+                const uint32_t jobIndex = FastGLTFUtils::AddTextureJob(textureJobs, meshDir, textureIndex, asset, getTextureCachePath(slot),
+                                                                       imageFormat, bMetallicRoughness);
+                textureJobs.Bindings.emplace_back(material, slot, jobIndex);
+            };
 
-                const size_t textureIndex = materialAccessor.pbrData.baseColorTexture.value().textureIndex;
-                albedo = FastGLTFUtils::LoadTexture(loadedTextures, meshDir, textureIndex, asset, EImageFormat::FORMAT_BC7_UNORM);
-                pbrData.AlbedoTextureIndex = albedo->GetBindlessIndex();
+            if (materialAccessor.pbrData.baseColorTexture.has_value())
+            {
+                addTextureBinding(materialAccessor.pbrData.baseColorTexture.value().textureIndex,
+                                  ECookedTextureSlot::COOKED_TEXTURE_SLOT_ALBEDO, EImageFormat::FORMAT_BC7_UNORM);
             }
 
-            Shared<Texture> normalMap = nullptr;
             if (materialAccessor.normalTexture.has_value())
             {
-                const size_t textureIndex = materialAccessor.normalTexture.value().textureIndex;
-                normalMap = FastGLTFUtils::LoadTexture(loadedTextures, meshDir, textureIndex, asset, EImageFormat::FORMAT_BC5_UNORM);
-                pbrData.NormalTextureIndex = normalMap->GetBindlessIndex();
+                addTextureBinding(materialAccessor.normalTexture.value().textureIndex, ECookedTextureSlot::COOKED_TEXTURE_SLOT_NORMAL,
+                                  EImageFormat::FORMAT_BC5_UNORM);
             }
 
-            Shared<Texture> metallicRoughness = nullptr;
             if (materialAccessor.pbrData.metallicRoughnessTexture.has_value())
             {
-                const size_t textureIndex = materialAccessor.pbrData.metallicRoughnessTexture.value().textureIndex;
-                metallicRoughness =
-                    FastGLTFUtils::LoadTexture(loadedTextures, meshDir, textureIndex, asset, EImageFormat::FORMAT_BC5_UNORM, true);
-                pbrData.MetallicRoughnessTextureIndex = metallicRoughness->GetBindlessIndex();
+                addTextureBinding(materialAccessor.pbrData.metallicRoughnessTexture.value().textureIndex,
+                                  ECookedTextureSlot::COOKED_TEXTURE_SLOT_METALLIC_ROUGHNESS, EImageFormat::FORMAT_BC5_UNORM, true);
             }
 
-            Shared<Texture> emissiveMap = nullptr;
             if (materialAccessor.emissiveTexture.has_value())
             {
-                const size_t textureIndex = materialAccessor.emissiveTexture.value().textureIndex;
-                emissiveMap = FastGLTFUtils::LoadTexture(loadedTextures, meshDir, textureIndex, asset, EImageFormat::FORMAT_BC7_UNORM);
-
-                pbrData.EmissiveTextureIndex = emissiveMap->GetBindlessIndex();
+                addTextureBinding(materialAccessor.emissiveTexture.value().textureIndex, ECookedTextureSlot::COOKED_TEXTURE_SLOT_EMISSIVE,
+                                  EImageFormat::FORMAT_BC7_UNORM);
             }
 
-            Shared<Texture> occlusionMap = nullptr;
             if (materialAccessor.occlusionTexture.has_value())
             {
-                const size_t textureIndex = materialAccessor.occlusionTexture.value().textureIndex;
-                occlusionMap = FastGLTFUtils::LoadTexture(loadedTextures, meshDir, textureIndex, asset, EImageFormat::FORMAT_BC4_UNORM);
-
-                pbrData.OcclusionTextureIndex = occlusionMap->GetBindlessIndex();
+                addTextureBinding(materialAccessor.occlusionTexture.value().textureIndex,
+                                  ECookedTextureSlot::COOKED_TEXTURE_SLOT_OCCLUSION, EImageFormat::FORMAT_BC4_UNORM);
             }
-
-            material = MakeShared<Material>(pbrData);
-            submesh->SetMaterial(material);
-
-            material->SetAlbedo(albedo);
-            material->SetNormalMap(normalMap);
-            material->SetEmissiveMap(emissiveMap);
-            material->SetMetallicRoughnessMap(metallicRoughness);
-            material->SetOcclusionMap(occlusionMap);
         }
 
         // In case mesh didn't have any material we force white material.
         if (!material)
         {
-            const PBRData pbrData = {.BaseColor = glm::vec4(1.f), .Roughness = 1.f, .Metallic = 1.f, .bIsOpaque = true};
-            material              = MakeShared<Material>(pbrData);
+            const PBRData pbrData      = {.BaseColor = glm::vec4(1.f), .Roughness = 1.f, .Metallic = 1.f, .bIsOpaque = true};
+            cookedSubmesh.MaterialData = pbrData;
+            material                   = MakeShared<Material>(pbrData);
             submesh->SetMaterial(material);
         }
-
-        MeshManager::OptimizeMesh(indices, rawVertices, attributeVertices);
-        const BufferSpecification bufferSpec = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
-                                                .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE |
-                                                              EBufferUsage::BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY};
-        submesh->m_IndexBuffer               = Buffer::Create(bufferSpec, indices.data(), indices.size() * sizeof(indices[0]));
-
-        submesh->m_VertexPositionBuffer = Buffer::Create(bufferSpec, rawVertices.data(), rawVertices.size() * sizeof(rawVertices[0]));
-        submesh->m_VertexAttributeBuffer =
-            Buffer::Create(bufferSpec, attributeVertices.data(), attributeVertices.size() * sizeof(attributeVertices[0]));
-        submesh->m_BoundingSphere = MeshManager::GenerateBoundingSphere(rawVertices);
-
-        std::vector<uint32_t> meshletVertices;
-        std::vector<uint8_t> meshletTriangles;
-        std::vector<Meshlet> meshlets;
-        MeshManager::BuildMeshlets(indices, rawVertices, meshlets, meshletVertices, meshletTriangles);
-
-        const BufferSpecification meshletBufferSpec = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
-                                                       .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE};
-        submesh->m_MeshletBuffer = Buffer::Create(meshletBufferSpec, meshlets.data(), meshlets.size() * sizeof(meshlets[0]));
-        submesh->m_MeshletVerticesBuffer =
-            Buffer::Create(meshletBufferSpec, meshletVertices.data(), meshletVertices.size() * sizeof(meshletVertices[0]));
-        submesh->m_MeshletTrianglesBuffer =
-            Buffer::Create(meshletBufferSpec, meshletTriangles.data(), meshletTriangles.size() * sizeof(meshletTriangles[0]));
     }
 }
 
-AABB MeshManager::GenerateAABB(const std::vector<MeshPositionVertex>& points)
+void MeshManager::CreateTextures(MeshTextureJobs& textureJobs)
 {
-#if _MSC_VER
-    if (AVX2Supported())
+    // NOTE: Job shared by several slots gets fallback of the first one bound.
+    const uint32_t defaultFallbackColor = GetStreamedTextureFallback(ECookedTextureSlot::COOKED_TEXTURE_SLOT_ALBEDO);
+    std::vector<uint32_t> fallbackColors(textureJobs.Jobs.size(), defaultFallbackColor);
+    for (auto it = textureJobs.Bindings.rbegin(); it != textureJobs.Bindings.rend(); ++it)
+        fallbackColors[it->JobIndex] = GetStreamedTextureFallback(it->Slot);
+
+    for (uint32_t jobIndex{}; jobIndex < textureJobs.Jobs.size(); ++jobIndex)
     {
-        size_t i       = 0;
-        __m256 minVecX = _mm256_set1_ps(FLT_MAX), minVecY = _mm256_set1_ps(FLT_MAX), minVecZ = _mm256_set1_ps(FLT_MAX);
-        __m256 maxVecX = _mm256_set1_ps(FLT_MIN), maxVecY = _mm256_set1_ps(FLT_MIN), maxVecZ = _mm256_set1_ps(FLT_MIN);
+        auto& job         = textureJobs.Jobs[jobIndex];
+        job.LoadedTexture = job.bStreamed ? TextureStreamer::CreateStreamed(job.CacheFilePath, fallbackColors[jobIndex])
+                                          : Texture::Create(job.TextureSpec, job.ImageData.data(), job.ImageData.size());
+        job.ImageData     = {};
+
+        if (!job.LoadedTexture) LOG_WARN("Texture cache \"{}\" vanished, texture is left unbound!", job.CacheFilePath.string());
+    }
 
-        const size_t alignedDataSize = (points.size() & ~7);
-        for (i = 0; i < alignedDataSize; i += 8)
+    // Bindings of a single material are recorded back to back.
+    for (size_t i{}; i < textureJobs.Bindings.size(); ++i)
+    {
+        const auto& binding  = textureJobs.Bindings[i];
+        const auto& material = binding.TargetMaterial;
+        const auto& texture  = textureJobs.Jobs[binding.JobIndex].LoadedTexture;
+        switch (binding.Slot)
         {
-            const auto* pointPtr = &points[i];
-
-            const __m256 pointX =
-                _mm256_set_ps(pointPtr[7].Position.x, pointPtr[6].Position.x, pointPtr[5].Position.x, pointPtr[4].Position.x,
-                              pointPtr[3].Position.x, pointPtr[2].Position.x, pointPtr[1].Position.x, pointPtr[0].Position.x);
-            const __m256 pointY =
-                _mm256_set_ps(pointPtr[7].Position.y, pointPtr[6].Position.y, pointPtr[5].Position.y, pointPtr[4].Position.y,
-                              pointPtr[3].Position.y, pointPtr[2].Position.y, pointPtr[1].Position.y, pointPtr[0].Position.y);
-            const __m256 pointZ =
-                _mm256_set_ps(pointPtr[7].Position.z, pointPtr[6].Position.z, pointPtr[5].Position.z, pointPtr[4].Position.z,
-                              pointPtr[3].Position.z, pointPtr[2].Position.z, pointPtr[1].Position.z, pointPtr[0].Position.z);
-
-            minVecX = _mm256_min_ps(minVecX, pointX);
-            minVecY = _mm256_min_ps(minVecY, pointY);
-            minVecZ = _mm256_min_ps(minVecZ, pointZ);
-
-            maxVecX = _mm256_max_ps(maxVecX, pointX);
-            maxVecY = _mm256_max_ps(maxVecY, pointY);
-            maxVecZ = _mm256_max_ps(maxVecZ, pointZ);
+            case ECookedTextureSlot::COOKED_TEXTURE_SLOT_ALBEDO: material->SetAlbedo(texture); break;
+            case ECookedTextureSlot::COOKED_TEXTURE_SLOT_NORMAL: material->SetNormalMap(texture); break;
+            case ECookedTextureSlot::COOKED_TEXTURE_SLOT_METALLIC_ROUGHNESS: material->SetMetallicRoughnessMap(texture); break;
+            case ECookedTextureSlot::COOKED_TEXTURE_SLOT_EMISSIVE: material->SetEmissiveMap(texture); break;
+            case ECookedTextureSlot::COOKED_TEXTURE_SLOT_OCCLUSION: material->SetOcclusionMap(texture); break;
+            default: PFR_ASSERT(false, "Unknown cooked texture slot!"); break;
         }
 
-        // Gather results and prepare them.
-        float minX[8] = {0.0f}, minY[8] = {0.0f}, minZ[8] = {0.0f};
-        _mm256_storeu_ps(minX, minVecX);
-        _mm256_storeu_ps(minY, minVecY);
-        _mm256_storeu_ps(minZ, minVecZ);
+        // NOTE: Material buffer was created with zeroed texture indices, upload patched ones.
+        const bool bLastMaterialBinding = i + 1 == textureJobs.Bindings.size() || textureJobs.Bindings[i + 1].TargetMaterial != material;
+        if (bLastMaterialBinding) material->Update();
+    }
+}
 
-        float maxX[8] = {0.0f}, maxY[8] = {0.0f}, maxZ[8] = {0.0f};
-        _mm256_storeu_ps(maxX, maxVecX);
-        _mm256_storeu_ps(maxY, maxVecY);
-        _mm256_storeu_ps(maxZ, maxVecZ);
+bool MeshManager::LoadCookedSubmeshes(std::vector<Shared<Submesh>>& submeshes, const std::vector<CookedSubmesh>& cookedSubmeshes)
+{
+    const auto& workingDir = Application::Get().GetSpecification().WorkingDir;
 
-        glm::vec3 min(minX[0], minY[0], minZ[0]);
-        glm::vec3 max(maxX[0], maxY[0], maxZ[0]);
-        for (i = 1; i < 8; ++i)
+    // Same texture can be referenced by multiple submeshes. Every one of them is resolved before any submesh is created, so mesh
+    // with missing or stale texture cache leaves nothing behind.
+    UnorderedMap<std::string, Shared<Texture>> loadedTextures;
+    for (const auto& cookedSubmesh : cookedSubmeshes)
+    {
+        for (size_t slot{}; slot < cookedSubmesh.TextureCachePaths.size(); ++slot)
         {
-            min = glm::min(min, glm::vec3{minX[i], minY[i], minZ[i]});
-            max = glm::max(max, glm::vec3{maxX[i], maxY[i], maxZ[i]});
-        }
+            const auto& textureCachePath = cookedSubmesh.TextureCachePaths[slot];
+            if (textureCachePath.empty() || loadedTextures.contains(textureCachePath)) continue;
 
-        // Take into account the remainder.
-        for (i = alignedDataSize; i < points.size(); ++i)
-        {
-            min = glm::min(points[i].Position, min);
-            max = glm::max(points[i].Position, max);
-        }
+            auto texture = TextureStreamer::CreateStreamed(std::filesystem::path(workingDir) / textureCachePath,
+                                                           GetStreamedTextureFallback(static_cast<ECookedTextureSlot>(slot)));
+            if (!texture)
+            {
+                LOG_WARN("Texture cache \"{}\" is missing or stale!", textureCachePath);
+                return false;
+            }
 
-        const glm::vec3 center = (max + min) * 0.5f;
-        return {.Center = center, .Extents = max - center};
+            loadedTextures[textureCachePath] = texture;
+        }
     }
-#endif
 
-    glm::vec3 min = glm::vec3(FLT_MAX);
-    glm::vec3 max = glm::vec3(FLT_MIN);
-    for (const auto& point : points)
+    const auto getCookedTexture = [&](const CookedSubmesh& cookedSubmesh, const ECookedTextureSlot slot) -> Shared<Texture>
+    {
+        const auto& textureCachePath = cookedSubmesh.TextureCachePaths[static_cast<size_t>(slot)];
+        return textureCachePath.empty() ? nullptr : loadedTextures.at(textureCachePath);
+    };
+
+    submeshes.reserve(submeshes.size() + cookedSubmeshes.size());
+    for (const auto& cookedSubmesh : cookedSubmeshes)
     {
-        min = glm::min(point.Position, min);
-        max = glm::max(point.Position, max);
+        auto& submesh = submeshes.emplace_back(MakeShared<Submesh>());
+
+        auto material = MakeShared<Material>(cookedSubmesh.MaterialData);
+        material->SetAlbedo(getCookedTexture(cookedSubmesh, ECookedTextureSlot::COOKED_TEXTURE_SLOT_ALBEDO));
+        material->SetNormalMap(getCookedTexture(cookedSubmesh, ECookedTextureSlot::COOKED_TEXTURE_SLOT_NORMAL));
+        material->SetMetallicRoughnessMap(getCookedTexture(cookedSubmesh, ECookedTextureSlot::COOKED_TEXTURE_SLOT_METALLIC_ROUGHNESS));
+        material->SetEmissiveMap(getCookedTexture(cookedSubmesh, ECookedTextureSlot::COOKED_TEXTURE_SLOT_EMISSIVE));
+        material->SetOcclusionMap(getCookedTexture(cookedSubmesh, ECookedTextureSlot::COOKED_TEXTURE_SLOT_OCCLUSION));
+
+        // NOTE: Material buffer was created with zeroed texture indices, upload patched ones.
+        material->Update();
+        submesh->SetMaterial(material);
+
+        CreateSubmeshBuffers(submesh, cookedSubmesh);
     }
 
-    const glm::vec3 center = (max + min) * 0.5f;
-    return {center, max - center};
+    return true;
 }
 
-Sphere MeshManager::GenerateBoundingSphere(const std::vector<MeshPositionVertex>& points)
+void MeshManager::CreateSubmeshBuffers(const Shared<Submesh>& submesh, const CookedSubmesh& cookedSubmesh)
 {
-    PFR_ASSERT(!points.empty(), "Empty vertices, can't generate bounding sphere!");
-
-    // First pass - find averaged vertex pos.
-    glm::vec3 averagedVertexPos(0.0f);
-    for (const auto& point : points)
-        averagedVertexPos += point.Position;
-
-    averagedVertexPos /= points.size();
-    const auto aabb = GenerateAABB(points);
+    const BufferSpecification bufferSpec = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
+                                            .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE |
+                                                          EBufferUsage::BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY};
+    submesh->m_IndexBuffer               = Buffer::Create(bufferSpec, cookedSubmesh.Indices.data(),
+                                                          cookedSubmesh.Indices.size() * sizeof(cookedSubmesh.Indices[0]));
+
+    submesh->m_VertexPositionBuffer  = Buffer::Create(bufferSpec, cookedSubmesh.VertexPositions.data(),
+                                                      cookedSubmesh.VertexPositions.size() * sizeof(cookedSubmesh.VertexPositions[0]));
+    submesh->m_VertexAttributeBuffer = Buffer::Create(bufferSpec, cookedSubmesh.VertexAttributes.data(),
+                                                      cookedSubmesh.VertexAttributes.size() * sizeof(cookedSubmesh.VertexAttributes[0]));
+    submesh->m_BoundingSphere        = cookedSubmesh.BoundingSphere;
+    submesh->m_PositionCenter        = cookedSubmesh.PositionCenter;
+    submesh->m_PositionExtent        = cookedSubmesh.PositionExtent;
+
+    const BufferSpecification meshletBufferSpec = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
+                                                   .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE};
+    submesh->m_MeshletBuffer                    = Buffer::Create(meshletBufferSpec, cookedSubmesh.Meshlets.data(),
+                                                                 cookedSubmesh.Meshlets.size() * sizeof(cookedSubmesh.Meshlets[0]));
+    submesh->m_MeshletVerticesBuffer =
+        Buffer::Create(meshletBufferSpec, cookedSubmesh.MeshletVertices.data(),
+                       cookedSubmesh.MeshletVertices.size() * sizeof(cookedSubmesh.MeshletVertices[0]));
+    submesh->m_MeshletTrianglesBuffer =
+        Buffer::Create(meshletBufferSpec, cookedSubmesh.MeshletTriangles.data(),
+                       cookedSubmesh.MeshletTriangles.size() * sizeof(cookedSubmesh.MeshletTriangles[0]));
+}
 
-    // Second pass - find farthest vertices for both averaged vertex position and AABB centroid.
-    glm::vec3 farthestVtx[2] = {points[0].Position, points[0].Position};
-    for (const auto& point : points)
+void MeshManager::LogGeometryMemory(const std::filesystem::path& meshFilePath, const std::vector<CookedSubmesh>& cookedSubmeshes)
+{
+    uint64_t vertexCount = 0, geometryBytes = 0;
+    for (const auto& cookedSubmesh : cookedSubmeshes)
     {
-        if (glm::distance2(averagedVertexPos, point.Position) > glm::distance2(averagedVertexPos, farthestVtx[0]))
-            farthestVtx[0] = point.Position;
-        if (glm::distance2(aabb.Center, point.Position) > glm::distance2(aabb.Center, farthestVtx[1])) farthestVtx[1] = point.Position;
+        vertexCount += cookedSubmesh.VertexPositions.size();
+        geometryBytes += cookedSubmesh.Indices.size() * sizeof(cookedSubmesh.Indices[0]) +
+                         cookedSubmesh.VertexPositions.size() * sizeof(cookedSubmesh.VertexPositions[0]) +
+                         cookedSubmesh.VertexAttributes.size() * sizeof(cookedSubmesh.VertexAttributes[0]) +
+                         cookedSubmesh.Meshlets.size() * sizeof(cookedSubmesh.Meshlets[0]) +
+                         cookedSubmesh.MeshletVertices.size() * sizeof(cookedSubmesh.MeshletVertices[0]) +
+                         cookedSubmesh.MeshletTriangles.size() * sizeof(cookedSubmesh.MeshletTriangles[0]);
     }
 
-    const float averagedVtxToFarthestDistance  = glm::distance(farthestVtx[0], averagedVertexPos);
-    const float aabbCentroidToFarthestDistance = glm::distance(farthestVtx[1], aabb.Center);
+    const uint64_t savedBytes = vertexCount * (sizeof(MeshPositionVertex) - sizeof(MeshQuantizedPositionVertex));
+    LOG_INFO("\"{}\" geometry VRAM: ({:.3f}) MB, quantized positions saved ({:.3f}) MB.", meshFilePath.string(),
+             geometryBytes / 1024.0 / 1024.0, savedBytes / 1024.0 / 1024.0);
+}
 
-    Sphere sphere = {};
-    sphere.Center = averagedVtxToFarthestDistance < aabbCentroidToFarthestDistance ? averagedVertexPos : aabb.Center;
-    sphere.Radius = glm::min(averagedVtxToFarthestDistance, aabbCentroidToFarthestDistance);
+AABB MeshManager::GenerateAABB(const std::vector<MeshPositionVertex>& points)
+{
+    return MeshBounds::ComputeAABB(points.data(), points.size());
+}
 
-    return sphere;
+Sphere MeshManager::GenerateBoundingSphere(const std::vector<MeshPositionVertex>& points)
+{
+    PFR_ASSERT(!points.empty(), "Empty vertices, can't generate bounding sphere!");
+    return MeshBounds::ComputeSphere(points.data(), points.size());
 }
 
 void MeshManager::OptimizeMesh(std::vector<uint32_t>& indices, std::vector<MeshPositionVertex>& rawVertices,
@@ -742,10 +964,45 @@ void MeshManager::BuildMeshlets(const std::vector<uint32_t>& indices, const std:
         outMeshlet.center = glm::vec3(bounds.center[0], bounds.center[1], bounds.center[2]);
         outMeshlet.radius = bounds.radius;
 
+        // NOTE: Cone test holds for any sphere enclosing the meshlet, so the tighter one of meshopt's and Ritter's is kept.
+        const auto sphere = MeshBounds::ComputeSphere(vertexPositions.data(), &outMeshletVertices[meshopt_m.vertex_offset],
+                                                      meshopt_m.vertex_count);
+        if (sphere.Radius < outMeshlet.radius)
+        {
+            outMeshlet.center = sphere.Center;
+            outMeshlet.radius = sphere.Radius;
+        }
+
         outMeshlet.coneCutoff = bounds.cone_cutoff_s8;
         for (uint32_t k{}; k < 3; ++k)
             outMeshlet.coneAxis[k] = bounds.cone_axis_s8[k];
     }
 }
 
+void MeshManager::QuantizePositions(const std::vector<MeshPositionVertex>& vertexPositions,
+                                    std::vector<MeshQuantizedPositionVertex>& outQuantizedPositions, glm::vec3& outCenter,
+                                    glm::vec3& outExtent)
+{
+    glm::vec3 minPosition(std::numeric_limits<float>::max()), maxPosition(std::numeric_limits<float>::lowest());
+    for (const auto& vertexPosition : vertexPositions)
+    {
+        minPosition = glm::min(minPosition, vertexPosition.Position);
+        maxPosition = glm::max(maxPosition, vertexPosition.Position);
+    }
+
+    // NOTE: Flat axes still need non-zero extent, otherwise dequantization turns into 0/0 on CPU side.
+    outCenter = vertexPositions.empty() ? glm::vec3(0.f) : (minPosition + maxPosition) * 0.5f;
+    outExtent = vertexPositions.empty() ? glm::vec3(1.f) : glm::max((maxPosition - minPosition) * 0.5f, glm::vec3(1e-6f));
+
+    const glm::vec3 invExtent = 1.f / outExtent;
+    outQuantizedPositions.resize(vertexPositions.size());
+    for (size_t i{}; i < vertexPositions.size(); ++i)
+    {
+        const glm::vec3 normalized = glm::clamp((vertexPositions[i].Position - outCenter) * invExtent, glm::vec3(-1.f), glm::vec3(1.f));
+        outQuantizedPositions[i].Position =
+            glm::i16vec4(meshopt_quantizeSnorm(normalized.x, 16), meshopt_quantizeSnorm(normalized.y, 16),
+                         meshopt_quantizeSnorm(normalized.z, 16), 0);
+    }
+}
+
 }  // namespace Pathfinder
\ No newline at end of file
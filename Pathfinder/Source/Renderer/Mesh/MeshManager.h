@@ -14,6 +14,10 @@ namespace Pathfinder
 {
 
 class Submesh;
+struct CookedSubmesh;
+struct MeshPrimitiveTask;
+struct MeshTextureJobs;
+
 class MeshManager final
 {
   public:
@@ -27,14 +31,29 @@ class MeshManager final
                               std::vector<Meshlet>& outMeshlets, std::vector<uint32_t>& outMeshletVertices,
                               std::vector<uint8_t>& outMeshletTriangles);
 
+    // 16-bit SNORM positions within their own bounds, shaders and BLAS builds dequantize them with center and extent.
+    static void QuantizePositions(const std::vector<MeshPositionVertex>& vertexPositions,
+                                  std::vector<MeshQuantizedPositionVertex>& outQuantizedPositions, glm::vec3& outCenter,
+                                  glm::vec3& outExtent);
+
     static void LoadMesh(std::vector<Shared<Submesh>>& submeshes, const std::filesystem::path& meshFilePath);
 
     static SurfaceMesh GenerateUVSphere(const uint32_t sectorCount, const uint32_t stackCount);
 
   private:
-    static void LoadSubmeshes(UnorderedMap<std::string, Shared<Texture>>& loadedTextures, std::vector<Shared<Submesh>>& submeshes,
+    static void LoadSubmeshes(MeshTextureJobs& textureJobs, std::vector<Shared<Submesh>>& submeshes,
+                              std::vector<CookedSubmesh>& cookedSubmeshes, std::vector<MeshPrimitiveTask>& outPrimitiveTasks,
                               const std::string& meshDir, const fastgltf::Asset& asset, const size_t meshIndex);
 
+    // Creates textures out of finished jobs and patches their bindless indices into waiting materials.
+    static void CreateTextures(MeshTextureJobs& textureJobs);
+
+    // Creates submeshes straight from cooked data, no parsing or optimization involved. False if any texture cache it references is
+    // missing or stale, submeshes are left untouched then.
+    NODISCARD static bool LoadCookedSubmeshes(std::vector<Shared<Submesh>>& submeshes, const std::vector<CookedSubmesh>& cookedSubmeshes);
+    static void CreateSubmeshBuffers(const Shared<Submesh>& submesh, const CookedSubmesh& cookedSubmesh);
+    static void LogGeometryMemory(const std::filesystem::path& meshFilePath, const std::vector<CookedSubmesh>& cookedSubmeshes);
+
     MeshManager()  = delete;
     ~MeshManager() = default;
 };
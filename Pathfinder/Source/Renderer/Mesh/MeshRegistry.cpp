@@ -0,0 +1,194 @@
+#include <PathfinderPCH.h>
+#include "MeshRegistry.h"
+
+#include "Mesh.h"
+#include "Submesh.h"
+#include "MeshCache.h"
+
+#include <Core/Application.h>
+#include <Renderer/Renderer.h>
+#include <Renderer/Buffer.h>
+#include <Renderer/Material.h>
+#include <Renderer/Texture.h>
+
+namespace Pathfinder
+{
+
+void MeshRegistry::Init()
+{
+    s_RegistryData = MakeUnique<RegistryData>();
+    LOG_TRACE("{}", __FUNCTION__);
+}
+
+void MeshRegistry::Shutdown()
+{
+    // NOTE: Device is idle by now, so retired meshes go right away. Meshes still held past this point are destroyed on release.
+    s_RegistryData.reset();
+    LOG_TRACE("{}", __FUNCTION__);
+}
+
+Shared<Mesh> MeshRegistry::Acquire(const std::filesystem::path& meshFilePath)
+{
+    PFR_ASSERT(s_RegistryData, "MeshRegistry is not initialized!");
+
+    std::error_code errorCode;
+    auto canonicalPath = std::filesystem::weakly_canonical(meshFilePath, errorCode);
+    if (errorCode) canonicalPath = meshFilePath.lexically_normal();
+    const auto canonicalPathString = canonicalPath.generic_string();
+    const auto writeTime           = std::filesystem::last_write_time(canonicalPath, errorCode);
+
+    Shared<Entry> entry = nullptr;
+    {
+        std::scoped_lock lock(s_RegistryData->Mutex);
+        if (const auto recordIt = s_RegistryData->PathRecords.find(canonicalPathString);
+            recordIt != s_RegistryData->PathRecords.end() && recordIt->second.WriteTime == writeTime)
+        {
+            if (const auto entryIt = s_RegistryData->Entries.find(recordIt->second.EntryKey);
+                entryIt != s_RegistryData->Entries.end() && !entryIt->second->MeshRef.expired())
+                entry = entryIt->second;
+        }
+    }
+
+    // NOTE: Hashing reads whole asset, so it's done outside of the lock and only if path has no resident mesh yet.
+    // Relative image URIs resolve against mesh directory, so copies dedup only within the same one.
+    if (!entry)
+    {
+        const uint64_t contentHash = MeshCache::ComputeCacheKey(canonicalPath);
+        const auto entryKey        = canonicalPath.parent_path().generic_string() + ':' + std::to_string(contentHash);
+
+        std::scoped_lock lock(s_RegistryData->Mutex);
+        s_RegistryData->PathRecords[canonicalPathString] = {.WriteTime = writeTime, .EntryKey = entryKey};
+
+        auto& registeredEntry = s_RegistryData->Entries[entryKey];
+        if (!registeredEntry)
+        {
+            registeredEntry               = MakeShared<Entry>();
+            registeredEntry->MeshFilePath = canonicalPath;
+        }
+        entry = registeredEntry;
+    }
+
+    Shared<Mesh> mesh = nullptr;
+    {
+        std::scoped_lock loadLock(entry->LoadMutex);
+        {
+            std::scoped_lock lock(s_RegistryData->Mutex);
+            mesh = entry->MeshRef.lock();
+        }
+
+        if (mesh)
+            ++s_RegistryData->DedupHitCount;
+        else
+        {
+            mesh                    = Shared<Mesh>(new Mesh(entry->MeshFilePath), &MeshRegistry::Retire);
+            const uint64_t meshSize = ComputeMemorySize(*mesh);
+            ++s_RegistryData->LoadCount;
+
+            std::scoped_lock lock(s_RegistryData->Mutex);
+            entry->MeshRef    = mesh;
+            entry->MemorySize = meshSize;
+        }
+    }
+
+    const uint32_t handleCount = ++entry->HandleCount;
+    if (handleCount > 1) LOG_TRACE("MeshRegistry: \"{}\" is shared by ({}) handles.", canonicalPathString, handleCount);
+
+    // NOTE: Handle owns the mesh through its deleter, so handles are counted apart from copies of the same handle.
+    return Shared<Mesh>(mesh.get(),
+                        [mesh, entry](Mesh*) mutable
+                        {
+                            --entry->HandleCount;
+                            mesh.reset();
+                        });
+}
+
+void MeshRegistry::Update()
+{
+    PFR_ASSERT(s_RegistryData, "MeshRegistry is not initialized!");
+
+    const uint64_t frameNumber = Application::Get().GetCurrentFrameNumber();
+    std::vector<Unique<Mesh>> destroyedMeshes;
+    MeshRegistryStats stats = {.LoadCount = s_RegistryData->LoadCount, .DedupHitCount = s_RegistryData->DedupHitCount};
+    {
+        std::scoped_lock lock(s_RegistryData->Mutex);
+        auto& retiredMeshes = s_RegistryData->RetiredMeshes;
+        while (!retiredMeshes.empty() && frameNumber - retiredMeshes.front().first > s_FRAMES_IN_FLIGHT)
+        {
+            destroyedMeshes.emplace_back(std::move(retiredMeshes.front().second));
+            retiredMeshes.pop_front();
+        }
+
+        // NOTE: Entry held by anything but the map is either being loaded or has live handles.
+        auto& entries = s_RegistryData->Entries;
+        for (auto it = entries.begin(); it != entries.end();)
+        {
+            if (it->second.use_count() == 1 && it->second->MeshRef.expired())
+            {
+                it = entries.erase(it);
+                continue;
+            }
+
+            const auto& entry = *it->second;
+            if (!entry.MeshRef.expired())
+            {
+                const uint32_t handleCount = entry.HandleCount;
+                ++stats.MeshCount;
+                stats.HandleCount += handleCount;
+                stats.ResidentMemory += entry.MemorySize;
+                stats.SavedMemory += handleCount > 1 ? (handleCount - 1) * entry.MemorySize : 0;
+            }
+            ++it;
+        }
+
+        auto& pathRecords = s_RegistryData->PathRecords;
+        for (auto it = pathRecords.begin(); it != pathRecords.end();)
+            it = entries.contains(it->second.EntryKey) ? std::next(it) : pathRecords.erase(it);
+    }
+
+    // Buffers and bindless texture slots are freed here, outside of the lock.
+    destroyedMeshes.clear();
+    Renderer::GetStats().MeshStats = stats;
+}
+
+void MeshRegistry::Retire(Mesh* mesh)
+{
+    if (!s_RegistryData)
+    {
+        delete mesh;
+        return;
+    }
+
+    std::scoped_lock lock(s_RegistryData->Mutex);
+    s_RegistryData->RetiredMeshes.emplace_back(Application::Get().GetCurrentFrameNumber(), Unique<Mesh>(mesh));
+}
+
+uint64_t MeshRegistry::ComputeMemorySize(const Mesh& mesh)
+{
+    uint64_t memorySize = 0;
+    UnorderedSet<const Texture*> textures;
+    for (const auto& submesh : mesh.GetSubmeshes())
+    {
+        for (const auto* buffer : {&submesh->GetIndexBuffer(), &submesh->GetVertexPositionBuffer(), &submesh->GetVertexAttributeBuffer(),
+                                   &submesh->GetMeshletBuffer(), &submesh->GetMeshletVerticesBuffer(),
+                                   &submesh->GetMeshletTrianglesBuffer()})
+        {
+            if (*buffer) memorySize += (*buffer)->GetSpecification().Capacity;
+        }
+
+        const auto& material = submesh->GetMaterial();
+        if (!material) continue;
+
+        // NOTE: White texture is a shared default, not owned by any mesh. Streamed textures count only with what they're created with,
+        // the rest of their mips is TextureStreamer's budget.
+        for (const auto* texture : {&material->GetAlbedo(), &material->GetNormalMap(), &material->GetMetallicRoughness(),
+                                    &material->GetEmissiveMap(), &material->GetAOMap()})
+        {
+            if (!*texture || *texture == TextureManager::GetWhiteTexture() || !textures.insert(texture->get()).second) continue;
+            memorySize += Texture::GetMemoryRequirements((*texture)->GetSpecification()).Size;
+        }
+    }
+
+    return memorySize;
+}
+
+}  // namespace Pathfinder
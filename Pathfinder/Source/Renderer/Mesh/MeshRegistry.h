@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Core/Core.h>
+#include <filesystem>
+
+namespace Pathfinder
+{
+
+class Mesh;
+
+struct MeshRegistryStats
+{
+    uint32_t MeshCount;       // Resident unique meshes.
+    uint32_t HandleCount;     // Live handles given out by Acquire().
+    uint64_t LoadCount;       // Since start, requests that went through MeshManager::LoadMesh().
+    uint64_t DedupHitCount;   // Since start, requests served by already resident mesh.
+    uint64_t ResidentMemory;  // Bytes of geometry buffers and textures of resident meshes.
+    uint64_t SavedMemory;     // Bytes live handles would've loaded again if every one of them had its own copy.
+};
+
+/*
+ * Hands out shared mesh handles, so asset referenced by many entities gets parsed and uploaded once.
+ * Meshes are keyed by canonical directory and content hash(MeshCache::ComputeCacheKey()), so copies of the same file under different
+ * names dedup too, while same file next to different images(relative URIs) doesn't.
+ * Canonical path remembers key it had, so requests for resident mesh don't rehash the file unless it was modified.
+ * Every Acquire() returns its own handle, once the last one is released mesh is retired and destroyed(GPU buffers, bindless texture
+ * slots) s_FRAMES_IN_FLIGHT frames later, when no frame in flight can reference it. Thread safe, mesh is loaded on calling thread,
+ * concurrent requests of the same mesh wait for it instead of loading their own copies.
+ */
+class MeshRegistry final
+{
+  public:
+    static void Init();
+    static void Shutdown();
+
+    NODISCARD static Shared<Mesh> Acquire(const std::filesystem::path& meshFilePath);
+
+    // Main thread, once per frame: destroys retired meshes GPU is done with, forgets released ones, publishes stats.
+    static void Update();
+
+  private:
+    // NOTE: MeshRef and MemorySize are guarded by RegistryData::Mutex, LoadMutex only serializes loading.
+    struct Entry
+    {
+        std::mutex LoadMutex;
+        Weak<Mesh> MeshRef;
+        std::filesystem::path MeshFilePath = {};  // Path it was first requested with.
+        uint64_t MemorySize                = 0;
+        std::atomic<uint32_t> HandleCount  = 0;
+    };
+
+    struct PathRecord
+    {
+        std::filesystem::file_time_type WriteTime = {};
+        std::string EntryKey                      = {};
+    };
+
+    struct RegistryData
+    {
+        std::mutex Mutex;
+        UnorderedMap<std::string, Shared<Entry>> Entries;             // Canonical directory and content hash -> entry.
+        UnorderedMap<std::string, PathRecord> PathRecords;            // Canonical path -> key it had when it was last acquired.
+        std::deque<std::pair<uint64_t, Unique<Mesh>>> RetiredMeshes;  // Frame number it was retired on, mesh.
+        std::atomic<uint64_t> LoadCount     = 0;
+        std::atomic<uint64_t> DedupHitCount = 0;
+    };
+
+    static inline Unique<RegistryData> s_RegistryData = nullptr;
+
+    MeshRegistry()  = delete;
+    ~MeshRegistry() = default;
+
+    // Deleter of resident mesh, called on whatever thread released its last handle.
+    static void Retire(Mesh* mesh);
+    NODISCARD static uint64_t ComputeMemorySize(const Mesh& mesh);
+};
+
+}  // namespace Pathfinder
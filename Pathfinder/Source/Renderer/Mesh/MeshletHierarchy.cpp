@@ -0,0 +1,274 @@
+#include <PathfinderPCH.h>
+#include "MeshletHierarchy.h"
+
+#include "MeshManager.h"
+#include "Globals.h"
+#include "MeshletLOD.h"
+
+#include <meshoptimizer.h>
+
+namespace Pathfinder
+{
+
+namespace MeshletHierarchyUtils
+{
+
+void AppendMeshletIndices(const Meshlet& meshlet, const std::vector<uint32_t>& meshletVertices,
+                          const std::vector<uint8_t>& meshletTriangles, std::vector<uint32_t>& outIndices)
+{
+    for (uint32_t i{}; i < meshlet.triangleCount * 3; ++i)
+        outIndices.emplace_back(meshletVertices[meshlet.vertexOffset + meshletTriangles[meshlet.triangleOffset + i]]);
+}
+
+// Grows sphere so it encloses the other one.
+void MergeSphere(glm::vec3& center, float& radius, const glm::vec3& otherCenter, const float otherRadius)
+{
+    const glm::vec3 offset = otherCenter - center;
+    const float distance   = glm::length(offset);
+    if (distance + otherRadius <= radius) return;
+
+    if (distance + radius <= otherRadius)
+    {
+        center = otherCenter;
+        radius = otherRadius;
+        return;
+    }
+
+    const float mergedRadius = (distance + radius + otherRadius) * 0.5f;
+    center += offset * ((mergedRadius - radius) / distance);
+    radius = mergedRadius;
+}
+
+// Greedily grows groups out of meshlets sharing the most vertices. Vertices are compared by position(positionRemap), so UV seams
+// don't split neighbours apart. Returns indices into meshlets.
+std::vector<std::vector<uint32_t>> GroupMeshlets(const std::vector<uint32_t>& levelMeshlets, const std::vector<Meshlet>& meshlets,
+                                                 const std::vector<uint32_t>& meshletVertices, const std::vector<uint32_t>& positionRemap,
+                                                 const uint32_t maxGroupSize)
+{
+    // Position -> level meshlets referencing it.
+    UnorderedMap<uint32_t, std::vector<uint32_t>> positionMeshlets;
+    for (uint32_t i{}; i < levelMeshlets.size(); ++i)
+    {
+        const auto& meshlet = meshlets[levelMeshlets[i]];
+        for (uint32_t v{}; v < meshlet.vertexCount; ++v)
+        {
+            auto& positionUsers = positionMeshlets[positionRemap[meshletVertices[meshlet.vertexOffset + v]]];
+            if (positionUsers.empty() || positionUsers.back() != i) positionUsers.emplace_back(i);
+        }
+    }
+
+    // Level meshlet -> neighbour, shared position count.
+    std::vector<UnorderedMap<uint32_t, uint32_t>> adjacency(levelMeshlets.size());
+    for (const auto& [position, positionUsers] : positionMeshlets)
+    {
+        for (const auto first : positionUsers)
+            for (const auto second : positionUsers)
+                if (first != second) ++adjacency[first][second];
+    }
+
+    std::vector<std::vector<uint32_t>> groups;
+    std::vector<bool> bGrouped(levelMeshlets.size(), false);
+    for (uint32_t seed{}; seed < levelMeshlets.size(); ++seed)
+    {
+        if (bGrouped[seed]) continue;
+
+        std::vector<uint32_t> group = {seed};
+        bGrouped[seed]              = true;
+
+        // Ungrouped neighbour -> positions it shares with the group.
+        UnorderedMap<uint32_t, uint32_t> candidates;
+        for (uint32_t member = seed; group.size() < maxGroupSize;)
+        {
+            for (const auto& [neighbour, sharedCount] : adjacency[member])
+                if (!bGrouped[neighbour]) candidates[neighbour] += sharedCount;
+
+            // NOTE: Ties go to the lower index, so hierarchy doesn't depend on hash map iteration order.
+            uint32_t bestCandidate = UINT32_MAX, bestSharedCount = 0;
+            for (const auto& [candidate, sharedCount] : candidates)
+            {
+                if (bGrouped[candidate]) continue;
+
+                if (sharedCount > bestSharedCount || (sharedCount == bestSharedCount && candidate < bestCandidate))
+                {
+                    bestCandidate   = candidate;
+                    bestSharedCount = sharedCount;
+                }
+            }
+            if (bestCandidate == UINT32_MAX) break;
+
+            group.emplace_back(bestCandidate);
+            bGrouped[bestCandidate] = true;
+            member                  = bestCandidate;
+        }
+
+        for (auto& member : group)
+            member = levelMeshlets[member];
+        groups.emplace_back(std::move(group));
+    }
+
+    return groups;
+}
+
+}  // namespace MeshletHierarchyUtils
+
+void MeshletHierarchy::Build(const std::vector<uint32_t>& indices, const std::vector<MeshPositionVertex>& vertexPositions,
+                             std::vector<Meshlet>& outMeshlets, std::vector<uint32_t>& outMeshletVertices,
+                             std::vector<uint8_t>& outMeshletTriangles)
+{
+    MeshManager::BuildMeshlets(indices, vertexPositions, outMeshlets, outMeshletVertices, outMeshletTriangles);
+
+    // Level 0 is exact, roots never get replaced by anything coarser.
+    std::vector<uint32_t> levelMeshlets(outMeshlets.size());
+    for (uint32_t i{}; i < outMeshlets.size(); ++i)
+    {
+        auto& meshlet        = outMeshlets[i];
+        meshlet.lodCenter    = meshlet.center;
+        meshlet.lodRadius    = meshlet.radius;
+        meshlet.lodError     = 0.f;
+        meshlet.parentCenter = meshlet.center;
+        meshlet.parentRadius = meshlet.radius;
+        meshlet.parentError  = std::numeric_limits<float>::max();
+
+        levelMeshlets[i] = i;
+    }
+
+    std::vector<uint32_t> positionRemap(vertexPositions.size());
+    meshopt_generateVertexRemap(positionRemap.data(), nullptr, vertexPositions.size(), vertexPositions.data(), vertexPositions.size(),
+                                sizeof(MeshPositionVertex));
+
+    // NOTE: Groups are simplified and clustered in their own compact vertex space, otherwise every meshopt call would touch
+    // the whole vertex buffer. Scratch maps global vertex to group local one, UINT32_MAX if it isn't referenced.
+    std::vector<uint32_t> globalToLocal(vertexPositions.size(), UINT32_MAX);
+    std::vector<uint32_t> localToGlobal;
+    std::vector<MeshPositionVertex> groupPositions;
+    std::vector<uint32_t> groupIndices, simplifiedIndices;
+    std::vector<Meshlet> groupMeshlets;
+    std::vector<uint32_t> groupMeshletVertices;
+    std::vector<uint8_t> groupMeshletTriangles;
+
+    for (uint32_t level = 1; level < s_MAX_LOD_LEVELS && levelMeshlets.size() > 1; ++level)
+    {
+        std::vector<uint32_t> nextLevelMeshlets;
+        for (const auto& group : MeshletHierarchyUtils::GroupMeshlets(levelMeshlets, outMeshlets, outMeshletVertices, positionRemap,
+                                                                      s_MESHLET_GROUP_SIZE))
+        {
+            groupIndices.clear();
+            for (const auto meshletIndex : group)
+                MeshletHierarchyUtils::AppendMeshletIndices(outMeshlets[meshletIndex], outMeshletVertices, outMeshletTriangles,
+                                                            groupIndices);
+
+            localToGlobal.clear();
+            groupPositions.clear();
+            for (auto& index : groupIndices)
+            {
+                if (globalToLocal[index] == UINT32_MAX)
+                {
+                    globalToLocal[index] = static_cast<uint32_t>(localToGlobal.size());
+                    localToGlobal.emplace_back(index);
+                    groupPositions.emplace_back(vertexPositions[index]);
+                }
+                index = globalToLocal[index];
+            }
+            for (const auto globalIndex : localToGlobal)
+                globalToLocal[globalIndex] = UINT32_MAX;
+
+            // NOTE: Locked border keeps group edges identical to what neighbouring groups see, that's what keeps LODs crack-free.
+            float simplifyError = 0.f;
+            simplifiedIndices.resize(groupIndices.size());
+            simplifiedIndices.resize(meshopt_simplify(simplifiedIndices.data(), groupIndices.data(), groupIndices.size(),
+                                                      &groupPositions[0].Position.x, groupPositions.size(), sizeof(MeshPositionVertex),
+                                                      groupIndices.size() / 6 * 3, std::numeric_limits<float>::max(),
+                                                      meshopt_SimplifyLockBorder, &simplifyError));
+            if (simplifiedIndices.empty() ||
+                static_cast<float>(simplifiedIndices.size()) > static_cast<float>(groupIndices.size()) * s_MIN_TRIANGLE_REDUCTION)
+                continue;
+
+            // Group bounds enclose children's and error accumulates, so projected error never decreases going up the hierarchy.
+            glm::vec3 groupCenter = outMeshlets[group[0]].lodCenter;
+            float groupRadius     = outMeshlets[group[0]].lodRadius;
+            float groupError      = 0.f;
+            for (const auto meshletIndex : group)
+            {
+                const auto& meshlet = outMeshlets[meshletIndex];
+                MeshletHierarchyUtils::MergeSphere(groupCenter, groupRadius, meshlet.lodCenter, meshlet.lodRadius);
+                groupError = std::max(groupError, meshlet.lodError);
+            }
+            groupError += simplifyError * meshopt_simplifyScale(&groupPositions[0].Position.x, groupPositions.size(),
+                                                                sizeof(MeshPositionVertex));
+
+            for (const auto meshletIndex : group)
+            {
+                auto& meshlet        = outMeshlets[meshletIndex];
+                meshlet.parentCenter = groupCenter;
+                meshlet.parentRadius = groupRadius;
+                meshlet.parentError  = groupError;
+            }
+
+            MeshManager::BuildMeshlets(simplifiedIndices, groupPositions, groupMeshlets, groupMeshletVertices, groupMeshletTriangles);
+
+            const auto vertexOffset   = static_cast<uint32_t>(outMeshletVertices.size());
+            const auto triangleOffset = static_cast<uint32_t>(outMeshletTriangles.size());  // Stays 4-byte aligned, see BuildMeshlets().
+            for (const auto localIndex : groupMeshletVertices)
+                outMeshletVertices.emplace_back(localToGlobal[localIndex]);
+            outMeshletTriangles.insert(outMeshletTriangles.end(), groupMeshletTriangles.begin(), groupMeshletTriangles.end());
+
+            for (auto meshlet : groupMeshlets)
+            {
+                meshlet.vertexOffset += vertexOffset;
+                meshlet.triangleOffset += triangleOffset;
+                meshlet.lodCenter    = groupCenter;
+                meshlet.lodRadius    = groupRadius;
+                meshlet.lodError     = groupError;
+                meshlet.parentCenter = groupCenter;
+                meshlet.parentRadius = groupRadius;
+                meshlet.parentError  = std::numeric_limits<float>::max();
+
+                nextLevelMeshlets.emplace_back(static_cast<uint32_t>(outMeshlets.size()));
+                outMeshlets.emplace_back(meshlet);
+            }
+        }
+
+        if (nextLevelMeshlets.empty()) break;
+        levelMeshlets = std::move(nextLevelMeshlets);
+    }
+
+    outMeshlets.shrink_to_fit();
+    outMeshletVertices.shrink_to_fit();
+    outMeshletTriangles.shrink_to_fit();
+}
+
+MeshletHierarchy::View MeshletHierarchy::MakeView(const glm::vec3& cameraPosition, const glm::mat4& projection, const float zNear,
+                                                  const float viewportHeight)
+{
+    return {.CameraPosition = cameraPosition, .zNear = zNear, .ProjectionScale = GetMeshletLODProjectionScale(projection, viewportHeight)};
+}
+
+uint32_t MeshletHierarchy::Select(const std::vector<Meshlet>& meshlets, const View& view, const glm::vec3& translation,
+                                  const glm::vec3& scale, const glm::vec4& orientation, std::vector<uint32_t>* outSelectedMeshlets)
+{
+    const glm::quat rotation(orientation.w, orientation.x, orientation.y, orientation.z);
+    const float maxScale = std::max({scale.x, scale.y, scale.z});
+
+    uint32_t triangleCount = 0;
+    for (uint32_t i{}; i < meshlets.size(); ++i)
+    {
+        const auto& meshlet = meshlets[i];
+        if (!IsMeshletLODSelected(translation + rotation * (meshlet.lodCenter * scale), meshlet.lodRadius * maxScale,
+                                  meshlet.lodError * maxScale, translation + rotation * (meshlet.parentCenter * scale),
+                                  meshlet.parentRadius * maxScale, meshlet.parentError * maxScale, view.CameraPosition, view.zNear,
+                                  view.ProjectionScale))
+            continue;
+
+        triangleCount += meshlet.triangleCount;
+        if (outSelectedMeshlets) outSelectedMeshlets->emplace_back(i);
+    }
+
+    return triangleCount;
+}
+
+float MeshletHierarchy::GetErrorThreshold()
+{
+    return MESHLET_LOD_ERROR_THRESHOLD;
+}
+
+}  // namespace Pathfinder
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Core/Core.h>
+#include "Renderer/RendererCoreDefines.h"
+
+namespace Pathfinder
+{
+
+/*
+ * Continuous meshlet LOD, built offline into the single meshlet array submesh already has, so task shaders pick LOD per meshlet.
+ * Level 0 is the original mesh. Meshlets of the last level get grouped by shared vertices, every group is merged, simplified to half
+ * with its border locked and split into meshlets again - those form the next level. Meshlet stores bounds and error of the group
+ * it was built from and of the group it got simplified into, selection itself lives in MeshletLOD.h shared with task shaders,
+ * Select() is its CPU reference.
+ */
+class MeshletHierarchy final
+{
+  public:
+    struct View
+    {
+        glm::vec3 CameraPosition = glm::vec3(0.f);
+        float zNear              = 0.1f;
+        float ProjectionScale    = 1.f;  // |Projection[1][1]| * viewport height / 2.
+    };
+
+    static void Build(const std::vector<uint32_t>& indices, const std::vector<MeshPositionVertex>& vertexPositions,
+                      std::vector<Meshlet>& outMeshlets, std::vector<uint32_t>& outMeshletVertices,
+                      std::vector<uint8_t>& outMeshletTriangles);
+
+    NODISCARD static View MakeView(const glm::vec3& cameraPosition, const glm::mat4& projection, const float zNear,
+                                   const float viewportHeight);
+
+    // Same cut task shaders draw(culling aside), returns its triangle count. Transform is the one MeshData holds.
+    NODISCARD static uint32_t Select(const std::vector<Meshlet>& meshlets, const View& view, const glm::vec3& translation = glm::vec3(0.f),
+                                     const glm::vec3& scale = glm::vec3(1.f), const glm::vec4& orientation = glm::vec4(0.f, 0.f, 0.f, 1.f),
+                                     std::vector<uint32_t>* outSelectedMeshlets = nullptr);
+
+    // Pixels projected error of selected meshlets stays within(MESHLET_LOD_ERROR_THRESHOLD).
+    NODISCARD static float GetErrorThreshold();
+
+  private:
+    static constexpr uint32_t s_MAX_LOD_LEVELS       = 16;
+    static constexpr uint32_t s_MESHLET_GROUP_SIZE   = 4;
+    static constexpr float s_MIN_TRIANGLE_REDUCTION = 0.85f;  // Groups simplified worse than that stay roots.
+
+    MeshletHierarchy()  = delete;
+    ~MeshletHierarchy() = default;
+};
+
+}  // namespace Pathfinder
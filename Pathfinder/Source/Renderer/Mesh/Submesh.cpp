@@ -13,6 +13,8 @@ void Submesh::Destroy()
     m_MeshletBuffer.reset();
     m_MeshletVerticesBuffer.reset();
     m_MeshletTrianglesBuffer.reset();
+
+    m_Material.reset();
 }
 
 }  // namespace Pathfinder
\ No newline at end of file
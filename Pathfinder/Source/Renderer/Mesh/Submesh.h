@@ -28,6 +28,11 @@ class Submesh final : private Uncopyable, private Unmovable
     NODISCARD FORCEINLINE auto& GetMaterial() const { return m_Material; }
     NODISCARD FORCEINLINE const auto& GetBoundingSphere() const { return m_BoundingSphere; }
 
+    // Vertex positions are quantized, see MeshQuantizedPositionVertex.
+    NODISCARD FORCEINLINE const auto& GetPositionCenter() const { return m_PositionCenter; }
+    NODISCARD FORCEINLINE const auto& GetPositionExtent() const { return m_PositionExtent; }
+
+    // NOTE: GPUScene caches material BDA, mesh instance has to be updated(e.g. MarkDirty<MeshComponent>()) to pick it up.
     void SetMaterial(const Shared<Material>& material) { m_Material = material; }
 
   private:
@@ -39,7 +44,9 @@ class Submesh final : private Uncopyable, private Unmovable
     Shared<Buffer> m_MeshletBuffer;
     Shared<Material> m_Material;
 
-    Sphere m_BoundingSphere = {};
+    Sphere m_BoundingSphere    = {};
+    glm::vec3 m_PositionCenter = glm::vec3(0.f);
+    glm::vec3 m_PositionExtent = glm::vec3(1.f);
 
     friend class MeshManager;
 
@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "AOBlur.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -26,18 +27,19 @@ void AOBlurPass::AddPass(Unique<RenderGraph>& rendergraph)
         "AOBlurPass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            pd.CameraData  = builder.ReadBuffer("CameraData",EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.SSAOTexture = builder.ReadTexture("SSAOTexture", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.CameraData  = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.SSAOTexture = builder.ReadTexture(ResourceNames::SSAOTexture, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 
-            builder.DeclareTexture("AOBlurTexture",
+            builder.DeclareTexture(ResourceNames::AOBlurTexture,
                                    {.DebugName  = "AOBlurTexture",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
                                     .Wrap       = ESamplerWrap::SAMPLER_WRAP_REPEAT,
                                     .Filter     = ESamplerFilter::SAMPLER_FILTER_LINEAR,
                                     .Format     = EImageFormat::FORMAT_R8_UNORM,
-                                    .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
-            builder.WriteRenderTarget("AOBlurTexture", glm::vec4{1.f}, EOp::CLEAR, EOp::STORE);
+                                    .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT,
+                                    .bTransient = true});
+            builder.WriteRenderTarget(ResourceNames::AOBlurTexture, glm::vec4{1.f}, EOp::CLEAR, EOp::STORE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "BloomPass.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -32,18 +33,19 @@ void BloomPass::AddHorizontalPass(Unique<RenderGraph>& rendergraph)
         "BloomHorizontalPass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.DeclareTexture("BloomTextureHoriz",
+            builder.DeclareTexture(ResourceNames::BloomTextureHoriz,
                                    {.DebugName  = "BloomTextureHoriz",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
                                     .Wrap       = ESamplerWrap::SAMPLER_WRAP_REPEAT,
                                     .Filter     = ESamplerFilter::SAMPLER_FILTER_LINEAR,
                                     .Format     = EImageFormat::FORMAT_RGBA16F,
-                                    .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
-            builder.WriteRenderTarget("BloomTextureHoriz", glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
+                                    .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT,
+                                    .bTransient = true});
+            builder.WriteRenderTarget(ResourceNames::BloomTextureHoriz, glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
 
-            pd.HDRTexture = builder.ReadTexture("HDRTexture_V2", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.CameraData = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.HDRTexture = builder.ReadTexture(ResourceNames::HDRTexture_V2, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -76,18 +78,20 @@ void BloomPass::AddVerticalPass(Unique<RenderGraph>& rendergraph)
         "BloomVerticalPass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.DeclareTexture("BloomTexture",
+            builder.DeclareTexture(ResourceNames::BloomTexture,
                                    {.DebugName  = "BloomTexture",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
                                     .Wrap       = ESamplerWrap::SAMPLER_WRAP_REPEAT,
                                     .Filter     = ESamplerFilter::SAMPLER_FILTER_LINEAR,
                                     .Format     = EImageFormat::FORMAT_RGBA16F,
-                                    .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
-            builder.WriteRenderTarget("BloomTexture", glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
+                                    .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT,
+                                    .bTransient = true});
+            builder.WriteRenderTarget(ResourceNames::BloomTexture, glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
 
-            pd.BloomTextureHoriz = builder.ReadTexture("BloomTextureHoriz", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.CameraData        = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.BloomTextureHoriz =
+                builder.ReadTexture(ResourceNames::BloomTextureHoriz, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "CascadedShadowMapPass.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -35,8 +36,8 @@ void CascadedShadowMapPass::AddPass(Unique<RenderGraph>& rendergraph)
             "CSMPass" + std::to_string(cascadeIndex), ERGPassType::RGPASS_TYPE_GRAPHICS,
             [=](PassData& pd, RenderGraphBuilder& builder)
             {
-                const std::string csmTextureName = "Cascade_" + std::to_string(cascadeIndex);
-                builder.DeclareTexture(csmTextureName, {.DebugName  = csmTextureName,
+                const auto& csmTextureName = ResourceNames::CascadeTextures.at(cascadeIndex);
+                builder.DeclareTexture(csmTextureName, {.DebugName  = csmTextureName.GetString(),
                                                         .Width      = m_Width,
                                                         .Height     = m_Height,
                                                         .Wrap       = ESamplerWrap::SAMPLER_WRAP_REPEAT,
@@ -45,7 +46,7 @@ void CascadedShadowMapPass::AddPass(Unique<RenderGraph>& rendergraph)
                                                         .UsageFlags = EImageUsage::IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT |
                                                                       EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
                 builder.WriteDepthStencil(csmTextureName, DepthStencilClearValue{1.0f, 0}, EOp::CLEAR, EOp::STORE);
-                pd.CameraData = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+                pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
 
                 builder.SetViewportScissor(m_Width, m_Height);
             },
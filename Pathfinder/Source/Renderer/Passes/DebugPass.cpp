@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "DebugPass.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Debug/DebugRenderer.h>
 #include <Renderer/Pipeline.h>
@@ -31,22 +32,27 @@ void DebugPass::AddPass(Unique<RenderGraph>& rendergraph, const LineVertex* line
         "DebugPass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.WriteDepthStencil("DepthOpaque_V3", {0.f, 0}, EOp::LOAD, EOp::STORE, EOp::DONT_CARE, EOp::DONT_CARE, "DepthOpaque_V2");
-            builder.WriteRenderTarget("AlbedoTexture_V3", glm::vec4{0.f}, EOp::LOAD, EOp::STORE, "AlbedoTexture_V2");
-
-            pd.CameraData = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-
-            builder.DeclareBuffer("LineVertexBuffer", {.DebugName  = "LineVertexBuffer",
-                                                       .ExtraFlags = EBufferFlag::BUFFER_FLAG_MAPPED,
-                                                       .UsageFlags = EBufferUsage::BUFFER_USAGE_VERTEX,
-                                                       .bPerFrame  = true});
-            pd.LineVertexBuffer = builder.ReadBuffer("LineVertexBuffer", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-
-            builder.DeclareBuffer("DebugSphereData", {.DebugName  = "DebugSphereData",
-                                                      .ExtraFlags = EBufferFlag::BUFFER_FLAG_MAPPED | EBufferFlag::BUFFER_FLAG_ADDRESSABLE,
-                                                      .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
-                                                      .bPerFrame  = true});
-            pd.DebugSphereData = builder.ReadBuffer("DebugSphereData", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            builder.WriteDepthStencil(ResourceNames::DepthOpaque_V3, {0.f, 0}, EOp::LOAD, EOp::STORE, EOp::DONT_CARE, EOp::DONT_CARE,
+                                      ResourceNames::DepthOpaque_V2);
+            builder.WriteRenderTarget(ResourceNames::AlbedoTexture_V3, glm::vec4{0.f}, EOp::LOAD, EOp::STORE,
+                                      ResourceNames::AlbedoTexture_V2);
+
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+
+            builder.DeclareBuffer(ResourceNames::LineVertexBuffer,
+                                  {.DebugName  = "LineVertexBuffer",
+                                   .ExtraFlags = EBufferFlag::BUFFER_FLAG_MAPPED,
+                                   .UsageFlags = EBufferUsage::BUFFER_USAGE_VERTEX,
+                                   .bPerFrame  = true});
+            pd.LineVertexBuffer =
+                builder.ReadBuffer(ResourceNames::LineVertexBuffer, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+
+            builder.DeclareBuffer(ResourceNames::DebugSphereData,
+                                  {.DebugName  = "DebugSphereData",
+                                   .ExtraFlags = EBufferFlag::BUFFER_FLAG_MAPPED | EBufferFlag::BUFFER_FLAG_ADDRESSABLE,
+                                   .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
+                                   .bPerFrame  = true});
+            pd.DebugSphereData = builder.ReadBuffer(ResourceNames::DebugSphereData, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "DepthPrePass.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -10,13 +11,14 @@
 
 #include <Renderer/Texture.h>
 #include <Renderer/Buffer.h>
+#include <Renderer/Image.h>
 
 namespace Pathfinder
 {
 
 DepthPrePass::DepthPrePass(const uint32_t width, const uint32_t height) : m_Width{width}, m_Height{height} {}
 
-void DepthPrePass::AddPass(Unique<RenderGraph>& rendergraph)
+void DepthPrePass::AddEarlyPass(Unique<RenderGraph>& rendergraph)
 {
     struct PassData
     {
@@ -27,24 +29,28 @@ void DepthPrePass::AddPass(Unique<RenderGraph>& rendergraph)
     };
 
     rendergraph->AddPass<PassData>(
-        "DepthPrePass", ERGPassType::RGPASS_TYPE_GRAPHICS,
+        "DepthPrePassEarly", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.DeclareTexture("DepthOpaque", {.DebugName  = "DepthOpaque",
-                                                   .Width      = m_Width,
-                                                   .Height     = m_Height,
-                                                   .Wrap       = ESamplerWrap::SAMPLER_WRAP_REPEAT,
-                                                   .Filter     = ESamplerFilter::SAMPLER_FILTER_NEAREST,
-                                                   .Format     = EImageFormat::FORMAT_D32F,
-                                                   .UsageFlags = EImageUsage::IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT |
-                                                                 EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
-            builder.WriteDepthStencil("DepthOpaque", DepthStencilClearValue(0.f, 0), EOp::CLEAR, EOp::STORE);
-
-            pd.CameraData         = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-            pd.MeshDataOpaque     = builder.ReadBuffer("MeshDataOpaque_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-            pd.CulledMeshesOpaque = builder.ReadBuffer("CulledMeshesOpaque_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-            pd.DrawBufferOpaque   = builder.ReadBuffer("DrawBufferOpaque_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE |
-                                                                                  EResourceState::RESOURCE_STATE_INDIRECT_ARGUMENT);
+            builder.DeclareTexture(ResourceNames::DepthOpaqueEarly,
+                                   {.DebugName  = "DepthOpaque",
+                                    .Width      = m_Width,
+                                    .Height     = m_Height,
+                                    .Wrap       = ESamplerWrap::SAMPLER_WRAP_REPEAT,
+                                    .Filter     = ESamplerFilter::SAMPLER_FILTER_NEAREST,
+                                    .Format     = EImageFormat::FORMAT_D32F,
+                                    .UsageFlags = EImageUsage::IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT |
+                                                  EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
+            builder.WriteDepthStencil(ResourceNames::DepthOpaqueEarly, DepthStencilClearValue(0.f, 0), EOp::CLEAR, EOp::STORE);
+
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.MeshDataOpaque =
+                builder.ReadBuffer(ResourceNames::MeshDataOpaque_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.CulledMeshesOpaque =
+                builder.ReadBuffer(ResourceNames::CulledMeshesOpaque_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.DrawBufferOpaque = builder.ReadBuffer(ResourceNames::DrawBufferOpaque_V1,
+                                                     EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE |
+                                                         EResourceState::RESOURCE_STATE_INDIRECT_ARGUMENT);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -71,4 +77,61 @@ void DepthPrePass::AddPass(Unique<RenderGraph>& rendergraph)
         });
 }
 
+void DepthPrePass::AddLatePass(Unique<RenderGraph>& rendergraph)
+{
+    struct PassData
+    {
+        RGBufferID CameraData;
+        RGBufferID MeshDataOpaque;
+        RGBufferID CulledMeshesOpaqueLate;
+        RGBufferID DrawBufferOpaqueLate;
+        RGTextureID HiZPyramid;
+    };
+
+    rendergraph->AddPass<PassData>(
+        "DepthPrePassLate", ERGPassType::RGPASS_TYPE_GRAPHICS,
+        [=](PassData& pd, RenderGraphBuilder& builder)
+        {
+            builder.WriteDepthStencil(ResourceNames::DepthOpaque, DepthStencilClearValue(0.f, 0), EOp::LOAD, EOp::STORE, EOp::DONT_CARE,
+                                      EOp::DONT_CARE, ResourceNames::DepthOpaqueEarly);
+
+            pd.CameraData     = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.MeshDataOpaque = builder.ReadBuffer(ResourceNames::MeshDataOpaque_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.CulledMeshesOpaqueLate =
+                builder.ReadBuffer(ResourceNames::CulledMeshesOpaqueLate_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.DrawBufferOpaqueLate = builder.ReadBuffer(ResourceNames::DrawBufferOpaqueLate_V1,
+                                                         EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE |
+                                                             EResourceState::RESOURCE_STATE_INDIRECT_ARGUMENT);
+            pd.HiZPyramid = builder.ReadTexture(ResourceNames::HiZPyramid, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+
+            builder.SetViewportScissor(m_Width, m_Height);
+        },
+        [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
+        {
+            const auto& rd = Renderer::GetRendererData();
+
+            auto& cameraDataBuffer             = context.GetBuffer(pd.CameraData);
+            auto& meshDataOpaqueBuffer         = context.GetBuffer(pd.MeshDataOpaque);
+            auto& drawBufferOpaqueLate         = context.GetBuffer(pd.DrawBufferOpaqueLate);
+            auto& culledMeshesBufferOpaqueLate = context.GetBuffer(pd.CulledMeshesOpaqueLate);
+            auto& hizPyramid                   = context.GetTexture(pd.HiZPyramid);
+            const auto& hizSpec                = hizPyramid->GetImage()->GetSpecification();
+
+            // NOTE: Task shader repeats HiZ test per meshlet.
+            PushConstantBlock pc = {.CameraDataBuffer   = cameraDataBuffer->GetBDA(),
+                                    .AlbedoTextureIndex = hizPyramid->GetBindlessIndex(),
+                                    .addr0              = meshDataOpaqueBuffer->GetBDA(),
+                                    .addr1              = culledMeshesBufferOpaqueLate->GetBDA()};
+            pc.data1 = glm::vec4(hizSpec.Width, hizSpec.Height, hizSpec.Mips, 0.0f);
+
+            const auto& pipeline = PipelineLibrary::Get(rd->DepthPrePassLatePipelineHash);
+            Renderer::BindPipeline(cb, pipeline);
+            cb->BindPushConstants(pipeline, 0, sizeof(pc), &pc);
+            cb->DrawMeshTasksMultiIndirect(drawBufferOpaqueLate, sizeof(uint32_t), drawBufferOpaqueLate, 0,
+                                           (drawBufferOpaqueLate->GetSpecification().Capacity - sizeof(uint32_t)) /
+                                               sizeof(DrawMeshTasksIndirectCommand),
+                                           sizeof(DrawMeshTasksIndirectCommand));
+        });
+}
+
 }  // namespace Pathfinder
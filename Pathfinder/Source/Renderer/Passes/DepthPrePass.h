@@ -13,7 +13,9 @@ class DepthPrePass final
     DepthPrePass() = default;
     DepthPrePass(const uint32_t width, const uint32_t height);
 
-    void AddPass(Unique<RenderGraph>& rendergraph);
+    // Early pass writes "DepthOpaqueEarly" which HiZ pyramid is built from, late pass completes it into "DepthOpaque".
+    void AddEarlyPass(Unique<RenderGraph>& rendergraph);
+    void AddLatePass(Unique<RenderGraph>& rendergraph);
     FORCEINLINE void OnResize(const uint32_t width, const uint32_t height) { m_Width = width, m_Height = height; }
 
   private:
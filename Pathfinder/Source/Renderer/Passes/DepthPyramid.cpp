@@ -0,0 +1,78 @@
+#include <PathfinderPCH.h>
+#include "DepthPyramid.h"
+#include "ResourceNames.h"
+
+#include <Renderer/Pipeline.h>
+#include <Renderer/CommandBuffer.h>
+#include <Renderer/RenderGraph/RenderGraph.h>
+#include <Renderer/Renderer.h>
+#include <Renderer/Texture.h>
+#include <Renderer/Image.h>
+
+namespace Pathfinder
+{
+
+DepthPyramidPass::DepthPyramidPass(const uint32_t width, const uint32_t height) : m_Width{width}, m_Height{height} {}
+
+void DepthPyramidPass::AddPass(Unique<RenderGraph>& rendergraph)
+{
+    struct PassData
+    {
+        RGTextureID DepthOpaqueEarly;
+        RGTextureID HiZPyramid;
+    };
+
+    rendergraph->AddPass<PassData>(
+        "DepthPyramidPass", ERGPassType::RGPASS_TYPE_COMPUTE,
+        [=](PassData& pd, RenderGraphBuilder& builder)
+        {
+            // NOTE: Level 0 matches depth resolution, so projected bounds map onto pyramid texels without any rescaling.
+            builder.DeclareTexture(ResourceNames::HiZPyramid,
+                                   {.DebugName     = "HiZPyramid",
+                                    .Width         = m_Width,
+                                    .Height        = m_Height,
+                                    .bGenerateMips = true,
+                                    .Wrap          = ESamplerWrap::SAMPLER_WRAP_CLAMP_TO_EDGE,
+                                    .Filter        = ESamplerFilter::SAMPLER_FILTER_NEAREST,
+                                    .Format        = EImageFormat::FORMAT_R32F,
+                                    .UsageFlags    = EImageUsage::IMAGE_USAGE_STORAGE_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
+            pd.HiZPyramid = builder.WriteTexture(ResourceNames::HiZPyramid);
+            pd.DepthOpaqueEarly =
+                builder.ReadTexture(ResourceNames::DepthOpaqueEarly, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+        },
+        [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
+        {
+            const auto& rd = Renderer::GetRendererData();
+
+            auto& depthOpaqueEarly = context.GetTexture(pd.DepthOpaqueEarly);
+            auto& hizPyramid       = context.GetTexture(pd.HiZPyramid);
+            const auto& hizImage   = hizPyramid->GetImage();
+            const auto& hizSpec    = hizImage->GetSpecification();
+
+            const auto& pipeline = PipelineLibrary::Get(rd->DepthReducePipelineHash);
+            Renderer::BindPipeline(cb, pipeline);
+
+            PushConstantBlock pc = {.AlbedoTextureIndex = depthOpaqueEarly->GetBindlessIndex()};
+            for (uint32_t mip{}; mip < hizSpec.Mips; ++mip)
+            {
+                // Every level reads the previous one.
+                if (mip > 0)
+                {
+                    cb->InsertBarriers({{.srcStageMask  = EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                         .srcAccessMask = EAccessFlags::ACCESS_SHADER_WRITE_BIT,
+                                         .dstStageMask  = EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                         .dstAccessMask = EAccessFlags::ACCESS_SHADER_READ_BIT}});
+                }
+
+                pc.StorageImageIndex = hizImage->GetMipBindlessIndex(mip);
+                pc.data0.x           = mip == 0 ? 1.0f : 0.0f;
+                pc.data0.y           = mip == 0 ? 0.0f : static_cast<float>(hizImage->GetMipBindlessIndex(mip - 1));
+                cb->BindPushConstants(pipeline, 0, sizeof(pc), &pc);
+
+                const glm::uvec2 mipSize = glm::max(glm::uvec2(hizSpec.Width >> mip, hizSpec.Height >> mip), glm::uvec2(1));
+                cb->Dispatch(glm::ceil((float)mipSize.x / HIZ_LOCAL_GROUP_SIZE), glm::ceil((float)mipSize.y / HIZ_LOCAL_GROUP_SIZE));
+            }
+        });
+}
+
+}  // namespace Pathfinder
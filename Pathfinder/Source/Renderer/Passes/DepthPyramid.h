@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Core/Core.h>
+#include <Renderer/RenderGraph/RenderGraphResourceID.h>
+
+namespace Pathfinder
+{
+class RenderGraph;
+
+// Builds HiZ pyramid(MIN reduction, reversed Z) from early depth for late occlusion culling, see HiZ.h.
+class DepthPyramidPass final
+{
+  public:
+    DepthPyramidPass() = default;
+    DepthPyramidPass(const uint32_t width, const uint32_t height);
+
+    void AddPass(Unique<RenderGraph>& rendergraph);
+    FORCEINLINE void OnResize(const uint32_t width, const uint32_t height) { m_Width = width, m_Height = height; }
+
+  private:
+    uint32_t m_Width{}, m_Height{};
+};
+}  // namespace Pathfinder
\ No newline at end of file
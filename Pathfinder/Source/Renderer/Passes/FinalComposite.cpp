@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "FinalComposite.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -35,7 +36,7 @@ void FinalCompositePass::AddFinalPass(Unique<RenderGraph>& rendergraph)
         "FinalCompositePass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.DeclareTexture("FinalTexture",
+            builder.DeclareTexture(ResourceNames::FinalTexture,
                                    {.DebugName  = "FinalTexture",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
@@ -44,16 +45,18 @@ void FinalCompositePass::AddFinalPass(Unique<RenderGraph>& rendergraph)
                                     .Format     = EImageFormat::FORMAT_A2R10G10B10_UNORM_PACK32,
                                     .UsageFlags = EImageUsage::IMAGE_USAGE_SAMPLED_BIT | EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
                                                   EImageUsage::IMAGE_USAGE_TRANSFER_SRC_BIT});
-            builder.WriteRenderTarget("FinalTexture", glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
+            builder.WriteRenderTarget(ResourceNames::FinalTexture, glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
 
 // NOTE: Debug Renderer things:
 #if PFR_DEBUG
-            pd.AlbedoTexture = builder.ReadTexture("AlbedoTexture_V3", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.AlbedoTexture =
+                builder.ReadTexture(ResourceNames::AlbedoTexture_V3, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 #else
-            pd.AlbedoTexture = builder.ReadTexture("AlbedoTexture_V2", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.AlbedoTexture =
+                builder.ReadTexture(ResourceNames::AlbedoTexture_V2, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 #endif
-            pd.BloomTexture = builder.ReadTexture("BloomTexture", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.CameraData   = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.BloomTexture = builder.ReadTexture(ResourceNames::BloomTexture, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.CameraData   = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -86,7 +89,10 @@ void FinalCompositePass::AddSwapchainBlitPass(Unique<RenderGraph>& rendergraph)
     rendergraph->AddPass<PassData>(
         "SwapchainBlitPass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
-        { pd.FinalTexture = builder.ReadTexture("FinalTexture", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE); },
+        {
+            pd.FinalTexture = builder.ReadTexture(ResourceNames::FinalTexture, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            builder.SetSideEffect();  // Presents, so it's the sink everything else is kept alive by.
+        },
         [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
         {
             // TODO: Insert barrier manually?
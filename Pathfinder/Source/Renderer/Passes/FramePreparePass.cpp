@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "FramePreparePass.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -23,8 +24,10 @@ void FramePreparePass::AddPass(Unique<RenderGraph>& rendergraph)
         RGBufferID MeshDataOpaque;
         RGBufferID MeshDataTransparent;
         RGBufferID DrawBufferOpaque;
+        RGBufferID DrawBufferOpaqueLate;
         RGBufferID DrawBufferTransparent;
         RGBufferID CulledMeshesOpaque;
+        RGBufferID CulledMeshesOpaqueLate;
         RGBufferID CulledMeshesTransparent;
     };
 
@@ -32,49 +35,59 @@ void FramePreparePass::AddPass(Unique<RenderGraph>& rendergraph)
         "FramePreparePass", ERGPassType::RGPASS_TYPE_TRANSFER,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
+            const auto& rd = Renderer::GetRendererData();
+
+            // NOTE: MeshData tables are persistent, each frame only changed records get uploaded.
+            builder.ImportBuffer(ResourceNames::MeshDataOpaque_V0, rd->OpaqueScene->GetBuffer(rd->FrameIndex));
+            pd.MeshDataOpaque = builder.WriteBuffer(ResourceNames::MeshDataOpaque_V0);
+
+            builder.ImportBuffer(ResourceNames::MeshDataTransparent_V0, rd->TransparentScene->GetBuffer(rd->FrameIndex));
+            pd.MeshDataTransparent = builder.WriteBuffer(ResourceNames::MeshDataTransparent_V0);
+
             RGBufferSpecification perFrameBS = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL | EBufferFlag::BUFFER_FLAG_MAPPED,
                                                 .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
                                                 .bPerFrame  = true};
 
-            perFrameBS.DebugName = "MeshDataOpaque_V0";
-            builder.DeclareBuffer("MeshDataOpaque_V0", perFrameBS);
-            pd.MeshDataOpaque = builder.WriteBuffer("MeshDataOpaque_V0");
-
-            perFrameBS.DebugName = "MeshDataTransparent_V0";
-            builder.DeclareBuffer("MeshDataTransparent_V0", perFrameBS);
-            pd.MeshDataTransparent = builder.WriteBuffer("MeshDataTransparent_V0");
-
             perFrameBS.Capacity  = sizeof(LightData);
             perFrameBS.DebugName = "LightData";
-            builder.DeclareBuffer("LightData", perFrameBS);
-            pd.LightData = builder.WriteBuffer("LightData");
+            builder.DeclareBuffer(ResourceNames::LightData, perFrameBS);
+            pd.LightData = builder.WriteBuffer(ResourceNames::LightData);
 
             perFrameBS.Capacity  = sizeof(CameraData);
             perFrameBS.DebugName = "CameraData";
-            builder.DeclareBuffer("CameraData", perFrameBS);
-            pd.CameraData = builder.WriteBuffer("CameraData");
+            builder.DeclareBuffer(ResourceNames::CameraData, perFrameBS);
+            pd.CameraData = builder.WriteBuffer(ResourceNames::CameraData);
 
             RGBufferSpecification drawBufferBS = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_ADDRESSABLE | EBufferFlag::BUFFER_FLAG_MAPPED,
                                                   .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE | EBufferUsage::BUFFER_USAGE_INDIRECT};
 
             drawBufferBS.DebugName = "DrawBufferOpaque_V0";
-            builder.DeclareBuffer("DrawBufferOpaque_V0", drawBufferBS);
-            pd.DrawBufferOpaque = builder.WriteBuffer("DrawBufferOpaque_V0");
+            builder.DeclareBuffer(ResourceNames::DrawBufferOpaque_V0, drawBufferBS);
+            pd.DrawBufferOpaque = builder.WriteBuffer(ResourceNames::DrawBufferOpaque_V0);
+
+            // NOTE: Late buffers get objects that became visible this frame, see ObjectCullingPass.
+            drawBufferBS.DebugName = "DrawBufferOpaqueLate_V0";
+            builder.DeclareBuffer(ResourceNames::DrawBufferOpaqueLate_V0, drawBufferBS);
+            pd.DrawBufferOpaqueLate = builder.WriteBuffer(ResourceNames::DrawBufferOpaqueLate_V0);
 
             drawBufferBS.DebugName = "DrawBufferTransparent_V0";
-            builder.DeclareBuffer("DrawBufferTransparent_V0", drawBufferBS);
-            pd.DrawBufferTransparent = builder.WriteBuffer("DrawBufferTransparent_V0");
+            builder.DeclareBuffer(ResourceNames::DrawBufferTransparent_V0, drawBufferBS);
+            pd.DrawBufferTransparent = builder.WriteBuffer(ResourceNames::DrawBufferTransparent_V0);
 
             RGBufferSpecification culledMeshesBS = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
                                                     .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE};
 
             culledMeshesBS.DebugName = "CulledMeshesOpaque_V0";
-            builder.DeclareBuffer("CulledMeshesOpaque_V0", culledMeshesBS);
-            pd.CulledMeshesOpaque = builder.WriteBuffer("CulledMeshesOpaque_V0");
+            builder.DeclareBuffer(ResourceNames::CulledMeshesOpaque_V0, culledMeshesBS);
+            pd.CulledMeshesOpaque = builder.WriteBuffer(ResourceNames::CulledMeshesOpaque_V0);
+
+            culledMeshesBS.DebugName = "CulledMeshesOpaqueLate_V0";
+            builder.DeclareBuffer(ResourceNames::CulledMeshesOpaqueLate_V0, culledMeshesBS);
+            pd.CulledMeshesOpaqueLate = builder.WriteBuffer(ResourceNames::CulledMeshesOpaqueLate_V0);
 
             culledMeshesBS.DebugName = "CulledMeshesTransparent_V0";
-            builder.DeclareBuffer("CulledMeshesTransparent_V0", culledMeshesBS);
-            pd.CulledMeshesTransparent = builder.WriteBuffer("CulledMeshesTransparent_V0");
+            builder.DeclareBuffer(ResourceNames::CulledMeshesTransparent_V0, culledMeshesBS);
+            pd.CulledMeshesTransparent = builder.WriteBuffer(ResourceNames::CulledMeshesTransparent_V0);
         },
         [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
         {
@@ -88,81 +101,35 @@ void FramePreparePass::AddPass(Unique<RenderGraph>& rendergraph)
             auto& cameraDataBuffer = context.GetBuffer(pd.CameraData);
             cameraDataBuffer->SetData(&rd->CameraStruct, sizeof(rd->CameraStruct));
 
-            // 1. Sort front to back, to minimize overdraw.
-            std ::sort(std::execution::par, rd->OpaqueObjects.begin(), rd->OpaqueObjects.end(),
-                       [&](const auto& lhs, const auto& rhs) -> bool
-                       {
-                           const float lhsDist = glm::length(lhs.Translation - rd->CameraStruct.Position);
-                           const float rhsDist = glm::length(rhs.Translation - rd->CameraStruct.Position);
-
-                           return lhsDist < rhsDist;  // Front to back drawing(minimize overdraw)
-                       });
-
-            // 2. Sort back to front.
-            std::sort(std::execution::par, rd->TransparentObjects.begin(), rd->TransparentObjects.end(),
-                      [&](const auto& lhs, const auto& rhs) -> bool
-                      {
-                          const float lhsDist = glm::length(lhs.Translation - rd->CameraStruct.Position);
-                          const float rhsDist = glm::length(rhs.Translation - rd->CameraStruct.Position);
-
-                          return lhsDist > rhsDist;  // Back to front drawing(preserve blending)
-                      });
-
-            auto& meshDataOpaqueBuffer     = context.GetBuffer(pd.MeshDataOpaque);
-            auto& drawBufferOpaque         = context.GetBuffer(pd.DrawBufferOpaque);
-            auto& culledMeshesBufferOpaque = context.GetBuffer(pd.CulledMeshesOpaque);
-
-            meshDataOpaqueBuffer->Resize(rd->OpaqueObjects.size() * sizeof(MeshData));
-            drawBufferOpaque->Resize(sizeof(uint32_t) + rd->OpaqueObjects.size() * sizeof(DrawMeshTasksIndirectCommand));
-            culledMeshesBufferOpaque->Resize(rd->OpaqueObjects.size() * sizeof(uint32_t));
-
-            std::vector<MeshData> opaqueMeshesData(rd->OpaqueObjects.size());
-            for (uint32_t objIdx{}; objIdx < rd->OpaqueObjects.size(); ++objIdx)
-            {
-                const auto& submeshData     = rd->OpaqueObjects.at(objIdx);
-                const auto& submesh         = submeshData.submesh;
-                const uint32_t meshletCount = submesh->GetMeshletBuffer()->GetSpecification().Capacity / sizeof(Meshlet);
-                opaqueMeshesData.at(objIdx) = {.sphere                    = submesh->GetBoundingSphere(),
-                                               .meshletCount              = meshletCount,
-                                               .translation               = submeshData.Translation,
-                                               .scale                     = submeshData.Scale,
-                                               .orientation               = submeshData.Orientation,
-                                               .materialBufferBDA         = submesh->GetMaterial()->GetBDA(),
-                                               .indexBufferBDA            = submesh->GetIndexBuffer()->GetBDA(),
-                                               .vertexPosBufferBDA        = submesh->GetVertexPositionBuffer()->GetBDA(),
-                                               .vertexAttributeBufferBDA  = submesh->GetVertexAttributeBuffer()->GetBDA(),
-                                               .meshletBufferBDA          = submesh->GetMeshletBuffer()->GetBDA(),
-                                               .meshletVerticesBufferBDA  = submesh->GetMeshletVerticesBuffer()->GetBDA(),
-                                               .meshletTrianglesBufferBDA = submesh->GetMeshletTrianglesBuffer()->GetBDA()};
-            }
-            if (!opaqueMeshesData.empty())
-                meshDataOpaqueBuffer->SetData(opaqueMeshesData.data(), opaqueMeshesData.size() * sizeof(opaqueMeshesData[0]));
-
-            auto& meshDataTransparentBuffer     = context.GetBuffer(pd.MeshDataTransparent);
+            // NOTE: Mesh instances have already put their changes into GPUScene tables, only those get uploaded.
+            auto& opaqueScene = rd->OpaqueScene;
+            opaqueScene->EndUpdate(rd->FrameIndex);
+
+            auto& drawBufferOpaque             = context.GetBuffer(pd.DrawBufferOpaque);
+            auto& drawBufferOpaqueLate         = context.GetBuffer(pd.DrawBufferOpaqueLate);
+            auto& culledMeshesBufferOpaque     = context.GetBuffer(pd.CulledMeshesOpaque);
+            auto& culledMeshesBufferOpaqueLate = context.GetBuffer(pd.CulledMeshesOpaqueLate);
+
+            const uint32_t opaqueSlotCount = std::max(opaqueScene->GetSlotCount(), 1u);
+            drawBufferOpaque->Resize(sizeof(uint32_t) + opaqueSlotCount * sizeof(DrawMeshTasksIndirectCommand));
+            drawBufferOpaqueLate->Resize(sizeof(uint32_t) + opaqueSlotCount * sizeof(DrawMeshTasksIndirectCommand));
+            culledMeshesBufferOpaque->Resize(opaqueSlotCount * sizeof(uint32_t));
+            culledMeshesBufferOpaqueLate->Resize(opaqueSlotCount * sizeof(uint32_t));
+
+            auto& transparentScene = rd->TransparentScene;
+            transparentScene->EndUpdate(rd->FrameIndex);
+
             auto& drawBufferTransparent         = context.GetBuffer(pd.DrawBufferTransparent);
             auto& culledMeshesBufferTransparent = context.GetBuffer(pd.CulledMeshesTransparent);
 
-            meshDataTransparentBuffer->Resize(rd->TransparentObjects.size() * sizeof(MeshData));
-            drawBufferTransparent->Resize(sizeof(uint32_t) + rd->TransparentObjects.size() * sizeof(DrawMeshTasksIndirectCommand));
-            culledMeshesBufferTransparent->Resize(rd->TransparentObjects.size() * sizeof(uint32_t));
-
-            std::vector<MeshData> transparentMeshesData = {};
-            for (const auto& [submesh, translation, scale, orientation] : rd->TransparentObjects)
-            {
-                const uint32_t meshletCount = submesh->GetMeshletBuffer()->GetSpecification().Capacity / sizeof(Meshlet);
-                transparentMeshesData.emplace_back(
-                    submesh->GetBoundingSphere(), meshletCount, translation, scale, orientation, submesh->GetMaterial()->GetBDA(),
-                    submesh->GetIndexBuffer()->GetBDA(), submesh->GetVertexPositionBuffer()->GetBDA(),
-                    submesh->GetVertexAttributeBuffer()->GetBDA(), submesh->GetMeshletBuffer()->GetBDA(),
-                    submesh->GetMeshletVerticesBuffer()->GetBDA(), submesh->GetMeshletTrianglesBuffer()->GetBDA());
-            }
-            if (!transparentMeshesData.empty())
-                meshDataTransparentBuffer->SetData(transparentMeshesData.data(),
-                                                   transparentMeshesData.size() * sizeof(transparentMeshesData[0]));
-
+            const uint32_t transparentSlotCount = std::max(transparentScene->GetSlotCount(), 1u);
+            drawBufferTransparent->Resize(sizeof(uint32_t) + transparentSlotCount * sizeof(DrawMeshTasksIndirectCommand));
+            culledMeshesBufferTransparent->Resize(transparentSlotCount * sizeof(uint32_t));
 
             cb->FillBuffer(drawBufferOpaque, 0);
             cb->FillBuffer(culledMeshesBufferOpaque, 0);
+            cb->FillBuffer(drawBufferOpaqueLate, 0);
+            cb->FillBuffer(culledMeshesBufferOpaqueLate, 0);
             cb->FillBuffer(drawBufferTransparent, 0);
             cb->FillBuffer(culledMeshesBufferTransparent, 0);
         });
@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "GBufferPass.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -31,6 +32,8 @@ void GBufferPass::AddForwardPlusOpaquePass(Unique<RenderGraph>& rendergraph)
         RGBufferID MeshData;
         RGBufferID CulledMeshes;
         RGBufferID DrawBuffer;
+        RGBufferID CulledMeshesLate;
+        RGBufferID DrawBufferLate;
         RGBufferID CulledPointLightIndices;
         RGBufferID CulledSpotLightIndices;
         RGTextureID AOBlurTexture;
@@ -41,9 +44,10 @@ void GBufferPass::AddForwardPlusOpaquePass(Unique<RenderGraph>& rendergraph)
         "ForwardPlusOpaquePass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.WriteDepthStencil("DepthOpaque_V0", {0.f, 0}, EOp::LOAD, EOp::STORE, EOp::DONT_CARE, EOp::DONT_CARE, "DepthOpaque");
+            builder.WriteDepthStencil(ResourceNames::DepthOpaque_V0, {0.f, 0}, EOp::LOAD, EOp::STORE, EOp::DONT_CARE, EOp::DONT_CARE,
+                                      ResourceNames::DepthOpaque);
 
-            builder.DeclareTexture("AlbedoTexture_V0",
+            builder.DeclareTexture(ResourceNames::AlbedoTexture_V0,
                                    {.DebugName  = "AlbedoTexture_V0",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
@@ -51,9 +55,9 @@ void GBufferPass::AddForwardPlusOpaquePass(Unique<RenderGraph>& rendergraph)
                                     .Filter     = ESamplerFilter::SAMPLER_FILTER_NEAREST,
                                     .Format     = EImageFormat::FORMAT_RGBA16F,
                                     .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
-            builder.WriteRenderTarget("AlbedoTexture_V0", glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
+            builder.WriteRenderTarget(ResourceNames::AlbedoTexture_V0, glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
 
-            builder.DeclareTexture("HDRTexture_V0",
+            builder.DeclareTexture(ResourceNames::HDRTexture_V0,
                                    {.DebugName  = "HDRTexture_V0",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
@@ -61,20 +65,27 @@ void GBufferPass::AddForwardPlusOpaquePass(Unique<RenderGraph>& rendergraph)
                                     .Filter     = ESamplerFilter::SAMPLER_FILTER_NEAREST,
                                     .Format     = EImageFormat::FORMAT_RGBA16F,
                                     .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
-            builder.WriteRenderTarget("HDRTexture_V0", glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
-
-            pd.CameraData   = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.LightData    = builder.ReadBuffer("LightData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.MeshData     = builder.ReadBuffer("MeshDataOpaque_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-            pd.CulledMeshes = builder.ReadBuffer("CulledMeshesOpaque_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-            pd.DrawBuffer   = builder.ReadBuffer("DrawBufferOpaque_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE |
-                                                                            EResourceState::RESOURCE_STATE_INDIRECT_ARGUMENT);
+            builder.WriteRenderTarget(ResourceNames::HDRTexture_V0, glm::vec4{0.f}, EOp::CLEAR, EOp::STORE);
+
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.LightData  = builder.ReadBuffer(ResourceNames::LightData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.MeshData   = builder.ReadBuffer(ResourceNames::MeshDataOpaque_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.CulledMeshes =
+                builder.ReadBuffer(ResourceNames::CulledMeshesOpaque_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.DrawBuffer = builder.ReadBuffer(ResourceNames::DrawBufferOpaque_V1,
+                                               EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE |
+                                                   EResourceState::RESOURCE_STATE_INDIRECT_ARGUMENT);
+            pd.CulledMeshesLate =
+                builder.ReadBuffer(ResourceNames::CulledMeshesOpaqueLate_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.DrawBufferLate = builder.ReadBuffer(ResourceNames::DrawBufferOpaqueLate_V1,
+                                                   EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE |
+                                                       EResourceState::RESOURCE_STATE_INDIRECT_ARGUMENT);
             pd.CulledPointLightIndices =
-                builder.ReadBuffer("CulledPointLightIndices", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+                builder.ReadBuffer(ResourceNames::CulledPointLightIndices, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
             pd.CulledSpotLightIndices =
-                builder.ReadBuffer("CulledSpotLightIndices", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.AOBlurTexture = builder.ReadTexture("AOBlurTexture", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.SSSTexture    = builder.ReadTexture("SSSTexture", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+                builder.ReadBuffer(ResourceNames::CulledSpotLightIndices, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.AOBlurTexture = builder.ReadTexture(ResourceNames::AOBlurTexture, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.SSSTexture    = builder.ReadTexture(ResourceNames::SSSTexture, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -89,15 +100,21 @@ void GBufferPass::AddForwardPlusOpaquePass(Unique<RenderGraph>& rendergraph)
             auto& meshDataOpaqueBuffer          = context.GetBuffer(pd.MeshData);
             auto& drawBufferOpaque              = context.GetBuffer(pd.DrawBuffer);
             auto& culledMeshesBufferOpaque      = context.GetBuffer(pd.CulledMeshes);
+            auto& drawBufferOpaqueLate          = context.GetBuffer(pd.DrawBufferLate);
+            auto& culledMeshesBufferOpaqueLate  = context.GetBuffer(pd.CulledMeshesLate);
             auto& culledPointLightIndicesBuffer = context.GetBuffer(pd.CulledPointLightIndices);
             auto& culledSpotLightIndicesBuffer  = context.GetBuffer(pd.CulledSpotLightIndices);
             auto& aoBlurTexture                 = context.GetTexture(pd.AOBlurTexture);
             auto& sssTexture                    = context.GetTexture(pd.SSSTexture);  // TODO: use it
 
-            if (drawBufferOpaque->GetMapped()) rd->ObjectCullStats.DrawCountOpaque = *(uint32_t*)drawBufferOpaque->GetMapped();
-            Renderer::GetStats().ObjectsDrawn += rd->ObjectCullStats.DrawCountOpaque;
+            // NOTE: Opaque and transparent passes might be recorded concurrently, so shared stats are only touched atomically.
+            const uint32_t drawCountOpaque     = drawBufferOpaque->GetMapped() ? *(uint32_t*)drawBufferOpaque->GetMapped() : 0;
+            const uint32_t drawCountOpaqueLate = drawBufferOpaqueLate->GetMapped() ? *(uint32_t*)drawBufferOpaqueLate->GetMapped() : 0;
+            std::atomic_ref(rd->ObjectCullStats.DrawCountOpaque).store(drawCountOpaque, std::memory_order_relaxed);
+            std::atomic_ref(rd->ObjectCullStats.DrawCountOpaqueLate).store(drawCountOpaqueLate, std::memory_order_relaxed);
+            std::atomic_ref(Renderer::GetStats().ObjectsDrawn).fetch_add(drawCountOpaque + drawCountOpaqueLate);
 
-            const PushConstantBlock pc = {.CameraDataBuffer                   = cameraDataBuffer->GetBDA(),
+            PushConstantBlock pc = {.CameraDataBuffer                   = cameraDataBuffer->GetBDA(),
                                           .LightDataBuffer                    = lightDataBuffer->GetBDA(),
                                           .StorageImageIndex                  = aoBlurTexture->GetBindlessIndex(),
                                           .VisiblePointLightIndicesDataBuffer = culledPointLightIndicesBuffer->GetBDA(),
@@ -112,6 +129,14 @@ void GBufferPass::AddForwardPlusOpaquePass(Unique<RenderGraph>& rendergraph)
                                            (drawBufferOpaque->GetSpecification().Capacity - sizeof(uint32_t)) /
                                                sizeof(DrawMeshTasksIndirectCommand),
                                            sizeof(DrawMeshTasksIndirectCommand));
+
+            // Objects that passed late occlusion culling.
+            pc.addr1 = culledMeshesBufferOpaqueLate->GetBDA();
+            cb->BindPushConstants(pipeline, 0, sizeof(pc), &pc);
+            cb->DrawMeshTasksMultiIndirect(drawBufferOpaqueLate, sizeof(uint32_t), drawBufferOpaqueLate, 0,
+                                           (drawBufferOpaqueLate->GetSpecification().Capacity - sizeof(uint32_t)) /
+                                               sizeof(DrawMeshTasksIndirectCommand),
+                                           sizeof(DrawMeshTasksIndirectCommand));
         });
 }
 
@@ -134,22 +159,27 @@ void GBufferPass::AddForwardPlusTransparentPass(Unique<RenderGraph>& rendergraph
         "ForwardPlusTransparentPass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.WriteDepthStencil("DepthOpaque_V1", {0.f, 0}, EOp::LOAD, EOp::STORE, EOp::DONT_CARE, EOp::DONT_CARE, "DepthOpaque_V0");
-            builder.WriteRenderTarget("AlbedoTexture_V1", glm::vec4{0.f}, EOp::LOAD, EOp::STORE, "AlbedoTexture_V0");
-            builder.WriteRenderTarget("HDRTexture_V1", glm::vec4{0.f}, EOp::LOAD, EOp::STORE, "HDRTexture_V0");
-
-            pd.CameraData   = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.LightData    = builder.ReadBuffer("LightData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.MeshData     = builder.ReadBuffer("MeshDataTransparent_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-            pd.CulledMeshes = builder.ReadBuffer("CulledMeshesTransparent_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
-            pd.DrawBuffer   = builder.ReadBuffer("DrawBufferTransparent_V1", EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE |
-                                                                                 EResourceState::RESOURCE_STATE_INDIRECT_ARGUMENT);
+            builder.WriteDepthStencil(ResourceNames::DepthOpaque_V1, {0.f, 0}, EOp::LOAD, EOp::STORE, EOp::DONT_CARE, EOp::DONT_CARE,
+                                      ResourceNames::DepthOpaque_V0);
+            builder.WriteRenderTarget(ResourceNames::AlbedoTexture_V1, glm::vec4{0.f}, EOp::LOAD, EOp::STORE,
+                                      ResourceNames::AlbedoTexture_V0);
+            builder.WriteRenderTarget(ResourceNames::HDRTexture_V1, glm::vec4{0.f}, EOp::LOAD, EOp::STORE, ResourceNames::HDRTexture_V0);
+
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.LightData  = builder.ReadBuffer(ResourceNames::LightData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.MeshData =
+                builder.ReadBuffer(ResourceNames::MeshDataTransparent_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.CulledMeshes =
+                builder.ReadBuffer(ResourceNames::CulledMeshesTransparent_V1, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            pd.DrawBuffer = builder.ReadBuffer(ResourceNames::DrawBufferTransparent_V1,
+                                               EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE |
+                                                   EResourceState::RESOURCE_STATE_INDIRECT_ARGUMENT);
             pd.CulledPointLightIndices =
-                builder.ReadBuffer("CulledPointLightIndices", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+                builder.ReadBuffer(ResourceNames::CulledPointLightIndices, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
             pd.CulledSpotLightIndices =
-                builder.ReadBuffer("CulledSpotLightIndices", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.AOBlurTexture = builder.ReadTexture("AOBlurTexture", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-            pd.SSSTexture    = builder.ReadTexture("SSSTexture", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+                builder.ReadBuffer(ResourceNames::CulledSpotLightIndices, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.AOBlurTexture = builder.ReadTexture(ResourceNames::AOBlurTexture, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+            pd.SSSTexture    = builder.ReadTexture(ResourceNames::SSSTexture, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -169,9 +199,9 @@ void GBufferPass::AddForwardPlusTransparentPass(Unique<RenderGraph>& rendergraph
             auto& aoBlurTexture                 = context.GetTexture(pd.AOBlurTexture);
             auto& sssTexture                    = context.GetTexture(pd.SSSTexture);  // TODO: use it
 
-            if (drawBufferTransparent->GetMapped())
-                rd->ObjectCullStats.DrawCountTransparent = *(uint32_t*)drawBufferTransparent->GetMapped();
-            Renderer::GetStats().ObjectsDrawn += rd->ObjectCullStats.DrawCountTransparent;
+            const uint32_t drawCountTransparent = drawBufferTransparent->GetMapped() ? *(uint32_t*)drawBufferTransparent->GetMapped() : 0;
+            std::atomic_ref(rd->ObjectCullStats.DrawCountTransparent).store(drawCountTransparent, std::memory_order_relaxed);
+            std::atomic_ref(Renderer::GetStats().ObjectsDrawn).fetch_add(drawCountTransparent);
 
             const PushConstantBlock pc = {.CameraDataBuffer                   = cameraDataBuffer->GetBDA(),
                                           .LightDataBuffer                    = lightDataBuffer->GetBDA(),
@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "LightCulling.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -34,16 +35,17 @@ void LightCullingPass::AddLightCullingPass(Unique<RenderGraph>& rendergraph)
     };
 
     rendergraph->AddPass<PassData>(
-        "LightCullingPass", ERGPassType::RGPASS_TYPE_COMPUTE,
+        "LightCullingPass", ERGPassType::RGPASS_TYPE_COMPUTE_ASYNC,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            pd.CameraData        = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
-            pd.LightData         = builder.ReadBuffer("LightData", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
-            pd.LightCullFrustums = builder.ReadBuffer("LightCullFrustums", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
-            pd.DepthOpaque       = builder.ReadTexture("DepthOpaque", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.LightData  = builder.ReadBuffer(ResourceNames::LightData, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.LightCullFrustums =
+                builder.ReadBuffer(ResourceNames::LightCullFrustums, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.DepthOpaque = builder.ReadTexture(ResourceNames::DepthOpaque, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
 
             // TODO: Move  FrustumDebugTexture to ComputeFrustums pass
-            builder.DeclareTexture("FrustumDebugTexture",
+            builder.DeclareTexture(ResourceNames::FrustumDebugTexture,
                                    {.DebugName  = "FrustumDebugTexture",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
@@ -51,10 +53,11 @@ void LightCullingPass::AddLightCullingPass(Unique<RenderGraph>& rendergraph)
                                     .Filter     = ESamplerFilter::SAMPLER_FILTER_NEAREST,
                                     .Format     = EImageFormat::FORMAT_RGBA8_UNORM,
                                     .UsageFlags = EImageUsage::IMAGE_USAGE_STORAGE_BIT | EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
-                                                  EImageUsage::IMAGE_USAGE_SAMPLED_BIT | EImageUsage::IMAGE_USAGE_TRANSFER_DST_BIT});
-            pd.FrustumDebugTexture = builder.WriteTexture("FrustumDebugTexture");
+                                                  EImageUsage::IMAGE_USAGE_SAMPLED_BIT | EImageUsage::IMAGE_USAGE_TRANSFER_DST_BIT,
+                                    .bTransient = true});
+            pd.FrustumDebugTexture = builder.WriteTexture(ResourceNames::FrustumDebugTexture);
 
-            builder.DeclareTexture("LightHeatMapTexture",
+            builder.DeclareTexture(ResourceNames::LightHeatMapTexture,
                                    {.DebugName  = "LightHeatMapTexture",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
@@ -62,25 +65,30 @@ void LightCullingPass::AddLightCullingPass(Unique<RenderGraph>& rendergraph)
                                     .Filter     = ESamplerFilter::SAMPLER_FILTER_NEAREST,
                                     .Format     = EImageFormat::FORMAT_RGBA8_UNORM,
                                     .UsageFlags = EImageUsage::IMAGE_USAGE_STORAGE_BIT | EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
-                                                  EImageUsage::IMAGE_USAGE_SAMPLED_BIT | EImageUsage::IMAGE_USAGE_TRANSFER_DST_BIT});
-            pd.LightHeatMapTexture = builder.WriteTexture("LightHeatMapTexture");
+                                                  EImageUsage::IMAGE_USAGE_SAMPLED_BIT | EImageUsage::IMAGE_USAGE_TRANSFER_DST_BIT,
+                                    .bTransient = true});
+            pd.LightHeatMapTexture = builder.WriteTexture(ResourceNames::LightHeatMapTexture);
 
             const uint32_t adjustedTiledWidth  = glm::ceil((float)m_Width / LIGHT_CULLING_TILE_SIZE);
             const uint32_t adjustedTiledHeight = glm::ceil((float)m_Height / LIGHT_CULLING_TILE_SIZE);
 
             const size_t cplibSize = MAX_POINT_LIGHTS * sizeof(LIGHT_INDEX_TYPE) * adjustedTiledWidth * adjustedTiledHeight;
-            builder.DeclareBuffer("CulledPointLightIndices", {.DebugName  = "CulledPointLightIndices",
-                                                              .ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
-                                                              .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
-                                                              .Capacity   = cplibSize});
-            pd.CulledPointLightIndices = builder.WriteBuffer("CulledPointLightIndices");
+            builder.DeclareBuffer(ResourceNames::CulledPointLightIndices,
+                                  {.DebugName  = "CulledPointLightIndices",
+                                   .ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
+                                   .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
+                                   .Capacity   = cplibSize,
+                                   .bTransient = true});
+            pd.CulledPointLightIndices = builder.WriteBuffer(ResourceNames::CulledPointLightIndices);
 
             const size_t csplibSize = MAX_SPOT_LIGHTS * sizeof(LIGHT_INDEX_TYPE) * adjustedTiledWidth * adjustedTiledHeight;
-            builder.DeclareBuffer("CulledSpotLightIndices", {.DebugName  = "CulledSpotLightIndices",
-                                                             .ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
-                                                             .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
-                                                             .Capacity   = csplibSize});
-            pd.CulledSpotLightIndices = builder.WriteBuffer("CulledSpotLightIndices");
+            builder.DeclareBuffer(ResourceNames::CulledSpotLightIndices,
+                                  {.DebugName  = "CulledSpotLightIndices",
+                                   .ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
+                                   .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
+                                   .Capacity   = csplibSize,
+                                   .bTransient = true});
+            pd.CulledSpotLightIndices = builder.WriteBuffer(ResourceNames::CulledSpotLightIndices);
         },
         [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
         {
@@ -124,20 +132,21 @@ void LightCullingPass::AddComputeLightCullingFrustumsPass(Unique<RenderGraph>& r
     };
 
     rendergraph->AddPass<PassData>(
-        "ComputeFrustumsPass", ERGPassType::RGPASS_TYPE_COMPUTE,
+        "ComputeFrustumsPass", ERGPassType::RGPASS_TYPE_COMPUTE_ASYNC,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
             const uint32_t adjustedTiledWidth  = glm::ceil((float)m_Width / LIGHT_CULLING_TILE_SIZE);
             const uint32_t adjustedTiledHeight = glm::ceil((float)m_Height / LIGHT_CULLING_TILE_SIZE);
 
-            builder.DeclareBuffer("LightCullFrustums", {.DebugName  = "LightCullFrustums",
-                                                        .ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
-                                                        .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
-                                                        .Capacity   = sizeof(TileFrustum) * adjustedTiledWidth * adjustedTiledHeight});
-            pd.LightCullFrustums = builder.WriteBuffer("LightCullFrustums");
+            builder.DeclareBuffer(ResourceNames::LightCullFrustums,
+                                  {.DebugName  = "LightCullFrustums",
+                                   .ExtraFlags = EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL,
+                                   .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE,
+                                   .Capacity   = sizeof(TileFrustum) * adjustedTiledWidth * adjustedTiledHeight});
+            pd.LightCullFrustums = builder.WriteBuffer(ResourceNames::LightCullFrustums);
 
-            pd.CameraData = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_STORAGE_BUFFER |
-                                                                 EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_STORAGE_BUFFER |
+                                                                          EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
         },
         [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
         {
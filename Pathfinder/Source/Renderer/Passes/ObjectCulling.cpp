@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "ObjectCulling.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -8,11 +9,27 @@
 #include <Renderer/Mesh/Submesh.h>
 #include <Renderer/Texture.h>
 #include <Renderer/Buffer.h>
+#include <Renderer/Image.h>
 
 namespace Pathfinder
 {
 
-void ObjectCullingPass::AddPass(Unique<RenderGraph>& rendergraph)
+namespace ObjectCullingUtils
+{
+
+// NOTE: Visibility history lives across frames outside of render graph, so hazards on it(late write of previous frame -> early read,
+// early read -> late write) are resolved manually.
+FORCEINLINE static void InsertVisibilityBarrier(const Shared<CommandBuffer>& cb)
+{
+    cb->InsertBarriers({{.srcStageMask  = EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         .srcAccessMask = EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_WRITE_BIT,
+                         .dstStageMask  = EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         .dstAccessMask = EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_WRITE_BIT}});
+}
+
+}  // namespace ObjectCullingUtils
+
+void ObjectCullingPass::AddEarlyPass(Unique<RenderGraph>& rendergraph)
 {
     struct PassData
     {
@@ -29,14 +46,16 @@ void ObjectCullingPass::AddPass(Unique<RenderGraph>& rendergraph)
         "ObjectCullingPass", ERGPassType::RGPASS_TYPE_COMPUTE,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            pd.CameraData = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
-
-            pd.MeshDataOpaque          = builder.WriteBuffer("MeshDataOpaque_V1", "MeshDataOpaque_V0");
-            pd.MeshDataTransparent     = builder.WriteBuffer("MeshDataTransparent_V1", "MeshDataTransparent_V0");
-            pd.DrawBufferOpaque        = builder.WriteBuffer("DrawBufferOpaque_V1", "DrawBufferOpaque_V0");
-            pd.DrawBufferTransparent   = builder.WriteBuffer("DrawBufferTransparent_V1", "DrawBufferTransparent_V0");
-            pd.CulledMeshesOpaque      = builder.WriteBuffer("CulledMeshesOpaque_V1", "CulledMeshesOpaque_V0");
-            pd.CulledMeshesTransparent = builder.WriteBuffer("CulledMeshesTransparent_V1", "CulledMeshesTransparent_V0");
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+
+            pd.MeshDataOpaque      = builder.WriteBuffer(ResourceNames::MeshDataOpaque_V1, ResourceNames::MeshDataOpaque_V0);
+            pd.MeshDataTransparent = builder.WriteBuffer(ResourceNames::MeshDataTransparent_V1, ResourceNames::MeshDataTransparent_V0);
+            pd.DrawBufferOpaque    = builder.WriteBuffer(ResourceNames::DrawBufferOpaque_V1, ResourceNames::DrawBufferOpaque_V0);
+            pd.DrawBufferTransparent =
+                builder.WriteBuffer(ResourceNames::DrawBufferTransparent_V1, ResourceNames::DrawBufferTransparent_V0);
+            pd.CulledMeshesOpaque = builder.WriteBuffer(ResourceNames::CulledMeshesOpaque_V1, ResourceNames::CulledMeshesOpaque_V0);
+            pd.CulledMeshesTransparent =
+                builder.WriteBuffer(ResourceNames::CulledMeshesTransparent_V1, ResourceNames::CulledMeshesTransparent_V0);
         },
         [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
         {
@@ -48,30 +67,88 @@ void ObjectCullingPass::AddPass(Unique<RenderGraph>& rendergraph)
             auto& drawBufferOpaque         = context.GetBuffer(pd.DrawBufferOpaque);
             auto& culledMeshesBufferOpaque = context.GetBuffer(pd.CulledMeshesOpaque);
 
-            // 1. Opaque
+            ObjectCullingUtils::InsertVisibilityBarrier(cb);
+
+            // 1. Opaque, only objects visible last frame.
             PushConstantBlock pc = {.CameraDataBuffer = cameraDataBuffer->GetBDA(),
                                     .addr0            = meshDataOpaqueBuffer->GetBDA(),
                                     .addr1            = drawBufferOpaque->GetBDA(),
-                                    .addr2            = culledMeshesBufferOpaque->GetBDA()};
-            pc.data0.x           = rd->OpaqueObjects.size();
+                                    .addr2            = culledMeshesBufferOpaque->GetBDA(),
+                                    .addr3            = rd->OpaqueScene->GetVisibilityBuffer()->GetBDA()};
+            pc.data0             = glm::vec4(rd->OpaqueScene->GetSlotCount(), rd->OpaqueScene->GetVisibilityHistorySlotCount(), 1.0f, 0.0f);
 
             const auto& pipeline = PipelineLibrary::Get(rd->ObjectCullingPipelineHash);
             Renderer::BindPipeline(cb, pipeline);
             cb->BindPushConstants(pipeline, 0, sizeof(pc), &pc);
-            cb->Dispatch(glm::ceil((float)rd->OpaqueObjects.size() / MESHLET_LOCAL_GROUP_SIZE));
+            cb->Dispatch(glm::ceil((float)rd->OpaqueScene->GetSlotCount() / MESHLET_LOCAL_GROUP_SIZE));
 
             auto& meshesDataTransparentBuffer   = context.GetBuffer(pd.MeshDataTransparent);
             auto& drawBufferTransparent         = context.GetBuffer(pd.DrawBufferTransparent);
             auto& culledMeshesBufferTransparent = context.GetBuffer(pd.CulledMeshesTransparent);
 
-            // 2. Transparent
-            pc.data0.x = rd->TransparentObjects.size();
-            pc.addr0   = meshesDataTransparentBuffer->GetBDA();
-            pc.addr1   = drawBufferTransparent->GetBDA();
-            pc.addr2   = culledMeshesBufferTransparent->GetBDA();
+            // 2. Transparent, they don't write depth, so frustum culling only.
+            pc.data0 = glm::vec4(rd->TransparentScene->GetSlotCount(), 0.0f, 0.0f, 0.0f);
+            pc.addr0 = meshesDataTransparentBuffer->GetBDA();
+            pc.addr1 = drawBufferTransparent->GetBDA();
+            pc.addr2 = culledMeshesBufferTransparent->GetBDA();
+            pc.addr3 = 0;
+            Renderer::BindPipeline(cb, pipeline);
+            cb->BindPushConstants(pipeline, 0, sizeof(pc), &pc);
+            cb->Dispatch(glm::ceil((float)rd->TransparentScene->GetSlotCount() / MESHLET_LOCAL_GROUP_SIZE));
+        });
+}
+
+void ObjectCullingPass::AddLatePass(Unique<RenderGraph>& rendergraph)
+{
+    struct PassData
+    {
+        RGBufferID CameraData;
+        RGBufferID MeshDataOpaque;
+        RGBufferID DrawBufferOpaqueLate;
+        RGBufferID CulledMeshesOpaqueLate;
+        RGTextureID HiZPyramid;
+    };
+
+    rendergraph->AddPass<PassData>(
+        "ObjectCullingLatePass", ERGPassType::RGPASS_TYPE_COMPUTE,
+        [=](PassData& pd, RenderGraphBuilder& builder)
+        {
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.MeshDataOpaque =
+                builder.ReadBuffer(ResourceNames::MeshDataOpaque_V1, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.HiZPyramid = builder.ReadTexture(ResourceNames::HiZPyramid, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+
+            pd.DrawBufferOpaqueLate = builder.WriteBuffer(ResourceNames::DrawBufferOpaqueLate_V1, ResourceNames::DrawBufferOpaqueLate_V0);
+            pd.CulledMeshesOpaqueLate =
+                builder.WriteBuffer(ResourceNames::CulledMeshesOpaqueLate_V1, ResourceNames::CulledMeshesOpaqueLate_V0);
+        },
+        [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
+        {
+            const auto& rd = Renderer::GetRendererData();
+
+            auto& cameraDataBuffer             = context.GetBuffer(pd.CameraData);
+            auto& meshDataOpaqueBuffer         = context.GetBuffer(pd.MeshDataOpaque);
+            auto& drawBufferOpaqueLate         = context.GetBuffer(pd.DrawBufferOpaqueLate);
+            auto& culledMeshesBufferOpaqueLate = context.GetBuffer(pd.CulledMeshesOpaqueLate);
+            auto& hizPyramid                   = context.GetTexture(pd.HiZPyramid);
+            const auto& hizSpec                = hizPyramid->GetImage()->GetSpecification();
+
+            ObjectCullingUtils::InsertVisibilityBarrier(cb);
+
+            // NOTE: Transparent objects are left out, they're frustum culled only.
+            PushConstantBlock pc = {.CameraDataBuffer   = cameraDataBuffer->GetBDA(),
+                                    .AlbedoTextureIndex = hizPyramid->GetBindlessIndex(),
+                                    .addr0              = meshDataOpaqueBuffer->GetBDA(),
+                                    .addr1              = drawBufferOpaqueLate->GetBDA(),
+                                    .addr2              = culledMeshesBufferOpaqueLate->GetBDA(),
+                                    .addr3              = rd->OpaqueScene->GetVisibilityBuffer()->GetBDA()};
+            pc.data0 = glm::vec4(rd->OpaqueScene->GetSlotCount(), rd->OpaqueScene->GetVisibilityHistorySlotCount(), 0.0f, 0.0f);
+            pc.data1 = glm::vec4(hizSpec.Width, hizSpec.Height, hizSpec.Mips, 0.0f);
+
+            const auto& pipeline = PipelineLibrary::Get(rd->ObjectCullingLatePipelineHash);
             Renderer::BindPipeline(cb, pipeline);
             cb->BindPushConstants(pipeline, 0, sizeof(pc), &pc);
-            cb->Dispatch(glm::ceil((float)rd->TransparentObjects.size() / MESHLET_LOCAL_GROUP_SIZE));
+            cb->Dispatch(glm::ceil((float)rd->OpaqueScene->GetSlotCount() / MESHLET_LOCAL_GROUP_SIZE));
         });
 }
 
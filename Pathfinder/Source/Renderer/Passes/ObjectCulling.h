@@ -12,6 +12,8 @@ class ObjectCullingPass final
   public:
     ObjectCullingPass() = default;
 
-    void AddPass(Unique<RenderGraph>& rendergraph);
+    // Two-phase occlusion culling: early pass takes objects visible last frame, late pass tests the rest against HiZ built in between.
+    void AddEarlyPass(Unique<RenderGraph>& rendergraph);
+    void AddLatePass(Unique<RenderGraph>& rendergraph);
 };
 }  // namespace Pathfinder
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "Quad2DPass.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -40,17 +41,20 @@ void Quad2DPass::AddPass(Unique<RenderGraph>& rendergraph, std::vector<Sprite>&
         "Quad2DPass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.WriteDepthStencil("DepthOpaque_V2", {0.f, 0}, EOp::LOAD, EOp::STORE, EOp::DONT_CARE, EOp::DONT_CARE, "DepthOpaque_V1");
-            builder.WriteRenderTarget("AlbedoTexture_V2", glm::vec4{0.f}, EOp::LOAD, EOp::STORE, "AlbedoTexture_V1");
-            builder.WriteRenderTarget("HDRTexture_V2", glm::vec4{0.f}, EOp::LOAD, EOp::STORE, "HDRTexture_V1");
-
-            pd.CameraData = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
-
-            builder.DeclareBuffer("SpriteData", {.DebugName  = "SpriteData",
-                                                 .ExtraFlags = EBufferFlag::BUFFER_FLAG_MAPPED | EBufferFlag::BUFFER_FLAG_ADDRESSABLE,
-                                                 .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE});
-            pd.SpriteData = builder.ReadBuffer("SpriteData", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE |
-                                                                 EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
+            builder.WriteDepthStencil(ResourceNames::DepthOpaque_V2, {0.f, 0}, EOp::LOAD, EOp::STORE, EOp::DONT_CARE, EOp::DONT_CARE,
+                                      ResourceNames::DepthOpaque_V1);
+            builder.WriteRenderTarget(ResourceNames::AlbedoTexture_V2, glm::vec4{0.f}, EOp::LOAD, EOp::STORE,
+                                      ResourceNames::AlbedoTexture_V1);
+            builder.WriteRenderTarget(ResourceNames::HDRTexture_V2, glm::vec4{0.f}, EOp::LOAD, EOp::STORE, ResourceNames::HDRTexture_V1);
+
+            pd.CameraData = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+
+            builder.DeclareBuffer(ResourceNames::SpriteData,
+                                  {.DebugName  = "SpriteData",
+                                   .ExtraFlags = EBufferFlag::BUFFER_FLAG_MAPPED | EBufferFlag::BUFFER_FLAG_ADDRESSABLE,
+                                   .UsageFlags = EBufferUsage::BUFFER_USAGE_STORAGE});
+            pd.SpriteData = builder.ReadBuffer(ResourceNames::SpriteData, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE |
+                                                                          EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Core/Core.h>
+#include <Renderer/RenderGraph/RenderGraphResourceID.h>
+
+namespace Pathfinder
+{
+
+// NOTE: Render graph resources shared between passes, interned once at startup, so per-frame setup refers to them by ID only.
+namespace ResourceNames
+{
+
+// Textures
+inline const RGResourceName AlbedoTexture_V0    = "AlbedoTexture_V0";
+inline const RGResourceName AlbedoTexture_V1    = "AlbedoTexture_V1";
+inline const RGResourceName AlbedoTexture_V2    = "AlbedoTexture_V2";
+inline const RGResourceName AlbedoTexture_V3    = "AlbedoTexture_V3";
+inline const RGResourceName HDRTexture_V0       = "HDRTexture_V0";
+inline const RGResourceName HDRTexture_V1       = "HDRTexture_V1";
+inline const RGResourceName HDRTexture_V2       = "HDRTexture_V2";
+inline const RGResourceName DepthOpaqueEarly    = "DepthOpaqueEarly";
+inline const RGResourceName DepthOpaque         = "DepthOpaque";
+inline const RGResourceName DepthOpaque_V0      = "DepthOpaque_V0";
+inline const RGResourceName DepthOpaque_V1      = "DepthOpaque_V1";
+inline const RGResourceName DepthOpaque_V2      = "DepthOpaque_V2";
+inline const RGResourceName DepthOpaque_V3      = "DepthOpaque_V3";
+inline const RGResourceName HiZPyramid          = "HiZPyramid";
+inline const RGResourceName SSAOTexture         = "SSAOTexture";
+inline const RGResourceName AOBlurTexture       = "AOBlurTexture";
+inline const RGResourceName SSSTexture          = "SSSTexture";
+inline const RGResourceName BloomTextureHoriz   = "BloomTextureHoriz";
+inline const RGResourceName BloomTexture        = "BloomTexture";
+inline const RGResourceName FinalTexture        = "FinalTexture";
+inline const RGResourceName FrustumDebugTexture = "FrustumDebugTexture";
+inline const RGResourceName LightHeatMapTexture = "LightHeatMapTexture";
+
+// Buffers
+inline const RGResourceName CameraData                 = "CameraData";
+inline const RGResourceName LightData                  = "LightData";
+inline const RGResourceName LightCullFrustums          = "LightCullFrustums";
+inline const RGResourceName CulledPointLightIndices    = "CulledPointLightIndices";
+inline const RGResourceName CulledSpotLightIndices     = "CulledSpotLightIndices";
+inline const RGResourceName MeshDataOpaque_V0          = "MeshDataOpaque_V0";
+inline const RGResourceName MeshDataOpaque_V1          = "MeshDataOpaque_V1";
+inline const RGResourceName MeshDataTransparent_V0     = "MeshDataTransparent_V0";
+inline const RGResourceName MeshDataTransparent_V1     = "MeshDataTransparent_V1";
+inline const RGResourceName DrawBufferOpaque_V0        = "DrawBufferOpaque_V0";
+inline const RGResourceName DrawBufferOpaque_V1        = "DrawBufferOpaque_V1";
+inline const RGResourceName DrawBufferOpaqueLate_V0    = "DrawBufferOpaqueLate_V0";
+inline const RGResourceName DrawBufferOpaqueLate_V1    = "DrawBufferOpaqueLate_V1";
+inline const RGResourceName DrawBufferTransparent_V0   = "DrawBufferTransparent_V0";
+inline const RGResourceName DrawBufferTransparent_V1   = "DrawBufferTransparent_V1";
+inline const RGResourceName CulledMeshesOpaque_V0      = "CulledMeshesOpaque_V0";
+inline const RGResourceName CulledMeshesOpaque_V1      = "CulledMeshesOpaque_V1";
+inline const RGResourceName CulledMeshesOpaqueLate_V0  = "CulledMeshesOpaqueLate_V0";
+inline const RGResourceName CulledMeshesOpaqueLate_V1  = "CulledMeshesOpaqueLate_V1";
+inline const RGResourceName CulledMeshesTransparent_V0 = "CulledMeshesTransparent_V0";
+inline const RGResourceName CulledMeshesTransparent_V1 = "CulledMeshesTransparent_V1";
+inline const RGResourceName LineVertexBuffer           = "LineVertexBuffer";
+inline const RGResourceName DebugSphereData            = "DebugSphereData";
+inline const RGResourceName SpriteData                 = "SpriteData";
+
+inline const auto CascadeTextures = []
+{
+    std::array<RGResourceName, SHADOW_CASCADE_COUNT> cascadeTextures = {};
+    for (uint32_t cascadeIndex{}; cascadeIndex < cascadeTextures.size(); ++cascadeIndex)
+        cascadeTextures[cascadeIndex] = RGResourceName("Cascade_" + std::to_string(cascadeIndex));
+    return cascadeTextures;
+}();
+
+}  // namespace ResourceNames
+
+}  // namespace Pathfinder
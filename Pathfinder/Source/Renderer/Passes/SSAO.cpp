@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "SSAO.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -25,17 +26,18 @@ void SSAOPass::AddPass(Unique<RenderGraph>& rendergraph)
         "SSAOPass", ERGPassType::RGPASS_TYPE_GRAPHICS,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            builder.DeclareTexture("SSAOTexture",
+            builder.DeclareTexture(ResourceNames::SSAOTexture,
                                    {.DebugName  = "SSAOTexture",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
                                     .Wrap       = ESamplerWrap::SAMPLER_WRAP_REPEAT,
                                     .Filter     = ESamplerFilter::SAMPLER_FILTER_LINEAR,
                                     .Format     = EImageFormat::FORMAT_R8_UNORM,
-                                    .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT});
-            builder.WriteRenderTarget("SSAOTexture", ColorClearValue{1.f}, EOp::CLEAR, EOp::STORE);
-            pd.CameraData  = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
-            pd.DepthOpaque = builder.ReadTexture("DepthOpaque", EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
+                                    .UsageFlags = EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT | EImageUsage::IMAGE_USAGE_SAMPLED_BIT,
+                                    .bTransient = true});
+            builder.WriteRenderTarget(ResourceNames::SSAOTexture, ColorClearValue{1.f}, EOp::CLEAR, EOp::STORE);
+            pd.CameraData  = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.DepthOpaque = builder.ReadTexture(ResourceNames::DepthOpaque, EResourceState::RESOURCE_STATE_FRAGMENT_SHADER_RESOURCE);
 
             builder.SetViewportScissor(m_Width, m_Height);
         },
@@ -1,5 +1,6 @@
 #include <PathfinderPCH.h>
 #include "ScreenSpaceShadowsPass.h"
+#include "ResourceNames.h"
 
 #include <Renderer/Pipeline.h>
 #include <Renderer/CommandBuffer.h>
@@ -26,18 +27,18 @@ void ScreenSpaceShadowsPass::AddPass(Unique<RenderGraph>& rendergraph)
     };
 
     rendergraph->AddPass<PassData>(
-        "ScreenSpaceShadowsPass", ERGPassType::RGPASS_TYPE_COMPUTE,
+        "ScreenSpaceShadowsPass", ERGPassType::RGPASS_TYPE_COMPUTE_ASYNC,
         [=](PassData& pd, RenderGraphBuilder& builder)
         {
-            pd.DepthOpaque = builder.ReadTexture("DepthOpaque", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
-            pd.CameraData  = builder.ReadBuffer("CameraData", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.DepthOpaque = builder.ReadTexture(ResourceNames::DepthOpaque, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.CameraData  = builder.ReadBuffer(ResourceNames::CameraData, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
             pd.CulledPointLightIndices =
-                builder.ReadBuffer("CulledPointLightIndices", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+                builder.ReadBuffer(ResourceNames::CulledPointLightIndices, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
             pd.CulledSpotLightIndices =
-                builder.ReadBuffer("CulledSpotLightIndices", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
-            pd.LightData = builder.ReadBuffer("LightData", EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+                builder.ReadBuffer(ResourceNames::CulledSpotLightIndices, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
+            pd.LightData = builder.ReadBuffer(ResourceNames::LightData, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE);
 
-            builder.DeclareTexture("SSSTexture",
+            builder.DeclareTexture(ResourceNames::SSSTexture,
                                    {.DebugName  = "SSSTexture",
                                     .Width      = m_Width,
                                     .Height     = m_Height,
@@ -46,7 +47,7 @@ void ScreenSpaceShadowsPass::AddPass(Unique<RenderGraph>& rendergraph)
                                     .Format     = EImageFormat::FORMAT_R16_UNORM,
                                     .UsageFlags = EImageUsage::IMAGE_USAGE_STORAGE_BIT | EImageUsage::IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
                                                   EImageUsage::IMAGE_USAGE_SAMPLED_BIT | EImageUsage::IMAGE_USAGE_TRANSFER_DST_BIT});
-            pd.SSSTexture = builder.WriteTexture("SSSTexture");
+            pd.SSSTexture = builder.WriteTexture(ResourceNames::SSSTexture);
         },
         [=](const PassData& pd, RenderGraphContext& context, Shared<CommandBuffer>& cb)
         {
@@ -0,0 +1,101 @@
+#include <PathfinderPCH.h>
+#include "ProfilerTrace.h"
+
+#include <nlohmann/json.hpp>
+
+namespace Pathfinder
+{
+
+namespace ProfilerTrace
+{
+
+static constexpr uint32_t s_CPU_PROCESS_ID = 0;
+static constexpr uint32_t s_GPU_PROCESS_ID = 1;
+
+bool WriteChromeTrace(const std::filesystem::path& filePath, const std::deque<ProfilerFrame>& cpuFrames,
+                      const std::deque<ProfilerFrame>& gpuFrames)
+{
+    if (cpuFrames.empty() && gpuFrames.empty())
+    {
+        LOG_WARN("Nothing to write into trace \"{}\"!", filePath.string());
+        return false;
+    }
+
+    // NOTE: Timestamps are in microseconds, relative to the earliest frame, so they stay small enough for double precision.
+    auto origin = std::chrono::steady_clock::time_point::max();
+    for (const auto* frames : {&cpuFrames, &gpuFrames})
+        if (!frames->empty()) origin = std::min(origin, frames->front().StartTime);
+
+    const auto toTraceUs = [&](const std::chrono::steady_clock::time_point& frameStart, const double frameRelativeMs)
+    { return std::chrono::duration<double, std::micro>(frameStart - origin).count() + frameRelativeMs * 1000.0; };
+
+    nlohmann::ordered_json events = nlohmann::ordered_json::array();
+    const auto addMetadata        = [&](const char* name, const uint32_t pid, const uint32_t tid, const std::string& value)
+    { events.push_back({{"name", name}, {"ph", "M"}, {"pid", pid}, {"tid", tid}, {"args", {{"name", value}}}}); };
+
+    addMetadata("process_name", s_CPU_PROCESS_ID, 0, "CPU");
+    addMetadata("process_name", s_GPU_PROCESS_ID, 0, "GPU");
+    addMetadata("thread_name", s_GPU_PROCESS_ID, 0, "Graphics Queue");
+
+    std::set<uint32_t> cpuThreadIDs;
+    for (const auto& frame : cpuFrames)
+    {
+        events.push_back({{"name", "Frame " + std::to_string(frame.FrameNumber)},
+                          {"ph", "i"},
+                          {"s", "p"},
+                          {"ts", toTraceUs(frame.StartTime, 0.0)},
+                          {"pid", s_CPU_PROCESS_ID},
+                          {"tid", 0}});
+
+        for (const auto& task : frame.Tasks)
+        {
+            cpuThreadIDs.insert(task.ThreadID);
+            events.push_back({{"name", task.Tag},
+                              {"cat", "CPU"},
+                              {"ph", "X"},
+                              {"ts", toTraceUs(frame.StartTime, task.StartTime)},
+                              {"dur", task.GetLength() * 1000.0},
+                              {"pid", s_CPU_PROCESS_ID},
+                              {"tid", task.ThreadID},
+                              {"args", {{"frame", frame.FrameNumber}}}});
+        }
+    }
+
+    for (const auto threadID : cpuThreadIDs)
+        addMetadata("thread_name", s_CPU_PROCESS_ID, threadID, threadID == 0 ? "Main Thread" : "Worker " + std::to_string(threadID));
+
+    for (const auto& frame : gpuFrames)
+    {
+        for (const auto& task : frame.Tasks)
+        {
+            events.push_back({{"name", task.Tag},
+                              {"cat", "GPU"},
+                              {"ph", "X"},
+                              {"ts", toTraceUs(frame.StartTime, task.StartTime)},
+                              {"dur", task.GetLength() * 1000.0},
+                              {"pid", s_GPU_PROCESS_ID},
+                              {"tid", 0},
+                              {"args", {{"frame", frame.FrameNumber}}}});
+        }
+    }
+
+    std::ofstream out(filePath, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
+    {
+        LOG_WARN("Failed to open trace file \"{}\"!", filePath.string());
+        return false;
+    }
+
+    nlohmann::ordered_json json;
+    json["traceEvents"]     = std::move(events);
+    json["displayTimeUnit"] = "ms";
+    out << json.dump() << std::endl;
+    out.close();
+
+    LOG_INFO("Profiler trace written to \"{}\" ({} CPU frames, {} GPU frames).", filePath.string(), cpuFrames.size(), gpuFrames.size());
+    return true;
+}
+
+}  // namespace ProfilerTrace
+
+}  // namespace Pathfinder
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Core/Core.h>
+#include <deque>
+
+namespace Pathfinder
+{
+
+namespace ProfilerTrace
+{
+
+// Chrome trace-event JSON(chrome://tracing, ui.perfetto.dev). CPU tasks go onto their thread tracks, GPU tasks onto separate "GPU" track.
+// Both histories are expected to be on the same(steady_clock) timeline.
+bool WriteChromeTrace(const std::filesystem::path& filePath, const std::deque<ProfilerFrame>& cpuFrames,
+                      const std::deque<ProfilerFrame>& gpuFrames);
+
+}  // namespace ProfilerTrace
+
+}  // namespace Pathfinder
\ No newline at end of file
@@ -3,11 +3,15 @@
 
 #include <Renderer/Renderer.h>
 #include <Renderer/CommandBuffer.h>
+#include <Renderer/DescriptorManager.h>
+#include <Renderer/GraphicsContext.h>
 #include <Renderer/Texture.h>
 #include <Renderer/Buffer.h>
 
 #include <Core/Application.h>
 
+#include <nlohmann/json.hpp>
+
 namespace Pathfinder
 {
 
@@ -50,10 +54,236 @@ FORCEINLINE static bool ImageUsageContains(const ImageUsageFlags source, const E
     return (source & flag) == flag;
 }
 
+FORCEINLINE static void HashCombine(uint64_t& seed, const uint64_t value)
+{
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+static glm::vec3 StringToVec3(const std::string& str)
+{
+    const auto hashCode = std::hash<std::string>{}(str);
+
+    const auto x = static_cast<float>((hashCode & 0xFF0000) >> 16) / 255.0f;
+    const auto y = static_cast<float>((hashCode & 0x00FF00) >> 8) / 255.0f;
+    const auto z = static_cast<float>(hashCode & 0x0000FF) / 255.0f;
+
+    return glm::vec3(x, y, z);
+}
+
+static constexpr uint32_t s_QUEUE_COUNT = 3;  // Indexed by ECommandBufferType.
+
+NODISCARD FORCEINLINE static ECommandBufferType PassTypeToQueue(const ERGPassType rgPassType)
+{
+    switch (rgPassType)
+    {
+        case ERGPassType::RGPASS_TYPE_GRAPHICS:
+        case ERGPassType::RGPASS_TYPE_COMPUTE:
+        case ERGPassType::RGPASS_TYPE_TRANSFER: return ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL;
+        case ERGPassType::RGPASS_TYPE_COMPUTE_ASYNC: return ECommandBufferType::COMMAND_BUFFER_TYPE_COMPUTE_ASYNC;
+        case ERGPassType::RGPASS_TYPE_TRANSFER_ASYNC: return ECommandBufferType::COMMAND_BUFFER_TYPE_TRANSFER_ASYNC;
+    }
+
+    PFR_ASSERT(false, "Unknown rg pass type!");
+    return ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL;
+}
+
+// NOTE: Planned masks assume graphics queue, stages other queues don't support are widened to ALL_COMMANDS, which there means
+// everything queue can do. Cross-queue part of the dependency is covered by semaphore wait anyway.
+template <typename TBarrier> static void ClampBarrierToQueue(TBarrier& barrier, const ECommandBufferType queue)
+{
+    if (queue == ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL) return;
+
+    RendererTypeFlags supportedStages = EPipelineStage::PIPELINE_STAGE_TOP_OF_PIPE_BIT | EPipelineStage::PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT |
+                                        EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT | EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT |
+                                        EPipelineStage::PIPELINE_STAGE_COPY_BIT | EPipelineStage::PIPELINE_STAGE_CLEAR_BIT |
+                                        EPipelineStage::PIPELINE_STAGE_HOST_BIT;
+    if (queue == ECommandBufferType::COMMAND_BUFFER_TYPE_COMPUTE_ASYNC)
+        supportedStages |= EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT | EPipelineStage::PIPELINE_STAGE_DRAW_INDIRECT_BIT |
+                           EPipelineStage::PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT |
+                           EPipelineStage::PIPELINE_STAGE_ACCELERATION_STRUCTURE_COPY_BIT |
+                           EPipelineStage::PIPELINE_STAGE_RAY_TRACING_SHADER_BIT;
+
+    if ((barrier.srcStageMask & ~supportedStages) != 0)
+    {
+        barrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        barrier.srcAccessMask = EAccessFlags::ACCESS_MEMORY_WRITE_BIT;
+    }
+
+    if ((barrier.dstStageMask & ~supportedStages) != 0)
+    {
+        barrier.dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        barrier.dstAccessMask = EAccessFlags::ACCESS_MEMORY_READ_BIT | EAccessFlags::ACCESS_MEMORY_WRITE_BIT;
+    }
+}
+
+// NOTE: Bindless set is bound per command buffer(secondaries don't inherit it), transfer queue doesn't need one.
+static void BindDescriptors(const Shared<CommandBuffer>& cb)
+{
+    const auto queue = cb->GetSpecification().Type;
+    if (queue == ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL)
+        Renderer::GetDescriptorManager()->Bind(cb, EPipelineStage::PIPELINE_STAGE_ALL_GRAPHICS_BIT |
+                                                       EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT |
+                                                       EPipelineStage::PIPELINE_STAGE_RAY_TRACING_SHADER_BIT);
+    else if (queue == ECommandBufferType::COMMAND_BUFFER_TYPE_COMPUTE_ASYNC)
+        Renderer::GetDescriptorManager()->Bind(cb, EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+}
+
+NODISCARD FORCEINLINE static bool HasWriteAccess(const RendererTypeFlags accessMask)
+{
+    constexpr RendererTypeFlags writeAccessMask =
+        EAccessFlags::ACCESS_SHADER_WRITE_BIT | EAccessFlags::ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+        EAccessFlags::ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | EAccessFlags::ACCESS_TRANSFER_WRITE_BIT |
+        EAccessFlags::ACCESS_HOST_WRITE_BIT | EAccessFlags::ACCESS_MEMORY_WRITE_BIT | EAccessFlags::ACCESS_SHADER_STORAGE_WRITE_BIT |
+        EAccessFlags::ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT;
+    return (accessMask & writeAccessMask) != 0;
+}
+
+// NOTE: Barriers of a group are recorded by a single InsertBarriers(), ones targeting the same resource with the same layouts are
+// folded into one, read-after-read ones without layout change or ownership transfer don't order anything, so they're dropped.
+static void MergeBarriers(std::vector<BufferMemoryBarrier>& bufferMemoryBarriers, std::vector<ImageMemoryBarrier>& imageMemoryBarriers)
+{
+    std::vector<BufferMemoryBarrier> mergedBufferBarriers;
+    mergedBufferBarriers.reserve(bufferMemoryBarriers.size());
+    for (const auto& bufferBarrier : bufferMemoryBarriers)
+    {
+        const bool bQueueTransfer = bufferBarrier.srcQueueFamilyIndex.has_value();
+        if (!bQueueTransfer && !HasWriteAccess(bufferBarrier.srcAccessMask) && !HasWriteAccess(bufferBarrier.dstAccessMask)) continue;
+
+        const auto it =
+            std::ranges::find_if(mergedBufferBarriers, [&](const auto& mergedBarrier)
+                                 { return mergedBarrier.buffer == bufferBarrier.buffer && !mergedBarrier.srcQueueFamilyIndex; });
+        if (bQueueTransfer || it == mergedBufferBarriers.end())
+        {
+            mergedBufferBarriers.emplace_back(bufferBarrier);
+            continue;
+        }
+
+        it->srcStageMask |= bufferBarrier.srcStageMask;
+        it->srcAccessMask |= bufferBarrier.srcAccessMask;
+        it->dstStageMask |= bufferBarrier.dstStageMask;
+        it->dstAccessMask |= bufferBarrier.dstAccessMask;
+    }
+    bufferMemoryBarriers = std::move(mergedBufferBarriers);
+
+    std::vector<ImageMemoryBarrier> mergedImageBarriers;
+    mergedImageBarriers.reserve(imageMemoryBarriers.size());
+    for (const auto& imageBarrier : imageMemoryBarriers)
+    {
+        const bool bQueueTransfer = imageBarrier.srcQueueFamilyIndex.has_value();
+        if (!bQueueTransfer && imageBarrier.oldLayout == imageBarrier.newLayout && !HasWriteAccess(imageBarrier.srcAccessMask) &&
+            !HasWriteAccess(imageBarrier.dstAccessMask))
+            continue;
+
+        const auto it = std::ranges::find_if(mergedImageBarriers,
+                                             [&](const auto& mergedBarrier)
+                                             {
+                                                 return mergedBarrier.image == imageBarrier.image && !mergedBarrier.srcQueueFamilyIndex &&
+                                                        mergedBarrier.oldLayout == imageBarrier.oldLayout &&
+                                                        mergedBarrier.newLayout == imageBarrier.newLayout;
+                                             });
+        if (bQueueTransfer || it == mergedImageBarriers.end())
+        {
+            mergedImageBarriers.emplace_back(imageBarrier);
+            continue;
+        }
+
+        it->srcStageMask |= imageBarrier.srcStageMask;
+        it->srcAccessMask |= imageBarrier.srcAccessMask;
+        it->dstStageMask |= imageBarrier.dstStageMask;
+        it->dstAccessMask |= imageBarrier.dstAccessMask;
+    }
+    imageMemoryBarriers = std::move(mergedImageBarriers);
+}
+
+NODISCARD FORCEINLINE static std::string_view QueueToString(const ECommandBufferType queue)
+{
+    switch (queue)
+    {
+        case ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL: return "GENERAL";
+        case ECommandBufferType::COMMAND_BUFFER_TYPE_COMPUTE_ASYNC: return "COMPUTE_ASYNC";
+        case ECommandBufferType::COMMAND_BUFFER_TYPE_TRANSFER_ASYNC: return "TRANSFER_ASYNC";
+    }
+
+    PFR_ASSERT(false, "Unknown queue!");
+    return s_DEFAULT_STRING;
+}
+
+NODISCARD FORCEINLINE static std::string_view BarrierHazardToString(const ERGBarrierHazard hazard)
+{
+    switch (hazard)
+    {
+        case ERGBarrierHazard::RGBARRIER_HAZARD_RAW: return "RAW";
+        case ERGBarrierHazard::RGBARRIER_HAZARD_WAR: return "WAR";
+        case ERGBarrierHazard::RGBARRIER_HAZARD_WAW: return "WAW";
+    }
+
+    PFR_ASSERT(false, "Unknown barrier hazard!");
+    return s_DEFAULT_STRING;
+}
+
+NODISCARD FORCEINLINE static std::string_view ImageLayoutToString(const EImageLayout imageLayout)
+{
+    switch (imageLayout)
+    {
+        case EImageLayout::IMAGE_LAYOUT_UNDEFINED: return "UNDEFINED";
+        case EImageLayout::IMAGE_LAYOUT_GENERAL: return "GENERAL";
+        case EImageLayout::IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL: return "COLOR_ATTACHMENT_OPTIMAL";
+        case EImageLayout::IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL: return "DEPTH_STENCIL_ATTACHMENT_OPTIMAL";
+        case EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL: return "SHADER_READ_ONLY_OPTIMAL";
+        case EImageLayout::IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL: return "TRANSFER_SRC_OPTIMAL";
+        case EImageLayout::IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL: return "TRANSFER_DST_OPTIMAL";
+        case EImageLayout::IMAGE_LAYOUT_PRESENT_SRC: return "PRESENT_SRC";
+        case EImageLayout::IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL: return "FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL";
+    }
+
+    PFR_ASSERT(false, "Unknown image layout!");
+    return s_DEFAULT_STRING;
+}
+
+// Where pass ended up after compilation, everything is empty for culled passes.
+struct CompiledPassPlacement
+{
+    Optional<uint32_t> Order        = std::nullopt;  // Position in topologically sorted passes.
+    Optional<uint32_t> Batch        = std::nullopt;
+    Optional<uint32_t> BarrierGroup = std::nullopt;  // Counted across all batches.
+};
+
+static std::vector<CompiledPassPlacement> GetCompiledPassPlacements(const RGCompiledGraph& compiledGraph, const uint32_t passCount)
+{
+    std::vector<CompiledPassPlacement> passPlacements(passCount);
+    for (uint32_t order{}; order < compiledGraph.TopologicallySortedPasses.size(); ++order)
+        passPlacements.at(compiledGraph.TopologicallySortedPasses[order]).Order = order;
+
+    uint32_t barrierGroupCount = 0;
+    for (uint32_t batchIndex{}; batchIndex < compiledGraph.SubmissionBatches.size(); ++batchIndex)
+    {
+        const auto& batch = compiledGraph.SubmissionBatches[batchIndex];
+        for (uint32_t i{}; i < batch.Passes.size(); ++i)
+        {
+            if (std::ranges::find(batch.BarrierGroupStarts, i) != batch.BarrierGroupStarts.end()) ++barrierGroupCount;
+
+            auto& passPlacement        = passPlacements.at(batch.Passes[i]);
+            passPlacement.Batch        = batchIndex;
+            passPlacement.BarrierGroup = barrierGroupCount - 1;
+        }
+    }
+
+    return passPlacements;
+}
+
+using RGResourceLifetimes = std::vector<std::pair<uint32_t, RGResourceLifetime>>;
+
+NODISCARD FORCEINLINE static Optional<RGResourceLifetime> FindLifetime(const RGResourceLifetimes& lifetimes, const uint32_t rootIndex)
+{
+    const auto it = std::ranges::find(lifetimes, rootIndex, &RGResourceLifetimes::value_type::first);
+    return it != lifetimes.end() ? Optional<RGResourceLifetime>{it->second} : std::nullopt;
+}
+
 }  // namespace RGUtils
 
-RenderGraph::RenderGraph(const uint8_t currentFrameIndex, const std::string& name, RenderGraphResourcePool& resourcePool)
-    : m_CurrentFrameIndex(currentFrameIndex), m_Name(name), m_ResourcePool(resourcePool)
+RenderGraph::RenderGraph(const uint8_t currentFrameIndex, const std::string& name, RenderGraphResourcePool& resourcePool,
+                         RenderGraphCache& renderGraphCache)
+    : m_CurrentFrameIndex(currentFrameIndex), m_Name(name), m_ResourcePool(resourcePool), m_RenderGraphCache(renderGraphCache)
 {
 }
 
@@ -61,193 +291,480 @@ void RenderGraph::Build()
 {
     Timer t = {};
 
+    Compile();
+    AliasTransientResources();
+    Renderer::GetStats().RenderGraphCompileStats = m_RenderGraphCache.GetCompileStats();
+    Renderer::GetStats().RenderGraphCullingStats = GetCullingStats();
+
+    // NOTE: Simulated once per compiled graph rather than every frame, timers are matched to passes in a single sweep. Async passes
+    // aren't GPU profiled(timestamps are written on graphics queue only), they're priced at average pass cost.
+    const auto& gpuTimers = Renderer::GetRendererData()->CachedGPUTimers;
+    if (!m_CompiledGraph->ScheduleStats.has_value() && !gpuTimers.empty())
+    {
+        UnorderedMap<std::string_view, uint32_t> passIndices;
+        for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
+            passIndices.emplace(m_Passes[passIndex]->m_Name, passIndex);
+
+        std::vector<Optional<float>> passCosts(m_Passes.size(), std::nullopt);
+        float averagePassCost = 0.f;
+        for (const auto& gpuTimer : gpuTimers)
+        {
+            averagePassCost += static_cast<float>(gpuTimer.GetLength());
+            if (const auto it = passIndices.find(gpuTimer.Tag); it != passIndices.end() && !passCosts[it->second])
+                passCosts[it->second] = static_cast<float>(gpuTimer.GetLength());
+        }
+        averagePassCost /= static_cast<float>(gpuTimers.size());
+
+        m_CompiledGraph->ScheduleStats =
+            SimulateSchedule([&](const uint32_t passIndex) { return passCosts[passIndex].value_or(averagePassCost); });
+    }
+    if (m_CompiledGraph->ScheduleStats) Renderer::GetStats().RenderGraphScheduleStats = m_CompiledGraph->ScheduleStats.value();
+
+    // NOTE: Graph is the same as the one dumped before otherwise.
+    if (m_bRecompiled) DumpCompiledGraph();
+
+#if RG_LOG_DEBUG_INFO
+    LOG_INFO("{} - {:.3f}ms", __FUNCTION__, t.GetElapsedMilliseconds());
+#endif
+}
+
+void RenderGraph::Compile()
+{
+    const uint64_t topologyHash = ComputeTopologyHash();
+    m_CompiledGraph             = m_RenderGraphCache.Find(topologyHash);
+    m_bRecompiled               = m_CompiledGraph == nullptr;
+    if (!m_bRecompiled) return;
+
+    Timer t                       = {};
+    m_CompiledGraph               = MakeShared<RGCompiledGraph>();
+    m_CompiledGraph->TopologyHash = topologyHash;
+
+    ResolveAliasRoots();
+    CullPasses();
     BuildAdjacencyLists();
     TopologicalSort();
-    GraphVizDump();
+    ComputeDependencyLevels();
+    PlanBarriers();
+    ScheduleSubmissions();
+    PlanBarrierGroups();
+    ComputeResourceLifetimes();
+
+    m_RenderGraphCache.Store(m_CompiledGraph, static_cast<float>(t.GetElapsedMilliseconds()));
 
 #if RG_LOG_DEBUG_INFO
-    LOG_INFO("{} - {:.3f}ms", __FUNCTION__, t.GetElapsedMilliseconds());
+    LOG_INFO("{} - recompiled {}(hash: {:016x}), {} dependency levels, {} passes culled, {} submissions, {:.3f}ms", __FUNCTION__, m_Name,
+             topologyHash, m_CompiledGraph->DependencyLevelCount, m_CompiledGraph->CulledPassCount,
+             m_CompiledGraph->SubmissionBatches.size(), t.GetElapsedMilliseconds());
 #endif
 }
 
 void RenderGraph::Execute()
 {
+    PFR_ASSERT(m_CompiledGraph, "RenderGraph isn't compiled!");
+
     auto& rd            = Renderer::GetRendererData();
     m_CurrentFrameIndex = rd->FrameIndex;
 
     PFR_ASSERT(m_CurrentFrameIndex < s_FRAMES_IN_FLIGHT, "Invalid fif index!");
     m_ResourcePool.Tick();
 
-    constexpr auto stringToVec3 = [](const std::string& str)
-    {
-        const auto hashCode = std::hash<std::string>{}(str);
+    Timer t = {};
+    for (auto& usedSecondaryCounts : m_UsedSecondaryCommandBufferCounts)
+        usedSecondaryCounts.fill(0);
 
-        const auto x = static_cast<float>((hashCode & 0xFF0000) >> 16) / 255.0f;
-        const auto y = static_cast<float>((hashCode & 0x00FF00) >> 8) / 255.0f;
-        const auto z = static_cast<float>(hashCode & 0x0000FF) / 255.0f;
+    std::array<uint32_t, RGUtils::s_QUEUE_COUNT> usedCommandBufferCounts = {0};
+    const auto acquireCommandBuffer = [&](const ECommandBufferType queue) -> Shared<CommandBuffer>&
+    {
+        auto& commandBuffers = rd->BatchCommandBuffers.at(static_cast<size_t>(queue)).at(m_CurrentFrameIndex);
+        auto& usedCount      = usedCommandBufferCounts.at(static_cast<size_t>(queue));
+        if (usedCount == commandBuffers.size())
+        {
+            commandBuffers.emplace_back(
+                CommandBuffer::Create({.Type       = queue,
+                                       .Level      = ECommandBufferLevel::COMMAND_BUFFER_LEVEL_PRIMARY,
+                                       .FrameIndex = m_CurrentFrameIndex,
+                                       .ThreadID   = ThreadPool::MapThreadID(ThreadPool::GetMainThreadID())}));
+        }
 
-        return glm::vec3(x, y, z);
+        return commandBuffers.at(usedCount++);
     };
 
-    UnorderedSet<uint32_t> runPasses;
-    for (auto currPassIdx : m_TopologicallySortedPasses)
+    const auto& submissionBatches = m_CompiledGraph->SubmissionBatches;
+    std::vector<Shared<SyncPoint>> batchSyncPoints(submissionBatches.size());
+    RGBarrierStats barrierStats = {};
+    for (uint32_t batchIndex{}; batchIndex < submissionBatches.size(); ++batchIndex)
     {
-        Timer t           = {};
-        auto& currentPass = m_Passes.at(currPassIdx);
+        const auto& batch = submissionBatches[batchIndex];
 
-        Shared<CommandBuffer> cb = nullptr;
-        switch (currentPass->m_Type)
+        // NOTE: Waits happen at all stages, since anything in the batch may consume what other queue produced.
+        std::vector<Shared<SyncPoint>> waitPoints;
+        for (const auto waitBatchIndex : batch.WaitBatches)
         {
-            case ERGPassType::RGPASS_TYPE_GRAPHICS:
-            case ERGPassType::RGPASS_TYPE_TRANSFER:
-            case ERGPassType::RGPASS_TYPE_COMPUTE: cb = rd->RenderCommandBuffer.at(m_CurrentFrameIndex); break;
+            const auto& syncPoint = batchSyncPoints.at(waitBatchIndex);
+            PFR_ASSERT(syncPoint, "Waiting on batch that hasn't been submitted!");
+            waitPoints.emplace_back(SyncPoint::Create(syncPoint->GetTimelineSemaphore(), syncPoint->GetValue(),
+                                                      EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT));
         }
-        PFR_ASSERT(cb, "Command buffer is not valid!");
 
-        rd->CPUProfiler.BeginTimestamp(currentPass->m_Name, stringToVec3(currentPass->m_Name));
-        rd->GPUProfiler.BeginTimestamp(cb, currentPass->m_Name, stringToVec3(currentPass->m_Name));
+        // Pipelines bound in one command buffer don't carry over to another one.
+        rd->LastBoundPipeline.reset();
+        if (batchIndex + 1 == submissionBatches.size())
+        {
+            ExecuteBatch(batch, rd->RenderCommandBuffer.at(m_CurrentFrameIndex), barrierStats);
 
-#if RG_LOG_DEBUG_INFO
-        LOG_INFO("Running {}", currentPass->m_Name);
-#endif
+            m_FinalBatchWaitPoints = std::move(waitPoints);
+            break;
+        }
 
-        runPasses.insert(currPassIdx);
+        auto& cb = acquireCommandBuffer(batch.Queue);
+        cb->BeginRecording(true);
+        RGUtils::BindDescriptors(cb);
 
-        for (auto textureID : currentPass->m_TextureCreates)
-        {
-            PFR_ASSERT(textureID.m_ID.has_value(), "TextureID doesn't have id!");
-            auto& rgTexture   = GetRGTexture(textureID);
-            rgTexture->Handle = m_ResourcePool.AllocateTexture(rgTexture->Description);
-        }
+        ExecuteBatch(batch, cb, barrierStats);
+
+        cb->EndRecording();
+        batchSyncPoints[batchIndex] = cb->Submit(waitPoints);
+    }
+
+    Renderer::GetStats().RenderGraphBarrierStats = barrierStats;
+    Renderer::GetStats().RenderGraphRecordTime   = static_cast<float>(t.GetElapsedMilliseconds());
+}
+
+void RenderGraph::ExecuteBatch(const RGSubmissionBatch& batch, Shared<CommandBuffer>& cb, RGBarrierStats& barrierStats)
+{
+    for (uint32_t groupIndex{}; groupIndex < batch.BarrierGroupStarts.size(); ++groupIndex)
+    {
+        const uint32_t groupStart = batch.BarrierGroupStarts[groupIndex];
+        const uint32_t groupEnd   = groupIndex + 1 < batch.BarrierGroupStarts.size() ? batch.BarrierGroupStarts[groupIndex + 1]
+                                                                                     : static_cast<uint32_t>(batch.Passes.size());
 
-        for (auto bufferID : currentPass->m_BufferCreates)
+        // NOTE: Resources have to exist before barriers of the group get resolved.
+        bool bAliasedBufferCreated = false;
+        for (uint32_t i{groupStart}; i < groupEnd; ++i)
+            bAliasedBufferCreated |= PreparePassResources(batch.Passes[i]);
+
+        std::vector<MemoryBarrier> memoryBarriers;
+        if (bAliasedBufferCreated)
         {
-            PFR_ASSERT(bufferID.m_ID.has_value(), "BufferID doesn't have id!");
-            auto& rgBuffer   = GetRGBuffer(bufferID);
-            rgBuffer->Handle = m_ResourcePool.AllocateBuffer(rgBuffer->Description);
+            // NOTE: Aliasing barrier, previous occupant of the memory should finish before we start using it. One global barrier covers
+            // all buffers.
+            memoryBarriers.emplace_back(
+                MemoryBarrier{.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                              .srcAccessMask = EAccessFlags::ACCESS_MEMORY_WRITE_BIT,
+                              .dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                              .dstAccessMask = EAccessFlags::ACCESS_MEMORY_READ_BIT | EAccessFlags::ACCESS_MEMORY_WRITE_BIT});
         }
 
         std::vector<BufferMemoryBarrier> bufferMemoryBarriers;
+        std::vector<ImageMemoryBarrier> imageMemoryBarriers;
+        for (uint32_t i{groupStart}; i < groupEnd; ++i)
+        {
+            const size_t prevBarrierCount = bufferMemoryBarriers.size() + imageMemoryBarriers.size();
+            ResolveBarriers(batch.Passes[i], bufferMemoryBarriers, imageMemoryBarriers);
+
+            const size_t passBarrierCount = bufferMemoryBarriers.size() + imageMemoryBarriers.size() - prevBarrierCount;
+            barrierStats.BarrierCount += static_cast<uint32_t>(passBarrierCount);
+            if (passBarrierCount != 0) ++barrierStats.BarrierCallCount;
+        }
+        barrierStats.BarrierCount += static_cast<uint32_t>(memoryBarriers.size());
 
-        const auto bufferRAWBarriers = BuildBufferRAWBarriers(currentPass, runPasses);
-        bufferMemoryBarriers.insert(bufferMemoryBarriers.end(), bufferRAWBarriers.begin(), bufferRAWBarriers.end());
+        RGUtils::MergeBarriers(bufferMemoryBarriers, imageMemoryBarriers);
+        if (!memoryBarriers.empty() || !bufferMemoryBarriers.empty() || !imageMemoryBarriers.empty())
+        {
+            cb->InsertBarriers(memoryBarriers, bufferMemoryBarriers, imageMemoryBarriers);
+            barrierStats.MergedBarrierCount +=
+                static_cast<uint32_t>(memoryBarriers.size() + bufferMemoryBarriers.size() + imageMemoryBarriers.size());
+            ++barrierStats.MergedBarrierCallCount;
+        }
 
-        const auto bufferWARBarriers = BuildBufferWARBarriers(currentPass, runPasses);
-        bufferMemoryBarriers.insert(bufferMemoryBarriers.end(), bufferWARBarriers.begin(), bufferWARBarriers.end());
+        const uint32_t groupSize = groupEnd - groupStart;
+        if (Renderer::GetRendererSettings().bParallelPassRecording && groupSize > 1)
+        {
+            // NOTE: Passes of a group don't depend on each other, so they're recorded concurrently, primary keeps their order.
+            std::vector<Shared<CommandBuffer>> secondaryCommandBuffers(groupSize);
+            ThreadPool::ParallelFor(groupSize, 1, [&](const uint32_t i)
+                                    { secondaryCommandBuffers[i] = RecordPassSecondary(batch.Passes[groupStart + i], batch.Queue); });
+
+            for (uint32_t i{}; i < groupSize; ++i)
+                ExecutePassSecondary(batch.Passes[groupStart + i], cb, secondaryCommandBuffers[i]);
+            Renderer::GetStats().SecondaryCommandBufferCount += groupSize;
+
+            // NOTE: vkCmdExecuteCommands leaves primary's bound pipeline and descriptor sets undefined, next passes start from scratch.
+            Renderer::GetRendererData()->LastBoundPipeline.reset();
+            RGUtils::BindDescriptors(cb);
+        }
+        else
+        {
+            for (uint32_t i{groupStart}; i < groupEnd; ++i)
+                ExecutePass(batch.Passes[i], cb);
+        }
 
-        const auto bufferWAWBarriers = BuildBufferWAWBarriers(currentPass, runPasses);
-        bufferMemoryBarriers.insert(bufferMemoryBarriers.end(), bufferWAWBarriers.begin(), bufferWAWBarriers.end());
+        // Images handed over to another queue are released once the whole group is done, it's submitted at once anyway.
+        std::vector<ImageMemoryBarrier> releaseImageBarriers;
+        for (uint32_t i{groupStart}; i < groupEnd; ++i)
+        {
+            const size_t prevBarrierCount = releaseImageBarriers.size();
+            ResolveReleaseBarriers(batch.Passes[i], releaseImageBarriers);
 
-        std::vector<ImageMemoryBarrier> imageMemoryBarriers;
+            barrierStats.BarrierCount += static_cast<uint32_t>(releaseImageBarriers.size() - prevBarrierCount);
+            if (releaseImageBarriers.size() != prevBarrierCount) ++barrierStats.BarrierCallCount;
+        }
 
-        const auto textureRAWBarriers = BuildTextureRAWBarriers(currentPass, runPasses);
-        imageMemoryBarriers.insert(imageMemoryBarriers.end(), textureRAWBarriers.begin(), textureRAWBarriers.end());
+        if (!releaseImageBarriers.empty())
+        {
+            cb->InsertBarriers({}, {}, releaseImageBarriers);
+            barrierStats.MergedBarrierCount += static_cast<uint32_t>(releaseImageBarriers.size());
+            ++barrierStats.MergedBarrierCallCount;
+        }
+    }
+}
 
-        const auto textureWARBarriers = BuildTextureWARBarriers(currentPass, runPasses);
-        imageMemoryBarriers.insert(imageMemoryBarriers.end(), textureWARBarriers.begin(), textureWARBarriers.end());
+bool RenderGraph::PreparePassResources(const uint32_t passIndex)
+{
+    const auto& currentPass = m_Passes.at(passIndex);
+    for (auto textureID : currentPass->m_TextureCreates)
+    {
+        PFR_ASSERT(textureID.m_ID.has_value(), "TextureID doesn't have id!");
+        auto& rgTexture   = GetRGTexture(textureID);
+        rgTexture->Handle = m_ResourcePool.AllocateTexture(rgTexture->Name, rgTexture->Description);
+    }
 
-        const auto textureWAWBarriers = BuildTextureWAWBarriers(currentPass, runPasses);
-        imageMemoryBarriers.insert(imageMemoryBarriers.end(), textureWAWBarriers.begin(), textureWAWBarriers.end());
+    bool bAliasedBufferCreated = false;
+    for (auto bufferID : currentPass->m_BufferCreates)
+    {
+        PFR_ASSERT(bufferID.m_ID.has_value(), "BufferID doesn't have id!");
+        auto& rgBuffer = GetRGBuffer(bufferID);
+        // Imported buffers have one.
+        if (!rgBuffer->Handle) rgBuffer->Handle = m_ResourcePool.AllocateBuffer(rgBuffer->Name, rgBuffer->Description);
+        if (rgBuffer->Handle->GetSpecification().AliasingInfo.Memory) bAliasedBufferCreated = true;
+    }
 
-        cb->BeginDebugLabel(currentPass->m_Name.data(), stringToVec3(currentPass->m_Name));
-        if (!bufferMemoryBarriers.empty() || !imageMemoryBarriers.empty())
-            cb->InsertBarriers({}, bufferMemoryBarriers, imageMemoryBarriers);
+    // NOTE: Aliases share physical resource with their source, which has been allocated by one of the previous passes.
+    for (const auto& textureIDs : {std::cref(currentPass->m_TextureReads), std::cref(currentPass->m_TextureWrites)})
+    {
+        for (const auto textureID : textureIDs.get())
+        {
+            auto& rgTexture = GetRGTexture(textureID);
+            if (!rgTexture->Handle) rgTexture->Handle = m_Textures.at(m_CompiledGraph->TextureRoots.at(textureID.m_ID.value()))->Handle;
+        }
+    }
 
-        if (currentPass->m_Type == ERGPassType::RGPASS_TYPE_GRAPHICS &&
-            (!currentPass->m_RenderTargetsInfo.empty() || currentPass->m_DepthStencil.has_value()))
+    for (const auto& bufferIDs : {std::cref(currentPass->m_BufferReads), std::cref(currentPass->m_BufferWrites)})
+    {
+        for (const auto bufferID : bufferIDs.get())
         {
-            PFR_ASSERT(currentPass->m_ViewportScissorInfo.has_value(), "RenderPass viewport size is invalid!");
+            auto& rgBuffer = GetRGBuffer(bufferID);
+            if (!rgBuffer->Handle) rgBuffer->Handle = m_Buffers.at(m_CompiledGraph->BufferRoots.at(bufferID.m_ID.value()))->Handle;
+        }
+    }
 
-            std::vector<Shared<Texture>> attachments;
-            std::vector<RenderingInfo> renderingInfos;
-            for (auto& renderTargetInfo : currentPass->m_RenderTargetsInfo)
-            {
-                attachments.emplace_back(GetRGTexture(renderTargetInfo.RenderTargetHandle)->Handle);
-                auto& renderingInfo =
-                    renderingInfos.emplace_back(renderTargetInfo.ClearValue, renderTargetInfo.LoadOp, renderTargetInfo.StoreOp);
-            }
+    return bAliasedBufferCreated;
+}
 
-            if (currentPass->m_DepthStencil.has_value())
-            {
-                auto& depthStencilInfo = currentPass->m_DepthStencil.value();
-                attachments.emplace_back(GetRGTexture(depthStencilInfo.DepthStencilHandle)->Handle);
+void RenderGraph::ExecutePass(const uint32_t passIndex, Shared<CommandBuffer>& cb)
+{
+    auto& rd                    = Renderer::GetRendererData();
+    const bool bGraphicsQueue   = m_CompiledGraph->PassQueues.at(passIndex) == ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL;
+    auto& currentPass           = m_Passes.at(passIndex);
+    const glm::vec3 markerColor = RGUtils::StringToVec3(currentPass->m_Name);
 
-                // TODO: Stencil
-                renderingInfos.emplace_back(depthStencilInfo.ClearValue, depthStencilInfo.DepthLoadOp, depthStencilInfo.DepthStoreOp);
-            }
+    Timer t = {};
+    rd->CPUProfiler.BeginTimestamp(currentPass->m_Name, markerColor);
+    if (bGraphicsQueue) rd->GPUProfiler.BeginTimestamp(cb, currentPass->m_Name, markerColor);
+
+#if RG_LOG_DEBUG_INFO
+    LOG_INFO("Running {}", currentPass->m_Name);
+#endif
 
-            cb->BeginRendering(attachments, renderingInfos);
+    cb->BeginDebugLabel(currentPass->m_Name.data(), markerColor);
 
-            auto& vs = currentPass->m_ViewportScissorInfo.value();
-            cb->SetViewportAndScissor(vs.Width, vs.Height, vs.OffsetX, vs.OffsetY);
-        }
+    const bool bRenderPass = IsRenderPass(passIndex);
+    if (bRenderPass)
+    {
+        BeginPassRendering(passIndex, cb, false);
+
+        auto& vs = currentPass->m_ViewportScissorInfo.value();
+        cb->SetViewportAndScissor(vs.Width, vs.Height, vs.OffsetX, vs.OffsetY);
+    }
+
+    RenderGraphContext context(*this, *currentPass);
+    currentPass->Execute(context, cb);
+
+    if (bRenderPass) cb->EndRendering();
+
+    cb->EndDebugLabel();
+    // LOG_DEBUG("Pass - {}, taken {:.3f}ms CPU time.", currentPass->m_Name, t.GetElapsedMilliseconds());
+
+    if (bGraphicsQueue) rd->GPUProfiler.EndTimestamp(cb);
+    rd->CPUProfiler.EndTimestamp();
+}
+
+bool RenderGraph::IsRenderPass(const uint32_t passIndex) const
+{
+    const auto& pass = m_Passes.at(passIndex);
+    return pass->m_Type == ERGPassType::RGPASS_TYPE_GRAPHICS && (!pass->m_RenderTargetsInfo.empty() || pass->m_DepthStencil.has_value());
+}
+
+void RenderGraph::BeginPassRendering(const uint32_t passIndex, Shared<CommandBuffer>& cb, const bool bSecondaryContents)
+{
+    auto& currentPass = m_Passes.at(passIndex);
+    PFR_ASSERT(currentPass->m_ViewportScissorInfo.has_value(), "RenderPass viewport size is invalid!");
 
-        RenderGraphContext context(*this, *currentPass);
-        currentPass->Execute(context, cb);
+    std::vector<Shared<Texture>> attachments;
+    std::vector<RenderingInfo> renderingInfos;
+    for (auto& renderTargetInfo : currentPass->m_RenderTargetsInfo)
+    {
+        attachments.emplace_back(GetRGTexture(renderTargetInfo.RenderTargetHandle)->Handle);
+        renderingInfos.emplace_back(renderTargetInfo.ClearValue, renderTargetInfo.LoadOp, renderTargetInfo.StoreOp);
+    }
+
+    if (currentPass->m_DepthStencil.has_value())
+    {
+        auto& depthStencilInfo = currentPass->m_DepthStencil.value();
+        attachments.emplace_back(GetRGTexture(depthStencilInfo.DepthStencilHandle)->Handle);
+
+        // TODO: Stencil
+        renderingInfos.emplace_back(depthStencilInfo.ClearValue, depthStencilInfo.DepthLoadOp, depthStencilInfo.DepthStoreOp);
+    }
+
+    cb->BeginRendering(attachments, renderingInfos, bSecondaryContents);
+}
 
-        if (currentPass->m_Type == ERGPassType::RGPASS_TYPE_GRAPHICS &&
-            (!currentPass->m_RenderTargetsInfo.empty() || currentPass->m_DepthStencil.has_value()))
-            cb->EndRendering();
+Shared<CommandBuffer> RenderGraph::RecordPassSecondary(const uint32_t passIndex, const ECommandBufferType queue)
+{
+    auto& rd                    = Renderer::GetRendererData();
+    auto& currentPass           = m_Passes.at(passIndex);
+    const glm::vec3 markerColor = RGUtils::StringToVec3(currentPass->m_Name);
+    rd->CPUProfiler.BeginTimestamp(currentPass->m_Name, markerColor);
+
+    // NOTE: Command pools are per thread, so command buffer is picked by the thread recording it.
+    const uint8_t threadIndex = ThreadPool::GetThreadIndex();
+    auto& commandBuffers      = rd->SecondaryCommandBuffers.at(static_cast<size_t>(queue)).at(m_CurrentFrameIndex).at(threadIndex);
+    auto& usedCount           = m_UsedSecondaryCommandBufferCounts.at(static_cast<size_t>(queue)).at(threadIndex);
+    if (usedCount == commandBuffers.size())
+    {
+        commandBuffers.emplace_back(CommandBuffer::Create({.Type       = queue,
+                                                           .Level      = ECommandBufferLevel::COMMAND_BUFFER_LEVEL_SECONDARY,
+                                                           .FrameIndex = m_CurrentFrameIndex,
+                                                           .ThreadID   = threadIndex}));
+    }
+    auto cb = commandBuffers.at(usedCount++);
+
+    // Rendering itself is begun by primary, secondary continues it with the same attachment formats.
+    const bool bRenderPass = IsRenderPass(passIndex);
+    Optional<RenderingInheritanceInfo> renderingInheritanceInfo = std::nullopt;
+    if (bRenderPass)
+    {
+        renderingInheritanceInfo = MakeOptional<RenderingInheritanceInfo>();
+        for (const auto& renderTargetInfo : currentPass->m_RenderTargetsInfo)
+        {
+            const auto& texture = GetRGTexture(renderTargetInfo.RenderTargetHandle)->Handle;
+            renderingInheritanceInfo->ColorFormats.emplace_back(texture->GetSpecification().Format);
+        }
 
-        cb->EndDebugLabel();
-        // LOG_DEBUG("Pass - {}, taken {:.3f}ms CPU time.", currentPass->m_Name, t.GetElapsedMilliseconds());
+        if (currentPass->m_DepthStencil.has_value())
+        {
+            const auto& texture                   = GetRGTexture(currentPass->m_DepthStencil->DepthStencilHandle)->Handle;
+            renderingInheritanceInfo->DepthFormat = texture->GetSpecification().Format;
+        }
+    }
 
-        rd->GPUProfiler.EndTimestamp(cb);
-        rd->CPUProfiler.EndTimestamp();
+    cb->BeginSecondaryRecording(renderingInheritanceInfo);
+    RGUtils::BindDescriptors(cb);
+    if (bRenderPass)
+    {
+        auto& vs = currentPass->m_ViewportScissorInfo.value();
+        cb->SetViewportAndScissor(vs.Width, vs.Height, vs.OffsetX, vs.OffsetY);
     }
+
+    RenderGraphContext context(*this, *currentPass);
+    currentPass->Execute(context, cb);
+    cb->EndRecording();
+
+    rd->CPUProfiler.EndTimestamp();
+    return cb;
+}
+
+void RenderGraph::ExecutePassSecondary(const uint32_t passIndex, Shared<CommandBuffer>& cb,
+                                       const Shared<CommandBuffer>& secondaryCommandBuffer)
+{
+    auto& rd                    = Renderer::GetRendererData();
+    const bool bGraphicsQueue   = m_CompiledGraph->PassQueues.at(passIndex) == ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL;
+    auto& currentPass           = m_Passes.at(passIndex);
+    const glm::vec3 markerColor = RGUtils::StringToVec3(currentPass->m_Name);
+
+    if (bGraphicsQueue) rd->GPUProfiler.BeginTimestamp(cb, currentPass->m_Name, markerColor);
+    cb->BeginDebugLabel(currentPass->m_Name.data(), markerColor);
+
+    const bool bRenderPass = IsRenderPass(passIndex);
+    if (bRenderPass) BeginPassRendering(passIndex, cb, true);
+    cb->ExecuteSecondaries({secondaryCommandBuffer});
+    if (bRenderPass) cb->EndRendering();
+
+    cb->EndDebugLabel();
+    if (bGraphicsQueue) rd->GPUProfiler.EndTimestamp(cb);
 }
 
-RGTextureID RenderGraph::DeclareTexture(const std::string& name, const RGTextureSpecification& rgTextureSpec)
+RGTextureID RenderGraph::DeclareTexture(const RGResourceName& name, const RGTextureSpecification& rgTextureSpec)
 {
-    PFR_ASSERT(m_TextureNameIDMap.find(name) == m_TextureNameIDMap.end(), "Texture with that name has already been declared");
+    PFR_ASSERT(name.IsValid(), "Invalid texture name!");
+    if (name.GetID() >= m_TextureNameIDs.size()) m_TextureNameIDs.resize(RGResourceName::GetInternedCount());
+    PFR_ASSERT(!m_TextureNameIDs[name.GetID()].IsValid(), "Texture with that name has already been declared");
+
     m_Textures.emplace_back(MakeUnique<RGTexture>(m_Textures.size(), rgTextureSpec, name));
 
     const RGTextureID textureID{m_Textures.size() - 1};
-    m_TextureNameIDMap[name] = textureID;
+    m_TextureNameIDs[name.GetID()] = textureID;
     return textureID;
 }
 
-RGBufferID RenderGraph::DeclareBuffer(const std::string& name, const RGBufferSpecification& rgBufferSpec)
+RGBufferID RenderGraph::DeclareBuffer(const RGResourceName& name, const RGBufferSpecification& rgBufferSpec)
 {
-    PFR_ASSERT(m_BufferNameIDMap.find(name) == m_BufferNameIDMap.end(), "Buffer with that name has already been declared");
+    PFR_ASSERT(name.IsValid(), "Invalid buffer name!");
+    if (name.GetID() >= m_BufferNameIDs.size()) m_BufferNameIDs.resize(RGResourceName::GetInternedCount());
+    PFR_ASSERT(!m_BufferNameIDs[name.GetID()].IsValid(), "Buffer with that name has already been declared");
+
     m_Buffers.emplace_back(MakeUnique<RGBuffer>(m_Buffers.size(), rgBufferSpec, name));
 
     const RGBufferID bufferID{m_Buffers.size() - 1};
-    m_BufferNameIDMap[name] = bufferID;
+    m_BufferNameIDs[name.GetID()] = bufferID;
     return bufferID;
 }
 
-RGTextureID RenderGraph::AliasTexture(const std::string& name, const std::string& source)
+RGBufferID RenderGraph::ImportBuffer(const RGResourceName& name, const Shared<Buffer>& buffer)
 {
-    PFR_ASSERT(!m_AliasMap.contains(name), "Alias with this name to source texture already contains!");
-    PFR_ASSERT(m_TextureNameIDMap.find(source) != m_TextureNameIDMap.end(), "Texture with source name isn't declared");
-
-    const auto& srcRGTexture = m_Textures.at(m_TextureNameIDMap.at(source).m_ID.value());
-    m_AliasMap[name]         = source;
+    PFR_ASSERT(buffer, "Imported buffer is invalid!");
+
+    const auto& bufferSpec = buffer->GetSpecification();
+    const auto bufferID    = DeclareBuffer(name, {.DebugName  = bufferSpec.DebugName,
+                                                  .ExtraFlags = bufferSpec.ExtraFlags,
+                                                  .UsageFlags = bufferSpec.UsageFlags,
+                                                  .Capacity   = bufferSpec.Capacity});
+    auto& rgBuffer      = GetRGBuffer(bufferID);
+    rgBuffer->Handle    = buffer;
+    rgBuffer->bImported = true;
+    return bufferID;
+}
 
-    auto newDesc      = srcRGTexture->Description;
-    newDesc.DebugName = name;
-    m_Textures.emplace_back(MakeUnique<RGTexture>(m_Textures.size(), newDesc, name));
+RGTextureID RenderGraph::AliasTexture(const RGResourceName& name, const RGResourceName& source)
+{
+    const auto sourceTextureID = GetTextureID(source);
+    auto newDesc               = m_Textures.at(sourceTextureID.m_ID.value())->Description;
+    newDesc.DebugName          = name.GetString();
 
-    const RGTextureID textureID{m_Textures.size() - 1};
-    m_TextureNameIDMap[name] = textureID;
+    const auto textureID                               = DeclareTexture(name, newDesc);
+    m_Textures.at(textureID.m_ID.value())->AliasSource = sourceTextureID.m_ID.value();
     return textureID;
 }
 
-RGBufferID RenderGraph::AliasBuffer(const std::string& name, const std::string& source)
+RGBufferID RenderGraph::AliasBuffer(const RGResourceName& name, const RGResourceName& source)
 {
-    PFR_ASSERT(!m_AliasMap.contains(name), "Alias with this name to source buffer already contains!");
-    PFR_ASSERT(m_BufferNameIDMap.find(source) != m_BufferNameIDMap.end(), "Texture with source name isn't declared");
-
-    const auto& srcRGBuffer = m_Buffers.at(m_BufferNameIDMap.at(source).m_ID.value());
-    m_AliasMap[name]        = source;
-
-    auto newDesc      = srcRGBuffer->Description;
-    newDesc.DebugName = name;
-    m_Buffers.emplace_back(MakeUnique<RGBuffer>(m_Buffers.size(), newDesc, name));
+    const auto sourceBufferID = GetBufferID(source);
+    auto newDesc              = m_Buffers.at(sourceBufferID.m_ID.value())->Description;
+    newDesc.DebugName         = name.GetString();
 
-    const RGBufferID bufferID{m_Buffers.size() - 1};
-    m_BufferNameIDMap[name] = bufferID;
+    const auto bufferID                              = DeclareBuffer(name, newDesc);
+    m_Buffers.at(bufferID.m_ID.value())->AliasSource = sourceBufferID.m_ID.value();
     return bufferID;
 }
 
@@ -271,105 +788,345 @@ NODISCARD Shared<Buffer>& RenderGraph::GetBuffer(const RGBufferID resourceID)
     return GetRGBuffer(resourceID)->Handle;
 }
 
+uint64_t RenderGraph::ComputeTopologyHash() const
+{
+    uint64_t topologyHash = 0;
+    const auto hashResourceIDs = [&topologyHash](const auto& resourceIDs)
+    {
+        RGUtils::HashCombine(topologyHash, resourceIDs.size());
+        for (const auto resourceID : resourceIDs)
+            RGUtils::HashCombine(topologyHash, resourceID.m_ID.value());
+    };
+
+    const auto hashResourceStates = [&topologyHash](const auto& resourceStateMap)
+    {
+        RGUtils::HashCombine(topologyHash, resourceStateMap.size());
+        for (const auto& [resourceID, resourceState] : resourceStateMap)
+            RGUtils::HashCombine(topologyHash, static_cast<uint64_t>(resourceID.m_ID.value()) << 32 | resourceState);
+    };
+
+    // NOTE: Insertion order of passes that use the resource decides which one gets synced with, so it's hashed as well.
+    const auto hashResource = [&topologyHash](const RGResource& resource)
+    {
+        RGUtils::HashCombine(topologyHash, resource.Name.GetID());  // Interned once per process, so IDs are stable across frames.
+        RGUtils::HashCombine(topologyHash, static_cast<uint64_t>(resource.bImported));
+        RGUtils::HashCombine(topologyHash, resource.AliasSource.has_value() ? resource.AliasSource.value() + 1ull : 0ull);
+        for (const auto& passes : {std::cref(resource.ReadPasses), std::cref(resource.WritePasses)})
+        {
+            RGUtils::HashCombine(topologyHash, passes.get().size());
+            for (const auto passIndex : passes.get())
+                RGUtils::HashCombine(topologyHash, passIndex);
+        }
+    };
+
+    RGUtils::HashCombine(topologyHash, m_Passes.size());
+    for (const auto& pass : m_Passes)
+    {
+        RGUtils::HashCombine(topologyHash, pass->m_NameID.GetID());
+        RGUtils::HashCombine(topologyHash, static_cast<uint64_t>(pass->m_Type));
+        RGUtils::HashCombine(topologyHash, static_cast<uint64_t>(pass->m_bHasSideEffects));
+
+        hashResourceIDs(pass->m_TextureCreates);
+        hashResourceIDs(pass->m_TextureReads);
+        hashResourceIDs(pass->m_TextureWrites);
+        hashResourceStates(pass->m_TextureStateMap);
+
+        hashResourceIDs(pass->m_BufferCreates);
+        hashResourceIDs(pass->m_BufferReads);
+        hashResourceIDs(pass->m_BufferWrites);
+        hashResourceStates(pass->m_BufferStateMap);
+    }
+
+    // Sizes aren't part of topology, transient placement is refreshed from current specs every frame.
+    RGUtils::HashCombine(topologyHash, m_Textures.size());
+    for (const auto& texture : m_Textures)
+    {
+        hashResource(*texture);
+        RGUtils::HashCombine(topologyHash, static_cast<uint64_t>(texture->Description.bTransient));
+    }
+
+    RGUtils::HashCombine(topologyHash, m_Buffers.size());
+    for (const auto& buffer : m_Buffers)
+    {
+        hashResource(*buffer);
+        RGUtils::HashCombine(topologyHash, static_cast<uint64_t>(buffer->Description.bTransient));
+    }
+
+    return topologyHash;
+}
+
 void RenderGraph::BuildAdjacencyLists()
 {
-    m_AdjdacencyLists.resize(m_Passes.size());
+    const auto& culledPasses = m_CompiledGraph->CulledPasses;
+    auto& adjacencyLists     = m_CompiledGraph->AdjacencyLists;
+    adjacencyLists.resize(m_Passes.size());
     for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
     {
+        if (culledPasses.at(passIndex)) continue;
+
         const auto& pass        = m_Passes.at(passIndex);
-        auto& passAdjacencyList = m_AdjdacencyLists.at(passIndex);
+        auto& passAdjacencyList = adjacencyLists.at(passIndex);
 
         for (uint32_t otherPassIndex{}; otherPassIndex < m_Passes.size(); ++otherPassIndex)
         {
             const auto& otherPass = m_Passes.at(otherPassIndex);
-            if (otherPass->m_Name == pass->m_Name) continue;
-
-            bool bDepends = false;
-            for (const auto otherPassInput : otherPass->m_TextureReads)
-            {
-                if (pass->m_TextureWrites.find(otherPassInput) == pass->m_TextureWrites.end()) continue;
-
-                passAdjacencyList.emplace_back(otherPassIndex);
-                bDepends = true;
-                break;
-            }
-
-            if (bDepends) continue;
-            for (const auto otherPassInput : otherPass->m_BufferReads)
-            {
-                if (pass->m_BufferWrites.find(otherPassInput) == pass->m_BufferWrites.end()) continue;
+            if (culledPasses.at(otherPassIndex) || otherPass->m_Name == pass->m_Name) continue;
 
+            if (otherPass->m_TextureReads.Intersects(pass->m_TextureWrites) || otherPass->m_BufferReads.Intersects(pass->m_BufferWrites))
                 passAdjacencyList.emplace_back(otherPassIndex);
-                break;
-            }
         }
     }
 }
 
 void RenderGraph::TopologicalSort()
 {
-    PFR_ASSERT(!m_Passes.empty() && !m_AdjdacencyLists.empty(), "RenderGraph is invalid!");
+    auto& topologicallySortedPasses = m_CompiledGraph->TopologicallySortedPasses;
+    PFR_ASSERT(!m_Passes.empty() && !m_CompiledGraph->AdjacencyLists.empty(), "RenderGraph is invalid!");
 
     std::vector<uint8_t> visitedPasses(m_Passes.size(), 0);  // Not visited.
     for (uint32_t passIndex{}; passIndex < visitedPasses.size(); ++passIndex)
     {
-        if (visitedPasses.at(passIndex) == 0)
-            RGUtils::DepthFirstSearch(passIndex, visitedPasses, m_TopologicallySortedPasses, m_AdjdacencyLists);
+        if (visitedPasses.at(passIndex) == 0 && !m_CompiledGraph->CulledPasses.at(passIndex))
+            RGUtils::DepthFirstSearch(passIndex, visitedPasses, topologicallySortedPasses, m_CompiledGraph->AdjacencyLists);
     }
-    std::ranges::reverse(m_TopologicallySortedPasses);
+    std::ranges::reverse(topologicallySortedPasses);
 
 #if RG_LOG_TOPSORT_RESULT
     LOG_INFO("After TopologicalSort:");
-    for (const auto passIdx : m_TopologicallySortedPasses)
+    for (const auto passIdx : topologicallySortedPasses)
     {
         LOG_INFO("Pass - {}", m_Passes.at(passIdx)->m_Name);
     }
 #endif
 }
 
-std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferRAWBarriers(const Unique<RGPassBase>& currentPass,
-                                                                     const UnorderedSet<uint32_t>& runPasses)
+void RenderGraph::ComputeDependencyLevels()
 {
-    std::vector<BufferMemoryBarrier> bufferMemoryBarriers;
+    auto& dependencyLevels = m_CompiledGraph->DependencyLevels;
+    dependencyLevels.assign(m_Passes.size(), 0);
 
-#if RG_LOG_DEBUG_INFO
-    LOG_INFO("\t{}:", __FUNCTION__);
-#endif
-    for (const auto resourceID : currentPass->m_BufferReads)
+    // Predecessors always come first in topological order, so a single pass over it is enough.
+    for (const auto passIndex : m_CompiledGraph->TopologicallySortedPasses)
     {
-        auto& buffer = m_Buffers.at(resourceID.m_ID.value());
-        if (!buffer->Handle)  // Means it's alias
-        {
-            const auto sourceBufferID = GetBufferID(m_AliasMap[buffer->Name]);
-            buffer->Handle            = m_Buffers.at(sourceBufferID.m_ID.value())->Handle;
-        }
+        for (const auto otherPassIndex : m_CompiledGraph->AdjacencyLists.at(passIndex))
+            dependencyLevels[otherPassIndex] = std::max(dependencyLevels[otherPassIndex], dependencyLevels[passIndex] + 1);
+    }
 
-        if (buffer->Handle->GetSpecification().Capacity == 0) continue;
+    m_CompiledGraph->DependencyLevelCount = dependencyLevels.empty() ? 0 : *std::ranges::max_element(dependencyLevels) + 1;
+}
 
-        // TODO: Maybe insert AlreadySyncedWith in the end?
-        Optional<uint32_t> prevPassIdx = std::nullopt;
-        for (const auto writePassIdx : buffer->WritePasses)
+void RenderGraph::ResolveAliasRoots()
+{
+    // NOTE: Alias is always declared after its source, so source root is already resolved.
+    auto& textureRoots = m_CompiledGraph->TextureRoots;
+    textureRoots.resize(m_Textures.size());
+    for (uint32_t textureIndex{}; textureIndex < m_Textures.size(); ++textureIndex)
+    {
+        const auto& aliasSource    = m_Textures[textureIndex]->AliasSource;
+        textureRoots[textureIndex] = aliasSource.has_value() ? textureRoots.at(aliasSource.value()) : textureIndex;
+    }
+
+    auto& bufferRoots = m_CompiledGraph->BufferRoots;
+    bufferRoots.resize(m_Buffers.size());
+    for (uint32_t bufferIndex{}; bufferIndex < m_Buffers.size(); ++bufferIndex)
+    {
+        const auto& aliasSource  = m_Buffers[bufferIndex]->AliasSource;
+        bufferRoots[bufferIndex] = aliasSource.has_value() ? bufferRoots.at(aliasSource.value()) : bufferIndex;
+    }
+}
+
+void RenderGraph::CullPasses()
+{
+    // NOTE: Pass is referenced by resources it produces(writes or declares), resource by passes consuming it. Unreferenced resources
+    // release their producers, passes losing all references get culled and release resources they consume, and so on.
+    std::vector<uint32_t> passRefCounts(m_Passes.size(), 0);
+    std::vector<uint32_t> textureRefCounts(m_Textures.size(), 0);
+    std::vector<uint32_t> bufferRefCounts(m_Buffers.size(), 0);
+    std::vector<std::vector<uint32_t>> textureProducers(m_Textures.size());
+    std::vector<std::vector<uint32_t>> bufferProducers(m_Buffers.size());
+
+    const auto producesTexture = [&](const uint32_t passIndex, const RGTextureID textureID)
+    { return m_Passes.at(passIndex)->m_TextureWrites.contains(textureID) || m_Passes.at(passIndex)->m_TextureCreates.contains(textureID); };
+    const auto producesBuffer = [&](const uint32_t passIndex, const RGBufferID bufferID)
+    { return m_Passes.at(passIndex)->m_BufferWrites.contains(bufferID) || m_Passes.at(passIndex)->m_BufferCreates.contains(bufferID); };
+
+    for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
+    {
+        const auto& pass = m_Passes.at(passIndex);
+        for (const auto& textureIDs : {std::cref(pass->m_TextureWrites), std::cref(pass->m_TextureCreates)})
+        {
+            for (const auto textureID : textureIDs.get())
+            {
+                auto& producers = textureProducers.at(textureID.m_ID.value());
+                if (!producers.empty() && producers.back() == passIndex) continue;  // Declared and written by the same pass.
+
+                producers.emplace_back(passIndex);
+                ++passRefCounts[passIndex];
+            }
+        }
+
+        for (const auto& bufferIDs : {std::cref(pass->m_BufferWrites), std::cref(pass->m_BufferCreates)})
+        {
+            for (const auto bufferID : bufferIDs.get())
+            {
+                auto& producers = bufferProducers.at(bufferID.m_ID.value());
+                if (!producers.empty() && producers.back() == passIndex) continue;
+
+                producers.emplace_back(passIndex);
+                ++passRefCounts[passIndex];
+            }
+        }
+
+        // Pass reading what it produces itself(scratch buffers) shouldn't keep itself alive.
+        for (const auto textureID : pass->m_TextureReads)
+            if (!producesTexture(passIndex, textureID)) ++textureRefCounts[textureID.m_ID.value()];
+
+        for (const auto bufferID : pass->m_BufferReads)
+            if (!producesBuffer(passIndex, bufferID)) ++bufferRefCounts[bufferID.m_ID.value()];
+
+        if (pass->m_bHasSideEffects) ++passRefCounts[passIndex];
+    }
+
+    // Writes into imported memory outlive the frame, so they're consumed no matter what.
+    for (uint32_t bufferIndex{}; bufferIndex < m_Buffers.size(); ++bufferIndex)
+        if (m_Buffers.at(m_CompiledGraph->BufferRoots.at(bufferIndex))->bImported) ++bufferRefCounts[bufferIndex];
+
+    auto& culledPasses = m_CompiledGraph->CulledPasses;
+    culledPasses.assign(m_Passes.size(), 0);
+
+    std::vector<uint32_t> passesToCull;
+    for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
+        if (passRefCounts[passIndex] == 0) passesToCull.emplace_back(passIndex);
+
+    const auto releaseProducers = [&](const std::vector<uint32_t>& producers)
+    {
+        for (const auto producerIndex : producers)
+        {
+            if (passRefCounts[producerIndex] == 0) continue;  // Already culled.
+            if (--passRefCounts[producerIndex] == 0) passesToCull.emplace_back(producerIndex);
+        }
+    };
+
+    for (uint32_t textureIndex{}; textureIndex < m_Textures.size(); ++textureIndex)
+        if (textureRefCounts[textureIndex] == 0) releaseProducers(textureProducers[textureIndex]);
+
+    for (uint32_t bufferIndex{}; bufferIndex < m_Buffers.size(); ++bufferIndex)
+        if (bufferRefCounts[bufferIndex] == 0) releaseProducers(bufferProducers[bufferIndex]);
+
+    while (!passesToCull.empty())
+    {
+        const uint32_t passIndex = passesToCull.back();
+        passesToCull.pop_back();
+        if (culledPasses[passIndex]) continue;
+
+        culledPasses[passIndex] = 1;
+        ++m_CompiledGraph->CulledPassCount;
+
+        const auto& pass = m_Passes.at(passIndex);
+        for (const auto textureID : pass->m_TextureReads)
+        {
+            if (producesTexture(passIndex, textureID)) continue;
+            if (--textureRefCounts[textureID.m_ID.value()] == 0) releaseProducers(textureProducers[textureID.m_ID.value()]);
+        }
+
+        for (const auto bufferID : pass->m_BufferReads)
+        {
+            if (producesBuffer(passIndex, bufferID)) continue;
+            if (--bufferRefCounts[bufferID.m_ID.value()] == 0) releaseProducers(bufferProducers[bufferID.m_ID.value()]);
+        }
+    }
+
+    PFR_ASSERT(m_CompiledGraph->CulledPassCount < m_Passes.size(), "Every pass got culled, forgot to SetSideEffect() on the final one?");
+}
+
+RGCullingStats RenderGraph::GetCullingStats() const
+{
+    RGCullingStats cullingStats = {.PassCount = static_cast<uint32_t>(m_Passes.size())};
+    for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
+    {
+        if (!m_CompiledGraph->CulledPasses.at(passIndex)) continue;
+
+        const auto& pass = m_Passes.at(passIndex);
+        cullingStats.CulledPassNames.emplace_back(pass->m_Name);
+        cullingStats.CulledTextureCount += static_cast<uint32_t>(pass->m_TextureCreates.size());
+        cullingStats.CulledBufferCount += static_cast<uint32_t>(pass->m_BufferCreates.size());
+    }
+
+    return cullingStats;
+}
+
+void RenderGraph::PlanBarriers()
+{
+    BarrierPlanState planState = {};
+    planState.TextureSyncedWith.resize(m_Textures.size());
+    planState.BufferSyncedWith.resize(m_Buffers.size());
+    planState.ImageLayouts.resize(m_Textures.size());
+    planState.TextureQueueAccesses.resize(m_Textures.size());
+    planState.BufferQueueAccesses.resize(m_Buffers.size());
+
+    auto& passQueues = m_CompiledGraph->PassQueues;
+    passQueues.resize(m_Passes.size());
+    for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
+        passQueues[passIndex] = RGUtils::PassTypeToQueue(m_Passes[passIndex]->m_Type);
+    m_CompiledGraph->PassQueueWaits.resize(m_Passes.size());
+
+    auto& passBarriers = m_CompiledGraph->PassBarriers;
+    passBarriers.resize(m_Passes.size());
+    for (const auto passIndex : m_CompiledGraph->TopologicallySortedPasses)
+    {
+        planState.RunPasses.insert(passIndex);
+
+        auto& currentPassBarriers = passBarriers.at(passIndex);
+        BuildBufferRAWBarriers(passIndex, planState, currentPassBarriers);
+        BuildBufferWARBarriers(passIndex, planState, currentPassBarriers);
+        BuildBufferWAWBarriers(passIndex, planState, currentPassBarriers);
+
+        BuildTextureRAWBarriers(passIndex, planState, currentPassBarriers);
+        BuildTextureWARBarriers(passIndex, planState, currentPassBarriers);
+        BuildTextureWAWBarriers(passIndex, planState, currentPassBarriers);
+
+        TrackQueueAccesses(passIndex, planState, currentPassBarriers);
+    }
+}
+
+void RenderGraph::BuildBufferRAWBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers)
+{
+    const auto& currentPass = m_Passes.at(passIndex);
+
+#if RG_LOG_DEBUG_INFO
+    LOG_INFO("\t{}:", __FUNCTION__);
+#endif
+    for (const auto resourceID : currentPass->m_BufferReads)
+    {
+        const uint32_t bufferIndex = resourceID.m_ID.value();
+        const auto& buffer         = m_Buffers.at(bufferIndex);
+        auto& alreadySyncedWith    = planState.BufferSyncedWith.at(bufferIndex);
+
+        // TODO: Maybe insert AlreadySyncedWith in the end?
+        Optional<uint32_t> prevPassIdx = std::nullopt;
+        for (const auto writePassIdx : buffer->WritePasses)
         {
-            if (!runPasses.contains(writePassIdx) || buffer->AlreadySyncedWith.contains(writePassIdx) && !m_AliasMap.contains(buffer->Name))
+            if (!planState.RunPasses.contains(writePassIdx) ||
+                alreadySyncedWith.contains(writePassIdx) && !buffer->AliasSource.has_value())
                 continue;
 
-            buffer->AlreadySyncedWith.insert(writePassIdx);
+            alreadySyncedWith.insert(writePassIdx);
             prevPassIdx = MakeOptional<uint32_t>(writePassIdx);
             break;
         }
 
         if (!prevPassIdx.has_value()) continue;
 #if RG_LOG_DEBUG_INFO
-        LOG_INFO("\t\t{}", buffer->Handle->GetSpecification().DebugName);
+        LOG_INFO("\t\t{}", buffer->Name.GetString());
 #endif
 
-        auto& bufferBarrier  = bufferMemoryBarriers.emplace_back(buffer->Handle);
+        auto& bufferBarrier  = passBarriers.BufferBarriers.emplace_back(bufferIndex, ERGBarrierHazard::RGBARRIER_HAZARD_RAW).Barrier;
         const auto& prevPass = m_Passes.at(prevPassIdx.value());
 
         // Retrieving hard in case resource is aliased.
         const auto prevResourceState = prevPass->m_BufferStateMap.contains(resourceID.m_ID.value())
                                            ? prevPass->m_BufferStateMap[resourceID.m_ID.value()]
-                                           : prevPass->m_BufferStateMap[GetBufferID(m_AliasMap[buffer->Name]).m_ID.value()];
+                                           : prevPass->m_BufferStateMap[buffer->AliasSource.value()];
         PFR_ASSERT(prevResourceState != EResourceState::RESOURCE_STATE_UNDEFINED, "Resource state is undefined!");
 
         // NOTE: Nothing to do with this.
@@ -384,7 +1141,7 @@ std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferRAWBarriers(const Uniqu
             bufferBarrier.srcAccessMask |= EAccessFlags::ACCESS_SHADER_WRITE_BIT | EAccessFlags::ACCESS_SHADER_READ_BIT;
         }
 
-        if (prevPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(prevPass->m_Type))
         {
             bufferBarrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             bufferBarrier.srcAccessMask = EAccessFlags::ACCESS_TRANSFER_WRITE_BIT;  // Maybe RW?
@@ -421,58 +1178,50 @@ std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferRAWBarriers(const Uniqu
             bufferBarrier.dstAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT;
         }
 
-        if (currentPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(currentPass->m_Type))
         {
             bufferBarrier.dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             bufferBarrier.dstAccessMask = EAccessFlags::ACCESS_TRANSFER_READ_BIT;  // Maybe RW?
         }
     }
-
-    return bufferMemoryBarriers;
 }
 
-std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferWARBarriers(const Unique<RGPassBase>& currentPass,
-                                                                     const UnorderedSet<uint32_t>& runPasses)
+void RenderGraph::BuildBufferWARBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers)
 {
-    std::vector<BufferMemoryBarrier> bufferMemoryBarriers;
+    const auto& currentPass = m_Passes.at(passIndex);
 #if RG_LOG_DEBUG_INFO
     LOG_INFO("\t{}:", __FUNCTION__);
 #endif
     for (const auto resourceID : currentPass->m_BufferWrites)
     {
-        auto& buffer = m_Buffers.at(resourceID.m_ID.value());
-        if (!buffer->Handle)  // Means it's alias
-        {
-            const auto sourceBufferID = GetBufferID(m_AliasMap[buffer->Name]);
-            buffer->Handle            = m_Buffers.at(sourceBufferID.m_ID.value())->Handle;
-        }
-
-        if (buffer->Handle->GetSpecification().Capacity == 0) continue;
+        const uint32_t bufferIndex = resourceID.m_ID.value();
+        const auto& buffer         = m_Buffers.at(bufferIndex);
+        auto& alreadySyncedWith    = planState.BufferSyncedWith.at(bufferIndex);
         //  if (currentPass->m_BufferReads.contains(resourceID)) continue;  // In case it's RMW buffer
 
         // TODO: Maybe insert AlreadySyncedWith in the end?
         Optional<uint32_t> prevPassIdx = std::nullopt;
         for (const auto readPassIdx : buffer->ReadPasses)
         {
-            if (!runPasses.contains(readPassIdx) || buffer->AlreadySyncedWith.contains(readPassIdx)) continue;
+            if (!planState.RunPasses.contains(readPassIdx) || alreadySyncedWith.contains(readPassIdx)) continue;
 
-            buffer->AlreadySyncedWith.insert(readPassIdx);
+            alreadySyncedWith.insert(readPassIdx);
             prevPassIdx = MakeOptional<uint32_t>(readPassIdx);
             break;
         }
 
         if (!prevPassIdx.has_value()) continue;
 #if RG_LOG_DEBUG_INFO
-        LOG_INFO("\t\t{}", buffer->Handle->GetSpecification().DebugName);
+        LOG_INFO("\t\t{}", buffer->Name.GetString());
 #endif
 
-        auto& bufferBarrier  = bufferMemoryBarriers.emplace_back(buffer->Handle);
+        auto& bufferBarrier  = passBarriers.BufferBarriers.emplace_back(bufferIndex, ERGBarrierHazard::RGBARRIER_HAZARD_WAR).Barrier;
         const auto& prevPass = m_Passes.at(prevPassIdx.value());
 
         // Retrieving hard in case resource is aliased.
         const auto prevResourceState = prevPass->m_BufferStateMap.contains(resourceID.m_ID.value())
                                            ? prevPass->m_BufferStateMap[resourceID.m_ID.value()]
-                                           : prevPass->m_BufferStateMap[GetBufferID(m_AliasMap[buffer->Name]).m_ID.value()];
+                                           : prevPass->m_BufferStateMap[buffer->AliasSource.value()];
         PFR_ASSERT(prevResourceState != EResourceState::RESOURCE_STATE_UNDEFINED, "Resource state is undefined!");
 
         // NOTE: Nothing to do with this.
@@ -509,7 +1258,7 @@ std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferWARBarriers(const Uniqu
             bufferBarrier.srcAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT;
         }
 
-        if (prevPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(prevPass->m_Type))
         {
             bufferBarrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             bufferBarrier.srcAccessMask = EAccessFlags::ACCESS_TRANSFER_READ_BIT;  // Maybe RW?
@@ -521,56 +1270,49 @@ std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferWARBarriers(const Uniqu
         bufferBarrier.dstStageMask |= EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT;
         bufferBarrier.dstAccessMask |= EAccessFlags::ACCESS_SHADER_WRITE_BIT | EAccessFlags::ACCESS_SHADER_READ_BIT;
 
-        if (currentPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(currentPass->m_Type))
         {
             bufferBarrier.dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             bufferBarrier.dstAccessMask = EAccessFlags::ACCESS_TRANSFER_WRITE_BIT;  // Maybe RW?
         }
     }
-    return bufferMemoryBarriers;
 }
 
-std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferWAWBarriers(const Unique<RGPassBase>& currentPass,
-                                                                     const UnorderedSet<uint32_t>& runPasses)
+void RenderGraph::BuildBufferWAWBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers)
 {
-    std::vector<BufferMemoryBarrier> bufferMemoryBarriers;
+    const auto& currentPass = m_Passes.at(passIndex);
 #if RG_LOG_DEBUG_INFO
     LOG_INFO("\t{}:", __FUNCTION__);
 #endif
     for (const auto resourceID : currentPass->m_BufferWrites)
     {
-        auto& buffer = m_Buffers.at(resourceID.m_ID.value());
-        if (!buffer->Handle)  // Means it's alias
-        {
-            const auto sourceBufferID = GetBufferID(m_AliasMap[buffer->Name]);
-            buffer->Handle            = m_Buffers.at(sourceBufferID.m_ID.value())->Handle;
-        }
-
-        if (buffer->Handle->GetSpecification().Capacity == 0) continue;
+        const uint32_t bufferIndex = resourceID.m_ID.value();
+        const auto& buffer         = m_Buffers.at(bufferIndex);
+        auto& alreadySyncedWith    = planState.BufferSyncedWith.at(bufferIndex);
 
         // TODO: Maybe insert AlreadySyncedWith in the end?
         Optional<uint32_t> prevPassIdx = std::nullopt;
         for (const auto writePassIdx : buffer->WritePasses)
         {
-            if (!runPasses.contains(writePassIdx) || buffer->AlreadySyncedWith.contains(writePassIdx)) continue;
+            if (!planState.RunPasses.contains(writePassIdx) || alreadySyncedWith.contains(writePassIdx)) continue;
 
-            buffer->AlreadySyncedWith.insert(writePassIdx);
+            alreadySyncedWith.insert(writePassIdx);
             prevPassIdx = MakeOptional<uint32_t>(writePassIdx);
             break;
         }
 
         if (!prevPassIdx.has_value()) continue;
 #if RG_LOG_DEBUG_INFO
-        LOG_INFO("\t\t{}", buffer->Handle->GetSpecification().DebugName);
+        LOG_INFO("\t\t{}", buffer->Name.GetString());
 #endif
 
-        auto& bufferBarrier  = bufferMemoryBarriers.emplace_back(buffer->Handle);
+        auto& bufferBarrier  = passBarriers.BufferBarriers.emplace_back(bufferIndex, ERGBarrierHazard::RGBARRIER_HAZARD_WAW).Barrier;
         const auto& prevPass = m_Passes.at(prevPassIdx.value());
 
         // Retrieving hard in case resource is aliased.
         const auto prevResourceState = prevPass->m_BufferStateMap.contains(resourceID.m_ID.value())
                                            ? prevPass->m_BufferStateMap[resourceID.m_ID.value()]
-                                           : prevPass->m_BufferStateMap[GetBufferID(m_AliasMap[buffer->Name]).m_ID.value()];
+                                           : prevPass->m_BufferStateMap[buffer->AliasSource.value()];
         PFR_ASSERT(prevResourceState != EResourceState::RESOURCE_STATE_UNDEFINED, "Resource state is undefined!");
 
         // NOTE: Nothing to do with this.
@@ -585,7 +1327,7 @@ std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferWAWBarriers(const Uniqu
             bufferBarrier.srcAccessMask |= EAccessFlags::ACCESS_SHADER_WRITE_BIT | EAccessFlags::ACCESS_SHADER_READ_BIT;
         }
 
-        if (prevPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(prevPass->m_Type))
         {
             bufferBarrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             bufferBarrier.srcAccessMask = EAccessFlags::ACCESS_TRANSFER_WRITE_BIT;  // Maybe RW?
@@ -600,72 +1342,57 @@ std::vector<BufferMemoryBarrier> RenderGraph::BuildBufferWAWBarriers(const Uniqu
             bufferBarrier.dstAccessMask |= EAccessFlags::ACCESS_SHADER_WRITE_BIT | EAccessFlags::ACCESS_SHADER_READ_BIT;
         }
 
-        if (currentPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(currentPass->m_Type))
         {
             bufferBarrier.dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             bufferBarrier.dstAccessMask = EAccessFlags::ACCESS_TRANSFER_WRITE_BIT;  // Maybe RW?
         }
     }
-
-    return bufferMemoryBarriers;
 }
 
-std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureRAWBarriers(const Unique<RGPassBase>& currentPass,
-                                                                     const UnorderedSet<uint32_t>& runPasses)
+void RenderGraph::BuildTextureRAWBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers)
 {
-    std::vector<ImageMemoryBarrier> imageMemoryBarriers;
+    const auto& currentPass = m_Passes.at(passIndex);
 #if RG_LOG_DEBUG_INFO
     LOG_INFO("\t{}:", __FUNCTION__);
 #endif
     for (const auto resourceID : currentPass->m_TextureReads)
     {
-        auto& texture = m_Textures.at(resourceID.m_ID.value());
-        if (!texture->Handle)  // Means it's alias
-        {
-            const auto sourceTextureID = GetTextureID(m_AliasMap[texture->Name]);
-            texture->Handle            = m_Textures.at(sourceTextureID.m_ID.value())->Handle;
-        }
+        const uint32_t textureIndex = resourceID.m_ID.value();
+        const auto& texture         = m_Textures.at(textureIndex);
+        auto& alreadySyncedWith     = planState.TextureSyncedWith.at(textureIndex);
+        auto& imageLayout           = planState.ImageLayouts.at(m_CompiledGraph->TextureRoots.at(textureIndex));
 
-        if (currentPass->m_Type != ERGPassType::RGPASS_TYPE_TRANSFER &&
-            texture->Handle->GetImage()->GetSpecification().Layout == EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+        // NOTE: Layout is unknown until image gets transitioned this frame, in that case it's checked again in ResolveBarriers().
+        if (!IsRGTransferPass(currentPass->m_Type) && imageLayout == EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
             continue;
 
         // TODO: Maybe insert AlreadySyncedWith in the end?
         Optional<uint32_t> prevPassIdx = std::nullopt;
         for (const auto writePassIdx : texture->WritePasses)
         {
-            if (!runPasses.contains(writePassIdx) || texture->AlreadySyncedWith.contains(writePassIdx)) continue;
+            if (!planState.RunPasses.contains(writePassIdx) || alreadySyncedWith.contains(writePassIdx)) continue;
 
-            texture->AlreadySyncedWith.insert(writePassIdx);
+            alreadySyncedWith.insert(writePassIdx);
             prevPassIdx = MakeOptional<uint32_t>(writePassIdx);
             break;
         }
 
         if (!prevPassIdx.has_value()) continue;
 #if RG_LOG_DEBUG_INFO
-        LOG_INFO("\t\t{}", texture->Handle->GetSpecification().DebugName);
+        LOG_INFO("\t\t{}", texture->Name.GetString());
 #endif
 
         // if Write->Write continue(will be synced later)
         if (currentPass->m_TextureWrites.contains(resourceID)) continue;
 
-        auto& imageBarrier = imageMemoryBarriers.emplace_back();
-        imageBarrier.image = texture->Handle->GetImage();
-
-        const auto& imageSpec = imageBarrier.image->GetSpecification();
-
-        imageBarrier.subresourceRange = {
-            .baseMipLevel   = 0,
-            .mipCount       = imageSpec.Mips,
-            .baseArrayLayer = 0,
-            .layerCount     = imageSpec.Layers,
-        };
+        auto& imageBarrier = passBarriers.ImageBarriers.emplace_back(textureIndex, ERGBarrierHazard::RGBARRIER_HAZARD_RAW).Barrier;
 
         const auto& prevPass = m_Passes.at(prevPassIdx.value());
         // Retrieving hard in case resource is aliased.
         const auto prevResourceState = prevPass->m_TextureStateMap.contains(resourceID.m_ID.value())
                                            ? prevPass->m_TextureStateMap[resourceID.m_ID.value()]
-                                           : prevPass->m_TextureStateMap[GetTextureID(m_AliasMap[texture->Name]).m_ID.value()];
+                                           : prevPass->m_TextureStateMap[texture->AliasSource.value()];
         PFR_ASSERT(prevResourceState != EResourceState::RESOURCE_STATE_UNDEFINED, "Resource state is undefined!");
 
         // NOTE: Maybe remove storage image usage?
@@ -700,7 +1427,7 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureRAWBarriers(const Uniqu
             imageBarrier.srcAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_SAMPLED_READ_BIT;
         }
 
-        if (prevPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(prevPass->m_Type))
         {
             imageBarrier.oldLayout     = EImageLayout::IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
             imageBarrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
@@ -710,7 +1437,6 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureRAWBarriers(const Uniqu
         const auto currResourceState = currentPass->m_TextureStateMap[resourceID.m_ID.value()];
         PFR_ASSERT(currResourceState != EResourceState::RESOURCE_STATE_UNDEFINED, "Resource state is undefined!");
 
-        imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
         imageBarrier.newLayout = EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         if (RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_VERTEX_SHADER_RESOURCE))
         {
@@ -734,22 +1460,20 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureRAWBarriers(const Uniqu
             imageBarrier.dstAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_SAMPLED_READ_BIT;
         }
 
-        if (currentPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(currentPass->m_Type))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
             imageBarrier.newLayout     = EImageLayout::IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
             imageBarrier.dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             imageBarrier.dstAccessMask = EAccessFlags::ACCESS_TRANSFER_READ_BIT;  // Maybe RW?
         }
-    }
 
-    return imageMemoryBarriers;
+        if (imageBarrier.newLayout != EImageLayout::IMAGE_LAYOUT_UNDEFINED) imageLayout = imageBarrier.newLayout;
+    }
 }
 
-std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWARBarriers(const Unique<RGPassBase>& currentPass,
-                                                                     const UnorderedSet<uint32_t>& runPasses)
+void RenderGraph::BuildTextureWARBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers)
 {
-    std::vector<ImageMemoryBarrier> imageMemoryBarriers;
+    const auto& currentPass = m_Passes.at(passIndex);
 #if RG_LOG_DEBUG_INFO
     LOG_INFO("\t{}:", __FUNCTION__);
 #endif
@@ -758,47 +1482,36 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWARBarriers(const Uniqu
         // NOTE: First resource creation will be handled in BuildTextureWAWBarriers()
         if (currentPass->m_TextureCreates.contains(resourceID)) continue;
 
-        auto& texture = m_Textures.at(resourceID.m_ID.value());
-        if (!texture->Handle)  // Means it's alias
-        {
-            const auto sourceTextureID = GetTextureID(m_AliasMap[texture->Name]);
-            texture->Handle            = m_Textures.at(sourceTextureID.m_ID.value())->Handle;
-        }
+        const uint32_t textureIndex = resourceID.m_ID.value();
+        const auto& texture         = m_Textures.at(textureIndex);
+        auto& alreadySyncedWith     = planState.TextureSyncedWith.at(textureIndex);
+        auto& imageLayout           = planState.ImageLayouts.at(m_CompiledGraph->TextureRoots.at(textureIndex));
 
         // Means aliased, will be handled at BuildTextureWAWBarriers()
-        if (texture->Name != texture->Handle->GetSpecification().DebugName) continue;
+        if (texture->AliasSource.has_value()) continue;
 
         // TODO: Maybe insert AlreadySyncedWith in the end?
         Optional<uint32_t> prevPassIdx = std::nullopt;
         for (const auto readPassIdx : texture->ReadPasses)
         {
-            if (!runPasses.contains(readPassIdx) || texture->AlreadySyncedWith.contains(readPassIdx)) continue;
+            if (!planState.RunPasses.contains(readPassIdx) || alreadySyncedWith.contains(readPassIdx)) continue;
 
-            texture->AlreadySyncedWith.insert(readPassIdx);
+            alreadySyncedWith.insert(readPassIdx);
             prevPassIdx = MakeOptional<uint32_t>(readPassIdx);
             break;
         }
 
         if (!prevPassIdx.has_value()) continue;
 #if RG_LOG_DEBUG_INFO
-        LOG_INFO("\t\t{}", texture->Handle->GetSpecification().DebugName);
+        LOG_INFO("\t\t{}", texture->Name.GetString());
 #endif
-        auto& imageBarrier = imageMemoryBarriers.emplace_back();
-        imageBarrier.image = texture->Handle->GetImage();
-
-        const auto& imageSpec         = imageBarrier.image->GetSpecification();
-        imageBarrier.subresourceRange = {
-            .baseMipLevel   = 0,
-            .mipCount       = imageSpec.Mips,
-            .baseArrayLayer = 0,
-            .layerCount     = imageSpec.Layers,
-        };
+        auto& imageBarrier = passBarriers.ImageBarriers.emplace_back(textureIndex, ERGBarrierHazard::RGBARRIER_HAZARD_WAR).Barrier;
 
         const auto& prevPass = m_Passes.at(prevPassIdx.value());
         // Retrieving hard in case resource is aliased.
         const auto prevResourceState = prevPass->m_TextureStateMap.contains(resourceID.m_ID.value())
                                            ? prevPass->m_TextureStateMap[resourceID.m_ID.value()]
-                                           : prevPass->m_TextureStateMap[GetTextureID(m_AliasMap[texture->Name]).m_ID.value()];
+                                           : prevPass->m_TextureStateMap[texture->AliasSource.value()];
         PFR_ASSERT(prevResourceState != EResourceState::RESOURCE_STATE_UNDEFINED, "Resource state is undefined!");
 
         // NOTE: Maybe remove storage image usage?
@@ -832,7 +1545,7 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWARBarriers(const Uniqu
             imageBarrier.srcAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_SAMPLED_READ_BIT;
         }
 
-        if (prevPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(prevPass->m_Type))
         {
             imageBarrier.oldLayout     = EImageLayout::IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
             imageBarrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
@@ -844,7 +1557,6 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWARBarriers(const Uniqu
 
         if (RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_COLOR_RENDER_TARGET))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
             imageBarrier.newLayout = EImageLayout::IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
             imageBarrier.dstStageMask |= EPipelineStage::PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
             imageBarrier.dstAccessMask |= EAccessFlags::ACCESS_COLOR_ATTACHMENT_WRITE_BIT | EAccessFlags::ACCESS_COLOR_ATTACHMENT_READ_BIT;
@@ -852,7 +1564,6 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWARBarriers(const Uniqu
 
         if (RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_DEPTH_RENDER_TARGET))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
             imageBarrier.newLayout = EImageLayout::IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
             imageBarrier.dstStageMask |=
                 EPipelineStage::PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | EPipelineStage::PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
@@ -863,74 +1574,60 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWARBarriers(const Uniqu
         if (RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE) ||
             RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_STORAGE_IMAGE))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_GENERAL);
             imageBarrier.newLayout = EImageLayout::IMAGE_LAYOUT_GENERAL;
             imageBarrier.dstStageMask |= EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT;
             imageBarrier.dstAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_WRITE_BIT;
         }
 
-        if (currentPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(currentPass->m_Type))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
             imageBarrier.newLayout     = EImageLayout::IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
             imageBarrier.dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             imageBarrier.dstAccessMask = EAccessFlags::ACCESS_TRANSFER_WRITE_BIT;  // Maybe RW?
         }
-    }
 
-    return imageMemoryBarriers;
+        if (imageBarrier.newLayout != EImageLayout::IMAGE_LAYOUT_UNDEFINED) imageLayout = imageBarrier.newLayout;
+    }
 }
 
-std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWAWBarriers(const Unique<RGPassBase>& currentPass,
-                                                                     const UnorderedSet<uint32_t>& runPasses)
+void RenderGraph::BuildTextureWAWBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers)
 {
-    std::vector<ImageMemoryBarrier> imageMemoryBarriers;
+    const auto& currentPass = m_Passes.at(passIndex);
 #if RG_LOG_DEBUG_INFO
     LOG_INFO("\t{}:", __FUNCTION__);
 #endif
     for (const auto resourceID : currentPass->m_TextureWrites)
     {
-        auto& texture = m_Textures.at(resourceID.m_ID.value());
-        if (!texture->Handle)  // Means it's alias
-        {
-            const auto sourceTextureID = GetTextureID(m_AliasMap[texture->Name]);
-            texture->Handle            = m_Textures.at(sourceTextureID.m_ID.value())->Handle;
-        }
+        const uint32_t textureIndex = resourceID.m_ID.value();
+        const auto& texture         = m_Textures.at(textureIndex);
+        auto& alreadySyncedWith     = planState.TextureSyncedWith.at(textureIndex);
+        auto& imageLayout           = planState.ImageLayouts.at(m_CompiledGraph->TextureRoots.at(textureIndex));
 
         // TODO: Maybe insert AlreadySyncedWith in the end?
         Optional<uint32_t> prevPassIdx = std::nullopt;
         for (const auto writePassIdx : texture->WritePasses)
         {
-            if (!runPasses.contains(writePassIdx) || texture->AlreadySyncedWith.contains(writePassIdx)) continue;
+            if (!planState.RunPasses.contains(writePassIdx) || alreadySyncedWith.contains(writePassIdx)) continue;
 
-            texture->AlreadySyncedWith.insert(writePassIdx);
+            alreadySyncedWith.insert(writePassIdx);
             prevPassIdx = MakeOptional<uint32_t>(writePassIdx);
             break;
         }
 
         if (!prevPassIdx.has_value()) continue;
 #if RG_LOG_DEBUG_INFO
-        LOG_INFO("\t\t{}", texture->Handle->GetSpecification().DebugName);
+        LOG_INFO("\t\t{}", texture->Name.GetString());
 #endif
 
-        auto& imageBarrier = imageMemoryBarriers.emplace_back();
-        imageBarrier.image = texture->Handle->GetImage();
-
-        const auto& imageSpec       = imageBarrier.image->GetSpecification();
         const bool bTextureCreation = currentPass->m_TextureCreates.contains(resourceID);
-
-        imageBarrier.subresourceRange = {
-            .baseMipLevel   = 0,
-            .mipCount       = imageSpec.Mips,
-            .baseArrayLayer = 0,
-            .layerCount     = imageSpec.Layers,
-        };
+        auto& imageBarrier =
+            passBarriers.ImageBarriers.emplace_back(textureIndex, ERGBarrierHazard::RGBARRIER_HAZARD_WAW, bTextureCreation).Barrier;
 
         const auto& prevPass = m_Passes.at(prevPassIdx.value());
         // Retrieving hard in case resource is aliased.
         const auto prevResourceState = prevPass->m_TextureStateMap.contains(resourceID.m_ID.value())
                                            ? prevPass->m_TextureStateMap[resourceID.m_ID.value()]
-                                           : prevPass->m_TextureStateMap[GetTextureID(m_AliasMap[texture->Name]).m_ID.value()];
+                                           : prevPass->m_TextureStateMap[texture->AliasSource.value()];
         PFR_ASSERT(prevResourceState != EResourceState::RESOURCE_STATE_UNDEFINED, "Resource state is undefined!");
 
         // NOTE: Maybe remove storage image usage?
@@ -958,7 +1655,7 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWAWBarriers(const Uniqu
                 EAccessFlags::ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | EAccessFlags::ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
         }
 
-        if (prevPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(prevPass->m_Type))
         {
             imageBarrier.oldLayout     = EImageLayout::IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
             imageBarrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
@@ -967,24 +1664,17 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWAWBarriers(const Uniqu
 
         if (bTextureCreation)
         {
-            imageBarrier.oldLayout     = bTextureCreation ? EImageLayout::IMAGE_LAYOUT_UNDEFINED : imageSpec.Layout;
+            imageBarrier.oldLayout     = EImageLayout::IMAGE_LAYOUT_UNDEFINED;
             imageBarrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_TOP_OF_PIPE_BIT;
             imageBarrier.srcAccessMask = EAccessFlags::ACCESS_NONE;
         }
 
-        // NOTE: Since I drop all the things from other Build*Barriers() here:
-        if (imageSpec.Layout == EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
-        {
-            imageBarrier.oldLayout = EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            imageBarrier.srcStageMask |= EPipelineStage::PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-            imageBarrier.srcAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_SAMPLED_READ_BIT;
-        }
+        // NOTE: Aliased memory and read-only layout fixup depend on what resource pool handed out, see ResolveBarriers().
 
         const auto currResourceState = currentPass->m_TextureStateMap[resourceID.m_ID.value()];
         PFR_ASSERT(currResourceState != EResourceState::RESOURCE_STATE_UNDEFINED, "Resource state is undefined!");
         if (RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_COLOR_RENDER_TARGET))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
             imageBarrier.newLayout = EImageLayout::IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
             imageBarrier.dstStageMask |= EPipelineStage::PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
             imageBarrier.dstAccessMask |= EAccessFlags::ACCESS_COLOR_ATTACHMENT_WRITE_BIT | EAccessFlags::ACCESS_COLOR_ATTACHMENT_READ_BIT;
@@ -992,7 +1682,6 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWAWBarriers(const Uniqu
 
         if (RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_DEPTH_RENDER_TARGET))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
             imageBarrier.newLayout = EImageLayout::IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
             imageBarrier.dstStageMask |=
                 EPipelineStage::PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | EPipelineStage::PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
@@ -1003,48 +1692,923 @@ std::vector<ImageMemoryBarrier> RenderGraph::BuildTextureWAWBarriers(const Uniqu
         if (RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_COMPUTE_SHADER_RESOURCE) ||
             RGUtils::ResourceStateContains(currResourceState, EResourceState::RESOURCE_STATE_STORAGE_IMAGE))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_GENERAL);
             imageBarrier.newLayout = EImageLayout::IMAGE_LAYOUT_GENERAL;
             imageBarrier.dstStageMask |= EPipelineStage::PIPELINE_STAGE_COMPUTE_SHADER_BIT;
             imageBarrier.dstAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_WRITE_BIT;
         }
 
-        if (currentPass->m_Type == ERGPassType::RGPASS_TYPE_TRANSFER)
+        if (IsRGTransferPass(currentPass->m_Type))
         {
-            imageBarrier.image->SetLayout(EImageLayout::IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
             imageBarrier.newLayout     = EImageLayout::IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
             imageBarrier.dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_TRANSFER_BIT;
             imageBarrier.dstAccessMask = EAccessFlags::ACCESS_TRANSFER_WRITE_BIT;  // Maybe RW?
         }
+
+        if (imageBarrier.newLayout != EImageLayout::IMAGE_LAYOUT_UNDEFINED) imageLayout = imageBarrier.newLayout;
     }
+}
 
-    return imageMemoryBarriers;
+void RenderGraph::CollectRootAccesses(const uint32_t passIndex, UnorderedMap<uint32_t, bool>& textureRootAccesses,
+                                      UnorderedMap<uint32_t, bool>& bufferRootAccesses) const
+{
+    const auto& currentPass = m_Passes.at(passIndex);
+    for (const auto textureID : currentPass->m_TextureReads)
+        textureRootAccesses.try_emplace(m_CompiledGraph->TextureRoots.at(textureID.m_ID.value()), false);
+    for (const auto& textureIDs : {std::cref(currentPass->m_TextureWrites), std::cref(currentPass->m_TextureCreates)})
+        for (const auto textureID : textureIDs.get())
+            textureRootAccesses[m_CompiledGraph->TextureRoots.at(textureID.m_ID.value())] = true;
+
+    for (const auto bufferID : currentPass->m_BufferReads)
+        bufferRootAccesses.try_emplace(m_CompiledGraph->BufferRoots.at(bufferID.m_ID.value()), false);
+    for (const auto& bufferIDs : {std::cref(currentPass->m_BufferWrites), std::cref(currentPass->m_BufferCreates)})
+        for (const auto bufferID : bufferIDs.get())
+            bufferRootAccesses[m_CompiledGraph->BufferRoots.at(bufferID.m_ID.value())] = true;
 }
 
-void RenderGraph::GraphVizDump()
+void RenderGraph::TrackQueueAccesses(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers)
 {
-    PFR_ASSERT(!m_Passes.empty() && !m_Name.empty(), "DebugName or passes array is not valid!");
+    const auto& currentPass = m_Passes.at(passIndex);
+    const auto& passQueues  = m_CompiledGraph->PassQueues;
+    const auto queue        = passQueues.at(passIndex);
+    auto& passQueueWaits    = m_CompiledGraph->PassQueueWaits.at(passIndex);
+
+    const auto waitOn = [&](const uint32_t otherPassIndex)
+    {
+        if (passQueues.at(otherPassIndex) == queue || std::ranges::find(passQueueWaits, otherPassIndex) != passQueueWaits.end()) return;
+        passQueueWaits.emplace_back(otherPassIndex);
+    };
+
+    // NOTE: Read waits on the last writer, write waits on it and every reader since, same queue ordering is up to barriers.
+    const auto trackAccess = [&](BarrierPlanState::QueueAccessState& accessState, const bool bWrite)
+    {
+        if (accessState.LastWriter.has_value()) waitOn(accessState.LastWriter.value());
+        if (!bWrite)
+        {
+            accessState.ReadersSinceWrite.emplace_back(passIndex);
+            return;
+        }
+
+        for (const auto readPassIndex : accessState.ReadersSinceWrite)
+            waitOn(readPassIndex);
+
+        accessState.ReadersSinceWrite.clear();
+        accessState.LastWriter = MakeOptional<uint32_t>(passIndex);
+    };
+
+    UnorderedMap<uint32_t, bool> textureRootAccesses;
+    UnorderedMap<uint32_t, bool> bufferRootAccesses;
+    CollectRootAccesses(passIndex, textureRootAccesses, bufferRootAccesses);
+
+    for (const auto& [rootIndex, bWrite] : bufferRootAccesses)
+        trackAccess(planState.BufferQueueAccesses.at(rootIndex), bWrite);
+
+    for (const auto& [rootIndex, bWrite] : textureRootAccesses)
+    {
+        auto& accessState = planState.TextureQueueAccesses.at(rootIndex);
+        trackAccess(accessState, bWrite);
+
+        // NOTE: Texture is created(contents discarded) by its first user in the frame, so transfers are needed only within the frame.
+        const Optional<uint32_t> ownerPassIndex = accessState.LastAccess;
+        accessState.LastAccess                  = MakeOptional<uint32_t>(passIndex);
+        if (!ownerPassIndex.has_value() || passQueues.at(ownerPassIndex.value()) == queue) continue;
+
+        waitOn(ownerPassIndex.value());
+
+        // First barrier on the image becomes acquire, if there's none(layout already matches), image still has to be acquired.
+        auto acquireIt = std::ranges::find_if(passBarriers.ImageBarriers, [&](const auto& imageBarrierTemplate)
+                                              { return m_CompiledGraph->TextureRoots.at(imageBarrierTemplate.TextureIndex) == rootIndex; });
+        if (acquireIt == passBarriers.ImageBarriers.end())
+        {
+            const auto imageLayout = planState.ImageLayouts.at(rootIndex).value_or(EImageLayout::IMAGE_LAYOUT_UNDEFINED);
+            acquireIt              = passBarriers.ImageBarriers.emplace(passBarriers.ImageBarriers.begin(), rootIndex,
+                                                                        ERGBarrierHazard::RGBARRIER_HAZARD_RAW);
+            acquireIt->Barrier     = {.dstStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                      .dstAccessMask = EAccessFlags::ACCESS_MEMORY_READ_BIT | EAccessFlags::ACCESS_MEMORY_WRITE_BIT,
+                                      .oldLayout     = imageLayout,
+                                      .newLayout     = imageLayout};
+        }
+
+        // Anything before the acquire on this queue is ordered by semaphore wait, which covers all stages.
+        acquireIt->bQueueTransfer        = true;
+        acquireIt->SrcQueue              = passQueues.at(ownerPassIndex.value());
+        acquireIt->DstQueue              = queue;
+        acquireIt->Barrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        acquireIt->Barrier.srcAccessMask = EAccessFlags::ACCESS_NONE;
+
+        auto& ownerPassBarriers              = m_CompiledGraph->PassBarriers.at(ownerPassIndex.value());
+        auto& releaseBarrier                 = ownerPassBarriers.ReleaseImageBarriers.emplace_back(*acquireIt);
+        releaseBarrier.Barrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        releaseBarrier.Barrier.srcAccessMask = EAccessFlags::ACCESS_MEMORY_WRITE_BIT;
+        releaseBarrier.Barrier.dstStageMask  = EPipelineStage::PIPELINE_STAGE_NONE;
+        releaseBarrier.Barrier.dstAccessMask = EAccessFlags::ACCESS_NONE;
+        ++m_CompiledGraph->QueueTransferCount;
+    }
+}
+
+void RenderGraph::ScheduleSubmissions()
+{
+    const auto& sortedPasses = m_CompiledGraph->TopologicallySortedPasses;
+    const auto& passQueues   = m_CompiledGraph->PassQueues;
+
+    std::vector<uint32_t> passOrder(m_Passes.size(), 0);
+    for (uint32_t order{}; order < sortedPasses.size(); ++order)
+        passOrder[sortedPasses[order]] = order;
+
+    // NOTE: Submission signals once everything submitted to the queue before it is done, so waiting on a pass covers earlier passes of
+    // its queue. Only the latest dependency per queue is kept, and only if the queue hasn't waited that far already.
+    std::array<std::array<Optional<uint32_t>, RGUtils::s_QUEUE_COUNT>, RGUtils::s_QUEUE_COUNT> waitedUpTo = {};  // Topological order.
+    std::vector<std::vector<uint32_t>> passWaits(m_Passes.size());
+    std::vector<uint8_t> signalPasses(m_Passes.size(), 0);
+    for (const auto passIndex : sortedPasses)
+    {
+        std::array<Optional<uint32_t>, RGUtils::s_QUEUE_COUNT> latestWaits = {};
+        for (const auto otherPassIndex : m_CompiledGraph->PassQueueWaits.at(passIndex))
+        {
+            auto& latestWait = latestWaits.at(static_cast<size_t>(passQueues.at(otherPassIndex)));
+            if (!latestWait.has_value() || passOrder[otherPassIndex] > passOrder[latestWait.value()])
+                latestWait = MakeOptional<uint32_t>(otherPassIndex);
+        }
+
+        auto& queueWaitedUpTo = waitedUpTo.at(static_cast<size_t>(passQueues.at(passIndex)));
+        for (uint32_t queueIndex{}; queueIndex < RGUtils::s_QUEUE_COUNT; ++queueIndex)
+        {
+            const auto& latestWait = latestWaits[queueIndex];
+            if (!latestWait.has_value() ||
+                queueWaitedUpTo[queueIndex].has_value() && queueWaitedUpTo[queueIndex].value() >= passOrder[latestWait.value()])
+                continue;
+
+            queueWaitedUpTo[queueIndex] = MakeOptional<uint32_t>(passOrder[latestWait.value()]);
+            passWaits[passIndex].emplace_back(latestWait.value());
+            signalPasses[latestWait.value()] = 1;
+        }
+    }
+
+    // Batch is closed after a pass somebody waits on and a new one is opened before a pass that waits.
+    auto& submissionBatches = m_CompiledGraph->SubmissionBatches;
+    std::vector<uint32_t> passBatches(m_Passes.size(), 0);
+    std::array<Optional<uint32_t>, RGUtils::s_QUEUE_COUNT> openBatches = {};
+    for (const auto passIndex : sortedPasses)
+    {
+        auto& openBatch = openBatches.at(static_cast<size_t>(passQueues.at(passIndex)));
+        if (!openBatch.has_value() || !passWaits[passIndex].empty())
+        {
+            openBatch = MakeOptional<uint32_t>(static_cast<uint32_t>(submissionBatches.size()));
+            submissionBatches.emplace_back(passQueues.at(passIndex));
+        }
+
+        auto& batch = submissionBatches.at(openBatch.value());
+        batch.Passes.emplace_back(passIndex);
+        passBatches[passIndex] = openBatch.value();
+
+        for (const auto waitPassIndex : passWaits[passIndex])
+            batch.WaitBatches.emplace_back(passBatches[waitPassIndex]);
+
+        if (signalPasses[passIndex]) openBatch.reset();
+    }
+
+    PFR_ASSERT(!submissionBatches.empty() && submissionBatches.back().Queue == ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL,
+               "Last submission goes along with swapchain, async passes have to be consumed by graphics ones!");
+
+    // NOTE: Frame is done once the last batch is, so it joins whatever async queues submitted last.
+    auto& finalBatch = submissionBatches.back();
+    for (uint32_t queueIndex{1}; queueIndex < RGUtils::s_QUEUE_COUNT; ++queueIndex)
+    {
+        const auto lastQueueBatchIt = std::ranges::find_if(submissionBatches.rbegin(), submissionBatches.rend(), [&](const auto& batch)
+                                                           { return static_cast<uint32_t>(batch.Queue) == queueIndex; });
+        if (lastQueueBatchIt == submissionBatches.rend()) continue;
+
+        const auto lastQueueBatchIndex = static_cast<uint32_t>(std::distance(lastQueueBatchIt, submissionBatches.rend()) - 1);
+        if (std::ranges::find(finalBatch.WaitBatches, lastQueueBatchIndex) == finalBatch.WaitBatches.end())
+            finalBatch.WaitBatches.emplace_back(lastQueueBatchIndex);
+    }
+}
+
+void RenderGraph::PlanBarrierGroups()
+{
+    const auto& passBarriers = m_CompiledGraph->PassBarriers;
+    auto& plannedStats       = m_CompiledGraph->PlannedBarrierStats;
+
+    // NOTE: Pass joins current group only if it has no hazard with passes already there(read-read is fine) and none of its barriers
+    // touch what they access, then barriers of the whole group can be hoisted before its first pass.
+    for (auto& batch : m_CompiledGraph->SubmissionBatches)
+    {
+        UnorderedMap<uint32_t, bool> groupTextureAccesses;
+        UnorderedMap<uint32_t, bool> groupBufferAccesses;
+        UnorderedSet<uint32_t> groupBarrierTextures;
+        UnorderedSet<uint32_t> groupBarrierBuffers;
+        UnorderedSet<uint32_t> groupReleaseTextures;
+        const auto closeGroup = [&]
+        {
+            plannedStats.MergedBarrierCount += static_cast<uint32_t>(groupBarrierTextures.size() + groupBarrierBuffers.size());
+            plannedStats.MergedBarrierCount += static_cast<uint32_t>(groupReleaseTextures.size());
+            if (!groupBarrierTextures.empty() || !groupBarrierBuffers.empty()) ++plannedStats.MergedBarrierCallCount;
+            if (!groupReleaseTextures.empty()) ++plannedStats.MergedBarrierCallCount;
+
+            groupTextureAccesses.clear();
+            groupBufferAccesses.clear();
+            groupBarrierTextures.clear();
+            groupBarrierBuffers.clear();
+            groupReleaseTextures.clear();
+        };
+
+        for (uint32_t i{}; i < batch.Passes.size(); ++i)
+        {
+            const uint32_t passIndex = batch.Passes[i];
+            const auto& barriers     = passBarriers.at(passIndex);
+
+            UnorderedMap<uint32_t, bool> textureRootAccesses;
+            UnorderedMap<uint32_t, bool> bufferRootAccesses;
+            CollectRootAccesses(passIndex, textureRootAccesses, bufferRootAccesses);
+
+            const auto hasHazard = [](const UnorderedMap<uint32_t, bool>& groupAccesses, const UnorderedMap<uint32_t, bool>& passAccesses)
+            {
+                return std::ranges::any_of(passAccesses,
+                                           [&](const auto& passAccess)
+                                           {
+                                               const auto it = groupAccesses.find(passAccess.first);
+                                               return it != groupAccesses.end() && (it->second || passAccess.second);
+                                           });
+            };
+
+            bool bSplit = hasHazard(groupTextureAccesses, textureRootAccesses) || hasHazard(groupBufferAccesses, bufferRootAccesses);
+            for (const auto& imageBarrierTemplate : barriers.ImageBarriers)
+                bSplit |= groupTextureAccesses.contains(m_CompiledGraph->TextureRoots.at(imageBarrierTemplate.TextureIndex));
+            for (const auto& bufferBarrierTemplate : barriers.BufferBarriers)
+                bSplit |= groupBufferAccesses.contains(m_CompiledGraph->BufferRoots.at(bufferBarrierTemplate.BufferIndex));
+
+            if (i == 0 || bSplit)
+            {
+                if (i != 0) closeGroup();
+                batch.BarrierGroupStarts.emplace_back(i);
+            }
+
+            for (const auto& [rootIndex, bWrite] : textureRootAccesses)
+                groupTextureAccesses[rootIndex] |= bWrite;
+            for (const auto& [rootIndex, bWrite] : bufferRootAccesses)
+                groupBufferAccesses[rootIndex] |= bWrite;
+
+            for (const auto& imageBarrierTemplate : barriers.ImageBarriers)
+                groupBarrierTextures.insert(m_CompiledGraph->TextureRoots.at(imageBarrierTemplate.TextureIndex));
+            for (const auto& bufferBarrierTemplate : barriers.BufferBarriers)
+                groupBarrierBuffers.insert(m_CompiledGraph->BufferRoots.at(bufferBarrierTemplate.BufferIndex));
+            for (const auto& imageBarrierTemplate : barriers.ReleaseImageBarriers)
+                groupReleaseTextures.insert(m_CompiledGraph->TextureRoots.at(imageBarrierTemplate.TextureIndex));
+
+            plannedStats.BarrierCount += static_cast<uint32_t>(barriers.ImageBarriers.size() + barriers.BufferBarriers.size());
+            plannedStats.BarrierCount += static_cast<uint32_t>(barriers.ReleaseImageBarriers.size());
+            if (!barriers.ImageBarriers.empty() || !barriers.BufferBarriers.empty()) ++plannedStats.BarrierCallCount;
+            if (!barriers.ReleaseImageBarriers.empty()) ++plannedStats.BarrierCallCount;
+        }
+
+        closeGroup();
+    }
+}
+
+RGScheduleStats RenderGraph::SimulateSchedule(const std::function<float(const uint32_t passIndex)>& passCostFunc) const
+{
+    PFR_ASSERT(m_CompiledGraph, "RenderGraph isn't compiled!");
+
+    const auto& submissionBatches = m_CompiledGraph->SubmissionBatches;
+    RGScheduleStats scheduleStats = {.BatchCount         = static_cast<uint32_t>(submissionBatches.size()),
+                                     .QueueTransferCount = m_CompiledGraph->QueueTransferCount};
+
+    // NOTE: Batch starts once its queue is free and batches it waits on are done, submission overhead is ignored.
+    std::array<float, RGUtils::s_QUEUE_COUNT> queueFreeTimes = {0.f};
+    std::vector<float> batchEndTimes(submissionBatches.size(), 0.f);
+    for (uint32_t batchIndex{}; batchIndex < submissionBatches.size(); ++batchIndex)
+    {
+        const auto& batch     = submissionBatches[batchIndex];
+        const auto queueIndex = static_cast<size_t>(batch.Queue);
+
+        float startTime = queueFreeTimes.at(queueIndex);
+        for (const auto waitBatchIndex : batch.WaitBatches)
+            startTime = std::max(startTime, batchEndTimes.at(waitBatchIndex));
+        scheduleStats.SyncPointCount += static_cast<uint32_t>(batch.WaitBatches.size());
+
+        float batchTime = 0.f;
+        for (const auto passIndex : batch.Passes)
+            batchTime += passCostFunc(passIndex);
+
+        scheduleStats.SerialTime += batchTime;
+        scheduleStats.QueueBusyTime.at(queueIndex) += batchTime;
+
+        batchEndTimes[batchIndex]   = startTime + batchTime;
+        queueFreeTimes[queueIndex]  = batchEndTimes[batchIndex];
+        scheduleStats.ScheduledTime = std::max(scheduleStats.ScheduledTime, batchEndTimes[batchIndex]);
+    }
+
+    return scheduleStats;
+}
+
+void RenderGraph::ComputeResourceLifetimes()
+{
+    constexpr uint32_t s_CulledPassOrder = std::numeric_limits<uint32_t>::max();
+    const auto& sortedPasses             = m_CompiledGraph->TopologicallySortedPasses;
+    std::vector<uint32_t> passOrder(m_Passes.size(), s_CulledPassOrder);
+    for (uint32_t order{}; order < sortedPasses.size(); ++order)
+        passOrder[sortedPasses[order]] = order;
+
+    // NOTE: Async batch may run anywhere between batches it waits on and the first batch waiting on it, so its passes occupy that
+    // whole window, otherwise memory could be shared with graphics work running concurrently.
+    std::vector<RGResourceLifetime> passWindows(m_Passes.size());
+    for (const auto passIndex : sortedPasses)
+        passWindows[passIndex] = {.FirstUse = passOrder[passIndex], .LastUse = passOrder[passIndex]};
+
+    // Barriers of the whole group are recorded before its first pass, so passes of the group can't share memory with each other.
+    const auto& submissionBatches = m_CompiledGraph->SubmissionBatches;
+    for (const auto& batch : submissionBatches)
+    {
+        for (uint32_t groupIndex{}; groupIndex < batch.BarrierGroupStarts.size(); ++groupIndex)
+        {
+            const uint32_t groupStart = batch.BarrierGroupStarts[groupIndex];
+            const uint32_t groupEnd   = groupIndex + 1 < batch.BarrierGroupStarts.size() ? batch.BarrierGroupStarts[groupIndex + 1]
+                                                                                         : static_cast<uint32_t>(batch.Passes.size());
+            const RGResourceLifetime groupWindow = {.FirstUse = passOrder.at(batch.Passes[groupStart]),
+                                                    .LastUse  = passOrder.at(batch.Passes[groupEnd - 1])};
+            for (uint32_t i{groupStart}; i < groupEnd; ++i)
+                passWindows[batch.Passes[i]] = groupWindow;
+        }
+    }
+
+    for (uint32_t batchIndex{}; batchIndex < submissionBatches.size(); ++batchIndex)
+    {
+        const auto& batch = submissionBatches[batchIndex];
+        if (batch.Queue == ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL) continue;
+
+        uint32_t windowStart = 0;
+        for (const auto waitBatchIndex : batch.WaitBatches)
+            windowStart = std::max(windowStart, passOrder.at(submissionBatches.at(waitBatchIndex).Passes.back()) + 1);
+
+        uint32_t windowEnd = static_cast<uint32_t>(sortedPasses.size()) - 1;
+        for (const auto& otherBatch : submissionBatches)
+        {
+            if (std::ranges::find(otherBatch.WaitBatches, batchIndex) != otherBatch.WaitBatches.end())
+                windowEnd = std::min(windowEnd, passOrder.at(otherBatch.Passes.front()));
+        }
+
+        for (const auto passIndex : batch.Passes)
+        {
+            passWindows[passIndex].FirstUse = std::min(passWindows[passIndex].FirstUse, windowStart);
+            passWindows[passIndex].LastUse  = std::max(passWindows[passIndex].LastUse, windowEnd);
+        }
+    }
+
+    // NOTE: Aliases(_V0 -> _V1) share physical resource with source, so lifetime covers all of them.
+    const auto extendLifetime = [&](RGResourceLifetime& lifetime, const RGResource& resource)
+    {
+        for (const auto& passes : {std::cref(resource.ReadPasses), std::cref(resource.WritePasses)})
+        {
+            for (const auto passIndex : passes.get())
+            {
+                if (passOrder.at(passIndex) == s_CulledPassOrder) continue;
+
+                lifetime.FirstUse = std::min(lifetime.FirstUse, passWindows.at(passIndex).FirstUse);
+                lifetime.LastUse  = std::max(lifetime.LastUse, passWindows.at(passIndex).LastUse);
+            }
+        }
+    };
+
+    constexpr RGResourceLifetime s_EmptyLifetime = {.FirstUse = std::numeric_limits<uint32_t>::max(), .LastUse = 0};
+
+    UnorderedMap<uint32_t, RGResourceLifetime> textureLifetimes;
+    for (uint32_t textureIndex{}; textureIndex < m_Textures.size(); ++textureIndex)
+    {
+        const uint32_t rootIndex = m_CompiledGraph->TextureRoots.at(textureIndex);
+        if (!m_Textures.at(rootIndex)->Description.bTransient) continue;
+
+        extendLifetime(textureLifetimes.try_emplace(rootIndex, s_EmptyLifetime).first->second, *m_Textures[textureIndex]);
+    }
+
+    UnorderedMap<uint32_t, RGResourceLifetime> bufferLifetimes;
+    for (uint32_t bufferIndex{}; bufferIndex < m_Buffers.size(); ++bufferIndex)
+    {
+        const uint32_t rootIndex = m_CompiledGraph->BufferRoots.at(bufferIndex);
+        if (!m_Buffers.at(rootIndex)->Description.bTransient) continue;
+
+        extendLifetime(bufferLifetimes.try_emplace(rootIndex, s_EmptyLifetime).first->second, *m_Buffers[bufferIndex]);
+    }
+
+    // Declaration order keeps requests stable between frames, so pool can reuse previous placement.
+    for (uint32_t textureIndex{}; textureIndex < m_Textures.size(); ++textureIndex)
+    {
+        const auto it = textureLifetimes.find(textureIndex);
+        if (it != textureLifetimes.end() && it->second.FirstUse <= it->second.LastUse)
+            m_CompiledGraph->TextureLifetimes.emplace_back(textureIndex, it->second);
+    }
+
+    for (uint32_t bufferIndex{}; bufferIndex < m_Buffers.size(); ++bufferIndex)
+    {
+        const auto it = bufferLifetimes.find(bufferIndex);
+        if (it != bufferLifetimes.end() && it->second.FirstUse <= it->second.LastUse)
+            m_CompiledGraph->BufferLifetimes.emplace_back(bufferIndex, it->second);
+    }
+}
+
+void RenderGraph::AliasTransientResources()
+{
+    // NOTE: Lifetimes come from compiled graph, so topology hash covers them, only sizes can change on their own(resize).
+    uint64_t placementHash = m_CompiledGraph->TopologyHash;
+    for (const auto& [textureIndex, lifetime] : m_CompiledGraph->TextureLifetimes)
+    {
+        const auto& spec = m_Textures[textureIndex]->Description;
+        RGUtils::HashCombine(placementHash, static_cast<uint64_t>(spec.Width) << 32 | spec.Height);
+        RGUtils::HashCombine(placementHash, static_cast<uint64_t>(spec.Format) << 32 | spec.Layers);
+        RGUtils::HashCombine(placementHash, spec.Mips);
+        RGUtils::HashCombine(placementHash, static_cast<uint64_t>(spec.UsageFlags));
+        RGUtils::HashCombine(placementHash, static_cast<uint64_t>(spec.Wrap) << 16 | static_cast<uint64_t>(spec.Filter) << 8 |
+                                                static_cast<uint64_t>(spec.bGenerateMips));
+    }
+
+    for (const auto& [bufferIndex, lifetime] : m_CompiledGraph->BufferLifetimes)
+    {
+        const auto& spec = m_Buffers[bufferIndex]->Description;
+        RGUtils::HashCombine(placementHash, spec.Capacity);
+        RGUtils::HashCombine(placementHash, static_cast<uint64_t>(spec.UsageFlags) << 32 | static_cast<uint64_t>(spec.ExtraFlags));
+    }
+
+    if (!m_ResourcePool.IsTransientPlacementUpToDate(placementHash))
+    {
+        std::vector<RGTransientTextureRequest> textureRequests;
+        textureRequests.reserve(m_CompiledGraph->TextureLifetimes.size());
+        for (const auto& [textureIndex, lifetime] : m_CompiledGraph->TextureLifetimes)
+            textureRequests.emplace_back(m_Textures[textureIndex]->Name, &m_Textures[textureIndex]->Description, lifetime);
+
+        std::vector<RGTransientBufferRequest> bufferRequests;
+        bufferRequests.reserve(m_CompiledGraph->BufferLifetimes.size());
+        for (const auto& [bufferIndex, lifetime] : m_CompiledGraph->BufferLifetimes)
+            bufferRequests.emplace_back(m_Buffers[bufferIndex]->Name, &m_Buffers[bufferIndex]->Description, lifetime);
+
+        m_ResourcePool.PlaceTransientResources(placementHash, textureRequests, bufferRequests);
+    }
+    Renderer::GetStats().TransientMemoryStats = m_ResourcePool.GetTransientMemoryStats();
+}
+
+void RenderGraph::ResolveBarriers(const uint32_t passIndex, std::vector<BufferMemoryBarrier>& bufferMemoryBarriers,
+                                  std::vector<ImageMemoryBarrier>& imageMemoryBarriers)
+{
+    const auto& currentPass  = m_Passes.at(passIndex);
+    const auto& passBarriers = m_CompiledGraph->PassBarriers.at(passIndex);
+    const auto queue         = m_CompiledGraph->PassQueues.at(passIndex);
+
+    bufferMemoryBarriers.reserve(bufferMemoryBarriers.size() + passBarriers.BufferBarriers.size());
+    for (const auto& bufferBarrierTemplate : passBarriers.BufferBarriers)
+    {
+        // NOTE: Capacity is checked on handle, since pool may hand out an already grown buffer for a zero-sized request.
+        const auto& buffer = m_Buffers.at(bufferBarrierTemplate.BufferIndex)->Handle;
+        if (buffer->GetSpecification().Capacity == 0) continue;
+
+        auto& bufferBarrier  = bufferMemoryBarriers.emplace_back(bufferBarrierTemplate.Barrier);
+        bufferBarrier.buffer = buffer;
+        RGUtils::ClampBarrierToQueue(bufferBarrier, queue);
+    }
+
+    // NOTE: Layouts are applied in planned order, so each check sees the same layout as it would during planning.
+    imageMemoryBarriers.reserve(imageMemoryBarriers.size() + passBarriers.ImageBarriers.size());
+    for (const auto& imageBarrierTemplate : passBarriers.ImageBarriers)
+    {
+        const auto image      = m_Textures.at(imageBarrierTemplate.TextureIndex)->Handle->GetImage();
+        const auto& imageSpec = image->GetSpecification();
+        const bool bReadBarrier = imageBarrierTemplate.Hazard == ERGBarrierHazard::RGBARRIER_HAZARD_RAW;
+        if (bReadBarrier && !imageBarrierTemplate.bQueueTransfer && !IsRGTransferPass(currentPass->m_Type) &&
+            imageSpec.Layout == EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+            continue;
+
+        auto& imageBarrier            = imageMemoryBarriers.emplace_back(imageBarrierTemplate.Barrier);
+        imageBarrier.image            = image;
+        imageBarrier.subresourceRange = {
+            .baseMipLevel   = 0,
+            .mipCount       = imageSpec.Mips,
+            .baseArrayLayer = 0,
+            .layerCount     = imageSpec.Layers,
+        };
+
+        // NOTE: Layouts have to match the release recorded on the owner queue, both are taken from the image.
+        if (imageBarrierTemplate.bQueueTransfer)
+        {
+            imageBarrier.oldLayout = imageSpec.Layout;
+            if (imageBarrier.newLayout == EImageLayout::IMAGE_LAYOUT_UNDEFINED) imageBarrier.newLayout = imageSpec.Layout;
+
+            const uint32_t srcQueueFamilyIndex = GraphicsContext::Get().GetQueueFamilyIndex(imageBarrierTemplate.SrcQueue);
+            const uint32_t dstQueueFamilyIndex = GraphicsContext::Get().GetQueueFamilyIndex(imageBarrierTemplate.DstQueue);
+            if (srcQueueFamilyIndex != dstQueueFamilyIndex)
+            {
+                imageBarrier.srcQueueFamilyIndex = MakeOptional<uint32_t>(srcQueueFamilyIndex);
+                imageBarrier.dstQueueFamilyIndex = MakeOptional<uint32_t>(dstQueueFamilyIndex);
+            }
+        }
+        else if (imageBarrierTemplate.Hazard == ERGBarrierHazard::RGBARRIER_HAZARD_WAW)
+        {
+            // NOTE: Memory is shared with other transient resources, so contents are discarded(UNDEFINED), wait for previous occupant.
+            const bool bAliasingBarrier = imageBarrierTemplate.bTextureCreation && imageSpec.AliasingInfo.Memory;
+            if (bAliasingBarrier)
+            {
+                imageBarrier.srcStageMask  = EPipelineStage::PIPELINE_STAGE_ALL_COMMANDS_BIT;
+                imageBarrier.srcAccessMask = EAccessFlags::ACCESS_MEMORY_WRITE_BIT;
+            }
+
+            // NOTE: Since I drop all the things from other Build*Barriers() here:
+            if (!bAliasingBarrier && imageSpec.Layout == EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+            {
+                imageBarrier.oldLayout = EImageLayout::IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                imageBarrier.srcStageMask |= EPipelineStage::PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+                imageBarrier.srcAccessMask |= EAccessFlags::ACCESS_SHADER_READ_BIT | EAccessFlags::ACCESS_SHADER_SAMPLED_READ_BIT;
+            }
+        }
+
+        RGUtils::ClampBarrierToQueue(imageBarrier, queue);
+        if (imageBarrier.newLayout != EImageLayout::IMAGE_LAYOUT_UNDEFINED) image->SetLayout(imageBarrier.newLayout);
+    }
+}
+
+void RenderGraph::ResolveReleaseBarriers(const uint32_t passIndex, std::vector<ImageMemoryBarrier>& imageMemoryBarriers)
+{
+    const auto& releaseBarriers = m_CompiledGraph->PassBarriers.at(passIndex).ReleaseImageBarriers;
+    imageMemoryBarriers.reserve(imageMemoryBarriers.size() + releaseBarriers.size());
+    for (const auto& imageBarrierTemplate : releaseBarriers)
+    {
+        // Same family means no ownership to give away, acquire on the other side is a plain barrier then.
+        const uint32_t srcQueueFamilyIndex = GraphicsContext::Get().GetQueueFamilyIndex(imageBarrierTemplate.SrcQueue);
+        const uint32_t dstQueueFamilyIndex = GraphicsContext::Get().GetQueueFamilyIndex(imageBarrierTemplate.DstQueue);
+        if (srcQueueFamilyIndex == dstQueueFamilyIndex) continue;
+
+        // NOTE: Layout isn't tracked here, acquire performs the transition and updates it.
+        const auto image                 = m_Textures.at(imageBarrierTemplate.TextureIndex)->Handle->GetImage();
+        const auto& imageSpec            = image->GetSpecification();
+        auto& imageBarrier               = imageMemoryBarriers.emplace_back(imageBarrierTemplate.Barrier);
+        imageBarrier.image               = image;
+        imageBarrier.oldLayout           = imageSpec.Layout;
+        imageBarrier.srcQueueFamilyIndex = MakeOptional<uint32_t>(srcQueueFamilyIndex);
+        imageBarrier.dstQueueFamilyIndex = MakeOptional<uint32_t>(dstQueueFamilyIndex);
+        if (imageBarrier.newLayout == EImageLayout::IMAGE_LAYOUT_UNDEFINED) imageBarrier.newLayout = imageSpec.Layout;
+        imageBarrier.subresourceRange = {
+            .baseMipLevel   = 0,
+            .mipCount       = imageSpec.Mips,
+            .baseArrayLayer = 0,
+            .layerCount     = imageSpec.Layers,
+        };
+    }
+}
+
+std::string RenderGraph::ExportGraphViz() const
+{
+    PFR_ASSERT(m_CompiledGraph, "RenderGraph isn't compiled!");
+
+    const auto passPlacements = RGUtils::GetCompiledPassPlacements(*m_CompiledGraph, static_cast<uint32_t>(m_Passes.size()));
 
     std::stringstream ss;
-    ss << "digraph " << m_Name << " {" << std::endl;
-    ss << "\tnode [shape=rectangle, style=filled];" << std::endl;
-    ss << "\tedge [color=black];" << std::endl << std::endl;
+    ss << "digraph \"" << m_Name << "\" {" << std::endl;
+    ss << "\trankdir=LR;" << std::endl;
+    ss << "\tnode [style=filled, fontname=\"Consolas\", fontsize=10];" << std::endl;
+    ss << "\tedge [color=black, fontname=\"Consolas\", fontsize=8];" << std::endl << std::endl;
 
-    for (const auto idx : m_TopologicallySortedPasses)
+    for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
     {
-        const auto& pass = m_Passes.at(idx);
-        for (const auto passIndex : m_AdjdacencyLists.at(idx))
+        const auto& pass           = m_Passes[passIndex];
+        const auto queue           = m_CompiledGraph->PassQueues.at(passIndex);
+        const auto& passPlacement  = passPlacements[passIndex];
+        std::string label          = std::format("{}\\n{}", pass->m_Name, RGPassTypeToString(pass->m_Type));
+        std::string_view fillColor = "lightgray";
+        std::string_view style     = "filled";
+        if (m_CompiledGraph->CulledPasses.at(passIndex))
         {
-            ss << "\t" << pass->m_Name << " -> " << m_Passes.at(passIndex)->m_Name << std::endl;
+            label += "\\nCULLED";
+            fillColor = "gray";
+            style     = "filled,dashed";
         }
-        ss << std::endl;
+        else
+        {
+            label += std::format("\\norder {}, batch {}, group {}", passPlacement.Order.value(), passPlacement.Batch.value(),
+                                 passPlacement.BarrierGroup.value());
+            if (queue == ECommandBufferType::COMMAND_BUFFER_TYPE_COMPUTE_ASYNC)
+                fillColor = "lightblue";
+            else if (queue == ECommandBufferType::COMMAND_BUFFER_TYPE_TRANSFER_ASYNC)
+                fillColor = "lightyellow";
+        }
+
+        ss << std::format("\tP{} [shape=rectangle, label=\"{}\", fillcolor=\"{}\", style=\"{}\"];", passIndex, label, fillColor, style)
+           << std::endl;
+    }
+    ss << std::endl;
+
+    // NOTE: Resources carry their root lifetime and heap range, so nodes with disjoint lifetimes and overlapping ranges share memory.
+    const auto getResourceLabelSuffix = [](const Optional<RGResourceLifetime>& lifetime, const Optional<RGTransientPlacement>& placement)
+    {
+        std::string labelSuffix = {};
+        if (lifetime) labelSuffix += std::format("\\nlifetime [{}..{}]", lifetime->FirstUse, lifetime->LastUse);
+        if (placement) labelSuffix += std::format("\\nheap [{}..{})", placement->Offset, placement->Offset + placement->Size);
+        return labelSuffix;
+    };
+
+    for (uint32_t textureIndex{}; textureIndex < m_Textures.size(); ++textureIndex)
+    {
+        const auto& texture      = m_Textures[textureIndex];
+        const uint32_t rootIndex = m_CompiledGraph->TextureRoots.at(textureIndex);
+        const auto& rootTexture  = m_Textures.at(rootIndex);
+        const auto& spec         = texture->Description;
+
+        std::string label = std::format("{}\\n{}x{}x{} {}", texture->Name.GetString(), spec.Width, spec.Height, spec.Layers,
+                                        ImageUtils::ImageFormatToString(spec.Format));
+        label += getResourceLabelSuffix(RGUtils::FindLifetime(m_CompiledGraph->TextureLifetimes, rootIndex),
+                                        m_ResourcePool.GetTransientTexturePlacement(rootTexture->Name));
+
+        ss << std::format("\tT{} [shape=ellipse, label=\"{}\", fillcolor=\"{}\"];", textureIndex, label,
+                          rootTexture->Description.bTransient ? "palegreen" : "white")
+           << std::endl;
+        if (texture->AliasSource)
+            ss << std::format("\tT{} -> T{} [style=dotted, label=\"alias\"];", texture->AliasSource.value(), textureIndex) << std::endl;
+    }
+
+    for (uint32_t bufferIndex{}; bufferIndex < m_Buffers.size(); ++bufferIndex)
+    {
+        const auto& buffer       = m_Buffers[bufferIndex];
+        const uint32_t rootIndex = m_CompiledGraph->BufferRoots.at(bufferIndex);
+        const auto& rootBuffer   = m_Buffers.at(rootIndex);
+        std::string label        = std::format("{}\\n{} bytes", buffer->Name.GetString(), buffer->Description.Capacity);
+        label += getResourceLabelSuffix(RGUtils::FindLifetime(m_CompiledGraph->BufferLifetimes, rootIndex),
+                                        m_ResourcePool.GetTransientBufferPlacement(rootBuffer->Name));
+
+        std::string_view fillColor = "white";
+        if (rootBuffer->bImported)
+            fillColor = "orange";
+        else if (rootBuffer->Description.bTransient)
+            fillColor = "palegreen";
+
+        ss << std::format("\tB{} [shape=cylinder, label=\"{}\", fillcolor=\"{}\"];", bufferIndex, label, fillColor) << std::endl;
+        if (buffer->AliasSource)
+            ss << std::format("\tB{} -> B{} [style=dotted, label=\"alias\"];", buffer->AliasSource.value(), bufferIndex) << std::endl;
+    }
+    ss << std::endl;
+
+    // Resource edges: reads go into the pass, writes and creates out of it, labeled with barrier pass records for that resource.
+    for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
+    {
+        const auto& pass         = m_Passes[passIndex];
+        const auto& passBarriers = m_CompiledGraph->PassBarriers.at(passIndex);
+
+        const auto getTextureBarrierLabel = [&](const uint32_t textureIndex)
+        {
+            std::string barrierLabel = {};
+            for (const auto& imageBarrierTemplate : passBarriers.ImageBarriers)
+            {
+                if (imageBarrierTemplate.TextureIndex != textureIndex) continue;
+
+                barrierLabel += std::format("{} {} -> {}{}\\n", RGUtils::BarrierHazardToString(imageBarrierTemplate.Hazard),
+                                            RGUtils::ImageLayoutToString(imageBarrierTemplate.Barrier.oldLayout),
+                                            RGUtils::ImageLayoutToString(imageBarrierTemplate.Barrier.newLayout),
+                                            imageBarrierTemplate.bQueueTransfer ? " (acquire)" : "");
+            }
+            return barrierLabel;
+        };
+
+        const auto getBufferBarrierLabel = [&](const uint32_t bufferIndex)
+        {
+            std::string barrierLabel = {};
+            for (const auto& bufferBarrierTemplate : passBarriers.BufferBarriers)
+            {
+                if (bufferBarrierTemplate.BufferIndex == bufferIndex)
+                    barrierLabel += std::format("{}\\n", RGUtils::BarrierHazardToString(bufferBarrierTemplate.Hazard));
+            }
+            return barrierLabel;
+        };
+
+        for (const auto textureID : pass->m_TextureReads)
+            ss << std::format("\tT{0} -> P{1} [label=\"{2}\"];", textureID.m_ID.value(), passIndex,
+                              getTextureBarrierLabel(textureID.m_ID.value()))
+               << std::endl;
+
+        for (const auto& textureIDs : {std::cref(pass->m_TextureCreates), std::cref(pass->m_TextureWrites)})
+        {
+            for (const auto textureID : textureIDs.get())
+            {
+                if (&textureIDs.get() == &pass->m_TextureCreates && pass->m_TextureWrites.contains(textureID)) continue;
+
+                ss << std::format("\tP{0} -> T{1} [color=red, label=\"{2}\"];", passIndex, textureID.m_ID.value(),
+                                  getTextureBarrierLabel(textureID.m_ID.value()))
+                   << std::endl;
+            }
+        }
+
+        for (const auto bufferID : pass->m_BufferReads)
+            ss << std::format("\tB{0} -> P{1} [label=\"{2}\"];", bufferID.m_ID.value(), passIndex,
+                              getBufferBarrierLabel(bufferID.m_ID.value()))
+               << std::endl;
+
+        for (const auto& bufferIDs : {std::cref(pass->m_BufferCreates), std::cref(pass->m_BufferWrites)})
+        {
+            for (const auto bufferID : bufferIDs.get())
+            {
+                if (&bufferIDs.get() == &pass->m_BufferCreates && pass->m_BufferWrites.contains(bufferID)) continue;
+
+                ss << std::format("\tP{0} -> B{1} [color=red, label=\"{2}\"];", passIndex, bufferID.m_ID.value(),
+                                  getBufferBarrierLabel(bufferID.m_ID.value()))
+                   << std::endl;
+            }
+        }
+
+        // Queue ownership releases are recorded after the pass, so they hang on the pass itself.
+        for (const auto& imageBarrierTemplate : passBarriers.ReleaseImageBarriers)
+            ss << std::format("\tP{} -> T{} [style=dashed, color=blue, label=\"release to {}\"];", passIndex,
+                              imageBarrierTemplate.TextureIndex, RGUtils::QueueToString(imageBarrierTemplate.DstQueue))
+               << std::endl;
     }
 
     ss << "}" << std::endl;
+    return ss.str();
+}
+
+std::string RenderGraph::ExportJSON() const
+{
+    PFR_ASSERT(m_CompiledGraph, "RenderGraph isn't compiled!");
+
+    const auto passPlacements = RGUtils::GetCompiledPassPlacements(*m_CompiledGraph, static_cast<uint32_t>(m_Passes.size()));
+    const auto toOptionalJSON = [](const auto& value) { return value.has_value() ? nlohmann::ordered_json(value.value()) : nullptr; };
+    const auto toIndicesJSON  = [](const auto& resourceIDs)
+    {
+        nlohmann::ordered_json indices = nlohmann::ordered_json::array();
+        for (const auto resourceID : resourceIDs)
+            indices.emplace_back(resourceID.m_ID.value());
+        return indices;
+    };
+
+    const auto toBarrierJSON = [](const auto& barrier, const ERGBarrierHazard hazard)
+    {
+        nlohmann::ordered_json barrierJSON;
+        barrierJSON["hazard"]     = RGUtils::BarrierHazardToString(hazard);
+        barrierJSON["src_stage"]  = std::format("{:#x}", barrier.srcStageMask);
+        barrierJSON["src_access"] = std::format("{:#x}", barrier.srcAccessMask);
+        barrierJSON["dst_stage"]  = std::format("{:#x}", barrier.dstStageMask);
+        barrierJSON["dst_access"] = std::format("{:#x}", barrier.dstAccessMask);
+        return barrierJSON;
+    };
+
+    const auto toImageBarrierJSON = [&](const RGImageBarrierTemplate& imageBarrierTemplate)
+    {
+        auto barrierJSON                = toBarrierJSON(imageBarrierTemplate.Barrier, imageBarrierTemplate.Hazard);
+        barrierJSON["texture"]          = imageBarrierTemplate.TextureIndex;
+        barrierJSON["old_layout"]       = RGUtils::ImageLayoutToString(imageBarrierTemplate.Barrier.oldLayout);
+        barrierJSON["new_layout"]       = RGUtils::ImageLayoutToString(imageBarrierTemplate.Barrier.newLayout);
+        barrierJSON["texture_creation"] = imageBarrierTemplate.bTextureCreation;
+        if (imageBarrierTemplate.bQueueTransfer)
+        {
+            barrierJSON["src_queue"] = RGUtils::QueueToString(imageBarrierTemplate.SrcQueue);
+            barrierJSON["dst_queue"] = RGUtils::QueueToString(imageBarrierTemplate.DstQueue);
+        }
+        return barrierJSON;
+    };
+
+    nlohmann::ordered_json passes = nlohmann::ordered_json::array();
+    for (uint32_t passIndex{}; passIndex < m_Passes.size(); ++passIndex)
+    {
+        const auto& pass          = m_Passes[passIndex];
+        const auto& passPlacement = passPlacements[passIndex];
+        const auto& passBarriers  = m_CompiledGraph->PassBarriers.at(passIndex);
+
+        nlohmann::ordered_json passJSON;
+        passJSON["index"]            = passIndex;
+        passJSON["name"]             = pass->m_Name;
+        passJSON["type"]             = RGPassTypeToString(pass->m_Type);
+        passJSON["queue"]            = RGUtils::QueueToString(m_CompiledGraph->PassQueues.at(passIndex));
+        passJSON["culled"]           = m_CompiledGraph->CulledPasses.at(passIndex) != 0;
+        passJSON["side_effects"]     = pass->m_bHasSideEffects;
+        passJSON["dependency_level"] = m_CompiledGraph->DependencyLevels.at(passIndex);
+        passJSON["order"]            = toOptionalJSON(passPlacement.Order);
+        passJSON["batch"]            = toOptionalJSON(passPlacement.Batch);
+        passJSON["barrier_group"]    = toOptionalJSON(passPlacement.BarrierGroup);
+        passJSON["successors"]       = m_CompiledGraph->AdjacencyLists.at(passIndex);
+        passJSON["queue_waits"]      = m_CompiledGraph->PassQueueWaits.at(passIndex);
+
+        passJSON["texture_creates"] = toIndicesJSON(pass->m_TextureCreates);
+        passJSON["texture_reads"]   = toIndicesJSON(pass->m_TextureReads);
+        passJSON["texture_writes"]  = toIndicesJSON(pass->m_TextureWrites);
+        passJSON["buffer_creates"]  = toIndicesJSON(pass->m_BufferCreates);
+        passJSON["buffer_reads"]    = toIndicesJSON(pass->m_BufferReads);
+        passJSON["buffer_writes"]   = toIndicesJSON(pass->m_BufferWrites);
+
+        nlohmann::ordered_json bufferBarriers = nlohmann::ordered_json::array();
+        for (const auto& bufferBarrierTemplate : passBarriers.BufferBarriers)
+        {
+            auto barrierJSON      = toBarrierJSON(bufferBarrierTemplate.Barrier, bufferBarrierTemplate.Hazard);
+            barrierJSON["buffer"] = bufferBarrierTemplate.BufferIndex;
+            bufferBarriers.emplace_back(std::move(barrierJSON));
+        }
+
+        nlohmann::ordered_json imageBarriers = nlohmann::ordered_json::array();
+        for (const auto& imageBarrierTemplate : passBarriers.ImageBarriers)
+            imageBarriers.emplace_back(toImageBarrierJSON(imageBarrierTemplate));
+
+        nlohmann::ordered_json releaseImageBarriers = nlohmann::ordered_json::array();
+        for (const auto& imageBarrierTemplate : passBarriers.ReleaseImageBarriers)
+            releaseImageBarriers.emplace_back(toImageBarrierJSON(imageBarrierTemplate));
+
+        passJSON["barriers"]["buffers"]        = std::move(bufferBarriers);
+        passJSON["barriers"]["images"]         = std::move(imageBarriers);
+        passJSON["barriers"]["image_releases"] = std::move(releaseImageBarriers);
+        passes.emplace_back(std::move(passJSON));
+    }
+
+    // NOTE: Lifetime and heap placement belong to alias root, versions(_V0 -> _V1) share them. Roots with overlapping heap ranges
+    // are the ones sharing memory.
+    const auto fillResourceJSON = [&](nlohmann::ordered_json& resourceJSON, const RGResource& resource, const uint32_t resourceIndex,
+                                      const uint32_t rootIndex, const Optional<RGResourceLifetime>& lifetime,
+                                      const Optional<RGTransientPlacement>& placement)
+    {
+        resourceJSON["index"]        = resourceIndex;
+        resourceJSON["name"]         = resource.Name.GetString();
+        resourceJSON["alias_source"] = toOptionalJSON(resource.AliasSource);
+        resourceJSON["alias_root"]   = rootIndex;
+        resourceJSON["lifetime"]     = nullptr;
+        if (lifetime) resourceJSON["lifetime"] = {{"first_use", lifetime->FirstUse}, {"last_use", lifetime->LastUse}};
+
+        resourceJSON["heap_placement"] = nullptr;
+        if (placement) resourceJSON["heap_placement"] = {{"offset", placement->Offset}, {"size", placement->Size}};
+    };
+
+    nlohmann::ordered_json textures = nlohmann::ordered_json::array();
+    for (uint32_t textureIndex{}; textureIndex < m_Textures.size(); ++textureIndex)
+    {
+        const auto& texture      = m_Textures[textureIndex];
+        const uint32_t rootIndex = m_CompiledGraph->TextureRoots.at(textureIndex);
+        const auto& rootSpec     = m_Textures.at(rootIndex)->Description;
+
+        nlohmann::ordered_json textureJSON;
+        fillResourceJSON(textureJSON, *texture, textureIndex, rootIndex,
+                         RGUtils::FindLifetime(m_CompiledGraph->TextureLifetimes, rootIndex),
+                         m_ResourcePool.GetTransientTexturePlacement(m_Textures.at(rootIndex)->Name));
+
+        const auto& spec          = texture->Description;
+        textureJSON["debug_name"] = spec.DebugName;
+        textureJSON["width"]      = spec.Width;
+        textureJSON["height"]     = spec.Height;
+        textureJSON["layers"]     = spec.Layers;
+        textureJSON["format"]     = ImageUtils::ImageFormatToString(spec.Format);
+        textureJSON["usage"]      = std::format("{:#x}", spec.UsageFlags);
+        textureJSON["mips"]       = spec.bGenerateMips;
+        textureJSON["transient"]  = rootSpec.bTransient;
+        textureJSON["per_frame"]  = spec.bPerFrame;
+        textures.emplace_back(std::move(textureJSON));
+    }
+
+    nlohmann::ordered_json buffers = nlohmann::ordered_json::array();
+    for (uint32_t bufferIndex{}; bufferIndex < m_Buffers.size(); ++bufferIndex)
+    {
+        const auto& buffer       = m_Buffers[bufferIndex];
+        const uint32_t rootIndex = m_CompiledGraph->BufferRoots.at(bufferIndex);
+        const auto& rootBuffer   = m_Buffers.at(rootIndex);
+
+        nlohmann::ordered_json bufferJSON;
+        fillResourceJSON(bufferJSON, *buffer, bufferIndex, rootIndex, RGUtils::FindLifetime(m_CompiledGraph->BufferLifetimes, rootIndex),
+                         m_ResourcePool.GetTransientBufferPlacement(rootBuffer->Name));
+
+        const auto& spec         = buffer->Description;
+        bufferJSON["debug_name"] = spec.DebugName;
+        bufferJSON["capacity"]   = spec.Capacity;
+        bufferJSON["usage"]      = std::format("{:#x}", spec.UsageFlags);
+        bufferJSON["flags"]      = std::format("{:#x}", spec.ExtraFlags);
+        bufferJSON["transient"]  = rootBuffer->Description.bTransient;
+        bufferJSON["per_frame"]  = spec.bPerFrame;
+        bufferJSON["imported"]   = rootBuffer->bImported;
+        buffers.emplace_back(std::move(bufferJSON));
+    }
+
+    nlohmann::ordered_json submissionBatches = nlohmann::ordered_json::array();
+    for (const auto& batch : m_CompiledGraph->SubmissionBatches)
+    {
+        submissionBatches.push_back({{"queue", RGUtils::QueueToString(batch.Queue)},
+                                     {"passes", batch.Passes},
+                                     {"wait_batches", batch.WaitBatches},
+                                     {"barrier_group_starts", batch.BarrierGroupStarts}});
+    }
+
+    const auto& barrierStats = m_CompiledGraph->PlannedBarrierStats;
+    nlohmann::ordered_json json;
+    json["name"]                   = m_Name;
+    json["topology_hash"]          = std::format("{:016x}", m_CompiledGraph->TopologyHash);
+    json["dependency_level_count"] = m_CompiledGraph->DependencyLevelCount;
+    json["culled_pass_count"]      = m_CompiledGraph->CulledPassCount;
+    json["queue_transfer_count"]   = m_CompiledGraph->QueueTransferCount;
+    json["passes"]                 = std::move(passes);
+    json["textures"]               = std::move(textures);
+    json["buffers"]                = std::move(buffers);
+    json["submission_batches"]     = std::move(submissionBatches);
+    json["planned_barrier_stats"]  = {{"barriers", barrierStats.BarrierCount},
+                                      {"merged_barriers", barrierStats.MergedBarrierCount},
+                                      {"barrier_calls", barrierStats.BarrierCallCount},
+                                      {"merged_barrier_calls", barrierStats.MergedBarrierCallCount}};
+    return json.dump(4);
+}
+
+void RenderGraph::DumpCompiledGraph() const
+{
+    PFR_ASSERT(!m_Passes.empty() && !m_Name.empty(), "DebugName or passes array is not valid!");
+
+    const auto& appSpec  = Application::Get().GetSpecification();
+    const auto assetsDir = std::filesystem::path(appSpec.WorkingDir) / appSpec.AssetsDir;
+
+    const std::string graphViz = ExportGraphViz();
+    SaveData((assetsDir / "render_graph_ref.dot").string().data(), graphViz.data(), graphViz.size());
 
-    const auto& appSpec = Application::Get().GetSpecification();
-    const auto savePath = std::filesystem::path(appSpec.WorkingDir) / appSpec.AssetsDir / "render_graph_ref.dot";
-    SaveData(savePath.string().data(), ss.str().data(), ss.str().size());
+    const std::string json = ExportJSON();
+    SaveData((assetsDir / "render_graph_ref.json").string().data(), json.data(), json.size());
 }
 
 }  // namespace Pathfinder
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "RenderGraphBuilder.h"
 
 #include "RenderGraphResourcePool.h"
+#include "RenderGraphCache.h"
 
 // https://medium.com/@pavlo.muratov/organizing-gpu-work-with-directed-acyclic-graphs-f3fd5f2c2af3
 // NOTE: Heavily inspired by Yuri ODonnel, themaister, Adria-DX12, LegitEngine.
@@ -19,7 +20,8 @@ class CommandBuffer;
 class RenderGraph final : private Uncopyable, private Unmovable
 {
   public:
-    RenderGraph(const uint8_t currentFrameIndex, const std::string& name, RenderGraphResourcePool& resourcePool);
+    RenderGraph(const uint8_t currentFrameIndex, const std::string& name, RenderGraphResourcePool& resourcePool,
+                RenderGraphCache& renderGraphCache);
     ~RenderGraph() = default;
 
     template <typename TData, typename... Args>
@@ -37,26 +39,62 @@ class RenderGraph final : private Uncopyable, private Unmovable
     void Build();
     void Execute();
 
-    RGTextureID DeclareTexture(const std::string& name, const RGTextureSpecification& rgTextureSpec);
-    RGBufferID DeclareBuffer(const std::string& name, const RGBufferSpecification& rgBufferSpec);
+    // NOTE: CPU-only part of Build(): dependencies, execution order, lifetimes and barriers, no GPU resources are touched, so it can be
+    // called repeatedly. Compiled graph is taken from cache in case topology hash matches one of the previous frames.
+    void Compile();
+    NODISCARD FORCEINLINE const auto& GetTopologicallySortedPasses() const
+    {
+        PFR_ASSERT(m_CompiledGraph, "RenderGraph isn't compiled!");
+        return m_CompiledGraph->TopologicallySortedPasses;
+    }
+    NODISCARD FORCEINLINE uint32_t GetPassCount() const { return static_cast<uint32_t>(m_Passes.size()); }
+    NODISCARD FORCEINLINE const auto& GetSubmissionBatches() const
+    {
+        PFR_ASSERT(m_CompiledGraph, "RenderGraph isn't compiled!");
+        return m_CompiledGraph->SubmissionBatches;
+    }
+
+    NODISCARD FORCEINLINE const auto& GetPlannedBarrierStats() const
+    {
+        PFR_ASSERT(m_CompiledGraph, "RenderGraph isn't compiled!");
+        return m_CompiledGraph->PlannedBarrierStats;
+    }
+
+    // NOTE: Last graphics batch is recorded into render command buffer, renderer submits it along with swapchain, so it has to wait
+    // on these as well.
+    NODISCARD FORCEINLINE const auto& GetFinalBatchWaitPoints() const { return m_FinalBatchWaitPoints; }
+
+    // Replays submission batches on CPU with given per pass GPU cost(ms), nothing is recorded.
+    NODISCARD RGScheduleStats SimulateSchedule(const std::function<float(const uint32_t passIndex)>& passCostFunc) const;
+
+    // NOTE: Compiled graph dumps: passes(queue, culled), resources(size, format, lifetime), aliasing and planned barriers. Work right
+    // after Compile(), so no GPU is needed, heap placements of transient resources show up only once Build() has placed them.
+    NODISCARD std::string ExportGraphViz() const;
+    NODISCARD std::string ExportJSON() const;
+
+    RGTextureID DeclareTexture(const RGResourceName& name, const RGTextureSpecification& rgTextureSpec);
+    RGBufferID DeclareBuffer(const RGResourceName& name, const RGBufferSpecification& rgBufferSpec);
+    // NOTE: Buffer is owned outside of the graph(contents persist across frames), graph only tracks its usage and barriers.
+    RGBufferID ImportBuffer(const RGResourceName& name, const Shared<Buffer>& buffer);
 
-    RGTextureID AliasTexture(const std::string& name, const std::string& source);
-    RGBufferID AliasBuffer(const std::string& name, const std::string& source);
+    RGTextureID AliasTexture(const RGResourceName& name, const RGResourceName& source);
+    RGBufferID AliasBuffer(const RGResourceName& name, const RGResourceName& source);
 
-    FORCEINLINE NODISCARD RGTextureID GetTextureID(const std::string& name) const
+    // NOTE: Plain index into table addressed by interned name ID, no string hashing.
+    FORCEINLINE NODISCARD RGTextureID GetTextureID(const RGResourceName& name) const
     {
-        PFR_ASSERT(!name.empty(), "Invalid texture name!");
-        PFR_ASSERT(m_TextureNameIDMap.contains(name), "Texture isn't declared!");
+        PFR_ASSERT(name.IsValid(), "Invalid texture name!");
+        PFR_ASSERT(name.GetID() < m_TextureNameIDs.size() && m_TextureNameIDs[name.GetID()].IsValid(), "Texture isn't declared!");
 
-        return m_TextureNameIDMap.at(name);
+        return m_TextureNameIDs[name.GetID()];
     }
 
-    FORCEINLINE NODISCARD RGBufferID GetBufferID(const std::string& name) const
+    FORCEINLINE NODISCARD RGBufferID GetBufferID(const RGResourceName& name) const
     {
-        PFR_ASSERT(!name.empty(), "Invalid buffer name!");
-        PFR_ASSERT(m_BufferNameIDMap.contains(name), "Buffer isn't declared!");
+        PFR_ASSERT(name.IsValid(), "Invalid buffer name!");
+        PFR_ASSERT(name.GetID() < m_BufferNameIDs.size() && m_BufferNameIDs[name.GetID()].IsValid(), "Buffer isn't declared!");
 
-        return m_BufferNameIDMap.at(name);
+        return m_BufferNameIDs[name.GetID()];
     }
 
     NODISCARD Shared<Texture>& GetTexture(const RGTextureID resourceID);
@@ -69,37 +107,105 @@ class RenderGraph final : private Uncopyable, private Unmovable
     std::string m_Name = s_DEFAULT_STRING;
     uint8_t m_CurrentFrameIndex{};
     RenderGraphResourcePool& m_ResourcePool;
+    RenderGraphCache& m_RenderGraphCache;
 
     std::vector<Unique<RGPassBase>> m_Passes;
     std::vector<Unique<RGTexture>> m_Textures;
     std::vector<Unique<RGBuffer>> m_Buffers;
 
-    std::vector<uint32_t> m_TopologicallySortedPasses;
-    std::vector<std::vector<uint32_t>> m_AdjdacencyLists;
+    Shared<RGCompiledGraph> m_CompiledGraph = nullptr;
+    bool m_bRecompiled                      = false;
+    std::vector<Shared<SyncPoint>> m_FinalBatchWaitPoints;
+    std::array<std::array<uint32_t, s_WORKER_THREAD_COUNT>, 3> m_UsedSecondaryCommandBufferCounts = {};  // Per queue, per thread.
 
-    UnorderedMap<std::string, std::string> m_AliasMap;
-    UnorderedMap<std::string, RGTextureID> m_TextureNameIDMap;
-    UnorderedMap<std::string, RGBufferID> m_BufferNameIDMap;
+    std::vector<RGTextureID> m_TextureNameIDs;  // Indexed by interned name ID, invalid if graph doesn't declare it.
+    std::vector<RGBufferID> m_BufferNameIDs;
+
+    // Order dependent hash of everything compiled graph is derived from: passes, their resource usage and aliases.
+    NODISCARD uint64_t ComputeTopologyHash() const;
+
+    void ResolveAliasRoots();
+
+    // Reference counting from sinks(side effect passes, imported buffers), passes not contributing to any of them are culled.
+    void CullPasses();
+    NODISCARD RGCullingStats GetCullingStats() const;
 
     void BuildAdjacencyLists();
     void TopologicalSort();
+    void ComputeDependencyLevels();
 
-    // TODO: Populate it, cuz it's poor dump rn.
-    void GraphVizDump();
+    // Computes lifetimes of transient resources from topological order(stretched over async batch overlap), memory is aliased by
+    // resource pool in Build().
+    void ComputeResourceLifetimes();
+    void AliasTransientResources();
+
+    // Writes both dumps next to assets, called once per recompilation.
+    void DumpCompiledGraph() const;
+
+    // NOTE: Simulates execution in topological order to decide which passes each one syncs with, state is local to planning, so
+    // compiled barriers can be replayed every frame.
+    struct BarrierPlanState
+    {
+        UnorderedSet<uint32_t> RunPasses;
+        std::vector<UnorderedSet<uint32_t>> TextureSyncedWith;
+        std::vector<UnorderedSet<uint32_t>> BufferSyncedWith;
+        std::vector<Optional<EImageLayout>> ImageLayouts;  // Per root texture, empty until some barrier transitions it.
+
+        struct QueueAccessState
+        {
+            Optional<uint32_t> LastWriter;
+            std::vector<uint32_t> ReadersSinceWrite;
+            Optional<uint32_t> LastAccess;  // Image is owned by queue of this pass.
+        };
+        std::vector<QueueAccessState> TextureQueueAccesses;  // Per root.
+        std::vector<QueueAccessState> BufferQueueAccesses;
+    };
+    void PlanBarriers();
+
+    // Aliases(_V0 -> _V1) share physical resource, so hazards are tracked per root, write wins if pass does both.
+    void CollectRootAccesses(const uint32_t passIndex, UnorderedMap<uint32_t, bool>& textureRootAccesses,
+                             UnorderedMap<uint32_t, bool>& bufferRootAccesses) const;
+
+    // Collects passes of other queues current one has to wait on, turns first image barrier into ownership acquire if needed.
+    void TrackQueueAccesses(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers);
+
+    // Splits passes into per-queue submission batches, each cross-queue dependency becomes one semaphore wait.
+    void ScheduleSubmissions();
+
+    // Splits each batch into groups of passes free of hazards between each other, so their barriers can be merged and hoisted.
+    void PlanBarrierGroups();
 
     // BUFFER: Read-After-Write
-    std::vector<BufferMemoryBarrier> BuildBufferRAWBarriers(const Unique<RGPassBase>& currentPass, const UnorderedSet<uint32_t>& runPasses);
+    void BuildBufferRAWBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers);
     // BUFFER: Write-After-Read
-    std::vector<BufferMemoryBarrier> BuildBufferWARBarriers(const Unique<RGPassBase>& currentPass, const UnorderedSet<uint32_t>& runPasses);
+    void BuildBufferWARBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers);
     // BUFFER: Write-After-Write
-    std::vector<BufferMemoryBarrier> BuildBufferWAWBarriers(const Unique<RGPassBase>& currentPass, const UnorderedSet<uint32_t>& runPasses);
+    void BuildBufferWAWBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers);
 
-    // BUFFER: Read-After-Write
-    std::vector<ImageMemoryBarrier> BuildTextureRAWBarriers(const Unique<RGPassBase>& currentPass, const UnorderedSet<uint32_t>& runPasses);
+    // TEXTURE: Read-After-Write
+    void BuildTextureRAWBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers);
     // TEXTURE: Write-After-Read
-    std::vector<ImageMemoryBarrier> BuildTextureWARBarriers(const Unique<RGPassBase>& currentPass, const UnorderedSet<uint32_t>& runPasses);
+    void BuildTextureWARBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers);
     // TEXTURE: Write-After-Write
-    std::vector<ImageMemoryBarrier> BuildTextureWAWBarriers(const Unique<RGPassBase>& currentPass, const UnorderedSet<uint32_t>& runPasses);
+    void BuildTextureWAWBarriers(const uint32_t passIndex, BarrierPlanState& planState, RGPassBarrierTemplates& passBarriers);
+
+    // Fills handles of compiled barriers and applies checks that depend on current GPU state.
+    void ResolveBarriers(const uint32_t passIndex, std::vector<BufferMemoryBarrier>& bufferMemoryBarriers,
+                         std::vector<ImageMemoryBarrier>& imageMemoryBarriers);
+    void ResolveReleaseBarriers(const uint32_t passIndex, std::vector<ImageMemoryBarrier>& imageMemoryBarriers);
+
+    void ExecuteBatch(const RGSubmissionBatch& batch, Shared<CommandBuffer>& cb, RGBarrierStats& barrierStats);
+    // Allocates transient resources pass creates and resolves aliases, returns true if aliased buffer memory got reused.
+    NODISCARD bool PreparePassResources(const uint32_t passIndex);
+    void ExecutePass(const uint32_t passIndex, Shared<CommandBuffer>& cb);
+
+    NODISCARD bool IsRenderPass(const uint32_t passIndex) const;
+    void BeginPassRendering(const uint32_t passIndex, Shared<CommandBuffer>& cb, const bool bSecondaryContents);
+
+    // Called from ThreadPool workers, records pass body into a secondary of the calling thread.
+    NODISCARD Shared<CommandBuffer> RecordPassSecondary(const uint32_t passIndex, const ECommandBufferType queue);
+    // Rendering(if any), debug label and GPU timestamps stay on primary around the secondary.
+    void ExecutePassSecondary(const uint32_t passIndex, Shared<CommandBuffer>& cb, const Shared<CommandBuffer>& secondaryCommandBuffer);
 };
 
 }  // namespace Pathfinder
\ No newline at end of file
@@ -5,19 +5,24 @@
 namespace Pathfinder
 {
 
-void RenderGraphBuilder::DeclareBuffer(const std::string& name, const RGBufferSpecification& rgBufferSpec)
+void RenderGraphBuilder::DeclareBuffer(const RGResourceName& name, const RGBufferSpecification& rgBufferSpec)
 {
     m_RGPassBaseRef.m_BufferCreates.insert(m_RenderGraphRef.DeclareBuffer(name, rgBufferSpec));
 }
 
-void RenderGraphBuilder::DeclareTexture(const std::string& name, const RGTextureSpecification& rgTextureSpec)
+void RenderGraphBuilder::ImportBuffer(const RGResourceName& name, const Shared<Buffer>& buffer)
+{
+    m_RGPassBaseRef.m_BufferCreates.insert(m_RenderGraphRef.ImportBuffer(name, buffer));
+}
+
+void RenderGraphBuilder::DeclareTexture(const RGResourceName& name, const RGTextureSpecification& rgTextureSpec)
 {
     m_RGPassBaseRef.m_TextureCreates.insert(m_RenderGraphRef.DeclareTexture(name, rgTextureSpec));
 }
 
-RGTextureID RenderGraphBuilder::WriteTexture(const std::string& name, const std::string& input)
+RGTextureID RenderGraphBuilder::WriteTexture(const RGResourceName& name, const RGResourceName& input)
 {
-    if (input != s_DEFAULT_STRING)
+    if (input.IsValid())
     {
         const auto sourceTextureID = m_RenderGraphRef.GetTextureID(input);
         m_RGPassBaseRef.m_TextureReads.insert(sourceTextureID);
@@ -40,7 +45,7 @@ RGTextureID RenderGraphBuilder::WriteTexture(const std::string& name, const std:
     return textureID;
 }
 
-RGTextureID RenderGraphBuilder::ReadTexture(const std::string& name, const ResourceStateFlags resourceStateFlags)
+RGTextureID RenderGraphBuilder::ReadTexture(const RGResourceName& name, const ResourceStateFlags resourceStateFlags)
 {
     PFR_ASSERT(resourceStateFlags != 0, "Resource state flags can't be empty!");
 
@@ -52,10 +57,10 @@ RGTextureID RenderGraphBuilder::ReadTexture(const std::string& name, const Resou
     return textureID;
 }
 
-RGTextureID RenderGraphBuilder::WriteRenderTarget(const std::string& name, const ColorClearValue& clearValue, const EOp loadOp,
-                                                  const EOp storeOp, const std::string& input)
+RGTextureID RenderGraphBuilder::WriteRenderTarget(const RGResourceName& name, const ColorClearValue& clearValue, const EOp loadOp,
+                                                  const EOp storeOp, const RGResourceName& input)
 {
-    if (input != s_DEFAULT_STRING)
+    if (input.IsValid())
     {
         const auto sourceTextureID = m_RenderGraphRef.GetTextureID(input);
         m_RGPassBaseRef.m_TextureReads.insert(sourceTextureID);
@@ -81,11 +86,11 @@ RGTextureID RenderGraphBuilder::WriteRenderTarget(const std::string& name, const
     return textureID;
 }
 
-RGTextureID RenderGraphBuilder::WriteDepthStencil(const std::string& name, const DepthStencilClearValue& clearValue, const EOp depthLoadOp,
-                                                  const EOp depthStoreOp, const EOp stencilLoadOp, const EOp stencilStoreOp,
-                                                  const std::string& input)
+RGTextureID RenderGraphBuilder::WriteDepthStencil(const RGResourceName& name, const DepthStencilClearValue& clearValue,
+                                                  const EOp depthLoadOp, const EOp depthStoreOp, const EOp stencilLoadOp,
+                                                  const EOp stencilStoreOp, const RGResourceName& input)
 {
-    if (input != s_DEFAULT_STRING)
+    if (input.IsValid())
     {
         const auto sourceTextureID = m_RenderGraphRef.GetTextureID(input);
         m_RGPassBaseRef.m_TextureReads.insert(sourceTextureID);
@@ -123,7 +128,7 @@ RGTextureID RenderGraphBuilder::WriteDepthStencil(const std::string& name, const
     return textureID;
 }
 
-RGBufferID RenderGraphBuilder::ReadBuffer(const std::string& name, const ResourceStateFlags resourceStateFlags)
+RGBufferID RenderGraphBuilder::ReadBuffer(const RGResourceName& name, const ResourceStateFlags resourceStateFlags)
 {
     PFR_ASSERT(resourceStateFlags != 0, "Resource state flags can't be empty!");
 
@@ -135,9 +140,9 @@ RGBufferID RenderGraphBuilder::ReadBuffer(const std::string& name, const Resourc
     return bufferID;
 }
 
-RGBufferID RenderGraphBuilder::WriteBuffer(const std::string& name, const std::string& input)
+RGBufferID RenderGraphBuilder::WriteBuffer(const RGResourceName& name, const RGResourceName& input)
 {
-    if (input != s_DEFAULT_STRING)
+    if (input.IsValid())
     {
         const auto sourceBufferID = m_RenderGraphRef.GetBufferID(input);
         m_RGPassBaseRef.m_BufferReads.insert(sourceBufferID);
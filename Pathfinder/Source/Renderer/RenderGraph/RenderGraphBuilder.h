@@ -23,21 +23,25 @@ class RenderGraphBuilder final : private Uncopyable, private Unmovable
         m_RGPassBaseRef.m_ViewportScissorInfo = {.Width = width, .Height = height, .OffsetX = offsetX, .OffsetY = offsetY};
     }
 
-    void DeclareBuffer(const std::string& name, const RGBufferSpecification& rgBufferSpec);
-    void DeclareTexture(const std::string& name, const RGTextureSpecification& rgTextureSpec);
+    // NOTE: Pass does work visible outside of the graph(present, readback), keeps it and everything it depends on from being culled.
+    FORCEINLINE void SetSideEffect() { m_RGPassBaseRef.m_bHasSideEffects = true; }
 
-    RGTextureID WriteTexture(const std::string& name, const std::string& input = s_DEFAULT_STRING);
-    RGTextureID ReadTexture(const std::string& name, const ResourceStateFlags resourceStateFlags);
+    void DeclareBuffer(const RGResourceName& name, const RGBufferSpecification& rgBufferSpec);
+    void ImportBuffer(const RGResourceName& name, const Shared<Buffer>& buffer);
+    void DeclareTexture(const RGResourceName& name, const RGTextureSpecification& rgTextureSpec);
 
-    RGTextureID WriteRenderTarget(const std::string& name, const ColorClearValue& clearValue, const EOp loadOp, const EOp storeOp,
-                                  const std::string& input = s_DEFAULT_STRING);
-    RGTextureID WriteDepthStencil(const std::string& name, const DepthStencilClearValue& clearValue, const EOp depthLoadOp,
+    RGTextureID WriteTexture(const RGResourceName& name, const RGResourceName& input = {});
+    RGTextureID ReadTexture(const RGResourceName& name, const ResourceStateFlags resourceStateFlags);
+
+    RGTextureID WriteRenderTarget(const RGResourceName& name, const ColorClearValue& clearValue, const EOp loadOp, const EOp storeOp,
+                                  const RGResourceName& input = {});
+    RGTextureID WriteDepthStencil(const RGResourceName& name, const DepthStencilClearValue& clearValue, const EOp depthLoadOp,
                                   const EOp depthStoreOp, const EOp stencilLoadOp = EOp::DONT_CARE,
-                                  const EOp stencilStoreOp = EOp::DONT_CARE, const std::string& input = s_DEFAULT_STRING);
+                                  const EOp stencilStoreOp = EOp::DONT_CARE, const RGResourceName& input = {});
 
     // NOTE: Can be extended in future by adding EResourceState::storage/vertex/index_buffer
-    RGBufferID WriteBuffer(const std::string& name, const std::string& input = s_DEFAULT_STRING);
-    RGBufferID ReadBuffer(const std::string& name, const ResourceStateFlags resourceStateFlags);
+    RGBufferID WriteBuffer(const RGResourceName& name, const RGResourceName& input = {});
+    RGBufferID ReadBuffer(const RGResourceName& name, const ResourceStateFlags resourceStateFlags);
 
   private:
     RenderGraph& m_RenderGraphRef;
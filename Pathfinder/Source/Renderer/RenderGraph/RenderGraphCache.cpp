@@ -0,0 +1,38 @@
+#include <PathfinderPCH.h>
+#include "RenderGraphCache.h"
+
+namespace Pathfinder
+{
+
+Shared<RGCompiledGraph> RenderGraphCache::Find(const uint64_t topologyHash)
+{
+    const auto it = std::ranges::find_if(m_CompiledGraphs, [topologyHash](const auto& compiledGraph)
+                                         { return compiledGraph->TopologyHash == topologyHash; });
+    if (it == m_CompiledGraphs.end()) return nullptr;
+
+    std::rotate(m_CompiledGraphs.begin(), it, std::next(it));
+    ++m_CompileStats.CacheHitCount;
+    m_CompileStats.TopologyHash = topologyHash;
+    return m_CompiledGraphs.front();
+}
+
+void RenderGraphCache::Store(const Shared<RGCompiledGraph>& compiledGraph, const float compileTime)
+{
+    PFR_ASSERT(compiledGraph, "Compiled graph is not valid!");
+
+    if (m_CompiledGraphs.size() >= s_MAX_CACHED_GRAPHS) m_CompiledGraphs.pop_back();
+    m_CompiledGraphs.insert(m_CompiledGraphs.begin(), compiledGraph);
+
+    ++m_CompileStats.CompileCount;
+    m_CompileStats.TopologyHash     = compiledGraph->TopologyHash;
+    m_CompileStats.CachedGraphCount = static_cast<uint32_t>(m_CompiledGraphs.size());
+    m_CompileStats.LastCompileTime  = compileTime;
+}
+
+void RenderGraphCache::Clear()
+{
+    m_CompiledGraphs.clear();
+    m_CompileStats.CachedGraphCount = 0;
+}
+
+}  // namespace Pathfinder
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <Core/Core.h>
+#include <Renderer/RendererCoreDefines.h>
+#include <Renderer/CommandBuffer.h>
+#include "RenderGraphResourcePool.h"
+
+namespace Pathfinder
+{
+
+enum class ERGBarrierHazard : uint8_t
+{
+    RGBARRIER_HAZARD_RAW,
+    RGBARRIER_HAZARD_WAR,
+    RGBARRIER_HAZARD_WAW
+};
+
+// NOTE: Barriers are planned from graph structure only, buffer/image handles and checks depending on GPU state(capacity, current
+// image layout, aliased memory) are resolved right before pass execution.
+struct RGBufferBarrierTemplate
+{
+    uint32_t BufferIndex        = 0;
+    ERGBarrierHazard Hazard     = ERGBarrierHazard::RGBARRIER_HAZARD_RAW;
+    BufferMemoryBarrier Barrier = {};  // Buffer is null until resolved.
+};
+
+struct RGImageBarrierTemplate
+{
+    uint32_t TextureIndex      = 0;
+    ERGBarrierHazard Hazard    = ERGBarrierHazard::RGBARRIER_HAZARD_RAW;
+    bool bTextureCreation      = false;
+    ImageMemoryBarrier Barrier = {};  // Image and subresource range are filled when resolved.
+
+    // NOTE: Images are exclusively owned by queue family, so cross-queue access needs release on the owner and matching acquire.
+    bool bQueueTransfer         = false;
+    ECommandBufferType SrcQueue = ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL;
+    ECommandBufferType DstQueue = ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL;
+};
+
+struct RGPassBarrierTemplates
+{
+    std::vector<RGBufferBarrierTemplate> BufferBarriers;
+    std::vector<RGImageBarrierTemplate> ImageBarriers;         // NOTE: Order matters, image layouts are tracked in the same order.
+    std::vector<RGImageBarrierTemplate> ReleaseImageBarriers;  // Recorded after the pass, hand images over to another queue.
+};
+
+// NOTE: Consecutive passes of the same queue, submitted at once. Buffers are created with concurrent sharing, so only images need
+// ownership transfers, syncing across queues is done with timeline semaphores each submission signals.
+struct RGSubmissionBatch
+{
+    ECommandBufferType Queue = ECommandBufferType::COMMAND_BUFFER_TYPE_GENERAL;
+    std::vector<uint32_t> Passes;              // In topological order.
+    std::vector<uint32_t> WaitBatches;         // Batches of other queues, submitted earlier, this one waits on.
+    std::vector<uint32_t> BarrierGroupStarts;  // Indices into Passes, barriers of a group are recorded at once before its first pass.
+};
+
+struct RGBarrierStats
+{
+    uint32_t BarrierCount           = 0;  // What passes would record on their own.
+    uint32_t MergedBarrierCount     = 0;  // Left after merging per group and dropping read-after-read ones.
+    uint32_t BarrierCallCount       = 0;  // InsertBarriers() calls, one per pass that has any barriers.
+    uint32_t MergedBarrierCallCount = 0;  // One per group(+ one for releases).
+};
+
+struct RGScheduleStats
+{
+    uint32_t BatchCount         = 0;
+    uint32_t SyncPointCount     = 0;  // Cross-queue semaphore waits.
+    uint32_t QueueTransferCount = 0;  // Image ownership transfers, release + acquire pairs.
+    float SerialTime            = 0.f;  // ms, every pass one after another on graphics queue.
+    float ScheduledTime         = 0.f;  // ms, async batches overlapping graphics ones.
+
+    std::array<float, 3> QueueBusyTime = {0.f};  // ms, indexed by ECommandBufferType.
+};
+
+// Everything derived from graph topology, stays valid as long as passes declare the same resources with the same usage.
+struct RGCompiledGraph
+{
+    uint64_t TopologyHash = 0;
+
+    std::vector<uint8_t> CulledPasses;  // Per pass, 1 if nothing reaching a sink consumes its outputs.
+    uint32_t CulledPassCount = 0;
+
+    std::vector<std::vector<uint32_t>> AdjacencyLists;
+    std::vector<uint32_t> TopologicallySortedPasses;  // Culled passes excluded.
+    std::vector<uint32_t> DependencyLevels;  // Per pass, longest dependency chain leading to it.
+    uint32_t DependencyLevelCount = 0;
+
+    std::vector<uint32_t> TextureRoots;  // Resource index -> index of the resource it aliases(itself if not aliased).
+    std::vector<uint32_t> BufferRoots;
+
+    // Transient roots in declaration order, specs are taken from current frame, so resizes don't invalidate compiled graph.
+    std::vector<std::pair<uint32_t, RGResourceLifetime>> TextureLifetimes;
+    std::vector<std::pair<uint32_t, RGResourceLifetime>> BufferLifetimes;
+
+    std::vector<RGPassBarrierTemplates> PassBarriers;  // Indexed by pass.
+
+    std::vector<ECommandBufferType> PassQueues;         // Indexed by pass.
+    std::vector<std::vector<uint32_t>> PassQueueWaits;  // Per pass, passes of other queues it depends on.
+    std::vector<RGSubmissionBatch> SubmissionBatches;   // In submission order, last graphics one goes along with swapchain.
+    uint32_t QueueTransferCount = 0;
+
+    RGBarrierStats PlannedBarrierStats = {};  // Upper bound, some barriers get dropped once image layouts are known.
+
+    Optional<RGScheduleStats> ScheduleStats = std::nullopt;  // Simulated once, first frame GPU timings are available.
+};
+
+struct RGCompileStats
+{
+    uint64_t TopologyHash     = 0;
+    uint64_t CompileCount     = 0;  // Cache misses, graph compiled from scratch.
+    uint64_t CacheHitCount    = 0;
+    uint32_t CachedGraphCount = 0;
+    float LastCompileTime     = 0.f;  // ms
+};
+
+struct RGCullingStats
+{
+    uint32_t PassCount          = 0;
+    uint32_t CulledTextureCount = 0;  // Declared by culled passes, never allocated.
+    uint32_t CulledBufferCount  = 0;
+    std::vector<std::string> CulledPassNames;
+};
+
+// NOTE: Holds last few compiled graphs, so toggling features(debug renderer, shadows) back and forth doesn't cause recompilation.
+class RenderGraphCache final : private Uncopyable, private Unmovable
+{
+  public:
+    RenderGraphCache()  = default;
+    ~RenderGraphCache() = default;
+
+    NODISCARD Shared<RGCompiledGraph> Find(const uint64_t topologyHash);
+    void Store(const Shared<RGCompiledGraph>& compiledGraph, const float compileTime);
+    void Clear();
+
+    NODISCARD FORCEINLINE const auto& GetCompileStats() const { return m_CompileStats; }
+
+  private:
+    static constexpr uint32_t s_MAX_CACHED_GRAPHS = 4;
+
+    std::vector<Shared<RGCompiledGraph>> m_CompiledGraphs;  // Most recently used first.
+    RGCompileStats m_CompileStats = {};
+};
+using RGCache = RenderGraphCache;
+
+}  // namespace Pathfinder
\ No newline at end of file
@@ -28,20 +28,20 @@ template <> struct RGResourceTraits<ERGResourceType::RGRESOURCE_TYPE_BUFFER>
 
 struct RenderGraphResource
 {
-    RenderGraphResource(const uint64_t id, const std::string_view& name) : ID(id), Name(name) /*, Version(0), RefCounter(0) */ {}
+    RenderGraphResource(const uint64_t id, const RGResourceName& name) : ID(id), Name(name) /*, Version(0) */ {}
 
-    UnorderedSet<uint32_t> WritePasses;
-    UnorderedSet<uint32_t> ReadPasses;
+    RGFlatSet<uint32_t> WritePasses;
+    RGFlatSet<uint32_t> ReadPasses;
 
-    UnorderedSet<uint32_t> AlreadySyncedWith;
    // EResourceState State = EResourceState::RESOURCE_STATE_UNDEFINED;
     uint64_t ID{};
     // uint64_t Version{};
-    // uint64_t RefCounter{};
+    bool bImported                 = false;         // Owned outside of the graph, so writes to it are visible after the frame.
+    Optional<uint32_t> AliasSource = std::nullopt;  // Index of the resource this one is a new version of(_V0 -> _V1).
 
     // std::optional<uint32_t> WriterPassIdx  = std::nullopt;
     // std::optional<uint32_t> LastUsedByPass = std::nullopt;
-    std::string Name = s_DEFAULT_STRING;
+    RGResourceName Name = {};
 };
 using RGResource = RenderGraphResource;
 
@@ -50,7 +50,7 @@ template <ERGResourceType ResourceType> struct TypedRenderGraphResource : Render
     using Resource     = RGResourceTraits<ResourceType>::Resource;
     using ResourceDesc = RGResourceTraits<ResourceType>::ResourceDesc;
 
-    TypedRenderGraphResource(const uint64_t id, const ResourceDesc& desc, const std::string_view& name = s_DEFAULT_STRING)
+    TypedRenderGraphResource(const uint64_t id, const ResourceDesc& desc, const RGResourceName& name)
         : RenderGraphResource(id, name), Handle(nullptr), Description(desc)
     {
     }
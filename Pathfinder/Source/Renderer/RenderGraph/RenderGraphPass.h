@@ -16,26 +16,25 @@ enum class ERGPassType : uint8_t
     RGPASS_TYPE_GRAPHICS,
     RGPASS_TYPE_COMPUTE,
     RGPASS_TYPE_TRANSFER,
-    // TODO: RGPASS_TYPE_COMPUTE_ASYNC
-    // TODO: RGPASS_TYPE_TRANSFER_ASYNC
+    RGPASS_TYPE_COMPUTE_ASYNC,  // Recorded into async compute queue submissions, overlaps with graphics work.
+    RGPASS_TYPE_TRANSFER_ASYNC  // Recorded into dedicated transfer queue submissions.
 };
 
 class RenderGraphPassBase : private Uncopyable, private Unmovable
 {
   public:
-    RenderGraphPassBase(const std::string& name, const ERGPassType rgPassType) : m_Name(name), m_Type(rgPassType) {}
+    RenderGraphPassBase(const std::string& name, const ERGPassType rgPassType) : m_Name(name), m_Type(rgPassType), m_NameID(name) {}
     virtual ~RenderGraphPassBase() = default;
 
   protected:
     virtual void Setup(RenderGraphBuilder&)                                 = 0;
     virtual void Execute(RenderGraphContext&, Shared<CommandBuffer>&) const = 0;
 
-    // FORCEINLINE bool IsCulled() const { return m_RefCounter == 0; }
-
   private:
-    std::string m_Name = s_DEFAULT_STRING;
-    ERGPassType m_Type = ERGPassType::RGPASS_TYPE_GRAPHICS;
-    //   uint32_t m_RefCounter{};
+    std::string m_Name     = s_DEFAULT_STRING;
+    ERGPassType m_Type     = ERGPassType::RGPASS_TYPE_GRAPHICS;
+    bool m_bHasSideEffects = false;  // Never culled, even if nothing reads its outputs.
+    RGResourceName m_NameID;         // Same name interned, so per-frame topology hashing deals with its ID, not the string.
     uint64_t m_ID{};
 
     friend RenderGraph;
@@ -68,17 +67,17 @@ class RenderGraphPassBase : private Uncopyable, private Unmovable
         uint32_t OffsetY{};
     };
 
-    UnorderedSet<RGTextureID> m_TextureCreates;
-    UnorderedSet<RGTextureID> m_TextureReads;
-    UnorderedSet<RGTextureID> m_TextureWrites;
-    //  UnorderedSet<RGTextureID> m_TextureDestroys;  // In case pass culled.
-    UnorderedMap<RGTextureID, ResourceStateFlags> m_TextureStateMap;
+    RGFlatSet<RGTextureID> m_TextureCreates;
+    RGFlatSet<RGTextureID> m_TextureReads;
+    RGFlatSet<RGTextureID> m_TextureWrites;
+    //  RGFlatSet<RGTextureID> m_TextureDestroys;  // In case pass culled.
+    RGFlatMap<RGTextureID, ResourceStateFlags> m_TextureStateMap;
 
-    UnorderedSet<RGBufferID> m_BufferCreates;
-    UnorderedSet<RGBufferID> m_BufferReads;
-    UnorderedSet<RGBufferID> m_BufferWrites;
-    // UnorderedSet<RGBufferID> m_BufferDestroys;  // In case pass culled.
-    UnorderedMap<RGBufferID, ResourceStateFlags> m_BufferStateMap;
+    RGFlatSet<RGBufferID> m_BufferCreates;
+    RGFlatSet<RGBufferID> m_BufferReads;
+    RGFlatSet<RGBufferID> m_BufferWrites;
+    // RGFlatSet<RGBufferID> m_BufferDestroys;  // In case pass culled.
+    RGFlatMap<RGBufferID, ResourceStateFlags> m_BufferStateMap;
 
     std::vector<RenderTargetInfo> m_RenderTargetsInfo;
     Optional<DepthStencilInfo> m_DepthStencil           = std::nullopt;
@@ -155,14 +154,19 @@ NODISCARD FORCEINLINE std::string_view RGPassTypeToString(const ERGPassType rgPa
     switch (rgPassType)
     {
         case ERGPassType::RGPASS_TYPE_GRAPHICS: return "GRAPHICS";
-        case ERGPassType::RGPASS_TYPE_COMPUTE:
-            return "COMPUTE";
-            //  case ERGPassType::RGPASS_TYPE_COMPUTE_ASYNC: return "COMPUTE_ASYNC";
+        case ERGPassType::RGPASS_TYPE_COMPUTE: return "COMPUTE";
         case ERGPassType::RGPASS_TYPE_TRANSFER: return "TRANSFER";
+        case ERGPassType::RGPASS_TYPE_COMPUTE_ASYNC: return "COMPUTE_ASYNC";
+        case ERGPassType::RGPASS_TYPE_TRANSFER_ASYNC: return "TRANSFER_ASYNC";
     }
 
     PFR_ASSERT(false, "Unknown rg pass type!");
     return s_DEFAULT_STRING;
 }
 
+NODISCARD FORCEINLINE bool IsRGTransferPass(const ERGPassType rgPassType)
+{
+    return rgPassType == ERGPassType::RGPASS_TYPE_TRANSFER || rgPassType == ERGPassType::RGPASS_TYPE_TRANSFER_ASYNC;
+}
+
 }  // namespace Pathfinder
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <PathfinderPCH.h>
+#include "RenderGraphResourceID.h"
+
+#include <deque>
+#include <shared_mutex>
+
+namespace Pathfinder
+{
+
+namespace RGResourceNameRegistry
+{
+
+// NOTE: Deque keeps strings in place while growing, so views stored as map keys stay valid. Function-local to avoid static init order
+// issues, since names are interned from statics of other translation units.
+struct Storage
+{
+    std::shared_mutex Mutex;
+    std::deque<std::string> Names;
+    UnorderedMap<std::string_view, uint32_t> NameIDMap;
+};
+
+static Storage& Get()
+{
+    static Storage s_Storage = {};
+    return s_Storage;
+}
+
+}  // namespace RGResourceNameRegistry
+
+RenderGraphResourceName::RenderGraphResourceName(const std::string_view name)
+{
+    PFR_ASSERT(!name.empty(), "Resource name can't be empty!");
+
+    auto& storage = RGResourceNameRegistry::Get();
+    {
+        std::shared_lock lock(storage.Mutex);
+        if (const auto it = storage.NameIDMap.find(name); it != storage.NameIDMap.end())
+        {
+            m_ID = it->second;
+            return;
+        }
+    }
+
+    std::unique_lock lock(storage.Mutex);
+    if (const auto it = storage.NameIDMap.find(name); it != storage.NameIDMap.end())
+    {
+        m_ID = it->second;
+        return;
+    }
+
+    m_ID = static_cast<uint32_t>(storage.Names.size());
+    storage.NameIDMap.emplace(storage.Names.emplace_back(name), m_ID);
+}
+
+const std::string& RenderGraphResourceName::GetString() const
+{
+    static const std::string s_InvalidName = s_DEFAULT_STRING;
+    if (!IsValid()) return s_InvalidName;
+
+    auto& storage = RGResourceNameRegistry::Get();
+    std::shared_lock lock(storage.Mutex);
+    return storage.Names.at(m_ID);
+}
+
+uint32_t RenderGraphResourceName::GetInternedCount()
+{
+    auto& storage = RGResourceNameRegistry::Get();
+    std::shared_lock lock(storage.Mutex);
+    return static_cast<uint32_t>(storage.Names.size());
+}
+
+}  // namespace Pathfinder
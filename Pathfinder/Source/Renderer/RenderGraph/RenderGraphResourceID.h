@@ -18,7 +18,9 @@ struct RGTextureSpecification
     EImageFormat Format        = EImageFormat::FORMAT_RGBA8_UNORM;
     ImageUsageFlags UsageFlags = EImageUsage::IMAGE_USAGE_SAMPLED_BIT;
     uint32_t Layers            = 1;
+    uint32_t Mips              = 1;  // NOTE: Ignored with bGenerateMips, same as TextureSpecification::Mips.
     const bool bPerFrame       = false;
+    const bool bTransient      = false;  // NOTE: Contents don't outlive the frame, so memory can be shared with other transient resources.
 };
 
 struct RGBufferSpecification
@@ -28,6 +30,7 @@ struct RGBufferSpecification
     BufferUsageFlags UsageFlags = 0;
     const bool bPerFrame        = false;
     size_t Capacity             = 0;
+    const bool bTransient       = false;  // NOTE: Same as for textures, device-local only since memory block isn't mappable.
 };
 
 enum class ERGResourceType : uint8_t
@@ -58,6 +61,92 @@ template <ERGResourceType TResourceType> struct TypedRenderGraphResourceID : RGR
 using RGBufferID  = TypedRenderGraphResourceID<ERGResourceType::RGRESOURCE_TYPE_BUFFER>;
 using RGTextureID = TypedRenderGraphResourceID<ERGResourceType::RGRESOURCE_TYPE_TEXTURE>;
 
+// NOTE: Interned resource name, string is hashed and stored once per process, after that graph looks resources up by dense name ID.
+// Passes keep names in statics(see Passes/ResourceNames.h), so nothing is hashed or allocated during per-frame setup.
+class RenderGraphResourceName final
+{
+  public:
+    RenderGraphResourceName() = default;
+    RenderGraphResourceName(const char* name) : RenderGraphResourceName(std::string_view{name}) {}
+    RenderGraphResourceName(const std::string& name) : RenderGraphResourceName(std::string_view{name}) {}
+    explicit RenderGraphResourceName(const std::string_view name);
+
+    NODISCARD FORCEINLINE uint32_t GetID() const { return m_ID; }
+    NODISCARD FORCEINLINE bool IsValid() const { return m_ID != s_INVALID_ID; }
+    NODISCARD const std::string& GetString() const;
+    auto operator<=>(const RenderGraphResourceName&) const = default;
+
+    NODISCARD static uint32_t GetInternedCount();
+
+  private:
+    static constexpr uint32_t s_INVALID_ID = std::numeric_limits<uint32_t>::max();
+    uint32_t m_ID                          = s_INVALID_ID;
+};
+using RGResourceName = RenderGraphResourceName;
+
+// NOTE: Sorted small vector, passes touch a handful of resources, so contiguous memory beats node/bucket based sets on insertion and
+// iteration, iteration order is deterministic as well(ascending, same as pass insertion order for pass indices).
+template <typename T> class RGFlatSet final
+{
+  public:
+    bool insert(const T value)
+    {
+        const auto it = std::ranges::lower_bound(m_Values, value);
+        if (it != m_Values.end() && *it == value) return false;
+
+        m_Values.insert(it, value);
+        return true;
+    }
+
+    NODISCARD FORCEINLINE bool contains(const T value) const { return std::ranges::binary_search(m_Values, value); }
+
+    // Merge walk over both sorted ranges, no lookups.
+    NODISCARD bool Intersects(const RGFlatSet& other) const
+    {
+        auto lhs = m_Values.begin(), rhs = other.m_Values.begin();
+        while (lhs != m_Values.end() && rhs != other.m_Values.end())
+        {
+            if (*lhs == *rhs) return true;
+            *lhs < *rhs ? ++lhs : ++rhs;
+        }
+        return false;
+    }
+
+    NODISCARD FORCEINLINE size_t size() const { return m_Values.size(); }
+    NODISCARD FORCEINLINE bool empty() const { return m_Values.empty(); }
+    NODISCARD FORCEINLINE auto begin() const { return m_Values.begin(); }
+    NODISCARD FORCEINLINE auto end() const { return m_Values.end(); }
+
+  private:
+    std::vector<T> m_Values;
+};
+
+// Same as RGFlatSet, sorted by key, operator[] default-inserts like std::map.
+template <typename TKey, typename TValue> class RGFlatMap final
+{
+  public:
+    TValue& operator[](const TKey key)
+    {
+        const auto it = std::ranges::lower_bound(m_Values, key, {}, &std::pair<TKey, TValue>::first);
+        if (it != m_Values.end() && it->first == key) return it->second;
+
+        return m_Values.insert(it, {key, TValue{}})->second;
+    }
+
+    NODISCARD FORCEINLINE bool contains(const TKey key) const
+    {
+        return std::ranges::binary_search(m_Values, key, {}, &std::pair<TKey, TValue>::first);
+    }
+
+    NODISCARD FORCEINLINE size_t size() const { return m_Values.size(); }
+    NODISCARD FORCEINLINE bool empty() const { return m_Values.empty(); }
+    NODISCARD FORCEINLINE auto begin() const { return m_Values.begin(); }
+    NODISCARD FORCEINLINE auto end() const { return m_Values.end(); }
+
+  private:
+    std::vector<std::pair<TKey, TValue>> m_Values;
+};
+
 }  // namespace Pathfinder
 
 namespace std
@@ -2,6 +2,7 @@
 #include "RenderGraphResourcePool.h"
 #include <Renderer/Texture.h>
 #include <Renderer/Buffer.h>
+#include <Renderer/GraphicsContext.h>
 
 namespace Pathfinder
 {
@@ -10,8 +11,8 @@ namespace RGUtils
 {
 FORCEINLINE bool AreTextureSpecsCompatible(const TextureSpecification& lhs, const TextureSpecification& rhs)
 {
-    return std::tie(lhs.bGenerateMips, lhs.Wrap, lhs.Filter, lhs.Format, lhs.UsageFlags, lhs.Layers) ==
-           std::tie(rhs.bGenerateMips, rhs.Wrap, rhs.Filter, rhs.Format, rhs.UsageFlags, rhs.Layers);
+    return std::tie(lhs.bGenerateMips, lhs.Mips, lhs.Wrap, lhs.Filter, lhs.Format, lhs.UsageFlags, lhs.Layers) ==
+           std::tie(rhs.bGenerateMips, rhs.Mips, rhs.Wrap, rhs.Filter, rhs.Format, rhs.UsageFlags, rhs.Layers);
 }
 
 FORCEINLINE bool AreBufferSpecsCompatible(const BufferSpecification& lhs, const BufferSpecification& rhs)
@@ -19,8 +20,226 @@ FORCEINLINE bool AreBufferSpecsCompatible(const BufferSpecification& lhs, const
     return std::tie(lhs.UsageFlags, lhs.ExtraFlags) == std::tie(rhs.UsageFlags, rhs.ExtraFlags);
 }
 
+NODISCARD FORCEINLINE static TextureSpecification GetTextureSpecification(const RGTextureSpecification& spec)
+{
+    return {.DebugName     = spec.DebugName,
+            .Width         = spec.Width,
+            .Height        = spec.Height,
+            .bGenerateMips = spec.bGenerateMips,
+            .Wrap          = spec.Wrap,
+            .Filter        = spec.Filter,
+            .Format        = spec.Format,
+            .UsageFlags    = spec.UsageFlags,
+            .Layers        = spec.Layers,
+            .Mips          = spec.Mips};
+}
+
+NODISCARD FORCEINLINE static BufferSpecification GetBufferSpecification(const RGBufferSpecification& spec)
+{
+    return {.DebugName = spec.DebugName, .ExtraFlags = spec.ExtraFlags, .UsageFlags = spec.UsageFlags, .Capacity = spec.Capacity};
+}
+
+NODISCARD FORCEINLINE static uint64_t AlignUp(const uint64_t value, const uint64_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+struct TransientPlacement
+{
+    MemoryRequirements Requirements = {};
+    RGResourceLifetime Lifetime     = {};
+    uint64_t Offset                 = 0;
+};
+
+// Greedy first-fit: biggest resources go first, each one takes the lowest offset that doesn't intersect
+// memory of already placed resources alive at the same time. Returns required heap size.
+static uint64_t PlaceTransientAllocations(std::vector<TransientPlacement>& placements)
+{
+    std::vector<uint32_t> placementOrder(placements.size());
+    std::iota(placementOrder.begin(), placementOrder.end(), 0);
+    std::ranges::sort(placementOrder,
+                      [&](const uint32_t lhs, const uint32_t rhs)
+                      {
+                          if (placements[lhs].Requirements.Size != placements[rhs].Requirements.Size)
+                              return placements[lhs].Requirements.Size > placements[rhs].Requirements.Size;
+
+                          return placements[lhs].Lifetime.FirstUse < placements[rhs].Lifetime.FirstUse;
+                      });
+
+    uint64_t heapSize = 0;
+    std::vector<uint32_t> placedIndices;
+    std::vector<std::pair<uint64_t, uint64_t>> occupiedRanges;
+    for (const auto placementIndex : placementOrder)
+    {
+        auto& placement = placements[placementIndex];
+
+        occupiedRanges.clear();
+        for (const auto placedIndex : placedIndices)
+        {
+            const auto& other = placements[placedIndex];
+            if (placement.Lifetime.LastUse < other.Lifetime.FirstUse || other.Lifetime.LastUse < placement.Lifetime.FirstUse) continue;
+
+            occupiedRanges.emplace_back(other.Offset, other.Offset + other.Requirements.Size);
+        }
+        std::ranges::sort(occupiedRanges);
+
+        uint64_t offset = 0;
+        for (const auto& [rangeBegin, rangeEnd] : occupiedRanges)
+        {
+            if (AlignUp(offset, placement.Requirements.Alignment) + placement.Requirements.Size <= rangeBegin) break;
+            offset = std::max(offset, rangeEnd);
+        }
+
+        placement.Offset = AlignUp(offset, placement.Requirements.Alignment);
+        heapSize         = std::max(heapSize, placement.Offset + placement.Requirements.Size);
+        placedIndices.emplace_back(placementIndex);
+    }
+
+    return heapSize;
+}
+
+// Makes sure heap is big enough and has the right memory type, returns false if resources can't share memory at all.
+static bool PrepareTransientHeap(void*& heapMemory, uint64_t& currentHeapSize, uint32_t& currentMemoryTypeBits,
+                                 const std::vector<TransientPlacement>& placements, const uint64_t requiredHeapSize)
+{
+    MemoryRequirements heapRequirements = {.Size = requiredHeapSize, .Alignment = 1, .MemoryTypeBits = ~0u};
+    for (const auto& placement : placements)
+    {
+        heapRequirements.Alignment = std::max(heapRequirements.Alignment, placement.Requirements.Alignment);
+        heapRequirements.MemoryTypeBits &= placement.Requirements.MemoryTypeBits;
+    }
+    if (heapRequirements.MemoryTypeBits == 0) return false;
+
+    if (heapMemory && currentHeapSize >= requiredHeapSize && currentMemoryTypeBits == heapRequirements.MemoryTypeBits) return true;
+
+    if (heapMemory) GraphicsContext::Get().FreeMemory(heapMemory);
+    heapMemory            = GraphicsContext::Get().AllocateMemory(heapRequirements);
+    currentHeapSize       = requiredHeapSize;
+    currentMemoryTypeBits = heapRequirements.MemoryTypeBits;
+    return true;
+}
+
 }  // namespace RGUtils
 
+RenderGraphResourcePool::~RenderGraphResourcePool()
+{
+    ReleaseTransientResources();
+
+    if (m_TransientTextureHeap.Memory) GraphicsContext::Get().FreeMemory(m_TransientTextureHeap.Memory);
+    if (m_TransientBufferHeap.Memory) GraphicsContext::Get().FreeMemory(m_TransientBufferHeap.Memory);
+}
+
+void RenderGraphResourcePool::ReleaseTransientResources()
+{
+    m_TransientTextures.clear();
+    m_TransientBuffers.clear();
+    m_TransientTexturePlacements.clear();
+    m_TransientBufferPlacements.clear();
+}
+
+Optional<RGTransientPlacement> RenderGraphResourcePool::GetTransientTexturePlacement(const RGResourceName& name) const
+{
+    const auto it = m_TransientTexturePlacements.find(name.GetID());
+    return it != m_TransientTexturePlacements.end() ? Optional<RGTransientPlacement>{it->second} : std::nullopt;
+}
+
+Optional<RGTransientPlacement> RenderGraphResourcePool::GetTransientBufferPlacement(const RGResourceName& name) const
+{
+    const auto it = m_TransientBufferPlacements.find(name.GetID());
+    return it != m_TransientBufferPlacements.end() ? Optional<RGTransientPlacement>{it->second} : std::nullopt;
+}
+
+void RenderGraphResourcePool::PlaceTransientResources(const uint64_t placementHash,
+                                                      const std::vector<RGTransientTextureRequest>& textureRequests,
+                                                      const std::vector<RGTransientBufferRequest>& bufferRequests)
+{
+    if (IsTransientPlacementUpToDate(placementHash)) return;
+
+    // NOTE: Frames in flight may still reference previous placement.
+    GraphicsContext::Get().WaitDeviceOnFinish();
+    ReleaseTransientResources();
+    m_TransientPlacementHash = placementHash;
+    m_TransientMemoryStats   = {};
+
+    if (!textureRequests.empty())
+    {
+        std::vector<RGUtils::TransientPlacement> placements;
+        for (const auto& [name, spec, lifetime] : textureRequests)
+        {
+            PFR_ASSERT(!spec->bPerFrame, "Per-frame textures can't be transient!");
+            placements.emplace_back(Texture::GetMemoryRequirements(RGUtils::GetTextureSpecification(*spec)), lifetime);
+            m_TransientMemoryStats.UnaliasedBytes += placements.back().Requirements.Size;
+        }
+
+        const uint64_t heapSize = RGUtils::PlaceTransientAllocations(placements);
+        if (RGUtils::PrepareTransientHeap(m_TransientTextureHeap.Memory, m_TransientTextureHeap.Size, m_TransientTextureHeap.MemoryTypeBits,
+                                          placements, heapSize))
+        {
+            for (size_t i{}; i < textureRequests.size(); ++i)
+            {
+                const auto& [name, spec, lifetime] = textureRequests[i];
+                PFR_ASSERT(!m_TransientTextures.contains(name.GetID()), "Transient textures should have unique names!");
+
+                m_TransientTextures[name.GetID()] =
+                    Texture::Create(RGUtils::GetTextureSpecification(*spec), nullptr, 0,
+                                    {.Memory = m_TransientTextureHeap.Memory, .Offset = placements[i].Offset});
+
+                m_TransientTexturePlacements[name.GetID()] = {.Offset = placements[i].Offset, .Size = placements[i].Requirements.Size};
+            }
+
+            m_TransientMemoryStats.AliasedBytes += heapSize;
+            m_TransientMemoryStats.TextureCount = static_cast<uint32_t>(textureRequests.size());
+        }
+        else
+        {
+            LOG_WARN("RenderGraphResourcePool: Transient textures have no common memory type, aliasing is disabled for them!");
+            for (const auto& placement : placements)
+                m_TransientMemoryStats.AliasedBytes += placement.Requirements.Size;
+        }
+    }
+
+    if (!bufferRequests.empty())
+    {
+        std::vector<RGUtils::TransientPlacement> placements;
+        for (const auto& [name, spec, lifetime] : bufferRequests)
+        {
+            PFR_ASSERT(!spec->bPerFrame, "Per-frame buffers can't be transient!");
+            PFR_ASSERT(spec->ExtraFlags & EBufferFlag::BUFFER_FLAG_DEVICE_LOCAL, "Transient buffers should be device-local!");
+            placements.emplace_back(Buffer::GetMemoryRequirements(RGUtils::GetBufferSpecification(*spec)), lifetime);
+            m_TransientMemoryStats.UnaliasedBytes += placements.back().Requirements.Size;
+        }
+
+        const uint64_t heapSize = RGUtils::PlaceTransientAllocations(placements);
+        if (RGUtils::PrepareTransientHeap(m_TransientBufferHeap.Memory, m_TransientBufferHeap.Size, m_TransientBufferHeap.MemoryTypeBits,
+                                          placements, heapSize))
+        {
+            for (size_t i{}; i < bufferRequests.size(); ++i)
+            {
+                const auto& [name, spec, lifetime] = bufferRequests[i];
+                PFR_ASSERT(!m_TransientBuffers.contains(name.GetID()), "Transient buffers should have unique names!");
+
+                auto bufferSpec                           = RGUtils::GetBufferSpecification(*spec);
+                bufferSpec.AliasingInfo                   = {.Memory = m_TransientBufferHeap.Memory, .Offset = placements[i].Offset};
+                m_TransientBuffers[name.GetID()]          = Buffer::Create(bufferSpec);
+                m_TransientBufferPlacements[name.GetID()] = {.Offset = placements[i].Offset, .Size = placements[i].Requirements.Size};
+            }
+
+            m_TransientMemoryStats.AliasedBytes += heapSize;
+            m_TransientMemoryStats.BufferCount = static_cast<uint32_t>(bufferRequests.size());
+        }
+        else
+        {
+            LOG_WARN("RenderGraphResourcePool: Transient buffers have no common memory type, aliasing is disabled for them!");
+            for (const auto& placement : placements)
+                m_TransientMemoryStats.AliasedBytes += placement.Requirements.Size;
+        }
+    }
+
+    LOG_INFO("RenderGraphResourcePool: Peak transient memory: {:.3f} MB before aliasing, {:.3f} MB after ({} textures, {} buffers).",
+             m_TransientMemoryStats.UnaliasedBytes / 1024.0f / 1024.0f, m_TransientMemoryStats.AliasedBytes / 1024.0f / 1024.0f,
+             m_TransientMemoryStats.TextureCount, m_TransientMemoryStats.BufferCount);
+}
+
 void RenderGraphResourcePool::Tick()
 {
     ++m_FrameNumber;
@@ -81,17 +300,15 @@ void RenderGraphResourcePool::Tick()
     }
 }
 
-Shared<Texture> RenderGraphResourcePool::AllocateTexture(const RGTextureSpecification& spec)
+Shared<Texture> RenderGraphResourcePool::AllocateTexture(const RGResourceName& name, const RGTextureSpecification& spec)
 {
-    const TextureSpecification textureSpec = {.DebugName     = spec.DebugName,
-                                              .Width         = spec.Width,
-                                              .Height        = spec.Height,
-                                              .bGenerateMips = spec.bGenerateMips,
-                                              .Wrap          = spec.Wrap,
-                                              .Filter        = spec.Filter,
-                                              .Format        = spec.Format,
-                                              .UsageFlags    = spec.UsageFlags,
-                                              .Layers        = spec.Layers};
+    // NOTE: Transient texture that wasn't placed(no common memory type) goes through regular pooling.
+    if (spec.bTransient)
+    {
+        if (const auto it = m_TransientTextures.find(name.GetID()); it != m_TransientTextures.end()) return it->second;
+    }
+
+    const TextureSpecification textureSpec = RGUtils::GetTextureSpecification(spec);
 
     if (spec.bPerFrame)
     {
@@ -142,10 +359,14 @@ Shared<Texture> RenderGraphResourcePool::AllocateTexture(const RGTextureSpecific
     return texture.Handle;
 }
 
-Shared<Buffer> RenderGraphResourcePool::AllocateBuffer(const RGBufferSpecification& spec)
+Shared<Buffer> RenderGraphResourcePool::AllocateBuffer(const RGResourceName& name, const RGBufferSpecification& spec)
 {
-    const BufferSpecification bufferSpec = {
-        .DebugName = spec.DebugName, .ExtraFlags = spec.ExtraFlags, .UsageFlags = spec.UsageFlags, .Capacity = spec.Capacity};
+    if (spec.bTransient)
+    {
+        if (const auto it = m_TransientBuffers.find(name.GetID()); it != m_TransientBuffers.end()) return it->second;
+    }
+
+    const BufferSpecification bufferSpec = RGUtils::GetBufferSpecification(spec);
 
     if (spec.bPerFrame)
     {
@@ -10,21 +10,86 @@ namespace Pathfinder
 class Buffer;
 class Texture;
 
+// NOTE: Inclusive range of positions in topologically sorted pass order, where resource(and its aliases) is used.
+struct RGResourceLifetime
+{
+    uint32_t FirstUse = 0;
+    uint32_t LastUse  = 0;
+};
+
+struct RGTransientMemoryStats
+{
+    uint64_t UnaliasedBytes = 0;  // What transient resources take if each one has its own allocation.
+    uint64_t AliasedBytes   = 0;  // Size of shared memory blocks they're placed into.
+    uint32_t TextureCount   = 0;
+    uint32_t BufferCount    = 0;
+};
+
+// Where transient resource got placed inside its heap, resources with overlapping ranges share memory.
+struct RGTransientPlacement
+{
+    uint64_t Offset = 0;
+    uint64_t Size   = 0;
+};
+
+// Transient resource to be placed, description isn't copied, it stays owned by render graph.
+template <typename TSpecification> struct RGTransientRequest
+{
+    RGResourceName Name                 = {};
+    const TSpecification* Specification = nullptr;
+    RGResourceLifetime Lifetime         = {};
+};
+using RGTransientTextureRequest = RGTransientRequest<RGTextureSpecification>;
+using RGTransientBufferRequest  = RGTransientRequest<RGBufferSpecification>;
+
 // TODO: Refactor, do I need bIsActive? since I have LastUsedFrame..
 class RenderGraphResourcePool final : private Uncopyable, private Unmovable
 {
   public:
-    RenderGraphResourcePool()  = default;
-    ~RenderGraphResourcePool() = default;
+    RenderGraphResourcePool() = default;
+    ~RenderGraphResourcePool();
 
     void Tick();
 
-    Shared<Texture> AllocateTexture(const RGTextureSpecification& spec);
-    Shared<Buffer> AllocateBuffer(const RGBufferSpecification& spec);
+    // NOTE: Transient resources with non-overlapping lifetimes are placed into the same memory. Placement hash(compiled graph topology
+    // + resource sizes) is checked first, so requests are gathered and placement is rebuilt only in case it has changed(resize, new
+    // passes), otherwise previous frame placement is reused.
+    NODISCARD FORCEINLINE bool IsTransientPlacementUpToDate(const uint64_t placementHash) const
+    {
+        return placementHash == m_TransientPlacementHash;
+    }
+    void PlaceTransientResources(const uint64_t placementHash, const std::vector<RGTransientTextureRequest>& textureRequests,
+                                 const std::vector<RGTransientBufferRequest>& bufferRequests);
+    NODISCARD FORCEINLINE const auto& GetTransientMemoryStats() const { return m_TransientMemoryStats; }
+
+    // NOTE: Keyed by interned resource name, same as transient resources, empty for resources that didn't get aliased.
+    NODISCARD Optional<RGTransientPlacement> GetTransientTexturePlacement(const RGResourceName& name) const;
+    NODISCARD Optional<RGTransientPlacement> GetTransientBufferPlacement(const RGResourceName& name) const;
+
+    Shared<Texture> AllocateTexture(const RGResourceName& name, const RGTextureSpecification& spec);
+    Shared<Buffer> AllocateBuffer(const RGResourceName& name, const RGBufferSpecification& spec);
 
   private:
     uint64_t m_FrameNumber = 0;
 
+    struct TransientHeap
+    {
+        void* Memory = nullptr;
+        uint64_t Size{};
+        uint32_t MemoryTypeBits{};
+    };
+
+    TransientHeap m_TransientTextureHeap = {};  // NOTE: Images and buffers have separate heaps to not care about bufferImageGranularity.
+    TransientHeap m_TransientBufferHeap  = {};
+    UnorderedMap<uint32_t, Shared<Texture>> m_TransientTextures;  // Keyed by interned name ID.
+    UnorderedMap<uint32_t, Shared<Buffer>> m_TransientBuffers;
+    UnorderedMap<uint32_t, RGTransientPlacement> m_TransientTexturePlacements;
+    UnorderedMap<uint32_t, RGTransientPlacement> m_TransientBufferPlacements;
+    uint64_t m_TransientPlacementHash             = 0;
+    RGTransientMemoryStats m_TransientMemoryStats = {};
+
+    void ReleaseTransientResources();
+
     struct PooledTexture
     {
         Shared<Texture> Handle                = nullptr;
@@ -18,46 +18,41 @@
 #include "Mesh/Submesh.h"
 
 #include "HWRT.h"
+#include "ProfilerTrace.h"
 #include "Debug/DebugRenderer.h"
 
 #include "RenderGraph/RenderGraph.h"
 
-// Okay, main issue for now is that cpu->gpu uploading doesn't work without ImmediateSubmit since I don't offset memory...(i copy data to
-// the same location for staging heap) Possible solution is to create lots of staging buffers for frame OR upload & wait rn Hint: Create
-// GrowableHeap, with offset each time I memcpy anythin.
-
 namespace Pathfinder
 {
 
 void Renderer::Init()
 {
-    s_RendererSettings.bVSync   = Application::Get().GetWindow()->IsVSync();
-    s_RendererData              = MakeUnique<RendererData>();
-    s_RendererData->LightStruct = MakeUnique<LightData>();
-    s_DescriptorManager         = DescriptorManager::Create();
-
-    std::ranges::for_each(s_RendererData->UploadHeap,
-                          [](auto& uploadHeap)
-                          {
-                              const BufferSpecification uploadHeapSpec = {.ExtraFlags = EBufferFlag::BUFFER_FLAG_MAPPED,
-                                                                          .UsageFlags = EBufferUsage::BUFFER_USAGE_TRANSFER_SOURCE,
-                                                                          .Capacity   = s_RendererData->s_MAX_UPLOAD_HEAP_CAPACITY};
-
-                              uploadHeap = Buffer::Create(uploadHeapSpec);
-                          });
+    s_RendererSettings.bVSync                 = Application::Get().GetWindow()->IsVSync();
+    s_RendererSettings.bParallelPassRecording = true;
+    s_RendererData                            = MakeUnique<RendererData>();
+    s_RendererData->LightStruct               = MakeUnique<LightData>();
+    s_DescriptorManager                       = DescriptorManager::Create();
 
     TextureManager::Init();
+    MeshRegistry::Init();
     ShaderLibrary::Init();
     PipelineLibrary::Init();
     RayTracingBuilder::Init();
 
     s_RendererData->R2D = MakeUnique<Renderer2D>();
 
+    s_RendererData->OpaqueScene      = MakeUnique<GPUScene>("MeshDataOpaque");
+    s_RendererData->TransparentScene = MakeUnique<GPUScene>("MeshDataTransparent");
+
     ShaderLibrary::Load({{"DepthPrePass"},
+                         {"DepthPrePass", {{"LATE_CULLING", ""}}},
+                         {"DepthReduce"},
                          {"ForwardPlus"},
                          {"Shadows/SSShadows"},
                          {"Shadows/CSM"},
                          {"Culling/ObjectCulling"},
+                         {"Culling/ObjectCulling", {{"LATE_CULLING", ""}}},
                          {"Culling/ComputeFrustums"},
                          {"Culling/LightCulling", {{"ADVANCED_CULLING", ""}}},
                          {"Composite"},
@@ -88,6 +83,7 @@ void Renderer::Init()
         [](const WindowResizeData& resizeData)
         {
             s_RendererData->DepthPrePass.OnResize(resizeData.Width, resizeData.Height);
+            s_RendererData->DepthPyramidPass.OnResize(resizeData.Width, resizeData.Height);
             s_RendererData->CascadedShadowMapPass.OnResize(resizeData.Width, resizeData.Height);
             s_RendererData->LightCullingPass.OnResize(resizeData.Width, resizeData.Height);
             s_RendererData->SSSPass.OnResize(resizeData.Width, resizeData.Height);
@@ -128,6 +124,7 @@ void Renderer::Init()
     s_RendererData->FramePreparePass      = {};
     s_RendererData->ObjectCullingPass     = {};
     s_RendererData->DepthPrePass          = DepthPrePass(windowSpec.Width, windowSpec.Height);
+    s_RendererData->DepthPyramidPass      = DepthPyramidPass(windowSpec.Width, windowSpec.Height);
     s_RendererData->CascadedShadowMapPass = CascadedShadowMapPass(windowSpec.Width, windowSpec.Height);
     s_RendererData->LightCullingPass      = LightCullingPass(windowSpec.Width, windowSpec.Height);
     s_RendererData->SSSPass               = ScreenSpaceShadowsPass(windowSpec.Width, windowSpec.Height);
@@ -144,6 +141,7 @@ void Renderer::Init()
 void Renderer::Shutdown()
 {
     GraphicsContext::Get().WaitDeviceOnFinish();
+    MeshRegistry::Shutdown();
 
 #if PFR_DEBUG
     DebugRenderer::Shutdown();
@@ -163,8 +161,6 @@ void Renderer::Shutdown()
 
 void Renderer::Begin()
 {
-    TextureManager::LinkLoadedTexturesWithMeshes();
-
     s_RendererData->bIsFrameBegin = true;
     ShaderLibrary::DestroyGarbageIfNeeded();
 
@@ -179,9 +175,6 @@ void Renderer::Begin()
     s_RendererData->bAnybodyCastsShadows = false;
     s_RendererData->LastBoundPipeline.reset();
 
-    s_RendererData->OpaqueObjects.clear();
-    s_RendererData->TransparentObjects.clear();
-
     s_RendererData->FrameIndex = window->GetCurrentFrameIndex();
 
     s_RendererData->CachedGPUTimers.clear();
@@ -198,8 +191,6 @@ void Renderer::Begin()
     s_RendererData->CPUProfiler.BeginFrame();
     s_RendererData->GPUProfiler.BeginFrame();
 
-    s_RendererData->UploadHeap.at(s_RendererData->FrameIndex)->Resize(s_RendererData->s_MAX_UPLOAD_HEAP_CAPACITY);
-
     uint32_t prevPoolCount              = s_RendererStats.DescriptorPoolCount;
     uint32_t prevDescriptorSetCount     = s_RendererStats.DescriptorSetCount;
     uint32_t prevImageViewCount         = s_RendererStats.ImageViewCount;
@@ -225,14 +216,22 @@ void Renderer::Begin()
 
 void Renderer::Flush(const Unique<UILayer>& uiLayer)
 {
+    RequestStreamedTextureMips();
+    TextureStreamer::Update();
+    MeshRegistry::Update();
+
     s_RendererData->GPUProfiler.BeginPipelineStatisticsQuery(s_RendererData->RenderCommandBuffer.at(s_RendererData->FrameIndex));
 
-    auto rg = MakeUnique<RenderGraph>(s_RendererData->FrameIndex, std::string(s_ENGINE_NAME), s_RendererData->ResourcePool);
+    auto rg = MakeUnique<RenderGraph>(s_RendererData->FrameIndex, std::string(s_ENGINE_NAME), s_RendererData->ResourcePool,
+                                      s_RendererData->CompiledGraphCache);
 
-    s_RendererData->FramePreparePass.AddPass(rg);   // Set camera data, light data, etc..
-    s_RendererData->ObjectCullingPass.AddPass(rg);  // Cull objects in compute, fill indirect arg buffers.
-                                                    //  s_RendererData->CascadedShadowMapPass.AddPass(rg); // Cascaded Shadows
-    s_RendererData->DepthPrePass.AddPass(rg);
+    s_RendererData->FramePreparePass.AddPass(rg);        // Set camera data, light data, etc..
+    s_RendererData->ObjectCullingPass.AddEarlyPass(rg);  // Cull objects in compute, fill indirect arg buffers.
+                                                         //  s_RendererData->CascadedShadowMapPass.AddPass(rg); // Cascaded Shadows
+    s_RendererData->DepthPrePass.AddEarlyPass(rg);       // Depth of objects visible last frame.
+    s_RendererData->DepthPyramidPass.AddPass(rg);        // HiZ from early depth.
+    s_RendererData->ObjectCullingPass.AddLatePass(rg);   // Occlusion cull the rest against HiZ.
+    s_RendererData->DepthPrePass.AddLatePass(rg);        // Complete depth with newly visible objects.
     s_RendererData->LightCullingPass.AddPass(rg);  // Cull lights, fill buffers with culled indices.
     s_RendererData->SSSPass.AddPass(rg);           // ScreenSpace shadows
     s_RendererData->SSAOPass.AddPass(rg);          // ssao-depth-reconstruction
@@ -262,14 +261,27 @@ void Renderer::Flush(const Unique<UILayer>& uiLayer)
         SyncPoint::Create(swapchain->GetImageAvailableSemaphore(), 1, EPipelineStage::PIPELINE_STAGE_TOP_OF_PIPE_BIT);
     const auto swapchainRenderFinishedSyncPoint =
         SyncPoint::Create(swapchain->GetRenderSemaphore(), 1, EPipelineStage::PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+
+    // NOTE: Render graph has already submitted its other batches, last one is recorded here and joins async queues.
+    auto waitPoints = rg->GetFinalBatchWaitPoints();
+    waitPoints.emplace_back(swapchainImageAvailableSyncPoint);
     s_RendererData->RenderCommandBuffer.at(s_RendererData->FrameIndex)
-        ->Submit({swapchainImageAvailableSyncPoint}, {swapchainRenderFinishedSyncPoint}, swapchain->GetRenderFence());
+        ->Submit(waitPoints, {swapchainRenderFinishedSyncPoint}, swapchain->GetRenderFence());
     s_RendererData->bIsFrameBegin = false;
 
     s_RendererData->CPUProfiler.EndFrame();
     s_RendererData->CachedCPUTimers = s_RendererData->CPUProfiler.GetResults();
 }
 
+void Renderer::ExportProfilerTrace(const std::filesystem::path& filePath)
+{
+    PFR_ASSERT(s_RendererData, "RendererData is not valid!");
+
+    const auto& appSpec = Application::Get().GetSpecification();
+    ProfilerTrace::WriteChromeTrace(std::filesystem::path(appSpec.WorkingDir) / filePath, s_RendererData->CPUProfiler.GetHistory(),
+                                    s_RendererData->GPUProfiler.GetHistory());
+}
+
 void Renderer::BeginScene(const Camera& camera)
 {
     s_RendererData->LightCullingPass.SetRecomputeLightCullFrustums(s_RendererData->CameraStruct.FOV != camera.GetZoom());
@@ -294,6 +306,13 @@ void Renderer::DrawQuad(const glm::vec3& translation, const glm::vec3& scale, co
 
 void Renderer::BindPipeline(const Shared<CommandBuffer>& commandBuffer, Shared<Pipeline> pipeline)
 {
+    // NOTE: Secondaries are recorded concurrently and hold a single pass each, nothing to skip there.
+    if (commandBuffer->GetSpecification().Level == ECommandBufferLevel::COMMAND_BUFFER_LEVEL_SECONDARY)
+    {
+        commandBuffer->BindPipeline(pipeline);
+        return;
+    }
+
     if (const auto pipelineToBind = s_RendererData->LastBoundPipeline.lock())
     {
         if (pipelineToBind != pipeline) commandBuffer->BindPipeline(pipeline);
@@ -306,15 +325,66 @@ void Renderer::BindPipeline(const Shared<CommandBuffer>& commandBuffer, Shared<P
     s_RendererData->LastBoundPipeline = pipeline;
 }
 
-void Renderer::SubmitMesh(const Shared<Mesh>& mesh, const glm::vec3& translation, const glm::vec3& scale, const glm::vec4& orientation)
+uint32_t Renderer::AddMeshInstance(const Shared<Mesh>& mesh, const glm::vec3& translation, const glm::vec3& scale,
+                                   const glm::vec4& orientation)
 {
-    for (auto& submesh : mesh->GetSubmeshes())
+    PFR_ASSERT(mesh, "Mesh instance requires mesh!");
+
+    uint32_t instanceID = 0;
+    if (!s_RendererData->FreeMeshInstances.empty())
+    {
+        instanceID = s_RendererData->FreeMeshInstances.back();
+        s_RendererData->FreeMeshInstances.pop_back();
+    }
+    else
+    {
+        instanceID = static_cast<uint32_t>(s_RendererData->MeshInstances.size());
+        s_RendererData->MeshInstances.emplace_back();
+    }
+
+    auto& instance       = s_RendererData->MeshInstances[instanceID];
+    instance.Mesh        = mesh;
+    instance.Translation = translation;
+    instance.Scale       = scale;
+    instance.Orientation = orientation;
+    instance.Slots.clear();
+    for (const auto& submesh : mesh->GetSubmeshes())
     {
-        if (submesh->GetMaterial()->IsOpaque())
-            s_RendererData->OpaqueObjects.emplace_back(submesh, translation, scale, orientation);
-        else
-            s_RendererData->TransparentObjects.emplace_back(submesh, translation, scale, orientation);
+        auto* gpuScene = submesh->GetMaterial()->IsOpaque() ? s_RendererData->OpaqueScene.get() : s_RendererData->TransparentScene.get();
+        instance.Slots.emplace_back(gpuScene, gpuScene->AddObject(submesh, translation, scale, orientation));
     }
+
+    return instanceID;
+}
+
+void Renderer::UpdateMeshInstance(const uint32_t instanceID, const glm::vec3& translation, const glm::vec3& scale,
+                                  const glm::vec4& orientation)
+{
+    PFR_ASSERT(instanceID < s_RendererData->MeshInstances.size() && s_RendererData->MeshInstances[instanceID].Mesh,
+               "Mesh instance is not valid!");
+
+    auto& instance       = s_RendererData->MeshInstances[instanceID];
+    instance.Translation = translation;
+    instance.Scale       = scale;
+    instance.Orientation = orientation;
+    for (const auto& [gpuScene, slot] : instance.Slots)
+        gpuScene->UpdateObject(slot, translation, scale, orientation);
+}
+
+void Renderer::RemoveMeshInstance(const uint32_t instanceID)
+{
+    // NOTE: Scene might outlive renderer, its entities are destroyed after shutdown then.
+    if (!s_RendererData) return;
+
+    PFR_ASSERT(instanceID < s_RendererData->MeshInstances.size() && s_RendererData->MeshInstances[instanceID].Mesh,
+               "Mesh instance is not valid!");
+
+    auto& instance = s_RendererData->MeshInstances[instanceID];
+    for (const auto& [gpuScene, slot] : instance.Slots)
+        gpuScene->RemoveObject(slot);
+
+    instance = {};
+    s_RendererData->FreeMeshInstances.emplace_back(instanceID);
 }
 
 void Renderer::AddDirectionalLight(const DirectionalLight& dl)
@@ -360,6 +430,32 @@ Shared<Image> Renderer::GetFinalPassImage()
     return nullptr;  // s_RendererData->CompositeFramebuffer->GetAttachments()[0].Attachment;
 }
 
+void Renderer::RequestStreamedTextureMips()
+{
+    // NOTE: Texture is assumed to span the whole object, so bounding sphere's projected diameter stands for its on-screen size.
+    const auto& camera        = s_RendererData->CameraStruct;
+    const float pixelsPerUnit = std::abs(camera.Projection[1][1]) * camera.FullResolution.y;
+    for (const auto& [mesh, translation, scale, orientation, slots] : s_RendererData->MeshInstances)
+    {
+        if (!mesh) continue;
+
+        for (const auto& submesh : mesh->GetSubmeshes())
+        {
+            const auto& boundingSphere = submesh->GetBoundingSphere();
+            const glm::quat rotation(orientation.w, orientation.x, orientation.y, orientation.z);
+            const glm::vec3 center = translation + rotation * (boundingSphere.Center * scale);
+            const float radius     = boundingSphere.Radius * std::max({std::abs(scale.x), std::abs(scale.y), std::abs(scale.z)});
+            const float distance   = std::max(glm::length(center - camera.Position) - radius, camera.zNear);
+            const float screenSize = radius * pixelsPerUnit / distance;
+
+            const auto& material = submesh->GetMaterial();
+            for (const auto* texture : {&material->GetAlbedo(), &material->GetNormalMap(), &material->GetMetallicRoughness(),
+                                        &material->GetEmissiveMap(), &material->GetAOMap()})
+                if (*texture) TextureStreamer::RequestMips(*texture, screenSize);
+        }
+    }
+}
+
 void Renderer::CreatePipelines()
 {
     // Compute Light-Culling Frustums && Light-Culling
@@ -384,6 +480,21 @@ void Renderer::CreatePipelines()
                                                      .Shader          = ShaderLibrary::Get("Culling/ObjectCulling"),
                                                      .PipelineType    = EPipelineType::PIPELINE_TYPE_COMPUTE};
         s_RendererData->ObjectCullingPipelineHash = PipelineLibrary::Push(objectCullingPS);
+
+        PipelineSpecification objectCullingLatePS     = {.DebugName       = "ObjectCullingLate",
+                                                         .PipelineOptions = MakeOptional<ComputePipelineOptions>(),
+                                                         .Shader = ShaderLibrary::Get({"Culling/ObjectCulling", {{"LATE_CULLING", ""}}}),
+                                                         .PipelineType = EPipelineType::PIPELINE_TYPE_COMPUTE};
+        s_RendererData->ObjectCullingLatePipelineHash = PipelineLibrary::Push(objectCullingLatePS);
+    }
+
+    // HiZ
+    {
+        PipelineSpecification depthReducePS     = {.DebugName       = "DepthReduce",
+                                                   .PipelineOptions = MakeOptional<ComputePipelineOptions>(),
+                                                   .Shader          = ShaderLibrary::Get("DepthReduce"),
+                                                   .PipelineType    = EPipelineType::PIPELINE_TYPE_COMPUTE};
+        s_RendererData->DepthReducePipelineHash = PipelineLibrary::Push(depthReducePS);
     }
 
     // Cascaded Shadow Maps
@@ -421,6 +532,13 @@ void Renderer::CreatePipelines()
                                                 .PipelineType    = EPipelineType::PIPELINE_TYPE_GRAPHICS};
 
         s_RendererData->DepthPrePassPipelineHash = PipelineLibrary::Push(depthPrePassPS);
+
+        PipelineSpecification depthPrePassLatePS = {.DebugName       = "DepthPrePassLate",
+                                                    .PipelineOptions = MakeOptional<GraphicsPipelineOptions>(depthGPO),
+                                                    .Shader          = ShaderLibrary::Get({"DepthPrePass", {{"LATE_CULLING", ""}}}),
+                                                    .PipelineType    = EPipelineType::PIPELINE_TYPE_GRAPHICS};
+
+        s_RendererData->DepthPrePassLatePipelineHash = PipelineLibrary::Push(depthPrePassLatePS);
     }
 
     // Forward+
@@ -8,12 +8,17 @@
 
 #include "CPUProfiler.h"
 #include "GPUProfiler.h"
+#include "GPUScene.h"
+#include "TextureStreamer.h"
+#include "Mesh/MeshRegistry.h"
 
 #include <Renderer/RenderGraph/RenderGraphPass.h>
 #include <Renderer/RenderGraph/RenderGraphResourcePool.h>
+#include <Renderer/RenderGraph/RenderGraphCache.h>
 
 #include <Renderer/Passes/GBufferPass.h>
 #include <Renderer/Passes/DepthPrePass.h>
+#include <Renderer/Passes/DepthPyramid.h>
 #include <Renderer/Passes/AOBlur.h>
 #include <Renderer/Passes/FinalComposite.h>
 #include <Renderer/Passes/FramePreparePass.h>
@@ -52,8 +57,14 @@ class Renderer final
     static void DrawQuad(const glm::vec3& translation, const glm::vec3& scale, const glm::vec4& orientation,
                          const glm::vec4& color = glm::vec4(1.0f), const Shared<Texture>& texture = nullptr, const uint32_t layer = 0);
 
-    static void SubmitMesh(const Shared<Mesh>& mesh, const glm::vec3& translation = glm::vec3(0.0f),
-                           const glm::vec3& scale = glm::vec3(1.0f), const glm::vec4& orientation = glm::vec4(0.f, 0.f, 0.f, 1.f));
+    // NOTE: Meshes are retained, instance stays in GPUScene tables until removed, only adds/updates/removes reach GPU.
+    NODISCARD static uint32_t AddMeshInstance(const Shared<Mesh>& mesh, const glm::vec3& translation = glm::vec3(0.0f),
+                                              const glm::vec3& scale       = glm::vec3(1.0f),
+                                              const glm::vec4& orientation = glm::vec4(0.f, 0.f, 0.f, 1.f));
+    static void UpdateMeshInstance(const uint32_t instanceID, const glm::vec3& translation, const glm::vec3& scale,
+                                   const glm::vec4& orientation);
+    static void RemoveMeshInstance(const uint32_t instanceID);
+
     static void AddDirectionalLight(const DirectionalLight& dl);
     static void AddPointLight(const PointLight& pl);
     static void AddSpotLight(const SpotLight& sl);
@@ -74,6 +85,9 @@ class Renderer final
         return s_RendererData->CachedGPUTimers;
     }
 
+    // Writes CPU and GPU profiler history as Chrome trace-event JSON, path is relative to working directory.
+    static void ExportProfilerTrace(const std::filesystem::path& filePath);
+
     static const std::vector<std::pair<std::string, uint64_t>>& GetPipelineStatistics()
     {
         PFR_ASSERT(s_RendererData, "RendererData is not valid!");
@@ -99,19 +113,20 @@ class Renderer final
 
     NODISCARD FORCEINLINE static bool IsWorldEmpty()
     {
-        return s_RendererData && s_RendererData->TransparentObjects.empty() && s_RendererData->OpaqueObjects.empty();
+        return s_RendererData && s_RendererData->MeshInstances.size() == s_RendererData->FreeMeshInstances.size();
     }
 
   private:
     Renderer()  = delete;
     ~Renderer() = default;
 
-    struct RenderObject
+    struct MeshInstance
     {
-        Shared<Submesh> submesh = nullptr;
-        glm::vec3 Translation   = glm::vec3(0.f);
-        glm::vec3 Scale         = glm::vec3(1.f);
-        glm::vec4 Orientation   = glm::vec4(0.f, 0.f, 0.f, 1.f);
+        Shared<Pathfinder::Mesh> Mesh = nullptr;  // nullptr marks free instance.
+        glm::vec3 Translation         = glm::vec3(0.f);
+        glm::vec3 Scale               = glm::vec3(1.f);
+        glm::vec4 Orientation         = glm::vec4(0.f, 0.f, 0.f, 1.f);
+        std::vector<std::pair<GPUScene*, uint32_t>> Slots;  // Per submesh, table it went to and its slot there.
     };
 
     struct RendererData
@@ -122,9 +137,6 @@ class Renderer final
         Unique<LightData> LightStruct = nullptr;
         CameraData CameraStruct;
 
-        // NOTE: PerFramed should be objects that are used by host and device.
-        BufferPerFrame UploadHeap;
-
         std::vector<ProfilerTask> CachedCPUTimers;
         Pathfinder::CPUProfiler CPUProfiler;
 
@@ -132,14 +144,19 @@ class Renderer final
         std::vector<ProfilerTask> CachedGPUTimers;
         Pathfinder::GPUProfiler GPUProfiler;
 
-        static constexpr size_t s_MAX_UPLOAD_HEAP_CAPACITY = 32 * 1024 * 1024;  // 32 MB
-        uint8_t FrameIndex                                 = 0;
+        uint8_t FrameIndex = 0;
 
         RGResourcePool ResourcePool;
+        RGCache CompiledGraphCache;  // NOTE: Graph is rebuilt every frame, but compiled only when its topology changes.
         Weak<Pipeline> LastBoundPipeline;
 
         // Rendering
         CommandBufferPerFrame RenderCommandBuffer;
+        // NOTE: Render graph submissions other than the last one(recorded into RenderCommandBuffer), indexed by ECommandBufferType.
+        std::array<std::array<std::vector<Shared<CommandBuffer>>, s_FRAMES_IN_FLIGHT>, 3> BatchCommandBuffers;
+        // NOTE: Per recording thread(command pools are per thread), indexed by ECommandBufferType, used for parallel pass recording.
+        std::array<std::array<std::array<std::vector<Shared<CommandBuffer>>, s_WORKER_THREAD_COUNT>, s_FRAMES_IN_FLIGHT>, 3>
+            SecondaryCommandBuffers;
         Pathfinder::FramePreparePass FramePreparePass;
 
         // Final
@@ -153,7 +170,12 @@ class Renderer final
 
         // DepthPrePass
         Pathfinder::DepthPrePass DepthPrePass;
-        uint64_t DepthPrePassPipelineHash = 0;
+        uint64_t DepthPrePassPipelineHash     = 0;
+        uint64_t DepthPrePassLatePipelineHash = 0;
+
+        // HiZ
+        Pathfinder::DepthPyramidPass DepthPyramidPass;
+        uint64_t DepthReducePipelineHash = 0;
 
         // BLOOM Ping-pong
         Pathfinder::BloomPass BloomPass;
@@ -170,8 +192,10 @@ class Renderer final
         Pathfinder::ScreenSpaceShadowsPass SSSPass;
         /*             SCREEN-SPACE SHADOWS                */
 
-        std::vector<RenderObject> OpaqueObjects;
-        std::vector<RenderObject> TransparentObjects;
+        std::vector<MeshInstance> MeshInstances;
+        std::vector<uint32_t> FreeMeshInstances;
+        Unique<GPUScene> OpaqueScene      = nullptr;  // Persistent MeshData tables, updated from mesh instances.
+        Unique<GPUScene> TransparentScene = nullptr;
 
         // Light-Culling
         uint64_t ComputeFrustumsPipelineHash = 0;
@@ -191,9 +215,11 @@ class Renderer final
         struct ObjectCullStatistics
         {
             uint32_t DrawCountOpaque;
+            uint32_t DrawCountOpaqueLate;
             uint32_t DrawCountTransparent;
         } ObjectCullStats;
-        uint64_t ObjectCullingPipelineHash = 0;
+        uint64_t ObjectCullingPipelineHash     = 0;
+        uint64_t ObjectCullingLatePipelineHash = 0;
         Pathfinder::ObjectCullingPass ObjectCullingPass;
         bool bIsFrameBegin = false;
     };
@@ -206,6 +232,7 @@ class Renderer final
         bool bVSync;
         bool bDrawColliders;
         bool bCollectGPUStats;
+        bool bParallelPassRecording;  // Hazard-free passes of render graph are recorded into secondaries on ThreadPool workers.
     };
 
     static inline RendererSettings s_RendererSettings;
@@ -223,11 +250,24 @@ class Renderer final
         float SwapchainPresentTime;
         uint32_t ImageViewCount;
         std::vector<MemoryBudget> MemoryBudgets;
+        RGTransientMemoryStats TransientMemoryStats;
+        RGCompileStats RenderGraphCompileStats;
+        RGCullingStats RenderGraphCullingStats;
+        RGScheduleStats RenderGraphScheduleStats;
+        RGBarrierStats RenderGraphBarrierStats;
+        float RenderGraphRecordTime;  // ms, CPU time RenderGraph::Execute() takes, compare with bParallelPassRecording off.
+        uint32_t SecondaryCommandBufferCount;
+        uint32_t SceneRecordsUploaded;
+        uint32_t SceneUploadRangeCount;
+        TextureStreamingStats StreamingStats;
+        MeshRegistryStats MeshStats;
     };
 
     static inline RendererStats s_RendererStats = {};
 
     static void CreatePipelines();
+    // Feeds TextureStreamer with projected sizes of submitted objects, so their materials get mips they're seen with.
+    static void RequestStreamedTextureMips();
 };
 
 }  // namespace Pathfinder
\ No newline at end of file
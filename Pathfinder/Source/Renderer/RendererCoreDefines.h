@@ -432,4 +432,33 @@ struct MemoryBudget
     uint64_t BudgetBytes     = 0;  // Estimated amount of memory available to the program
 };
 
+struct MemoryRequirements
+{
+    uint64_t Size           = 0;
+    uint64_t Alignment      = 0;
+    uint32_t MemoryTypeBits = 0;
+};
+
+// NOTE: Places resource into memory block allocated by GraphicsContext::AllocateMemory() instead of its own allocation.
+// Resource doesn't own the memory, so it's caller's responsibility to keep the block alive and insert aliasing barriers.
+struct MemoryAliasingInfo
+{
+    void* Memory    = nullptr;
+    uint64_t Offset = 0;
+};
+
+// NOTE: Completion token of staged upload, Value == 0 means data went straight into mapped memory and is already visible.
+struct UploadToken
+{
+    uint64_t Value = 0;
+    uint8_t Queue  = 0;
+};
+
+// NOTE: Device timestamp sampled together with host time, places GPU timestamps onto CPU timeline(std::chrono::steady_clock).
+struct CalibratedTimestamp
+{
+    uint64_t DeviceTicks = 0;
+    std::chrono::steady_clock::time_point HostTime{};
+};
+
 }  // namespace Pathfinder
@@ -3,24 +3,12 @@
 
 #include <Core/Application.h>
 #include "RendererAPI.h"
+#include "ShaderCache.h"
 #include <Platform/Vulkan/VulkanShader.h>
 
 namespace Pathfinder
 {
 
-FORCEINLINE static std::string HashShader(const std::string& shaderWithExt, const UnorderedMap<std::string, std::string>& macroDefinitions)
-{
-    std::string shaderDefinition = shaderWithExt + "_";
-
-    for (const auto& [key, value] : macroDefinitions)
-    {
-        shaderDefinition += std::hash<std::string>{}(key);
-        shaderDefinition += std::hash<std::string>{}(value);
-    }
-
-    return shaderDefinition;
-}
-
 // The way it works:
 // shaderc_include_result has char* pointers, all we have to do is to store somewhere our shader data to make sure that shaderc_struct
 // points to correct data, and then release it when shaderc is done
@@ -30,29 +18,27 @@ shaderc_include_result* GLSLShaderIncluder::GetInclude(const char* requested_sou
     auto* includeResult = new shaderc_include_result();
     PFR_ASSERT(includeResult, "Failed to allocate shaderc include result!");
 
-    auto* container          = new std::array<std::string, 2>();
-    includeResult->user_data = container;
+    auto include = ShaderIncludeCache::Get(requested_source);
+    PFR_ASSERT(include, "Failed to load shader header!");
 
-    const auto& appSpec            = Application::Get().GetSpecification();
-    const auto requestedSourcePath = std::filesystem::path(appSpec.WorkingDir) / appSpec.AssetsDir / appSpec.ShadersDir / requested_source;
+    if (std::ranges::find(m_Dependencies, std::string_view(requested_source), &ShaderDependency::Path) == m_Dependencies.end())
+        m_Dependencies.emplace_back(requested_source, include->Hash);
 
-    auto shaderSrc = LoadData<std::string>(requestedSourcePath.string().data());
-    PFR_ASSERT(!shaderSrc.empty(), "Failed to load shader header!");
-
-    (*container)[0] = requested_source;
-    (*container)[1] = std::move(shaderSrc);
+    // NOTE: Holding cached entry keeps its source alive even if cache gets cleared in the meantime.
+    auto* container          = new std::pair<std::string, Shared<const ShaderIncludeCache::Entry>>(requested_source, std::move(include));
+    includeResult->user_data = container;
 
-    includeResult->source_name        = (*container)[0].data();
-    includeResult->source_name_length = (*container)[0].size();
-    includeResult->content            = (*container)[1].data();
-    includeResult->content_length     = (*container)[1].size();
+    includeResult->source_name        = container->first.data();
+    includeResult->source_name_length = container->first.size();
+    includeResult->content            = container->second->Source.data();
+    includeResult->content_length     = container->second->Source.size();
 
     return includeResult;
 }
 
 void GLSLShaderIncluder::ReleaseInclude(shaderc_include_result* include_result)
 {
-    delete static_cast<std::array<std::string, 2>*>(include_result->user_data);
+    delete static_cast<std::pair<std::string, Shared<const ShaderIncludeCache::Entry>>*>(include_result->user_data);
     delete include_result;
 }
 
@@ -139,25 +125,49 @@ void Shader::DetectShaderKind(shaderc_shader_kind& shaderKind, const std::string
 std::vector<uint32_t> Shader::CompileOrRetrieveCached(const std::string& shaderName, const std::string& localShaderPath,
                                                       shaderc_shader_kind shaderKind, const bool bHotReload)
 {
-    const auto& appSpec           = Application::Get().GetSpecification();
-    const auto workingDirFilePath = std::filesystem::path(appSpec.WorkingDir);
+    constexpr auto optimizationLevel = shaderc_optimization_level_performance;
+    constexpr auto vulkanEnvVersion  = shaderc_env_version_vulkan_1_3;
+    constexpr auto spirvVersion      = shaderc_spirv_version_1_6;
+#if PFR_DEBUG
+    constexpr bool bGenerateDebugInfo = true;
+#else
+    constexpr bool bGenerateDebugInfo = false;
+#endif
+
+    // Headers could've been edited since they were cached.
+    if (bHotReload) ShaderIncludeCache::Clear();
 
-    // Firstly check if cache exists and retrieve it
-    const std::filesystem::path cachedShaderPath = workingDirFilePath / appSpec.AssetsDir / appSpec.CacheDir / appSpec.ShadersDir /
-                                                   (HashShader(shaderName, m_Specification.MacroDefinitions) + ".spv");
+    const auto shaderSrc = LoadData<std::string>(localShaderPath);
+
+    // Everything besides the source that affects produced SPIR-V.
+    uint64_t optionsHash = ShaderCache::HashMacros(m_Specification.MacroDefinitions);
+    ShaderCache::HashCombine(optionsHash, ShaderCache::s_MANIFEST_VERSION);
+    ShaderCache::HashCombine(optionsHash, static_cast<uint64_t>(RendererAPI::Get()));
+    ShaderCache::HashCombine(optionsHash, static_cast<uint64_t>(shaderKind));
+    ShaderCache::HashCombine(optionsHash, static_cast<uint64_t>(optimizationLevel));
+    ShaderCache::HashCombine(optionsHash, static_cast<uint64_t>(vulkanEnvVersion));
+    ShaderCache::HashCombine(optionsHash, static_cast<uint64_t>(spirvVersion));
+    ShaderCache::HashCombine(optionsHash, static_cast<uint64_t>(bGenerateDebugInfo));
+
+    ShaderCache::Manifest manifest = {.SourceHash = ShaderCache::HashString(shaderSrc), .OptionsHash = optionsHash};
+    const auto manifestPath        = ShaderCache::GetManifestPath(shaderName, m_Specification.MacroDefinitions);
+
+    std::vector<uint32_t> compiledShaderSrc;
 #if !VK_FORCE_SHADER_COMPILATION
-    // TODO: Add extra shader directories if don't exist, cuz loading fucked up
-    if (!bHotReload && std::filesystem::exists(cachedShaderPath)) return LoadData<std::vector<uint32_t>>(cachedShaderPath.string());
+    // Firstly check if manifest still describes current sources, then there's no need to even preprocess.
+    if (ShaderCache::Manifest cachedManifest = {};
+        ShaderCache::LoadManifest(manifestPath, cachedManifest) &&
+        ShaderCache::IsManifestUpToDate(cachedManifest, manifest.SourceHash, manifest.OptionsHash) &&
+        ShaderCache::LoadBinary(cachedManifest.ContentKey, compiledShaderSrc))
+        return compiledShaderSrc;
 #endif
 
-    // Got no cache, let's compile then
     thread_local shaderc::Compiler compiler;
-    thread_local shaderc::CompileOptions compileOptions;
-    compileOptions.SetOptimizationLevel(shaderc_optimization_level_performance);
+    // NOTE: Not thread_local, macros of previously compiled shaders would leak into this one.
+    shaderc::CompileOptions compileOptions;
+    compileOptions.SetOptimizationLevel(optimizationLevel);
     compileOptions.SetWarningsAsErrors();
-#if PFR_DEBUG
-    compileOptions.SetGenerateDebugInfo();
-#endif
+    if (bGenerateDebugInfo) compileOptions.SetGenerateDebugInfo();
 
     for (const auto& [name, value] : m_Specification.MacroDefinitions)
     {
@@ -167,15 +177,14 @@ std::vector<uint32_t> Shader::CompileOrRetrieveCached(const std::string& shaderN
             compileOptions.AddMacroDefinition(name);
     }
 
-    const auto shaderSrc = LoadData<std::string>(localShaderPath);
     switch (RendererAPI::Get())
     {
         case ERendererAPI::RENDERER_API_VULKAN:
         {
             compileOptions.SetSourceLanguage(shaderc_source_language_glsl);
-            compileOptions.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_3);
-            compileOptions.SetTargetSpirv(shaderc_spirv_version_1_6);
-            compileOptions.SetIncluder(MakeUnique<GLSLShaderIncluder>());
+            compileOptions.SetTargetEnvironment(shaderc_target_env_vulkan, vulkanEnvVersion);
+            compileOptions.SetTargetSpirv(spirvVersion);
+            compileOptions.SetIncluder(MakeUnique<GLSLShaderIncluder>(manifest.Dependencies));
 
             // Preprocess
             const auto preprocessedResult = compiler.PreprocessGlsl(shaderSrc.data(), shaderSrc.size() * sizeof(shaderSrc[0]), shaderKind,
@@ -192,6 +201,18 @@ std::vector<uint32_t> Shader::CompileOrRetrieveCached(const std::string& shaderN
             }
 
             const std::string preprocessedShaderSrc(preprocessedResult.cbegin(), preprocessedResult.cend());
+            manifest.ContentKey = ShaderCache::HashString(preprocessedShaderSrc);
+            ShaderCache::HashCombine(manifest.ContentKey, optionsHash);
+
+#if !VK_FORCE_SHADER_COMPILATION
+            // Edits that don't survive preprocessing(comments, unused branches of headers) end up with the same SPIR-V.
+            if (ShaderCache::LoadBinary(manifest.ContentKey, compiledShaderSrc))
+            {
+                ShaderCache::SaveManifest(manifestPath, manifest);
+                return compiledShaderSrc;
+            }
+#endif
+
             // Compile
             const auto compiledShaderResult =
                 compiler.CompileGlslToSpv(preprocessedShaderSrc.data(), preprocessedShaderSrc.size() * sizeof(preprocessedShaderSrc[0]),
@@ -207,8 +228,9 @@ std::vector<uint32_t> Shader::CompileOrRetrieveCached(const std::string& shaderN
                 PFR_ASSERT(false, shaderErrorMessage.data());
             }
 
-            const std::vector<uint32_t> compiledShaderSrc{compiledShaderResult.cbegin(), compiledShaderResult.cend()};
-            SaveData(cachedShaderPath.string(), compiledShaderSrc.data(), compiledShaderSrc.size() * sizeof(compiledShaderSrc[0]));
+            compiledShaderSrc.assign(compiledShaderResult.cbegin(), compiledShaderResult.cend());
+            ShaderCache::SaveBinary(manifest.ContentKey, compiledShaderSrc);
+            ShaderCache::SaveManifest(manifestPath, manifest);
 
             return compiledShaderSrc;
         }
@@ -255,14 +277,7 @@ void ShaderLibrary::Load(const std::vector<ShaderSpecification>& shaderSpecs)
 
 const Shared<Shader>& ShaderLibrary::Get(const std::string& shaderName)
 {
-    if (!s_Shaders.contains(shaderName))
-    {
-        LOG_ERROR("\"{}\" doesn't exist!", shaderName.data());
-        PFR_ASSERT(false, "Failed to retrieve shader!");
-    }
-
-    const auto range = s_Shaders.equal_range(shaderName);
-    return range.first->second;
+    return Get(ShaderSpecification{.Name = shaderName});
 }
 
 const Shared<Shader>& ShaderLibrary::Get(const ShaderSpecification& shaderSpec)
@@ -273,28 +288,20 @@ const Shared<Shader>& ShaderLibrary::Get(const ShaderSpecification& shaderSpec)
         PFR_ASSERT(false, "Failed to retrieve shader!");
     }
 
+    // NOTE: Variants of the same shader differ only by macros, so macro sets have to match exactly, empty value matches any.
     const auto range = s_Shaders.equal_range(shaderSpec.Name);
     for (auto it = range.first; it != range.second; ++it)
     {
-        const auto& shaderSpecFromRange = it->second->GetSpecification();
-        if (!shaderSpecFromRange.Name.empty() && !shaderSpec.Name.empty() &&
-            strcmp(shaderSpecFromRange.Name.data(), shaderSpec.Name.data()) != 0)
-            continue;
-
-        bool bAllMacrosFound = true;
-        for (const auto& [name1, value1] : shaderSpecFromRange.MacroDefinitions)
-        {
-            for (const auto& [name2, value2] : shaderSpec.MacroDefinitions)
-            {
-                if (strcmp(name1.data(), name2.data()) != 0 ||
-                    !value1.empty() && !value2.empty() && strcmp(value1.data(), value2.data()) != 0)
-                {
-                    bAllMacrosFound = false;
-                    break;
-                }
-            }
-        }
-
+        const auto& variantMacros = it->second->GetSpecification().MacroDefinitions;
+        if (variantMacros.size() != shaderSpec.MacroDefinitions.size()) continue;
+
+        const bool bAllMacrosFound = std::ranges::all_of(shaderSpec.MacroDefinitions,
+                                                         [&](const auto& macro)
+                                                         {
+                                                             const auto variantMacroIt = variantMacros.find(macro.first);
+                                                             return variantMacroIt != variantMacros.end() &&
+                                                                    (macro.second.empty() || variantMacroIt->second == macro.second);
+                                                         });
         if (bAllMacrosFound) return it->second;
     }
 
@@ -15,9 +15,14 @@ static constexpr uint8_t s_SHADER_EXTENSIONS_SIZE
 static constexpr std::array<const std::string_view, s_SHADER_EXTENSIONS_SIZE> s_SHADER_EXTENSIONS = {
     ".vert", ".tesc", ".tese", ".geom", ".frag", ".mesh", ".task", ".comp", ".rmiss", ".rgen", ".rchit", ".rahit", ".rcall"};
 
+struct ShaderDependency;
+
+// Serves headers from ShaderIncludeCache and records every header it resolved, so they end up in shader's cache manifest.
 class GLSLShaderIncluder final : public shaderc::CompileOptions::IncluderInterface
 {
   public:
+    explicit GLSLShaderIncluder(std::vector<ShaderDependency>& outDependencies) : m_Dependencies(outDependencies) {}
+
     // Handles shaderc_include_resolver_fn callbacks.
     shaderc_include_result* GetInclude(const char* requested_source, shaderc_include_type type, const char* requesting_source,
                                        size_t include_depth) final override;
@@ -26,6 +31,9 @@ class GLSLShaderIncluder final : public shaderc::CompileOptions::IncluderInterfa
     void ReleaseInclude(shaderc_include_result* data) final override;
 
     ~GLSLShaderIncluder() override = default;
+
+  private:
+    std::vector<ShaderDependency>& m_Dependencies;
 };
 
 class Pipeline;
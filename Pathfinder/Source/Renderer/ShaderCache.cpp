@@ -0,0 +1,192 @@
+#include <PathfinderPCH.h>
+#include "ShaderCache.h"
+
+#include <Core/Application.h>
+
+namespace Pathfinder
+{
+
+namespace ShaderCacheUtils
+{
+
+NODISCARD FORCEINLINE static std::filesystem::path GetShaderCacheDir()
+{
+    const auto& appSpec = Application::Get().GetSpecification();
+    return std::filesystem::path(appSpec.WorkingDir) / appSpec.AssetsDir / appSpec.CacheDir / appSpec.ShadersDir;
+}
+
+// NOTE: Cache files are shared by all compile threads, so write into temporary file first and then swap it in.
+static void SaveFileAtomically(const std::filesystem::path& filePath, const void* data, const int64_t dataSize)
+{
+    const auto tempFilePath =
+        filePath.string() + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    SaveData(tempFilePath, data, dataSize);
+
+    std::error_code ec = {};
+    std::filesystem::rename(tempFilePath, filePath, ec);
+    if (ec)
+    {
+        LOG_WARN("ShaderCache: Failed to save \"{}\"! {}", filePath.string(), ec.message());
+        std::filesystem::remove(tempFilePath, ec);
+    }
+}
+
+}  // namespace ShaderCacheUtils
+
+Shared<const ShaderIncludeCache::Entry> ShaderIncludeCache::Get(const std::string& includePath)
+{
+    {
+        std::lock_guard lock(s_Mutex);
+        if (const auto it = s_Entries.find(includePath); it != s_Entries.end()) return it->second;
+    }
+
+    const auto& appSpec     = Application::Get().GetSpecification();
+    const auto includedPath = std::filesystem::path(appSpec.WorkingDir) / appSpec.AssetsDir / appSpec.ShadersDir / includePath;
+    if (!std::filesystem::exists(includedPath)) return nullptr;
+
+    auto entry    = MakeShared<Entry>();
+    entry->Source = LoadData<std::string>(includedPath.string());
+    entry->Hash   = ShaderCache::HashString(entry->Source);
+
+    // NOTE: Another thread could've loaded it meanwhile, keep the first one so everybody sees the same contents.
+    std::lock_guard lock(s_Mutex);
+    return s_Entries.try_emplace(includePath, std::move(entry)).first->second;
+}
+
+void ShaderIncludeCache::Clear()
+{
+    std::lock_guard lock(s_Mutex);
+    s_Entries.clear();
+}
+
+uint64_t ShaderCache::HashString(const std::string_view& str)
+{
+    return ankerl::unordered_dense::hash<std::string_view>{}(str);
+}
+
+void ShaderCache::HashCombine(uint64_t& seed, const uint64_t value)
+{
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+uint64_t ShaderCache::HashMacros(const UnorderedMap<std::string, std::string>& macroDefinitions)
+{
+    std::vector<std::pair<std::string_view, std::string_view>> sortedMacros;
+    sortedMacros.reserve(macroDefinitions.size());
+    for (const auto& [name, value] : macroDefinitions)
+        sortedMacros.emplace_back(name, value);
+    std::ranges::sort(sortedMacros);
+
+    uint64_t macrosHash = sortedMacros.size();
+    for (const auto& [name, value] : sortedMacros)
+    {
+        HashCombine(macrosHash, HashString(name));
+        HashCombine(macrosHash, HashString(value));
+    }
+    return macrosHash;
+}
+
+std::filesystem::path ShaderCache::GetManifestPath(const std::string& shaderName,
+                                                   const UnorderedMap<std::string, std::string>& macroDefinitions)
+{
+    return ShaderCacheUtils::GetShaderCacheDir() /
+           std::format("{}_{:016x}{}", shaderName, HashMacros(macroDefinitions), s_MANIFEST_EXTENSION);
+}
+
+std::filesystem::path ShaderCache::GetBinaryPath(const uint64_t contentKey)
+{
+    return ShaderCacheUtils::GetShaderCacheDir() / "SPIRV" / std::format("{:016x}.spv", contentKey);
+}
+
+bool ShaderCache::LoadManifest(const std::filesystem::path& manifestPath, Manifest& outManifest)
+{
+    if (!std::filesystem::exists(manifestPath)) return false;
+
+    const auto blob = LoadData<std::vector<uint8_t>>(manifestPath.string());
+    if (blob.size() < sizeof(ManifestHeader)) return false;
+
+    ManifestHeader header = {};
+    std::memcpy(&header, blob.data(), sizeof(header));
+    if (header.Magic != s_MANIFEST_MAGIC || header.Version != s_MANIFEST_VERSION) return false;
+
+    outManifest.SourceHash  = header.SourceHash;
+    outManifest.OptionsHash = header.OptionsHash;
+    outManifest.ContentKey  = header.ContentKey;
+    outManifest.Dependencies.resize(header.DependencyCount);
+
+    // [Hash][PathLength][Path chars] per dependency.
+    size_t offset = sizeof(ManifestHeader);
+    for (auto& dependency : outManifest.Dependencies)
+    {
+        uint32_t pathLength = 0;
+        if (offset + sizeof(dependency.Hash) + sizeof(pathLength) > blob.size()) return false;
+
+        std::memcpy(&dependency.Hash, blob.data() + offset, sizeof(dependency.Hash));
+        offset += sizeof(dependency.Hash);
+        std::memcpy(&pathLength, blob.data() + offset, sizeof(pathLength));
+        offset += sizeof(pathLength);
+
+        if (offset + pathLength > blob.size()) return false;
+        dependency.Path.assign(reinterpret_cast<const char*>(blob.data() + offset), pathLength);
+        offset += pathLength;
+    }
+
+    return offset == blob.size();
+}
+
+bool ShaderCache::IsManifestUpToDate(const Manifest& manifest, const uint64_t sourceHash, const uint64_t optionsHash)
+{
+    if (manifest.SourceHash != sourceHash || manifest.OptionsHash != optionsHash) return false;
+
+    for (const auto& dependency : manifest.Dependencies)
+    {
+        const auto include = ShaderIncludeCache::Get(dependency.Path);
+        if (!include || include->Hash != dependency.Hash) return false;
+    }
+
+    return true;
+}
+
+void ShaderCache::SaveManifest(const std::filesystem::path& manifestPath, const Manifest& manifest)
+{
+    const ManifestHeader header = {.Magic           = s_MANIFEST_MAGIC,
+                                   .Version         = s_MANIFEST_VERSION,
+                                   .SourceHash      = manifest.SourceHash,
+                                   .OptionsHash     = manifest.OptionsHash,
+                                   .ContentKey      = manifest.ContentKey,
+                                   .DependencyCount = static_cast<uint32_t>(manifest.Dependencies.size())};
+
+    std::vector<uint8_t> blob(sizeof(header));
+    std::memcpy(blob.data(), &header, sizeof(header));
+    for (const auto& dependency : manifest.Dependencies)
+    {
+        const auto pathLength = static_cast<uint32_t>(dependency.Path.size());
+        const size_t offset   = blob.size();
+        blob.resize(offset + sizeof(dependency.Hash) + sizeof(pathLength) + pathLength);
+
+        std::memcpy(blob.data() + offset, &dependency.Hash, sizeof(dependency.Hash));
+        std::memcpy(blob.data() + offset + sizeof(dependency.Hash), &pathLength, sizeof(pathLength));
+        std::memcpy(blob.data() + offset + sizeof(dependency.Hash) + sizeof(pathLength), dependency.Path.data(), pathLength);
+    }
+
+    ShaderCacheUtils::SaveFileAtomically(manifestPath, blob.data(), blob.size());
+}
+
+bool ShaderCache::LoadBinary(const uint64_t contentKey, std::vector<uint32_t>& outSpirv)
+{
+    const auto binaryPath = GetBinaryPath(contentKey);
+    if (!std::filesystem::exists(binaryPath)) return false;
+
+    outSpirv = LoadData<std::vector<uint32_t>>(binaryPath.string());
+    return !outSpirv.empty();
+}
+
+void ShaderCache::SaveBinary(const uint64_t contentKey, const std::vector<uint32_t>& spirv)
+{
+    const auto binaryPath = GetBinaryPath(contentKey);
+    if (!std::filesystem::is_directory(binaryPath.parent_path())) std::filesystem::create_directories(binaryPath.parent_path());
+
+    ShaderCacheUtils::SaveFileAtomically(binaryPath, spirv.data(), spirv.size() * sizeof(spirv[0]));
+}
+
+}  // namespace Pathfinder
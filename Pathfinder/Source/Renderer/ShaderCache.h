@@ -0,0 +1,92 @@
+#pragma once
+
+#include <Core/Core.h>
+#include <mutex>
+
+namespace Pathfinder
+{
+
+// Header pulled in by shader, path is relative to shaders directory.
+struct ShaderDependency
+{
+    std::string Path = s_DEFAULT_STRING;
+    uint64_t Hash    = 0;
+};
+
+// Every shader header is read from disk and hashed once per process(until Clear()), shared by all compile threads.
+class ShaderIncludeCache final
+{
+  public:
+    struct Entry
+    {
+        std::string Source = s_DEFAULT_STRING;
+        uint64_t Hash      = 0;
+    };
+
+    // Returns nullptr in case header doesn't exist.
+    NODISCARD static Shared<const Entry> Get(const std::string& includePath);
+    static void Clear();
+
+  private:
+    static inline UnorderedMap<std::string, Shared<const Entry>> s_Entries;
+    static inline std::mutex s_Mutex;
+
+    ShaderIncludeCache()  = delete;
+    ~ShaderIncludeCache() = default;
+};
+
+/*
+ * SPIR-V is stored content-addressed: Cache/Shaders/SPIRV/<hash of preprocessed source, macros and compile options>.spv.
+ * Every shader variant(name + macro set) has manifest next to its old cache location that remembers hash of the source, compile
+ * options, content key and all headers(with their hashes) it pulled in. If all of them still match, SPIR-V is loaded without
+ * running preprocessor, otherwise shader is preprocessed and content key decides whether compilation is needed at all.
+ */
+class ShaderCache final
+{
+  public:
+    static constexpr uint32_t s_MANIFEST_MAGIC   = 0x4E414D53;  // "SMAN"
+    static constexpr uint32_t s_MANIFEST_VERSION = 1;
+    static constexpr std::string_view s_MANIFEST_EXTENSION = ".manifest";
+
+    struct Manifest
+    {
+        uint64_t SourceHash  = 0;
+        uint64_t OptionsHash = 0;
+        uint64_t ContentKey  = 0;
+        std::vector<ShaderDependency> Dependencies;
+    };
+
+    NODISCARD static uint64_t HashString(const std::string_view& str);
+    static void HashCombine(uint64_t& seed, const uint64_t value);
+
+    // Order independent hash of the macro set.
+    NODISCARD static uint64_t HashMacros(const UnorderedMap<std::string, std::string>& macroDefinitions);
+
+    NODISCARD static std::filesystem::path GetManifestPath(const std::string& shaderName,
+                                                           const UnorderedMap<std::string, std::string>& macroDefinitions);
+    NODISCARD static std::filesystem::path GetBinaryPath(const uint64_t contentKey);
+
+    // Returns false in case manifest doesn't exist, is corrupted or any of its inputs changed.
+    NODISCARD static bool LoadManifest(const std::filesystem::path& manifestPath, Manifest& outManifest);
+    NODISCARD static bool IsManifestUpToDate(const Manifest& manifest, const uint64_t sourceHash, const uint64_t optionsHash);
+    static void SaveManifest(const std::filesystem::path& manifestPath, const Manifest& manifest);
+
+    NODISCARD static bool LoadBinary(const uint64_t contentKey, std::vector<uint32_t>& outSpirv);
+    static void SaveBinary(const uint64_t contentKey, const std::vector<uint32_t>& spirv);
+
+  private:
+    struct ManifestHeader
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint64_t SourceHash;
+        uint64_t OptionsHash;
+        uint64_t ContentKey;
+        uint32_t DependencyCount;
+    };
+
+    ShaderCache()  = delete;
+    ~ShaderCache() = default;
+};
+
+}  // namespace Pathfinder
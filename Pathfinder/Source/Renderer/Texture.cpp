@@ -6,46 +6,65 @@
 #include <Renderer/Renderer.h>
 #include <Renderer/DescriptorManager.h>
 
-#include <Renderer/Mesh/Submesh.h>
-#include <Renderer/Material.h>
+#include "KTX2.h"
+#include "TextureStreamer.h"
 
+#if PFR_USE_COMPRESSONATOR
 #include <compressonator.h>
+#endif
 
 namespace Pathfinder
 {
 
-Shared<Texture> Texture::Create(const TextureSpecification& textureSpec, const void* data, const size_t dataSize)
+Shared<Texture> Texture::Create(const TextureSpecification& textureSpec, const void* data, const size_t dataSize,
+                                const MemoryAliasingInfo& aliasingInfo)
 {
     switch (RendererAPI::Get())
     {
-        case ERendererAPI::RENDERER_API_VULKAN: return MakeShared<VulkanTexture>(textureSpec, data, dataSize);
+        case ERendererAPI::RENDERER_API_VULKAN: return MakeShared<VulkanTexture>(textureSpec, data, dataSize, aliasingInfo);
     }
 
     PFR_ASSERT(false, "Unknown Renderer API!");
     return nullptr;
 }
 
-void Texture::Invalidate(const void* data = nullptr, const size_t dataSize = 0)
+MemoryRequirements Texture::GetMemoryRequirements(const TextureSpecification& textureSpec)
 {
-    if (data && dataSize > 0) m_Specification.UsageFlags |= EImageUsage::IMAGE_USAGE_TRANSFER_DST_BIT;
+    auto imageSpec = GetImageSpecification(textureSpec);
+    imageSpec.UsageFlags |= EImageUsage::IMAGE_USAGE_SAMPLED_BIT;  // NOTE: Textures are always sampled, see VulkanTexture.
+    return Image::GetMemoryRequirements(imageSpec);
+}
 
-    ImageSpecification imageSpec = {.DebugName  = m_Specification.DebugName,
-                                    .Width      = m_Specification.Width,
-                                    .Height     = m_Specification.Height,
-                                    .Format     = m_Specification.Format,
-                                    .UsageFlags = m_Specification.UsageFlags,
-                                    .Layers     = m_Specification.Layers};
-    if (m_Specification.bGenerateMips)
+ImageSpecification Texture::GetImageSpecification(const TextureSpecification& textureSpec)
+{
+    ImageSpecification imageSpec = {.DebugName  = textureSpec.DebugName,
+                                    .Width      = textureSpec.Width,
+                                    .Height     = textureSpec.Height,
+                                    .Format     = textureSpec.Format,
+                                    .UsageFlags = textureSpec.UsageFlags,
+                                    .Mips       = std::max(textureSpec.Mips, 1u),
+                                    .Layers     = textureSpec.Layers};
+    if (textureSpec.bGenerateMips)
     {
-        imageSpec.Mips = ImageUtils::CalculateMipCount(m_Specification.Width, m_Specification.Height);
+        imageSpec.Mips = ImageUtils::CalculateMipCount(textureSpec.Width, textureSpec.Height);
         imageSpec.UsageFlags |= EImageUsage::IMAGE_USAGE_TRANSFER_SRC_BIT;  // For downsampling the source.
     }
 
-    m_Image = Image::Create(imageSpec);
+    return imageSpec;
+}
+
+void Texture::Invalidate(const void* data = nullptr, const size_t dataSize = 0)
+{
+    if (data && dataSize > 0) m_Specification.UsageFlags |= EImageUsage::IMAGE_USAGE_TRANSFER_DST_BIT;
+
+    auto imageSpec         = GetImageSpecification(m_Specification);
+    imageSpec.AliasingInfo = m_AliasingInfo;
+    m_Image                = Image::Create(imageSpec);
 
     if (data && dataSize > 0)
     {
-        m_Image->SetData(data, dataSize);
+        // NOTE: Precomputed mips(texture cache) are uploaded as is, generated ones come from mip 0 only.
+        m_Image->SetData(data, dataSize, m_Specification.bGenerateMips ? 1 : imageSpec.Mips);
     }
 
     if (!(m_Specification.UsageFlags & EImageUsage::IMAGE_USAGE_STORAGE_BIT))
@@ -56,14 +75,58 @@ void Texture::Invalidate(const void* data = nullptr, const size_t dataSize = 0)
 }
 
 void TextureCompressor::Compress(TextureSpecification& textureSpec, const EImageFormat srcImageFormat, const void* rawImageData,
-                                 const size_t rawImageSize, void** outImageData, size_t& outImageSize)
+                                 const size_t rawImageSize, void** outImageData, size_t& outImageSize,
+                                 const ETextureCompressionQuality quality)
 {
     PFR_ASSERT(rawImageData && rawImageSize > 0, "Invalid image data to compress!");
 
+    const uint32_t mipCount = std::max(textureSpec.Mips, 1u);
+    std::vector<uint64_t> levelTexelCounts(mipCount);
+    std::vector<size_t> levelCompressedSizes(mipCount);
+    for (uint32_t mip{}; mip < mipCount; ++mip)
+    {
+        const uint32_t mipWidth   = std::max(textureSpec.Width >> mip, 1u);
+        const uint32_t mipHeight  = std::max(textureSpec.Height >> mip, 1u);
+        levelTexelCounts[mip]     = static_cast<uint64_t>(mipWidth) * mipHeight;
+        levelCompressedSizes[mip] = BCnEncoder::GetCompressedSize(textureSpec.Format, mipWidth, mipHeight);
+    }
+
+    // NOTE: Source texel size is derived from data itself, so any srcImageFormat with tightly packed mips works.
+    const uint64_t totalTexelCount = std::accumulate(levelTexelCounts.begin(), levelTexelCounts.end(), uint64_t{0});
+    PFR_ASSERT(rawImageSize % totalTexelCount == 0, "Raw image data doesn't match its mip chain!");
+    const uint64_t srcTexelSize = rawImageSize / totalTexelCount;
+
+    outImageSize  = std::accumulate(levelCompressedSizes.begin(), levelCompressedSizes.end(), size_t{0});
+    *outImageData = malloc(outImageSize);
+    PFR_ASSERT(*outImageData, "Failed to allocate memory for compressed texture!");
+
+    const auto* srcLevelData = static_cast<const uint8_t*>(rawImageData);
+    auto* dstLevelData       = static_cast<uint8_t*>(*outImageData);
+    for (uint32_t mip{}; mip < mipCount; ++mip)
+    {
+        const size_t rawLevelSize = levelTexelCounts[mip] * srcTexelSize;
+        CompressLevel(textureSpec.Format, srcImageFormat, std::max(textureSpec.Width >> mip, 1u), std::max(textureSpec.Height >> mip, 1u),
+                      srcLevelData, rawLevelSize, dstLevelData, levelCompressedSizes[mip], quality);
+
+        srcLevelData += rawLevelSize;
+        dstLevelData += levelCompressedSizes[mip];
+    }
+
+#if LOG_TEXTURE_COMPRESSION_INFO
+    LOG_INFO("TextureCompressor: {} bytes -> {} bytes({} mips), compression ratio: {:.2f}.", rawImageSize, outImageSize, mipCount,
+             rawImageSize / static_cast<float>(outImageSize));
+#endif
+}
+
+void TextureCompressor::CompressLevel(const EImageFormat dstImageFormat, const EImageFormat srcImageFormat, const uint32_t width,
+                                      const uint32_t height, const void* rawLevelData, const size_t rawLevelSize, void* outLevelData,
+                                      const size_t outLevelSize, const ETextureCompressionQuality quality)
+{
+#if PFR_USE_COMPRESSONATOR
     CMP_Texture srcTexture = {};
     srcTexture.dwSize      = sizeof(srcTexture);
-    srcTexture.dwWidth     = textureSpec.Width;
-    srcTexture.dwHeight    = textureSpec.Height;
+    srcTexture.dwWidth     = width;
+    srcTexture.dwHeight    = height;
 
     switch (srcImageFormat)
     {
@@ -81,13 +144,13 @@ void TextureCompressor::Compress(TextureSpecification& textureSpec, const EImage
             break;
         default: PFR_ASSERT(false, "Other src image formats currently not implemented! TODO!"); break;
     }
-    srcTexture.dwDataSize = rawImageSize;
-    srcTexture.pData      = (CMP_BYTE*)rawImageData;
+    srcTexture.dwDataSize = rawLevelSize;
+    srcTexture.pData      = (CMP_BYTE*)rawLevelData;
 
     CMP_Texture dstTexture = {.dwWidth = srcTexture.dwWidth, .dwHeight = srcTexture.dwHeight, .dwPitch = 0};
     dstTexture.dwSize      = sizeof(dstTexture);
 
-    switch (textureSpec.Format)
+    switch (dstImageFormat)
     {
         case EImageFormat::FORMAT_BC1_RGB_UNORM:
         case EImageFormat::FORMAT_BC1_RGB_SRGB:
@@ -117,18 +180,17 @@ void TextureCompressor::Compress(TextureSpecification& textureSpec, const EImage
     std::scoped_lock lock(s_CompressorMutex);
 
     dstTexture.dwDataSize = CMP_CalculateBufferSize(&dstTexture);
-    dstTexture.pData      = (CMP_BYTE*)malloc(dstTexture.dwDataSize);
+    PFR_ASSERT(dstTexture.dwDataSize == outLevelSize, "Compressonator buffer size doesn't match BCn block layout!");
+    dstTexture.pData = (CMP_BYTE*)outLevelData;
 
-#if LOG_TEXTURE_COMPRESSION_INFO
-    LOG_TAG_INFO(AMD_COMPRESSONATOR, "Succeed to move from: %llu bytes, to %llu bytes, compression ratio: %f %.", rawImageSize,
-                 dstTexture.dwDataSize, rawImageSize / (float)dstTexture.dwDataSize);
-#endif
+    // FAST, NORMAL.
+    constexpr std::array<float, 2> s_CompressonatorQualities = {0.01f, 0.05f};
 
     const auto CMP_PrintInfoStr         = [](const char* InfoStr) { LOG_INFO("AMD_Compressonator: {}", InfoStr); };
     CMP_CompressOptions compressOptions = {};
     compressOptions.dwSize              = sizeof(compressOptions);
     compressOptions.m_PrintInfoStr      = CMP_PrintInfoStr;
-    compressOptions.fquality            = 0.05f;  // 0.88f;
+    compressOptions.fquality            = s_CompressonatorQualities[static_cast<uint8_t>(quality)];
     compressOptions.bUseGPUDecompress   = true;
     compressOptions.bUseCGCompress      = true;
     compressOptions.nEncodeWith         = CMP_GPU_VLK;
@@ -149,66 +211,30 @@ void TextureCompressor::Compress(TextureSpecification& textureSpec, const EImage
 #endif
     );
     PFR_ASSERT(compressionStatus == CMP_OK, "Failed to convert texture using AMD Compressonator!");
+#else
+    PFR_ASSERT(BCnEncoder::IsSupported(srcImageFormat, dstImageFormat), "Unsupported texture compression formats!");
+    PFR_ASSERT(BCnEncoder::GetCompressedSize(dstImageFormat, width, height) == outLevelSize, "Invalid compressed level size!");
 
-    *outImageData = dstTexture.pData;
-    outImageSize  = dstTexture.dwDataSize;
+    // NOTE: No lock needed, encoder keeps no global state, so different textures compress concurrently.
+    BCnEncoder::Encode(rawLevelData, srcImageFormat, width, height, outLevelData, dstImageFormat, quality);
+#endif
 }
 
-void TextureCompressor::SaveCompressed(const std::filesystem::path& savePath, const TextureSpecification& textureSpec,
+bool TextureCompressor::SaveCompressed(const std::filesystem::path& savePath, const TextureSpecification& textureSpec,
                                        const void* imageData, const size_t imageSize)
 {
-    PFR_ASSERT(!savePath.empty(), "Invalid save path for compressed texture!");
-    PFR_ASSERT(imageData && imageSize > 0, "Invalid image data to save!");
-
-    std::ofstream out(savePath, std::ios::out | std::ios::binary);
-    if (!out.is_open())
-    {
-        LOG_WARN("TextureCompressor: Failed to save compressed texture! <{}>", savePath.string());
-        return;
-    }
-
-    // Store texture specification and its data.
-
-    const auto debugNameLength = textureSpec.DebugName.size();
-    out.write(reinterpret_cast<const char*>(&debugNameLength), sizeof(debugNameLength));
-    out.write(textureSpec.DebugName.data(), debugNameLength);
-    out.write(reinterpret_cast<const char*>(&textureSpec) + sizeof(std::string), sizeof(textureSpec) - sizeof(std::string));
-    out.write(reinterpret_cast<const char*>(&imageSize), sizeof(imageSize));
-    out.write(reinterpret_cast<const char*>(imageData), imageSize);
+    if (KTX2::Save(savePath, textureSpec, imageData, imageSize)) return true;
 
-    out.close();
+    LOG_WARN("TextureCompressor: Failed to save compressed texture! <{}>", savePath.string());
+    return false;
 }
 
-void TextureCompressor::LoadCompressed(const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec,
+bool TextureCompressor::LoadCompressed(const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec,
                                        std::vector<uint8_t>& outData)
 {
-    PFR_ASSERT(!loadPath.empty(), "Invalid load path for compressed texture!");
+    if (!std::filesystem::exists(loadPath)) return false;
 
-    std::ifstream in(loadPath, std::ios::in | std::ios::binary);
-    if (!in.is_open())
-    {
-        LOG_WARN("TextureCompressor: Failed to load compressed texture! <{}>", loadPath.string());
-        return;
-    }
-
-    // Load texture specification.
-    size_t debugNameLength = 0;
-    in.read(reinterpret_cast<char*>(&debugNameLength), sizeof(debugNameLength));
-
-    outTextureSpec.DebugName.resize(debugNameLength);
-    in.read(outTextureSpec.DebugName.data(), debugNameLength);
-
-    in.read(reinterpret_cast<char*>(&outTextureSpec) + sizeof(std::string), sizeof(outTextureSpec) - sizeof(std::string));
-
-    // Load compressed image size.
-    size_t dataSize = 0;
-    in.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
-    PFR_ASSERT(dataSize > 0, "Failed to load compressed image! DataSize is not > 0!");
-
-    outData.resize(dataSize);
-    in.read(reinterpret_cast<char*>(outData.data()), outData.size());
-
-    in.close();
+    return KTX2::Load(loadPath, outTextureSpec, outData);
 }
 
 void TextureManager::Init()
@@ -225,53 +251,17 @@ void TextureManager::Init()
                             &whiteColor, sizeof(whiteColor));
     }
 
+    TextureStreamer::Init();
     LOG_TRACE("{}", __FUNCTION__);
 }
 
 void TextureManager::Shutdown()
 {
+    TextureStreamer::Shutdown();
     s_WhiteTexture.reset();
     LOG_TRACE("{}", __FUNCTION__);
 
     SamplerStorage::Shutdown();
 }
 
-void TextureManager::LinkLoadedTexturesWithMeshes()
-{
-    //for (auto it = s_TexturesInProcess.begin(); it != s_TexturesInProcess.end();)
-    //{
-    //    auto& loadedEntry = *it;
-
-    //    // Don't block main thread.
-    //    if (loadedEntry.TextureFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
-    //    {
-    //        ++it;
-    //        continue;
-    //    }
-
-    //    const auto texture = loadedEntry.TextureFuture.get();
-    //    LOG_INFO("{}: {}", __FUNCTION__, texture->GetSpecification().DebugName);
-
-    //    if (auto submesh = loadedEntry.SubmeshPtr.lock())
-    //    {
-    //        auto& material = submesh->GetMaterial();
-    //        switch (loadedEntry.TextureLoadType)
-    //        {
-    //            case ETextureLoadType::TEXTURE_LOAD_TYPE_ALBEDO: material->SetAlbedo(texture); break;
-    //            case ETextureLoadType::TEXTURE_LOAD_TYPE_NORMAL: material->SetNormalMap(texture); break;
-    //            case ETextureLoadType::TEXTURE_LOAD_TYPE_METALLIC_ROUGHNESS: material->SetMetallicRoughnessMap(texture); break;
-    //            case ETextureLoadType::TEXTURE_LOAD_TYPE_OCCLUSION: material->SetOcclusionMap(texture); break;
-    //            case ETextureLoadType::TEXTURE_LOAD_TYPE_EMISSIVE: material->SetEmissiveMap(texture); break;
-    //            default: PFR_ASSERT(false, "Unknown ETextureLoadType!");
-    //        }
-
-    //        material->Update();
-    //    }
-
-    //    it = s_TexturesInProcess.erase(it);
-    //}
-
-    // s_TexturesInProcess.clear();
-}
-
 }  // namespace Pathfinder
\ No newline at end of file
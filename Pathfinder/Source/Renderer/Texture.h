@@ -4,6 +4,7 @@
 #include <Core/ThreadPool.h>
 #include "RendererCoreDefines.h"
 #include "Image.h"
+#include "BCnEncoder.h"
 
 namespace Pathfinder
 {
@@ -19,6 +20,7 @@ struct TextureSpecification
     EImageFormat Format        = EImageFormat::FORMAT_RGBA8_UNORM;
     ImageUsageFlags UsageFlags = EImageUsage::IMAGE_USAGE_SAMPLED_BIT;
     uint32_t Layers            = 1;
+    uint32_t Mips              = 1;  // NOTE: Mip levels carried by data on creation, ignored with bGenerateMips.
 };
 
 class Texture : private Uncopyable, private Unmovable
@@ -35,23 +37,37 @@ class Texture : private Uncopyable, private Unmovable
     }
     NODISCARD FORCEINLINE const auto& GetImage() const { return m_Image; }
 
-    NODISCARD static Shared<Texture> Create(const TextureSpecification& textureSpec, const void* data = nullptr, const size_t dataSize = 0);
+    NODISCARD static Shared<Texture> Create(const TextureSpecification& textureSpec, const void* data = nullptr, const size_t dataSize = 0,
+                                            const MemoryAliasingInfo& aliasingInfo = {});
+    NODISCARD static MemoryRequirements GetMemoryRequirements(const TextureSpecification& textureSpec);
 
     virtual void Resize(const uint32_t width, const uint32_t height) = 0;
     virtual void SetDebugName(const std::string& name)               = 0;
 
+    // NOTE: Recreates image from data keeping bindless slot and sampler, descriptors are left as is(see UpdateDescriptor()).
+    // Previous image is returned since GPU may still sample it, caller decides when it's safe to release.
+    NODISCARD virtual Shared<Image> Reload(const TextureSpecification& textureSpec, const void* data, const size_t dataSize) = 0;
+    // Points bindless slot at current image in frameIndex's descriptor set, that set must not be in use by GPU.
+    virtual void UpdateDescriptor(const uint8_t frameIndex) = 0;
+
   protected:
     Shared<Image> m_Image                = nullptr;
     TextureSpecification m_Specification = {};
     Optional<uint32_t> m_BindlessIndex   = std::nullopt;
     UUID m_UUID                          = {};  // NOTE: Used only for imgui purposes.
+    MemoryAliasingInfo m_AliasingInfo    = {};  // NOTE: Not a part of TextureSpecification since it's serialized into texture cache.
 
-    Texture(const TextureSpecification& textureSpec) : m_Specification(textureSpec) {}
+    Texture(const TextureSpecification& textureSpec, const MemoryAliasingInfo& aliasingInfo = {})
+        : m_Specification(textureSpec), m_AliasingInfo(aliasingInfo)
+    {
+    }
     Texture() = delete;
 
     virtual void Destroy() = 0;
     virtual void Invalidate(const void* data, const size_t dataSize);
     virtual void GenerateMipMaps() = 0;
+
+    NODISCARD static ImageSpecification GetImageSpecification(const TextureSpecification& textureSpec);
 };
 
 class TextureCompressor final
@@ -60,32 +76,33 @@ class TextureCompressor final
     // NOTE:
     // Compresses data from srcImageFormat into textureSpec.Format
     // outImageData will be fullfiled, so you have to free() it manually.
+    // Goes through AMD Compressonator where it's linked(PFR_USE_COMPRESSONATOR), otherwise through BCnEncoder, which is thread safe.
+    // rawImageData holds textureSpec.Mips levels tightly packed from mip 0, output keeps the same layout.
     static void Compress(TextureSpecification& textureSpec, const EImageFormat srcImageFormat, const void* rawImageData,
-                         const size_t rawImageSize, void** outImageData, size_t& outImageSize);
+                         const size_t rawImageSize, void** outImageData, size_t& outImageSize,
+                         const ETextureCompressionQuality quality = ETextureCompressionQuality::TEXTURE_COMPRESSION_QUALITY_NORMAL);
 
-    static void SaveCompressed(const std::filesystem::path& savePath, const TextureSpecification& textureSpec, const void* imageData,
+    // NOTE: Both go through KTX2 container, see KTX2.h.
+    static bool SaveCompressed(const std::filesystem::path& savePath, const TextureSpecification& textureSpec, const void* imageData,
                                const size_t imageSize);
 
-    static void LoadCompressed(const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec, std::vector<uint8_t>& outData);
+    // Returns false if cache is missing or stale, caller is expected to rebuild it then.
+    NODISCARD static bool LoadCompressed(const std::filesystem::path& loadPath, TextureSpecification& outTextureSpec,
+                                         std::vector<uint8_t>& outData);
 
   private:
+#if PFR_USE_COMPRESSONATOR
     static inline std::mutex s_CompressorMutex;
+#endif
+
+    static void CompressLevel(const EImageFormat dstImageFormat, const EImageFormat srcImageFormat, const uint32_t width,
+                              const uint32_t height, const void* rawLevelData, const size_t rawLevelSize, void* outLevelData,
+                              const size_t outLevelSize, const ETextureCompressionQuality quality);
 
     TextureCompressor()  = delete;
     ~TextureCompressor() = default;
 };
 
-enum class ETextureLoadType : uint8_t
-{
-    TEXTURE_LOAD_TYPE_ALBEDO,
-    TEXTURE_LOAD_TYPE_NORMAL,
-    TEXTURE_LOAD_TYPE_METALLIC_ROUGHNESS,
-    TEXTURE_LOAD_TYPE_EMISSIVE,
-    TEXTURE_LOAD_TYPE_OCCLUSION
-};
-
-// TODO: Parallel texture loading/compressing.
-class Submesh;
 class TextureManager final
 {
   public:
@@ -94,36 +111,8 @@ class TextureManager final
 
     NODISCARD FORCEINLINE static const auto& GetWhiteTexture() { return s_WhiteTexture; }
 
-    template <typename Func, typename... Args>
-    static Shared<Texture>& LoadTextureLazy(const ETextureLoadType textureLoadType, Weak<Submesh> submesh, const std::string& baseMeshDir,
-                                            const std::string& textureName, Func&& func, Args&&... args)
-    {
-        //const std::string wholeTextureName = baseMeshDir + textureName;
-
-        ////    if (loadedTextures.contains(textureName)) return loadedTextures[textureName];
-
-        ///*baseMeshDir + textureName*/
-        //s_TexturesInProcess.emplace_back(ThreadPool::Submit(std::forward<Func>(func), std::forward<Args>(args)...), submesh,
-        //                                 textureLoadType);
-
-        return s_WhiteTexture;
-    }
-
-    static void LinkLoadedTexturesWithMeshes();
-
   private:
     static inline Shared<Texture> s_WhiteTexture = nullptr;
-    //    static inline Pool<Shared<Texture>> s_TexturePool;
-
-    //static inline UnorderedMap<std::string, uint32_t> s_TexturesInProcessNameToIndex;
-
-    //struct LoadedTextureEntry
-    //{
-    //    std::shared_future<Shared<Texture>> TextureFuture;
-    //    Weak<Submesh> SubmeshPtr;
-    //    ETextureLoadType TextureLoadType;
-    //};
-    //static inline std::vector<LoadedTextureEntry> s_TexturesInProcess;
 
     TextureManager()  = delete;
     ~TextureManager() = default;
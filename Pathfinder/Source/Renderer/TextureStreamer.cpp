@@ -0,0 +1,289 @@
+#include <PathfinderPCH.h>
+#include "TextureStreamer.h"
+
+#include "KTX2.h"
+#include "Renderer.h"
+#include <Core/Application.h>
+
+namespace Pathfinder
+{
+
+namespace TextureStreamerUtils
+{
+
+// Specification of the image holding mips [firstMip, fullSpec.Mips).
+NODISCARD static TextureSpecification GetResidentSpecification(const TextureSpecification& fullSpec, const uint32_t firstMip)
+{
+    auto residentSpec   = fullSpec;
+    residentSpec.Width  = std::max(fullSpec.Width >> firstMip, 1u);
+    residentSpec.Height = std::max(fullSpec.Height >> firstMip, 1u);
+    residentSpec.Mips   = fullSpec.Mips - firstMip;
+    return residentSpec;
+}
+
+}  // namespace TextureStreamerUtils
+
+void TextureStreamer::Init()
+{
+    s_StreamerData = MakeUnique<StreamerData>();
+    LOG_TRACE("{}", __FUNCTION__);
+}
+
+void TextureStreamer::Shutdown()
+{
+    // NOTE: Jobs capture nothing but paths, still no point in leaving them behind.
+    for (const auto& streamedTexture : s_StreamerData->Textures)
+        if (streamedTexture.LoadFuture.valid()) streamedTexture.LoadFuture.wait();
+
+    s_StreamerData.reset();
+    LOG_TRACE("{}", __FUNCTION__);
+}
+
+Shared<Texture> TextureStreamer::CreateStreamed(const std::filesystem::path& cachePath, const uint32_t fallbackColor)
+{
+    PFR_ASSERT(s_StreamerData, "TextureStreamer is not initialized!");
+
+    TextureSpecification fullSpec = {};
+    if (!std::filesystem::exists(cachePath) || !KTX2::LoadSpecification(cachePath, fullSpec)) return nullptr;
+
+    // NOTE: Fallback shares sampler with the real texture, so reloads don't have to touch it.
+    auto texture = Texture::Create({.DebugName = fullSpec.DebugName, .Wrap = fullSpec.Wrap, .Filter = fullSpec.Filter}, &fallbackColor,
+                                   sizeof(fallbackColor));
+
+    StreamedTexture streamedTexture = {.TextureRef = texture, .TextureKey = texture.get(), .CachePath = cachePath, .FullSpec = fullSpec};
+    const uint32_t maxDimension     = std::max(fullSpec.Width, fullSpec.Height);
+    while (streamedTexture.TailMip + 1 < fullSpec.Mips && (maxDimension >> streamedTexture.TailMip) > s_MIP_TAIL_SIZE)
+        ++streamedTexture.TailMip;
+    streamedTexture.ResidentMip = streamedTexture.TargetMip = streamedTexture.RequestedMip = fullSpec.Mips;
+
+    std::scoped_lock lock(s_StreamerData->RegistrationMutex);
+    s_StreamerData->PendingRegistrations.emplace_back(std::move(streamedTexture));
+    return texture;
+}
+
+void TextureStreamer::RequestMips(const Shared<Texture>& texture, const float screenSize)
+{
+    PFR_ASSERT(s_StreamerData, "TextureStreamer is not initialized!");
+
+    const auto it = s_StreamerData->TextureIndices.find(texture.get());
+    if (it == s_StreamerData->TextureIndices.end()) return;
+
+    auto& streamedTexture = s_StreamerData->Textures[it->second];
+    const auto& fullSpec  = streamedTexture.FullSpec;
+
+    // One texel per pixel: every halving of the projected size drops one mip.
+    const float texelsPerPixel = static_cast<float>(std::max(fullSpec.Width, fullSpec.Height)) / std::max(screenSize, 1.f);
+    const uint32_t wantedMip =
+        std::min(static_cast<uint32_t>(std::max(std::floor(std::log2(texelsPerPixel)), 0.f)), streamedTexture.TailMip);
+
+    streamedTexture.RequestedMip  = std::min(streamedTexture.RequestedMip, wantedMip);
+    streamedTexture.Priority      = std::max(streamedTexture.Priority, screenSize);
+    streamedTexture.LastUsedFrame = Application::Get().GetCurrentFrameNumber();
+}
+
+void TextureStreamer::Update()
+{
+    PFR_ASSERT(s_StreamerData, "TextureStreamer is not initialized!");
+
+    const uint64_t frameNumber  = Application::Get().GetCurrentFrameNumber();
+    const uint8_t frameIndex    = Renderer::GetRendererData()->FrameIndex;
+    TextureStreamingStats stats = {.MemoryBudget = s_MemoryBudget};
+
+    while (!s_StreamerData->RetiredImages.empty() && frameNumber - s_StreamerData->RetiredImages.front().first > s_FRAMES_IN_FLIGHT)
+        s_StreamerData->RetiredImages.pop_front();
+
+    {
+        std::scoped_lock lock(s_StreamerData->RegistrationMutex);
+        for (auto& streamedTexture : s_StreamerData->PendingRegistrations)
+        {
+            s_StreamerData->TextureIndices[streamedTexture.TextureKey] = static_cast<uint32_t>(s_StreamerData->Textures.size());
+            s_StreamerData->Textures.emplace_back(std::move(streamedTexture));
+        }
+        s_StreamerData->PendingRegistrations.clear();
+    }
+
+    auto& textures = s_StreamerData->Textures;
+    for (uint32_t i{}; i < textures.size();)
+    {
+        auto& streamedTexture = textures[i];
+        const auto texture    = streamedTexture.TextureRef.lock();
+        if (!texture)
+        {
+            // NOTE: Swap-remove, in-flight job's result is simply dropped. Address might be taken by newly registered texture already,
+            // so index is checked before touching TextureIndices.
+            s_StreamerData->CommittedMemory -= KTX2::GetMipChainSize(streamedTexture.FullSpec, streamedTexture.TargetMip);
+            if (streamedTexture.PrevImage) s_StreamerData->RetiredImages.emplace_back(frameNumber, std::move(streamedTexture.PrevImage));
+
+            auto& textureIndices = s_StreamerData->TextureIndices;
+            if (const auto it = textureIndices.find(streamedTexture.TextureKey); it != textureIndices.end() && it->second == i)
+                textureIndices.erase(it);
+
+            const uint32_t lastIndex = static_cast<uint32_t>(textures.size()) - 1;
+            if (i != lastIndex)
+            {
+                streamedTexture = std::move(textures.back());
+                if (const auto it = textureIndices.find(streamedTexture.TextureKey); it != textureIndices.end() && it->second == lastIndex)
+                    it->second = i;
+            }
+            textures.pop_back();
+            continue;
+        }
+
+        // Repoint this frame's descriptor set, the rest get it on their turn.
+        if (streamedTexture.DirtyFrameMask & (1 << frameIndex))
+        {
+            texture->UpdateDescriptor(frameIndex);
+            streamedTexture.DirtyFrameMask &= ~(1 << frameIndex);
+            if (streamedTexture.DirtyFrameMask == 0)
+                s_StreamerData->RetiredImages.emplace_back(frameNumber, std::move(streamedTexture.PrevImage));
+        }
+
+        // NOTE: Next image can't be swapped in until every descriptor set stops pointing at the previous one.
+        if (streamedTexture.LoadFuture.valid() && streamedTexture.DirtyFrameMask == 0 &&
+            streamedTexture.LoadFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            ApplyLoad(streamedTexture, *texture);
+            ++stats.LoadsCompleted;
+        }
+
+        ++i;
+    }
+
+    // Tails go first, then upgrades of the biggest on screen.
+    std::vector<uint32_t> loadCandidates;
+    uint32_t loadsInFlight = 0;
+    for (uint32_t i{}; i < textures.size(); ++i)
+    {
+        const auto& streamedTexture = textures[i];
+        if (streamedTexture.LoadFuture.valid()) ++loadsInFlight;
+        if (streamedTexture.LoadFuture.valid() || streamedTexture.bFailed) continue;
+
+        if (streamedTexture.ResidentMip > streamedTexture.TailMip || streamedTexture.RequestedMip < streamedTexture.ResidentMip)
+            loadCandidates.emplace_back(i);
+    }
+
+    std::ranges::sort(loadCandidates,
+                      [&](const uint32_t lhs, const uint32_t rhs)
+                      {
+                          const bool bLhsTail = textures[lhs].ResidentMip > textures[lhs].TailMip;
+                          const bool bRhsTail = textures[rhs].ResidentMip > textures[rhs].TailMip;
+                          if (bLhsTail != bRhsTail) return bLhsTail;
+                          return textures[lhs].Priority > textures[rhs].Priority;
+                      });
+
+    std::vector<uint32_t> evictionOrder;
+    uint64_t scheduledBytes = 0;
+    for (const uint32_t candidate : loadCandidates)
+    {
+        if (loadsInFlight >= s_MAX_LOADS_IN_FLIGHT || scheduledBytes >= s_MAX_LOAD_BYTES_PER_FRAME) break;
+
+        auto& streamedTexture = textures[candidate];
+        if (streamedTexture.LoadFuture.valid()) continue;  // Evicted in the meantime.
+
+        uint32_t firstMip = streamedTexture.ResidentMip > streamedTexture.TailMip ? streamedTexture.TailMip : streamedTexture.RequestedMip;
+
+        const auto getExtraBytes = [&](const uint32_t mip)
+        {
+            return KTX2::GetMipChainSize(streamedTexture.FullSpec, mip) -
+                   KTX2::GetMipChainSize(streamedTexture.FullSpec, streamedTexture.TargetMip);
+        };
+
+        // NOTE: Tails are small and always fit, upgrades settle for fewer mips in case budget can't be freed.
+        if (firstMip < streamedTexture.TailMip && !MakeRoom(getExtraBytes(firstMip), evictionOrder, frameNumber, stats))
+        {
+            while (firstMip < streamedTexture.ResidentMip && s_StreamerData->CommittedMemory + getExtraBytes(firstMip) > s_MemoryBudget)
+                ++firstMip;
+            if (firstMip >= streamedTexture.ResidentMip) continue;
+        }
+
+        scheduledBytes += KTX2::GetMipChainSize(streamedTexture.FullSpec, firstMip);
+        ScheduleLoad(streamedTexture, firstMip);
+        ++loadsInFlight;
+    }
+
+    uint64_t residentMemory = 0;
+    for (auto& streamedTexture : textures)
+    {
+        residentMemory += KTX2::GetMipChainSize(streamedTexture.FullSpec, streamedTexture.ResidentMip);
+        if (streamedTexture.LoadFuture.valid()) ++stats.LoadsInFlight;
+
+        streamedTexture.RequestedMip = streamedTexture.FullSpec.Mips;
+        streamedTexture.Priority     = 0.f;
+    }
+
+    stats.StreamedTextureCount          = static_cast<uint32_t>(textures.size());
+    stats.ResidentMemory                = residentMemory;
+    Renderer::GetStats().StreamingStats = stats;
+}
+
+void TextureStreamer::ApplyLoad(StreamedTexture& streamedTexture, Texture& texture)
+{
+    const auto& result   = streamedTexture.LoadFuture.get();
+    const auto& fullSpec = streamedTexture.FullSpec;
+    if (!result.bLoaded || result.FullSpec.Width != fullSpec.Width || result.FullSpec.Height != fullSpec.Height ||
+        result.FullSpec.Format != fullSpec.Format || result.FullSpec.Mips != fullSpec.Mips)
+    {
+        LOG_WARN("TextureStreamer: Failed to stream \"{}\", fallback stays bound! <{}>", fullSpec.DebugName,
+                 streamedTexture.CachePath.string());
+        s_StreamerData->CommittedMemory -= KTX2::GetMipChainSize(fullSpec, streamedTexture.TargetMip);
+        s_StreamerData->CommittedMemory += KTX2::GetMipChainSize(fullSpec, streamedTexture.ResidentMip);
+        streamedTexture.TargetMip  = streamedTexture.ResidentMip;
+        streamedTexture.bFailed    = true;
+        streamedTexture.LoadFuture = {};
+        return;
+    }
+
+    streamedTexture.PrevImage = texture.Reload(TextureStreamerUtils::GetResidentSpecification(fullSpec, streamedTexture.TargetMip),
+                                               result.Data.data(), result.Data.size());
+    streamedTexture.ResidentMip    = streamedTexture.TargetMip;
+    streamedTexture.DirtyFrameMask = s_ALL_FRAMES_MASK;
+    streamedTexture.LoadFuture     = {};
+}
+
+void TextureStreamer::ScheduleLoad(StreamedTexture& streamedTexture, const uint32_t firstMip)
+{
+    PFR_ASSERT(!streamedTexture.LoadFuture.valid(), "TextureStreamer: Texture is already being loaded!");
+
+    s_StreamerData->CommittedMemory -= KTX2::GetMipChainSize(streamedTexture.FullSpec, streamedTexture.TargetMip);
+    s_StreamerData->CommittedMemory += KTX2::GetMipChainSize(streamedTexture.FullSpec, firstMip);
+    streamedTexture.TargetMip = firstMip;
+
+    streamedTexture.LoadFuture = ThreadPool::Submit(
+        [cachePath = streamedTexture.CachePath, firstMip]
+        {
+            LoadResult result = {};
+            result.bLoaded    = KTX2::Load(cachePath, result.FullSpec, result.Data, firstMip);
+            return result;
+        });
+}
+
+bool TextureStreamer::MakeRoom(const uint64_t bytes, std::vector<uint32_t>& evictionOrder, const uint64_t frameNumber,
+                               TextureStreamingStats& stats)
+{
+    if (s_StreamerData->CommittedMemory + bytes <= s_MemoryBudget) return true;
+
+    auto& textures = s_StreamerData->Textures;
+    if (evictionOrder.empty())
+    {
+        // NOTE: Built once per Update(), back is the least recently used.
+        for (uint32_t i{}; i < textures.size(); ++i)
+            if (textures[i].LastUsedFrame < frameNumber && textures[i].ResidentMip < textures[i].TailMip) evictionOrder.emplace_back(i);
+
+        std::ranges::sort(evictionOrder, std::greater{}, [&](const uint32_t i) { return textures[i].LastUsedFrame; });
+    }
+
+    while (!evictionOrder.empty() && s_StreamerData->CommittedMemory + bytes > s_MemoryBudget)
+    {
+        auto& streamedTexture = textures[evictionOrder.back()];
+        evictionOrder.pop_back();
+        if (streamedTexture.LoadFuture.valid() || streamedTexture.ResidentMip >= streamedTexture.TailMip) continue;
+
+        // Tail is reloaded rather than kept around, so eviction frees memory as soon as new image is swapped in.
+        ScheduleLoad(streamedTexture, streamedTexture.TailMip);
+        ++stats.Evictions;
+    }
+
+    return s_StreamerData->CommittedMemory + bytes <= s_MemoryBudget;
+}
+
+}  // namespace Pathfinder
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Core/Core.h>
+#include "RendererCoreDefines.h"
+#include "Texture.h"
+
+namespace Pathfinder
+{
+
+struct TextureStreamingStats
+{
+    uint32_t StreamedTextureCount;
+    uint32_t LoadsInFlight;
+    uint32_t LoadsCompleted;  // This frame.
+    uint32_t Evictions;       // This frame.
+    uint64_t ResidentMemory;  // Bytes of streamed mips that are currently bound.
+    uint64_t MemoryBudget;
+};
+
+/*
+ * Streams mip chains of cached(KTX2) textures under VRAM budget.
+ * Streamed texture gets its bindless slot up front, pointing at 1x1 fallback of caller's choice(neutral value of the material slot
+ * it's bound to), so materials can reference it right away.
+ * Mip tail(mips no bigger than s_MIP_TAIL_SIZE) of every texture is loaded first, higher mips follow, prioritized by projected
+ * screen size renderer requests every frame. Over budget, least recently used textures are evicted back down to their tails.
+ * No sparse residency: every residency change loads [ResidentMip, Mips) on ThreadPool and recreates image from it, then the slot
+ * is repointed frame by frame(descriptor set of frame in flight can't be touched), previous image lives until GPU is done with it.
+ */
+class TextureStreamer final
+{
+  public:
+    static void Init();
+    static void Shutdown();
+
+    // Returns nullptr if cache is missing or stale. Thread safe, texture joins streaming on the next Update().
+    // fallbackColor - RGBA8 texel(R in the lowest byte) texture shows until its mip tail is loaded.
+    NODISCARD static Shared<Texture> CreateStreamed(const std::filesystem::path& cachePath, const uint32_t fallbackColor = 0xFFFFFFFF);
+
+    // screenSize - projected size in pixels of the surface texture is mapped onto, biggest request within a frame wins.
+    // Non-streamed textures are ignored.
+    static void RequestMips(const Shared<Texture>& texture, const float screenSize);
+
+    // Main thread, once per frame before recording: applies finished loads, schedules new ones, enforces the budget.
+    static void Update();
+
+    FORCEINLINE static void SetMemoryBudget(const uint64_t memoryBudget) { s_MemoryBudget = memoryBudget; }
+    NODISCARD FORCEINLINE static uint64_t GetMemoryBudget() { return s_MemoryBudget; }
+
+  private:
+    static constexpr uint32_t s_MIP_TAIL_SIZE            = 128;
+    static constexpr uint32_t s_MAX_LOADS_IN_FLIGHT      = 16;
+    static constexpr uint64_t s_MAX_LOAD_BYTES_PER_FRAME = 32 * 1024 * 1024;  // NOTE: Keeps staging uploads per frame bounded.
+    static constexpr uint8_t s_ALL_FRAMES_MASK           = (1 << s_FRAMES_IN_FLIGHT) - 1;
+    static inline uint64_t s_MemoryBudget                = 512 * 1024 * 1024;
+
+    struct LoadResult
+    {
+        bool bLoaded = false;
+        TextureSpecification FullSpec;  // As stored in cache, compared against the one texture was registered with.
+        std::vector<uint8_t> Data;      // Mips [firstMip, FullSpec.Mips).
+    };
+
+    struct StreamedTexture
+    {
+        Weak<Texture> TextureRef;
+        const Texture* TextureKey       = nullptr;  // NOTE: Key into TextureIndices, compared only, never dereferenced.
+        std::filesystem::path CachePath = {};
+        TextureSpecification FullSpec   = {};
+        uint32_t TailMip                = 0;  // Tail is loaded before anything else and never evicted.
+        uint32_t ResidentMip            = 0;  // First bound mip, FullSpec.Mips while fallback is bound.
+        uint32_t TargetMip              = 0;  // ResidentMip once loading one is applied, used for budget accounting.
+        uint32_t RequestedMip           = 0;  // Best mip requested this frame, FullSpec.Mips if none.
+        float Priority                  = 0.f;
+        uint64_t LastUsedFrame          = 0;
+        uint8_t DirtyFrameMask          = 0;  // Bit per frame in flight whose descriptor set still points at PrevImage.
+        bool bFailed                    = false;
+        Shared<Image> PrevImage         = nullptr;
+        std::shared_future<LoadResult> LoadFuture;
+    };
+
+    struct StreamerData
+    {
+        std::vector<StreamedTexture> Textures;
+        UnorderedMap<const Texture*, uint32_t> TextureIndices;
+        std::deque<std::pair<uint64_t, Shared<Image>>> RetiredImages;  // Frame number it was retired on, image.
+        uint64_t CommittedMemory = 0;                                  // Bytes of TargetMip chains.
+
+        std::mutex RegistrationMutex;
+        std::vector<StreamedTexture> PendingRegistrations;
+    };
+
+    static inline Unique<StreamerData> s_StreamerData = nullptr;
+
+    TextureStreamer()  = delete;
+    ~TextureStreamer() = default;
+
+    static void ApplyLoad(StreamedTexture& streamedTexture, Texture& texture);
+    static void ScheduleLoad(StreamedTexture& streamedTexture, const uint32_t firstMip);
+    // Evicts least recently used textures down to their tails until bytes fit into the budget, returns whether they do.
+    NODISCARD static bool MakeRoom(const uint64_t bytes, std::vector<uint32_t>& evictionOrder, const uint64_t frameNumber,
+                                   TextureStreamingStats& stats);
+};
+
+}  // namespace Pathfinder
@@ -39,6 +39,15 @@ class Entity final
         return m_ScenePtr->m_Registry.get<T>(m_Handle);
     }
 
+    // NOTE: Components are modified in place, this lets scene know about it, e.g. so transform of the mesh gets reuploaded.
+    template <typename T> FORCEINLINE void MarkDirty() const
+    {
+        PFR_ASSERT(IsValid(), "Entity or its scene ptr is not valid!");
+        PFR_ASSERT(HasComponent<T>(), "Entity doesn't have the component!");
+
+        m_ScenePtr->m_Registry.patch<T>(m_Handle);
+    }
+
     template <typename T> FORCEINLINE void RemoveComponent()
     {
         PFR_ASSERT(IsValid(), "Entity or its scene ptr is not valid!");
@@ -28,7 +28,13 @@ FORCEINLINE static SpotLight SpotLightFromSpotLightComponent(const glm::vec3& po
     return {position, slc.Intensity, slc.Direction, slc.Height, slc.Color, slc.Radius, slc.InnerCutOff, slc.OuterCutOff, slc.bCastShadows};
 }
 
-Scene::Scene(const std::string& sceneName) : m_Name(sceneName) {}
+Scene::Scene(const std::string& sceneName) : m_Name(sceneName)
+{
+    m_Registry.on_construct<MeshComponent>().connect<&Scene::OnMeshComponentChanged>(this);
+    m_Registry.on_update<MeshComponent>().connect<&Scene::OnMeshComponentChanged>(this);
+    m_Registry.on_destroy<MeshComponent>().connect<&Scene::OnMeshComponentDestroyed>(this);
+    m_Registry.on_update<TransformComponent>().connect<&Scene::OnTransformComponentChanged>(this);
+}
 
 Scene::~Scene()
 {
@@ -45,6 +51,8 @@ void Scene::OnUpdate(const float deltaTime)
     // RebuildTLAS();
 
     std::scoped_lock<std::mutex> lock(m_SceneMutex);
+    UpdateMeshInstances();
+
     for (const auto entityID : m_Registry.view<IDComponent>())
     {
         Entity entity{entityID, this};
@@ -63,10 +71,7 @@ void Scene::OnUpdate(const float deltaTime)
         if (entity.HasComponent<MeshComponent>())
         {
             const auto& mc = entity.GetComponent<MeshComponent>();
-            Renderer::SubmitMesh(mc.Mesh, tc.Translation, tc.Scale,
-                                 {quaternionOrientation.x, quaternionOrientation.y, quaternionOrientation.z, quaternionOrientation.w});
-
-            if (Renderer::GetRendererSettings().bDrawColliders || mc.bDrawBoundingSphere)
+            if (mc.Mesh && (Renderer::GetRendererSettings().bDrawColliders || mc.bDrawBoundingSphere))
             {
                 //  DebugRenderer::DrawAABB(mc.Mesh, tc, glm::vec4(1, 1, 0, 1));
                 DebugRenderer::DrawSphere(
@@ -112,6 +117,65 @@ void Scene::OnUpdate(const float deltaTime)
     }
 }
 
+void Scene::OnMeshComponentChanged(entt::registry& registry, const entt::entity entityID)
+{
+    m_DirtyMeshEntities.insert(entityID);
+}
+
+void Scene::OnMeshComponentDestroyed(entt::registry& registry, const entt::entity entityID)
+{
+    m_DirtyMeshEntities.erase(entityID);
+    m_DirtyTransformEntities.erase(entityID);
+
+    if (const auto it = m_MeshInstances.find(entityID); it != m_MeshInstances.end())
+    {
+        Renderer::RemoveMeshInstance(it->second);
+        m_MeshInstances.erase(it);
+    }
+}
+
+void Scene::OnTransformComponentChanged(entt::registry& registry, const entt::entity entityID)
+{
+    m_DirtyTransformEntities.insert(entityID);
+}
+
+void Scene::UpdateMeshInstances()
+{
+    // NOTE: Entities nobody touched since last frame aren't visited at all.
+    for (const auto entityID : m_DirtyMeshEntities)
+    {
+        m_DirtyTransformEntities.erase(entityID);
+
+        if (const auto it = m_MeshInstances.find(entityID); it != m_MeshInstances.end())
+        {
+            Renderer::RemoveMeshInstance(it->second);
+            m_MeshInstances.erase(it);
+        }
+
+        const auto& mc = m_Registry.get<MeshComponent>(entityID);
+        if (!mc.Mesh) continue;
+
+        const auto& tc                   = m_Registry.get<TransformComponent>(entityID);
+        const auto quaternionOrientation = glm::quat{glm::radians(tc.Rotation)};
+        m_MeshInstances[entityID] =
+            Renderer::AddMeshInstance(mc.Mesh, tc.Translation, tc.Scale,
+                                      {quaternionOrientation.x, quaternionOrientation.y, quaternionOrientation.z, quaternionOrientation.w});
+    }
+    m_DirtyMeshEntities.clear();
+
+    for (const auto entityID : m_DirtyTransformEntities)
+    {
+        const auto it = m_MeshInstances.find(entityID);
+        if (it == m_MeshInstances.end()) continue;
+
+        const auto& tc                   = m_Registry.get<TransformComponent>(entityID);
+        const auto quaternionOrientation = glm::quat{glm::radians(tc.Rotation)};
+        Renderer::UpdateMeshInstance(it->second, tc.Translation, tc.Scale,
+                                     {quaternionOrientation.x, quaternionOrientation.y, quaternionOrientation.z, quaternionOrientation.w});
+    }
+    m_DirtyTransformEntities.clear();
+}
+
 void Scene::RebuildTLAS()
 {
     PFR_ASSERT(false, "Not implemented!");
@@ -42,6 +42,16 @@ class Scene final : private Uncopyable, private Unmovable
 
     AccelerationStructure m_TLAS = {};
 
+    // NOTE: Renderer keeps mesh instances, scene only reports entities whose MeshComponent/TransformComponent got added or patched.
+    UnorderedMap<entt::entity, uint32_t> m_MeshInstances;  // Entity -> renderer mesh instance.
+    UnorderedSet<entt::entity> m_DirtyMeshEntities;        // MeshComponent added/patched, instance is recreated.
+    UnorderedSet<entt::entity> m_DirtyTransformEntities;   // Only transform of the instance is updated.
+
+    void OnMeshComponentChanged(entt::registry& registry, const entt::entity entityID);
+    void OnMeshComponentDestroyed(entt::registry& registry, const entt::entity entityID);
+    void OnTransformComponentChanged(entt::registry& registry, const entt::entity entityID);
+    void UpdateMeshInstances();
+
     void RebuildTLAS();
     Scene() = delete;
 
@@ -32,6 +32,7 @@ static constexpr uint32_t s_MAX_IMAGES   = BIT(20);
 #endif
 
 #define SSS_LOCAL_GROUP_SIZE 16u
+#define HIZ_LOCAL_GROUP_SIZE 16u
 #define SHADOW_CASCADE_COUNT 4
 
 struct CSMData
@@ -54,6 +55,13 @@ struct MeshPositionVertex
     vec3 Position;
 };
 
+// What GPU actually stores: 16-bit SNORM within submesh bounds(MeshData::positionCenter +- positionExtent).
+// NOTE: W is padding, RGBA16_SNORM is what BLAS builds are guaranteed to accept, RGB16 isn't.
+struct MeshQuantizedPositionVertex
+{
+    i16vec4 Position;
+};
+
 struct MeshAttributeVertex
 {
     uint32_t Color;
@@ -88,6 +96,8 @@ struct MeshData
     vec3 translation;
     vec3 scale;
     vec4 orientation;
+    vec3 positionCenter;
+    vec3 positionExtent;
     uint64_t materialBufferBDA;
     uint64_t indexBufferBDA;
     uint64_t vertexPosBufferBDA;
@@ -116,10 +126,15 @@ layout(set = BINDLESS_MEGA_SET, binding = STORAGE_IMAGE_BINDING, r32f) uniform i
 
 layout(buffer_reference, buffer_reference_align = 4, scalar) readonly buffer VertexPosBuffer
 {
-    MeshPositionVertex positions[];
+    MeshQuantizedPositionVertex positions[];
 }
 s_VertexPosBuffersBDA;
 
+vec3 DequantizePosition(const MeshData md, const i16vec4 quantizedPosition)
+{
+    return md.positionCenter + max(vec3(quantizedPosition.xyz) / 32767.0, vec3(-1.0)) * md.positionExtent;
+}
+
 layout(buffer_reference, buffer_reference_align = 4, scalar) readonly buffer VertexAttribBuffer
 {
     MeshAttributeVertex attributes[];
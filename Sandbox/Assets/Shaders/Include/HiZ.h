@@ -0,0 +1,112 @@
+#ifndef HIZ_H
+#define HIZ_H
+
+// NOTE: Shared by occlusion culling shaders and CPU reference(HiZPyramid), keep it GLSL-compatible.
+// Depth is reversed-Z, so pyramid stores MIN(farthest) depth of the texels it covers.
+
+#ifdef __cplusplus
+// NOTE: Functions below aren't inline, so on C++ side it's included only by HiZPyramid.cpp.
+#include "Primitives.h"
+
+using ivec2 = glm::ivec2;
+using ivec4 = glm::ivec4;
+#else
+#include "Include/Primitives.h"
+#endif
+
+struct HiZSphereProjection
+{
+    vec4 UVRect;         // minU, minV, maxU, maxV. V goes down like texel rows.
+    float NearestDepth;  // Depth of the sphere's point closest to camera.
+    bool bValid;         // False if sphere crosses near plane, such spheres can't be culled.
+};
+
+ivec2 GetHiZLevelSize(const ivec2 baseSize, const uint32_t level)
+{
+    return max(ivec2(baseSize.x >> level, baseSize.y >> level), ivec2(1));
+}
+
+// Source texels [xy, zw] covered by destination texel. Odd source dimensions fold extra row/column in, so reduction stays conservative.
+ivec4 GetHiZReductionFootprint(const ivec2 dstTexel, const ivec2 srcSize)
+{
+    const ivec2 first = dstTexel * 2;
+    const ivec2 last  = min(first + ivec2(1) + ivec2(srcSize.x & 1, srcSize.y & 1), srcSize - ivec2(1));
+    return ivec4(first.x, first.y, last.x, last.y);
+}
+
+// 2D Polyhedral Bounds of a Clipped, Perspective-Projected 3D Sphere. Michael Mara, Morgan McGuire. 2013
+// viewCenter is in view space(camera looks towards -Z), projection is reversed-Z perspective.
+HiZSphereProjection ProjectSphereHiZ(const vec3 viewCenter, const float radius, const mat4 projection, const float zNear)
+{
+    HiZSphereProjection result;
+    result.UVRect       = vec4(0.0f, 0.0f, 1.0f, 1.0f);
+    result.NearestDepth = 1.0f;
+    result.bValid       = false;
+
+    const vec3 c = vec3(viewCenter.x, viewCenter.y, -viewCenter.z);  // Make forward positive.
+    if (c.z < radius + zNear) return result;
+
+    const vec3 cr    = c * radius;
+    const float czr2 = c.z * c.z - radius * radius;
+    const vec2 v     = sqrt(vec2(c.x * c.x + czr2, c.y * c.y + czr2));
+    const float minX = (v.x * c.x - cr.z) / (v.x * c.z + cr.x);
+    const float maxX = (v.x * c.x + cr.z) / (v.x * c.z - cr.x);
+    const float minY = (v.y * c.y - cr.z) / (v.y * c.z + cr.y);
+    const float maxY = (v.y * c.y + cr.z) / (v.y * c.z - cr.y);
+    const float p00  = projection[0][0];
+    const float p11  = projection[1][1];
+
+    // NDC +Y maps to the top row(negative viewport height), hence V flip.
+    result.UVRect = vec4(minX * p00, maxY * p11, maxX * p00, minY * p11) * vec4(0.5f, -0.5f, 0.5f, -0.5f) + vec4(0.5f);
+
+    const float nearestZ = radius - c.z;  // Back to view space.
+    result.NearestDepth  = (projection[2][2] * nearestZ + projection[3][2]) / -nearestZ;
+    result.bValid        = true;
+    return result;
+}
+
+// Picks level where sphere footprint is at most 1 texel wide, so 2x2 texels around it cover it completely.
+uint32_t SelectHiZLevel(const vec4 uvRect, const ivec2 baseSize, const uint32_t levelCount)
+{
+    const vec2 extent    = vec2(uvRect.z - uvRect.x, uvRect.w - uvRect.y) * vec2(baseSize);
+    const vec2 levels    = ceil(log2(max(extent, vec2(1.0f))));
+    const uint32_t level = uint32_t(levels.x > levels.y ? levels.x : levels.y);
+    return level < levelCount ? level : levelCount - 1u;
+}
+
+// Texels [xy, zw] of the level that have to be tested.
+ivec4 GetHiZTestTexels(const vec4 uvRect, const ivec2 levelSize)
+{
+    const vec4 clampedRect = clamp(uvRect, vec4(0.0f), vec4(1.0f));
+    const ivec4 texels     = ivec4(clampedRect * vec4(levelSize.x, levelSize.y, levelSize.x, levelSize.y));
+    return min(texels, ivec4(levelSize.x, levelSize.y, levelSize.x, levelSize.y) - ivec4(1));
+}
+
+bool IsHiZOccluded(const float nearestDepth, const float pyramidDepth)
+{
+    return nearestDepth < pyramidDepth;
+}
+
+#ifndef __cplusplus
+
+// Pyramid is fetched through bindless textures, so Globals.h has to be included first.
+bool IsSphereOccludedHiZ(const vec3 viewCenter, const float radius, const mat4 projection, const float zNear, const uint32_t pyramidIndex,
+                         const ivec2 baseSize, const uint32_t levelCount)
+{
+    const HiZSphereProjection projectedSphere = ProjectSphereHiZ(viewCenter, radius, projection, zNear);
+    if (!projectedSphere.bValid) return false;
+
+    const uint32_t level = SelectHiZLevel(projectedSphere.UVRect, baseSize, levelCount);
+    const ivec4 texels   = GetHiZTestTexels(projectedSphere.UVRect, GetHiZLevelSize(baseSize, level));
+
+    float pyramidDepth = 1.0;
+    for (int y = texels.y; y <= texels.w; ++y)
+        for (int x = texels.x; x <= texels.z; ++x)
+            pyramidDepth = min(pyramidDepth, texelFetch(u_GlobalTextures[nonuniformEXT(pyramidIndex)], ivec2(x, y), int(level)).x);
+
+    return IsHiZOccluded(projectedSphere.NearestDepth, pyramidDepth);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef MESHLET_LOD_H
+#define MESHLET_LOD_H
+
+// NOTE: Shared by task shaders and CPU reference(MeshletHierarchy), keep it GLSL-compatible.
+// Errors are object space distances, selection compares them projected into pixels against MESHLET_LOD_ERROR_THRESHOLD.
+
+#ifdef __cplusplus
+// NOTE: Functions below aren't inline, so on C++ side it's included only by MeshletHierarchy.cpp.
+#include "Meshlets.h"
+#endif
+
+#define MESHLET_LOD_ERROR_THRESHOLD 1.0f
+
+// Scale turning error at distance 1 into pixels: |Projection[1][1]| * viewportHeight / 2.
+float GetMeshletLODProjectionScale(const mat4 projection, const float viewportHeight)
+{
+    const float p11 = projection[1][1];
+    return (p11 > 0.0f ? p11 : -p11) * viewportHeight * 0.5f;
+}
+
+// Error is projected from the point of bounds closest to camera, so it's never underestimated.
+float ProjectMeshletLODError(const vec3 center, const float radius, const float error, const vec3 cameraPosition, const float zNear,
+                             const float projectionScale)
+{
+    const float boundsDistance = length(center - cameraPosition) - radius;
+    const float distance       = boundsDistance > zNear ? boundsDistance : zNear;
+    return error * projectionScale / distance;
+}
+
+// Meshlet is drawn when the group it was simplified from is precise enough, while the group it got simplified into isn't.
+// Whole group shares bounds and error, parent bounds enclose children's and errors only grow up the hierarchy, so every group
+// flips at once and neighbours always agree on shared(locked) borders - no cracks. Inputs are in world space.
+bool IsMeshletLODSelected(const vec3 lodCenter, const float lodRadius, const float lodError, const vec3 parentCenter,
+                          const float parentRadius, const float parentError, const vec3 cameraPosition, const float zNear,
+                          const float projectionScale)
+{
+    return ProjectMeshletLODError(lodCenter, lodRadius, lodError, cameraPosition, zNear, projectionScale) <=
+               MESHLET_LOD_ERROR_THRESHOLD &&
+           ProjectMeshletLODError(parentCenter, parentRadius, parentError, cameraPosition, zNear, projectionScale) >
+               MESHLET_LOD_ERROR_THRESHOLD;
+}
+
+#ifndef __cplusplus
+
+// RotateByQuat and MeshData come from Globals.h, so it has to be included first.
+bool IsMeshletLODSelected(const Meshlet meshlet, const MeshData md, const vec3 cameraPosition, const float zNear,
+                          const float projectionScale)
+{
+    const float maxScale = max(max(md.scale.x, md.scale.y), md.scale.z);
+    return IsMeshletLODSelected(RotateByQuat(meshlet.lodCenter * md.scale, md.orientation) + md.translation, meshlet.lodRadius * maxScale,
+                                meshlet.lodError * maxScale,
+                                RotateByQuat(meshlet.parentCenter * md.scale, md.orientation) + md.translation,
+                                meshlet.parentRadius * maxScale, meshlet.parentError * maxScale, cameraPosition, zNear, projectionScale);
+}
+
+#endif
+
+#endif
@@ -51,6 +51,7 @@ using vec3    = glm::vec3;
 using vec4    = glm::vec4;
 using mat4    = glm::mat4;
 using i8vec3  = glm::i8vec3;
+using i16vec4 = glm::i16vec4;
 
 #endif
 
@@ -71,4 +72,12 @@ struct Meshlet
     /* 8-bit SNORM; decode using x/127.0 */
     int8_t coneAxis[3];
     int8_t coneCutoff; /* = cos(angle/2) */
+
+    /* LOD: bounds and error of the group meshlet was simplified from(lod) and of the group it got simplified into(parent) */
+    vec3 lodCenter;
+    float lodRadius;
+    float lodError;
+    vec3 parentCenter;
+    float parentRadius;
+    float parentError;
 };
@@ -238,6 +238,8 @@ void SceneHierarchyPanel::ShowComponents(Entity entity)
     DrawComponent<TransformComponent>("TransformComponent", entity,
                                       [&](auto& tc)
                                       {
+                                          const TransformComponent prevTC = tc;
+
                                           // TODO: For DirectionalLights replace Translation(used as direction) for Rotation(better to
                                           // understand).
                                           if (entity.HasComponent<DirectionalLightComponent>())
@@ -250,6 +252,11 @@ void SceneHierarchyPanel::ShowComponents(Entity entity)
 
                                           DrawVec3Control("Rotation", tc.Rotation);
                                           DrawVec3Control("Scale", tc.Scale);
+
+                                          // NOTE: Renderer only picks up transforms scene was told about.
+                                          if (tc.Translation != prevTC.Translation || tc.Rotation != prevTC.Rotation ||
+                                              tc.Scale != prevTC.Scale)
+                                              entity.MarkDirty<TransformComponent>();
                                       });
 
     DrawComponent<PointLightComponent>("PointLightComponent", entity,
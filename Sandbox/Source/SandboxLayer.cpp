@@ -129,6 +129,9 @@ void SandboxLayer::OnUIRender()
         ImGui::Checkbox("Draw Colliders", &rs.bDrawColliders);
         ImGui::Separator();
 
+        ImGui::Checkbox("Parallel Pass Recording", &rs.bParallelPassRecording);
+        ImGui::Separator();
+
         const auto& mainWindowSwapchain   = Application::Get().GetWindow()->GetSwapchain();
         const char* items[3]              = {"FIFO", "IMMEDIATE", "MAILBOX"};
         const auto currentPresentMode     = mainWindowSwapchain->GetPresentMode();
@@ -230,6 +233,7 @@ void SandboxLayer::OnUIRender()
 
         ImGui::Separator();
         ImGui::Checkbox("CollectGPUStats", &Renderer::GetRendererSettings().bCollectGPUStats);
+        if (ImGui::Button("Export Chrome Trace")) Renderer::ExportProfilerTrace("PathfinderTrace.json");
 
         const auto& cpuTimers = Renderer::GetCPUProfilerResults();
         ImGui::SeparatorText("CPU");
@@ -267,6 +271,13 @@ void SandboxLayer::OnUIRender()
 
         ImGui::Separator();
         ImGui::Text("ImageViews: %u", rs.ImageViewCount);
+        ImGui::Text("Scene records uploaded: %u (%u ranges)", rs.SceneRecordsUploaded, rs.SceneUploadRangeCount);
+
+        const auto& meshRegistryStats = rs.MeshStats;
+        ImGui::Text("Meshes: %u resident, %u handles, %llu loads, %llu dedup hits", meshRegistryStats.MeshCount,
+                    meshRegistryStats.HandleCount, meshRegistryStats.LoadCount, meshRegistryStats.DedupHitCount);
+        ImGui::Text("Meshes: %0.3f MB resident, %0.3f MB saved by dedup", meshRegistryStats.ResidentMemory / 1024.0f / 1024.0f,
+                    meshRegistryStats.SavedMemory / 1024.0f / 1024.0f);
 
         ImGui::SeparatorText("Memory Statistics");
         for (uint32_t memoryHeapIndex = 0; const auto& memoryBudget : rs.MemoryBudgets)
@@ -278,6 +289,29 @@ void SandboxLayer::OnUIRender()
                         memoryBudget.AllocationBytes / 1024.0f / 1024.0f);
             ++memoryHeapIndex;
         }
+        ImGui::Text("Transient(%u textures, %u buffers): %0.3f MB -> %0.3f MB after aliasing", rs.TransientMemoryStats.TextureCount,
+                    rs.TransientMemoryStats.BufferCount, rs.TransientMemoryStats.UnaliasedBytes / 1024.0f / 1024.0f,
+                    rs.TransientMemoryStats.AliasedBytes / 1024.0f / 1024.0f);
+        ImGui::Text("RenderGraph: %llu compiles, %llu cache hits, last compile %0.3f ms", rs.RenderGraphCompileStats.CompileCount,
+                    rs.RenderGraphCompileStats.CacheHitCount, rs.RenderGraphCompileStats.LastCompileTime);
+        ImGui::Text("RenderGraph culled %zu/%u passes(%u textures, %u buffers not allocated)",
+                    rs.RenderGraphCullingStats.CulledPassNames.size(), rs.RenderGraphCullingStats.PassCount,
+                    rs.RenderGraphCullingStats.CulledTextureCount, rs.RenderGraphCullingStats.CulledBufferCount);
+        for (const auto& culledPassName : rs.RenderGraphCullingStats.CulledPassNames)
+            ImGui::BulletText("%s", culledPassName.data());
+
+        const auto& scheduleStats = rs.RenderGraphScheduleStats;
+        ImGui::Text("RenderGraph: %u submissions, %u cross-queue waits, %u ownership transfers", scheduleStats.BatchCount,
+                    scheduleStats.SyncPointCount, scheduleStats.QueueTransferCount);
+        ImGui::Text("Simulated GPU frame: %0.3f ms serial -> %0.3f ms with async overlap(graphics %0.3f, compute %0.3f, transfer %0.3f)",
+                    scheduleStats.SerialTime, scheduleStats.ScheduledTime, scheduleStats.QueueBusyTime[0], scheduleStats.QueueBusyTime[1],
+                    scheduleStats.QueueBusyTime[2]);
+
+        const auto& barrierStats = rs.RenderGraphBarrierStats;
+        ImGui::Text("RenderGraph barriers: %u in %u calls -> %u in %u calls after merging", barrierStats.BarrierCount,
+                    barrierStats.BarrierCallCount, barrierStats.MergedBarrierCount, barrierStats.MergedBarrierCallCount);
+        ImGui::Text("RenderGraph recording: %0.3f ms, secondary command buffers: %u", rs.RenderGraphRecordTime,
+                    rs.SecondaryCommandBufferCount);
 
         bAnythingHovered = ImGui::IsAnyItemHovered() || ImGui::IsWindowHovered();
         bAnythingFocused = ImGui::IsAnyItemFocused() || ImGui::IsWindowFocused();